@@ -20,6 +20,7 @@
 // Provides the complete iceoryx C API in one header.
 
 #include "chunk.h"
+#include "client.h"
 #include "enums.h"
 #include "event_info.h"
 #include "listener.h"
@@ -27,6 +28,7 @@
 #include "node.h"
 #include "publisher.h"
 #include "runtime.h"
+#include "server.h"
 #include "service_description.h"
 #include "subscriber.h"
 #include "types.h"
@@ -50,7 +50,44 @@ enum iox_ChunkReceiveResult
     ChunkReceiveResult_SUCCESS,
 };
 
-/// @brief used by subscriber; describes whether a publisher blocks when subscriber queue is full
+/// @brief describes states which can be triggered by a client
+enum iox_ClientState
+{
+    ClientState_HAS_RESPONSE,
+};
+
+/// @brief describes events which can be triggered by a client
+enum iox_ClientEvent
+{
+    ClientEvent_RESPONSE_RECEIVED,
+};
+
+/// @brief describes states which can be triggered by a server
+enum iox_ServerState
+{
+    ServerState_HAS_REQUEST,
+};
+
+/// @brief describes events which can be triggered by a server
+enum iox_ServerEvent
+{
+    ServerEvent_REQUEST_RECEIVED,
+};
+
+/// @brief describes the current connection state of a client
+enum iox_ConnectionState
+{
+    ConnectionState_NOT_CONNECTED = 0,
+    ConnectionState_CONNECT_REQUESTED,
+    ConnectionState_CONNECTED,
+    ConnectionState_DISCONNECT_REQUESTED,
+    ConnectionState_WAIT_FOR_OFFER,
+    ConnectionState_UNDEFINED_ERROR,
+};
+
+/// @brief used by subscriber, client and server; describes whether the producer blocks when the consumer queue is
+/// full
+
 enum iox_QueueFullPolicy
 {
     QueueFullPolicy_BLOCK_PUBLISHER,
@@ -64,6 +101,13 @@ enum iox_SubscriberTooSlowPolicy
     SubscriberTooSlowPolicy_DISCARD_OLDEST_DATA,
 };
 
+/// @brief used by client and server; describes whether the producer blocks when the consumer queue is full
+enum iox_ConsumerTooSlowPolicy
+{
+    ConsumerTooSlowPolicy_WAIT_FOR_CONSUMER,
+    ConsumerTooSlowPolicy_DISCARD_OLDEST_DATA,
+};
+
 /// @brief state of allocateChunk
 enum iox_AllocationResult
 {
@@ -19,6 +19,8 @@
 
 #include "c2cpp_binding.h"
 #include "iceoryx_binding_c/enums.h"
+#include "iceoryx_posh/popo/base_client.hpp"
+#include "iceoryx_posh/popo/base_server.hpp"
 #include "iceoryx_posh/popo/base_subscriber.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
 
@@ -28,6 +30,12 @@ iox::popo::SubscriberTooSlowPolicy subscriberTooSlowPolicy(const ENUM iox_Subscr
 iox::popo::QueueFullPolicy queueFullPolicy(const ENUM iox_QueueFullPolicy policy) noexcept;
 iox::popo::SubscriberEvent subscriberEvent(const iox_SubscriberEvent value) noexcept;
 iox::popo::SubscriberState subscriberState(const iox_SubscriberState value) noexcept;
+iox::popo::ConsumerTooSlowPolicy consumerTooSlowPolicy(const ENUM iox_ConsumerTooSlowPolicy policy) noexcept;
+iox::popo::QueueFullPolicy2 queueFullPolicy2(const ENUM iox_QueueFullPolicy policy) noexcept;
+iox::popo::ClientEvent clientEvent(const iox_ClientEvent value) noexcept;
+iox::popo::ClientState clientState(const iox_ClientState value) noexcept;
+iox::popo::ServerEvent serverEvent(const iox_ServerEvent value) noexcept;
+iox::popo::ServerState serverState(const iox_ServerState value) noexcept;
 } // namespace c2cpp
 
 #endif
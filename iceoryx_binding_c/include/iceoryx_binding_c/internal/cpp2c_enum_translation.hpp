@@ -24,6 +24,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
 #include "iceoryx_posh/popo/listener.hpp"
+#include "iceoryx_posh/popo/port_queue_policies.hpp"
 #include "iceoryx_posh/popo/wait_set.hpp"
 
 namespace cpp2c
@@ -35,6 +36,9 @@ iox_WaitSetResult waitSetResult(const iox::popo::WaitSetError value) noexcept;
 iox_ListenerResult listenerResult(const iox::popo::ListenerError value) noexcept;
 iox_SubscriberTooSlowPolicy subscriberTooSlowPolicy(const iox::popo::SubscriberTooSlowPolicy policy) noexcept;
 iox_QueueFullPolicy queueFullPolicy(const iox::popo::QueueFullPolicy policy) noexcept;
+iox_QueueFullPolicy queueFullPolicy(const iox::popo::QueueFullPolicy2 policy) noexcept;
+iox_ConsumerTooSlowPolicy consumerTooSlowPolicy(const iox::popo::ConsumerTooSlowPolicy policy) noexcept;
+iox_ConnectionState connectionState(const iox::ConnectionState value) noexcept;
 } // namespace cpp2c
 
 #endif
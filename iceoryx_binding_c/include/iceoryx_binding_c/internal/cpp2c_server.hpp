@@ -0,0 +1,55 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_BINDING_C_CPP2C_SERVER_HPP
+#define IOX_BINDING_C_CPP2C_SERVER_HPP
+
+#include "iceoryx_binding_c/enums.h"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_user.hpp"
+#include "iceoryx_posh/popo/base_server.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+
+struct cpp2c_Server
+{
+    cpp2c_Server() noexcept = default;
+    cpp2c_Server(const cpp2c_Server&) = delete;
+    cpp2c_Server(cpp2c_Server&& rhs) = delete;
+    ~cpp2c_Server() noexcept;
+
+    cpp2c_Server& operator=(const cpp2c_Server&) = delete;
+    cpp2c_Server& operator=(cpp2c_Server&& rhs) = delete;
+
+    void enableEvent(iox::popo::TriggerHandle&& triggerHandle, const iox::popo::ServerEvent serverEvent) noexcept;
+
+    void disableEvent(const iox::popo::ServerEvent serverEvent) noexcept;
+
+    void enableState(iox::popo::TriggerHandle&& triggerHandle, const iox::popo::ServerState serverState) noexcept;
+
+    void disableState(const iox::popo::ServerState serverState) noexcept;
+
+    void invalidateTrigger(const uint64_t uniqueTriggerId) noexcept;
+
+    bool hasRequests() const noexcept;
+
+    iox::popo::WaitSetIsConditionSatisfiedCallback
+    getCallbackForIsStateConditionSatisfied(const iox::popo::ServerState serverState) const noexcept;
+
+
+    iox::popo::ServerPortData* m_portData{nullptr};
+    iox::popo::TriggerHandle m_trigger;
+};
+#endif
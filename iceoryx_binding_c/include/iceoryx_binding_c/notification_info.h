@@ -17,7 +17,9 @@
 #ifndef IOX_BINDING_C_EVENT_INFO_H
 #define IOX_BINDING_C_EVENT_INFO_H
 
+#include "iceoryx_binding_c/client.h"
 #include "iceoryx_binding_c/internal/c2cpp_binding.h"
+#include "iceoryx_binding_c/server.h"
 #include "iceoryx_binding_c/subscriber.h"
 #include "iceoryx_binding_c/user_trigger.h"
 
@@ -36,6 +38,18 @@ uint64_t iox_notification_info_get_notification_id(iox_notification_info_t const
 bool iox_notification_info_does_originate_from_subscriber(iox_notification_info_t const self,
                                                           iox_sub_t const subscriber);
 
+/// @brief does the notification originate from a certain client
+/// @param[in] self handle to notification info
+/// @param[in] client handle to the client in question
+/// @return true if the notification originates from the client, otherwise false
+bool iox_notification_info_does_originate_from_client(iox_notification_info_t const self, iox_client_t const client);
+
+/// @brief does the notification originate from a certain server
+/// @param[in] self handle to notification info
+/// @param[in] server handle to the server in question
+/// @return true if the notification originates from the server, otherwise false
+bool iox_notification_info_does_originate_from_server(iox_notification_info_t const self, iox_server_t const server);
+
 /// @brief does the notification originate from a certain user trigger
 /// @param[in] self handle to notification info
 /// @param[in] user_trigger handle to the user trigger in question
@@ -48,6 +62,16 @@ bool iox_notification_info_does_originate_from_user_trigger(iox_notification_inf
 /// @return the handle to the subscriber if the notification originated from a subscriber, otherwise NULL
 iox_sub_t iox_notification_info_get_subscriber_origin(iox_notification_info_t const self);
 
+/// @brief acquires the handle of the client origin
+/// @param[in] self handle to notification info
+/// @return the handle to the client if the notification originated from a client, otherwise NULL
+iox_client_t iox_notification_info_get_client_origin(iox_notification_info_t const self);
+
+/// @brief acquires the handle of the server origin
+/// @param[in] self handle to notification info
+/// @return the handle to the server if the notification originated from a server, otherwise NULL
+iox_server_t iox_notification_info_get_server_origin(iox_notification_info_t const self);
+
 /// @brief acquires the handle of the user trigger origin
 /// @param[in] self handle to notification info
 /// @return the handle to the user trigger if the notification originated from a user trigger, otherwise NULL
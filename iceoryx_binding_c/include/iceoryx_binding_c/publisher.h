@@ -118,6 +118,29 @@ ENUM iox_AllocationResult iox_pub_loan_aligned_chunk_with_user_header(iox_pub_t
                                                                       const uint32_t userHeaderSize,
                                                                       const uint32_t userHeaderAlignment);
 
+/// @brief allocates multiple chunks with the same layout in the shared memory at once, which is cheaper than calling
+///        iox_pub_loan_aligned_chunk_with_user_header in a loop
+/// @param[in] self handle of the publisher
+/// @param[in] userPayloads array with at least numberOfChunks elements in which the pointers to the user-payloads of
+///            the allocated chunks are stored
+/// @param[in] numberOfChunks number of chunks to allocate
+/// @param[in] userPayloadSize user-payload size of the allocated chunks
+/// @param[in] userPayloadAlignment user-payload alignment of the allocated chunks
+/// @param[in] userHeaderSize user-header size of the allocated chunks
+/// @param[in] userHeaderAlignment user-header alignment of the allocated chunks
+/// @param[in] numberOfLoanedChunks pointer in which the number of allocated chunks is stored; it is less than
+///            numberOfChunks if the shared memory is running out of chunks
+/// @return if at least one chunk could be allocated it returns AllocationResult_SUCCESS otherwise a value which
+///         describes the error
+ENUM iox_AllocationResult iox_pub_loan_chunks(iox_pub_t const self,
+                                              void** const userPayloads,
+                                              const uint32_t numberOfChunks,
+                                              const uint32_t userPayloadSize,
+                                              const uint32_t userPayloadAlignment,
+                                              const uint32_t userHeaderSize,
+                                              const uint32_t userHeaderAlignment,
+                                              uint32_t* const numberOfLoanedChunks);
+
 /// @brief releases ownership of a previously allocated chunk without sending it
 /// @param[in] self handle of the publisher
 /// @param[in] userPayload pointer to the user-payload of the chunk which should be free'd
@@ -128,6 +151,13 @@ void iox_pub_release_chunk(iox_pub_t const self, void* const userPayload);
 /// @param[in] userPayload pointer to the user-payload of the chunk which should be send
 void iox_pub_publish_chunk(iox_pub_t const self, void* const userPayload);
 
+/// @brief sends multiple previously allocated chunks in the given order; every subscriber is notified once per batch
+///        instead of once per chunk
+/// @param[in] self handle of the publisher
+/// @param[in] userPayloads array of pointers to the user-payloads of the chunks which should be send
+/// @param[in] numberOfChunks number of elements in userPayloads
+void iox_pub_publish_chunks(iox_pub_t const self, void* const* const userPayloads, const uint32_t numberOfChunks);
+
 /// @brief offers the service
 /// @param[in] self handle of the publisher
 void iox_pub_offer(iox_pub_t const self);
@@ -101,6 +101,21 @@ ENUM iox_SubscribeState iox_sub_get_subscription_state(iox_sub_t const self);
 ///         an enum which describes the error
 ENUM iox_ChunkReceiveResult iox_sub_take_chunk(iox_sub_t const self, const void** const userPayload);
 
+/// @brief retrieve up to maxNumberOfChunks received chunks in one pass, which is cheaper than calling
+///        iox_sub_take_chunk in a loop
+/// @param[in] self handle to the subscriber
+/// @param[in] userPayloads array with at least maxNumberOfChunks elements in which the pointers to the
+///            user-payloads of the chunks are stored in the order in which the chunks were received
+/// @param[in] maxNumberOfChunks the maximum number of chunks to retrieve
+/// @param[in] numberOfChunks pointer in which the number of retrieved chunks is stored, also in the error case
+///            since every retrieved chunk must be released with iox_sub_release_chunk
+/// @return if at least one chunk could be received it returns ChunkReceiveResult_SUCCESS otherwise
+///         an enum which describes the error
+ENUM iox_ChunkReceiveResult iox_sub_take_chunks(iox_sub_t const self,
+                                                const void** const userPayloads,
+                                                const uint64_t maxNumberOfChunks,
+                                                uint64_t* const numberOfChunks);
+
 /// @brief release a previously acquired chunk (via iox_sub_getChunk)
 /// @param[in] self handle to the subscriber
 /// @param[in] userPayload pointer to the user-payload of chunk which should be released
@@ -35,7 +35,7 @@ struct iox_ws_storage_t_
 {
     // the value of the array size is the result of the following formula:
     // sizeof(WaitSet) / 8
-    uint64_t do_not_touch_me[2965];
+    uint64_t do_not_touch_me[2969];
 };
 typedef struct iox_ws_storage_t_ iox_ws_storage_t;
 
@@ -75,16 +75,44 @@ struct iox_pub_storage_t_
 };
 typedef struct iox_pub_storage_t_ iox_pub_storage_t;
 
+struct iox_client_storage_t_
+{
+    // the value of the array size is the result of the following formula:
+    // sizeof(cpp2c_Client) / 8
+#if defined(__APPLE__)
+    uint64_t do_not_touch_me[17];
+#elif defined(_WIN32)
+    uint64_t do_not_touch_me[17];
+#else
+    uint64_t do_not_touch_me[14];
+#endif
+};
+typedef struct iox_client_storage_t_ iox_client_storage_t;
+
+struct iox_server_storage_t_
+{
+    // the value of the array size is the result of the following formula:
+    // sizeof(cpp2c_Server) / 8
+#if defined(__APPLE__)
+    uint64_t do_not_touch_me[17];
+#elif defined(_WIN32)
+    uint64_t do_not_touch_me[17];
+#else
+    uint64_t do_not_touch_me[14];
+#endif
+};
+typedef struct iox_server_storage_t_ iox_server_storage_t;
+
 struct iox_listener_storage_t_
 {
     // the value of the array size is the result of the following formula:
     // sizeof(Listener) / 8
 #if defined(__APPLE__)
-    uint64_t do_not_touch_me[2643];
+    uint64_t do_not_touch_me[2719];
 #elif defined(_WIN32)
-    uint64_t do_not_touch_me[2774];
+    uint64_t do_not_touch_me[2850];
 #else
-    uint64_t do_not_touch_me[2567];
+    uint64_t do_not_touch_me[2643];
 #endif
 };
 typedef struct iox_listener_storage_t_ iox_listener_storage_t;
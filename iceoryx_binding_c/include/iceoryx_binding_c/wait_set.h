@@ -18,9 +18,11 @@
 #ifndef IOX_BINDING_C_WAIT_SET_H
 #define IOX_BINDING_C_WAIT_SET_H
 
+#include "iceoryx_binding_c/client.h"
 #include "iceoryx_binding_c/enums.h"
 #include "iceoryx_binding_c/internal/c2cpp_binding.h"
 #include "iceoryx_binding_c/notification_info.h"
+#include "iceoryx_binding_c/server.h"
 #include "iceoryx_binding_c/subscriber.h"
 #include "iceoryx_binding_c/types.h"
 #include "iceoryx_binding_c/user_trigger.h"
@@ -73,6 +75,18 @@ uint64_t iox_ws_size(iox_ws_t const self);
 /// @brief returns the maximum amount of events/states which can be registered at the waitset
 uint64_t iox_ws_capacity(iox_ws_t const self);
 
+/// @brief sets the time iox_ws_wait() and iox_ws_timed_wait() poll for notifications before the waitset sleeps,
+///        a duration of zero disables the busy poll
+/// @param[in] self handle to the wait set
+/// @param[in] busyPollDuration how long the notifications are polled before the waitset sleeps
+void iox_ws_set_busy_poll_duration(iox_ws_t const self, struct timespec busyPollDuration);
+
+/// @brief returns how often a wait was ended during the busy poll and how often the waitset had to sleep
+/// @param[in] self handle to the wait set
+/// @param[in] spinHits the number of waits which ended with a notification during the busy poll is stored here
+/// @param[in] sleeps the number of times the waitset went to sleep is stored here
+void iox_ws_get_wait_statistics(iox_ws_t const self, uint64_t* const spinHits, uint64_t* const sleeps);
+
 /// @brief Non-reversible call. After this call iox_ws_wait() and iox_ws_timed_wait() do
 ///        not block any longer and never return triggered events/states. This
 ///        function can be used to manually initialize destruction and to wakeup
@@ -141,6 +155,130 @@ ENUM iox_WaitSetResult iox_ws_attach_subscriber_event_with_context_data(iox_ws_t
                                                                         void (*callback)(iox_sub_t, void*),
                                                                         void* const contextData);
 
+/// @brief attaches a client state to a waitset
+/// @param[in] self handle to the waitset
+/// @param[in] client the client of the state which should be attached
+/// @param[in] clientState the state which should be attached
+/// @param[in] id an arbitrary id which will be tagged to the state
+/// @param[in] callback a callback which is attached to the state
+/// @return if the attaching was successfull it returns WaitSetResult_SUCCESS, otherwise
+///             an enum which describes the error
+ENUM iox_WaitSetResult iox_ws_attach_client_state(iox_ws_t const self,
+                                                  iox_client_t const client,
+                                                  const ENUM iox_ClientState clientState,
+                                                  const uint64_t id,
+                                                  void (*callback)(iox_client_t));
+
+/// @brief attaches a client state to a waitset. The callback has an additional contextData argument to provide
+/// access to user defined data.
+/// @param[in] self handle to the waitset
+/// @param[in] client the client of the state which should be attached
+/// @param[in] clientState the state which should be attached
+/// @param[in] id an arbitrary id which will be tagged to the state
+/// @param[in] callback a callback which is attached to the state
+/// @param[in] contextData a void pointer which is provided as second argument to the callback
+/// @return if the attaching was successfull it returns WaitSetResult_SUCCESS, otherwise
+///             an enum which describes the error
+ENUM iox_WaitSetResult iox_ws_attach_client_state_with_context_data(iox_ws_t const self,
+                                                                    iox_client_t const client,
+                                                                    const ENUM iox_ClientState clientState,
+                                                                    const uint64_t id,
+                                                                    void (*callback)(iox_client_t, void*),
+                                                                    void* const contextData);
+
+/// @brief attaches a client event to a waitset
+/// @param[in] self handle to the waitset
+/// @param[in] client the client of the event which should be attached
+/// @param[in] clientEvent the event which should be attached
+/// @param[in] eventId an arbitrary id which will be tagged to the event
+/// @param[in] callback a callback which is attached to the event
+/// @return if the attaching was successfull it returns WaitSetResult_SUCCESS, otherwise
+///             an enum which describes the error
+ENUM iox_WaitSetResult iox_ws_attach_client_event(iox_ws_t const self,
+                                                  iox_client_t const client,
+                                                  const ENUM iox_ClientEvent clientEvent,
+                                                  const uint64_t eventId,
+                                                  void (*callback)(iox_client_t));
+
+/// @brief attaches a client event to a waitset. The callback has an additional contextData argument to provide
+/// access to user defined data.
+/// @param[in] self handle to the waitset
+/// @param[in] client the client of the event which should be attached
+/// @param[in] clientEvent the event which should be attached
+/// @param[in] eventId an arbitrary id which will be tagged to the event
+/// @param[in] callback a callback which is attached to the event
+/// @param[in] contextData a void pointer which is provided as second argument to the callback
+/// @return if the attaching was successfull it returns WaitSetResult_SUCCESS, otherwise
+///             an enum which describes the error
+ENUM iox_WaitSetResult iox_ws_attach_client_event_with_context_data(iox_ws_t const self,
+                                                                    iox_client_t const client,
+                                                                    const ENUM iox_ClientEvent clientEvent,
+                                                                    const uint64_t eventId,
+                                                                    void (*callback)(iox_client_t, void*),
+                                                                    void* const contextData);
+
+/// @brief attaches a server state to a waitset
+/// @param[in] self handle to the waitset
+/// @param[in] server the server of the state which should be attached
+/// @param[in] serverState the state which should be attached
+/// @param[in] id an arbitrary id which will be tagged to the state
+/// @param[in] callback a callback which is attached to the state
+/// @return if the attaching was successfull it returns WaitSetResult_SUCCESS, otherwise
+///             an enum which describes the error
+ENUM iox_WaitSetResult iox_ws_attach_server_state(iox_ws_t const self,
+                                                  iox_server_t const server,
+                                                  const ENUM iox_ServerState serverState,
+                                                  const uint64_t id,
+                                                  void (*callback)(iox_server_t));
+
+/// @brief attaches a server state to a waitset. The callback has an additional contextData argument to provide
+/// access to user defined data.
+/// @param[in] self handle to the waitset
+/// @param[in] server the server of the state which should be attached
+/// @param[in] serverState the state which should be attached
+/// @param[in] id an arbitrary id which will be tagged to the state
+/// @param[in] callback a callback which is attached to the state
+/// @param[in] contextData a void pointer which is provided as second argument to the callback
+/// @return if the attaching was successfull it returns WaitSetResult_SUCCESS, otherwise
+///             an enum which describes the error
+ENUM iox_WaitSetResult iox_ws_attach_server_state_with_context_data(iox_ws_t const self,
+                                                                    iox_server_t const server,
+                                                                    const ENUM iox_ServerState serverState,
+                                                                    const uint64_t id,
+                                                                    void (*callback)(iox_server_t, void*),
+                                                                    void* const contextData);
+
+/// @brief attaches a server event to a waitset
+/// @param[in] self handle to the waitset
+/// @param[in] server the server of the event which should be attached
+/// @param[in] serverEvent the event which should be attached
+/// @param[in] eventId an arbitrary id which will be tagged to the event
+/// @param[in] callback a callback which is attached to the event
+/// @return if the attaching was successfull it returns WaitSetResult_SUCCESS, otherwise
+///             an enum which describes the error
+ENUM iox_WaitSetResult iox_ws_attach_server_event(iox_ws_t const self,
+                                                  iox_server_t const server,
+                                                  const ENUM iox_ServerEvent serverEvent,
+                                                  const uint64_t eventId,
+                                                  void (*callback)(iox_server_t));
+
+/// @brief attaches a server event to a waitset. The callback has an additional contextData argument to provide
+/// access to user defined data.
+/// @param[in] self handle to the waitset
+/// @param[in] server the server of the event which should be attached
+/// @param[in] serverEvent the event which should be attached
+/// @param[in] eventId an arbitrary id which will be tagged to the event
+/// @param[in] callback a callback which is attached to the event
+/// @param[in] contextData a void pointer which is provided as second argument to the callback
+/// @return if the attaching was successfull it returns WaitSetResult_SUCCESS, otherwise
+///             an enum which describes the error
+ENUM iox_WaitSetResult iox_ws_attach_server_event_with_context_data(iox_ws_t const self,
+                                                                    iox_server_t const server,
+                                                                    const ENUM iox_ServerEvent serverEvent,
+                                                                    const uint64_t eventId,
+                                                                    void (*callback)(iox_server_t, void*),
+                                                                    void* const contextData);
+
 /// @brief attaches a user trigger event to a waitset
 /// @param[in] self handle to the waitset
 /// @param[in] userTrigger the user trigger of the event which should be attached
@@ -184,6 +322,30 @@ void iox_ws_detach_subscriber_state(iox_ws_t const self,
                                     iox_sub_t const subscriber,
                                     const ENUM iox_SubscriberState subscriberState);
 
+/// @brief detaches a client event from a waitset
+/// @param[in] self handle to the waitset
+/// @param[in] client the client from which the event should be detached
+/// @param[in] clientEvent the event which should be detached from the client
+void iox_ws_detach_client_event(iox_ws_t const self, iox_client_t const client, const ENUM iox_ClientEvent clientEvent);
+
+/// @brief detaches a client state from a waitset
+/// @param[in] self handle to the waitset
+/// @param[in] client the client from which the state should be detached
+/// @param[in] clientState the state which should be detached from the client
+void iox_ws_detach_client_state(iox_ws_t const self, iox_client_t const client, const ENUM iox_ClientState clientState);
+
+/// @brief detaches a server event from a waitset
+/// @param[in] self handle to the waitset
+/// @param[in] server the server from which the event should be detached
+/// @param[in] serverEvent the event which should be detached from the server
+void iox_ws_detach_server_event(iox_ws_t const self, iox_server_t const server, const ENUM iox_ServerEvent serverEvent);
+
+/// @brief detaches a server state from a waitset
+/// @param[in] self handle to the waitset
+/// @param[in] server the server from which the state should be detached
+/// @param[in] serverState the state which should be detached from the server
+void iox_ws_detach_server_state(iox_ws_t const self, iox_server_t const server, const ENUM iox_ServerState serverState);
+
 /// @brief detaches a user trigger event from a waitset
 /// @param[in] self handle to the waitset
 /// @param[in] usertrigger the user trigger which should be detached
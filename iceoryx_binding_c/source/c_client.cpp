@@ -0,0 +1,190 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_binding_c/internal/c2cpp_enum_translation.hpp"
+#include "iceoryx_binding_c/internal/cpp2c_client.hpp"
+#include "iceoryx_binding_c/internal/cpp2c_enum_translation.hpp"
+#include "iceoryx_binding_c/internal/cpp2c_service_description_translation.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_user.hpp"
+#include "iceoryx_posh/popo/rpc_header.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+
+using namespace iox;
+using namespace iox::cxx;
+using namespace iox::popo;
+using namespace iox::capro;
+using namespace iox::runtime;
+
+extern "C" {
+#include "iceoryx_binding_c/client.h"
+}
+
+constexpr uint64_t CLIENT_OPTIONS_INIT_CHECK_CONSTANT = 47113130815;
+
+void iox_client_options_init(iox_client_options_t* options)
+{
+    if (options == nullptr)
+    {
+        LogWarn() << "client options initialization skipped - null pointer provided";
+        return;
+    }
+
+    ClientOptions clientOptions;
+    options->responseQueueCapacity = clientOptions.responseQueueCapacity;
+    options->nodeName = nullptr;
+    options->connectOnCreate = clientOptions.connectOnCreate;
+    options->responseQueueFullPolicy = cpp2c::queueFullPolicy(clientOptions.responseQueueFullPolicy);
+    options->serverTooSlowPolicy = cpp2c::consumerTooSlowPolicy(clientOptions.serverTooSlowPolicy);
+
+    options->initCheck = CLIENT_OPTIONS_INIT_CHECK_CONSTANT;
+}
+
+bool iox_client_options_is_initialized(const iox_client_options_t* const options)
+{
+    return options && options->initCheck == CLIENT_OPTIONS_INIT_CHECK_CONSTANT;
+}
+
+iox_client_t iox_client_init(iox_client_storage_t* self,
+                             const char* const service,
+                             const char* const instance,
+                             const char* const event,
+                             const iox_client_options_t* const options)
+{
+    if (self == nullptr)
+    {
+        LogWarn() << "client initialization skipped - null pointer provided for iox_client_storage_t";
+        return nullptr;
+    }
+
+    new (self) cpp2c_Client();
+    iox_client_t me = reinterpret_cast<iox_client_t>(self);
+
+    ClientOptions clientOptions;
+
+    // use default options otherwise
+    if (options != nullptr)
+    {
+        if (!iox_client_options_is_initialized(options))
+        {
+            // note that they may have been initialized but the initCheck
+            // pattern overwritten afterwards, we cannot be sure but it is a misuse
+            LogFatal() << "client options may not have been initialized with iox_client_options_init";
+            errorHandler(Error::kBINDING_C__CLIENT_OPTIONS_NOT_INITIALIZED);
+        }
+        clientOptions.responseQueueCapacity = options->responseQueueCapacity;
+        if (options->nodeName != nullptr)
+        {
+            clientOptions.nodeName = NodeName_t(TruncateToCapacity, options->nodeName);
+        }
+        clientOptions.connectOnCreate = options->connectOnCreate;
+        clientOptions.responseQueueFullPolicy = c2cpp::queueFullPolicy2(options->responseQueueFullPolicy);
+        clientOptions.serverTooSlowPolicy = c2cpp::consumerTooSlowPolicy(options->serverTooSlowPolicy);
+    }
+
+    me->m_portData = PoshRuntime::getInstance().getMiddlewareClient(
+        ServiceDescription{
+            IdString_t(TruncateToCapacity, service),
+            IdString_t(TruncateToCapacity, instance),
+            IdString_t(TruncateToCapacity, event),
+        },
+        clientOptions);
+    return me;
+}
+
+void iox_client_deinit(iox_client_t const self)
+{
+    self->~cpp2c_Client();
+}
+
+iox_AllocationResult iox_client_loan_request(iox_client_t const self, void** const payload, const uint32_t payloadSize)
+{
+    return iox_client_loan_aligned_request(self, payload, payloadSize, IOX_C_CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+}
+
+iox_AllocationResult iox_client_loan_aligned_request(iox_client_t const self,
+                                                     void** const payload,
+                                                     const uint32_t payloadSize,
+                                                     const uint32_t payloadAlignment)
+{
+    auto result = ClientPortUser(*self->m_portData)
+                      .allocateRequest(payloadSize, payloadAlignment)
+                      .and_then([&payload](RequestHeader* requestHeader) {
+                          *payload = requestHeader->getUserPayload();
+                      });
+    if (result.has_error())
+    {
+        return cpp2c::allocationResult(result.get_error());
+    }
+
+    return AllocationResult_SUCCESS;
+}
+
+void iox_client_release_request(iox_client_t const self, void* const payload)
+{
+    ClientPortUser(*self->m_portData).freeRequest(RequestHeader::fromPayload(payload));
+}
+
+void iox_client_send(iox_client_t const self, void* const payload)
+{
+    ClientPortUser(*self->m_portData).sendRequest(RequestHeader::fromPayload(payload));
+}
+
+void iox_client_connect(iox_client_t const self)
+{
+    ClientPortUser(*self->m_portData).connect();
+}
+
+void iox_client_disconnect(iox_client_t const self)
+{
+    ClientPortUser(*self->m_portData).disconnect();
+}
+
+iox_ConnectionState iox_client_get_connection_state(iox_client_t const self)
+{
+    return cpp2c::connectionState(ClientPortUser(*self->m_portData).getConnectionState());
+}
+
+iox_ChunkReceiveResult iox_client_take_response(iox_client_t const self, const void** const payload)
+{
+    auto result = ClientPortUser(*self->m_portData).getResponse();
+    if (result.has_error())
+    {
+        return cpp2c::chunkReceiveResult(result.get_error());
+    }
+
+    *payload = result.value()->getUserPayload();
+    return ChunkReceiveResult_SUCCESS;
+}
+
+void iox_client_release_response(iox_client_t const self, const void* const payload)
+{
+    ClientPortUser(*self->m_portData).releaseResponse(ResponseHeader::fromPayload(payload));
+}
+
+bool iox_client_has_responses(iox_client_t const self)
+{
+    return ClientPortUser(*self->m_portData).hasNewResponses();
+}
+
+bool iox_client_has_missed_responses(iox_client_t const self)
+{
+    return ClientPortUser(*self->m_portData).hasLostResponsesSinceLastCall();
+}
+
+iox_service_description_t iox_client_get_service_description(iox_client_t const self)
+{
+    return TranslateServiceDescription(ClientPortUser(*self->m_portData).getCaProServiceDescription());
+}
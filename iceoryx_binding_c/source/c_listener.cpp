@@ -16,6 +16,8 @@
 
 #include "iceoryx_binding_c/internal/c2cpp_enum_translation.hpp"
 #include "iceoryx_binding_c/internal/cpp2c_enum_translation.hpp"
+#include "iceoryx_binding_c/internal/cpp2c_client.hpp"
+#include "iceoryx_binding_c/internal/cpp2c_server.hpp"
 #include "iceoryx_binding_c/internal/cpp2c_subscriber.hpp"
 #include "iceoryx_posh/popo/listener.hpp"
 #include "iceoryx_posh/popo/user_trigger.hpp"
@@ -29,6 +31,9 @@ extern "C" {
 
 iox_listener_t iox_listener_init(iox_listener_storage_t* self)
 {
+    static_assert(sizeof(Listener) <= sizeof(iox_listener_storage_t), "iox_listener_storage_t is too small");
+    static_assert(alignof(Listener) <= alignof(iox_listener_storage_t), "iox_listener_storage_t is misaligned");
+
     if (self == nullptr)
     {
         LogWarn() << "listener initialization skipped - null pointer provided for iox_listener_storage_t";
@@ -79,6 +84,66 @@ iox_listener_attach_subscriber_event_with_context_data(iox_listener_t const self
     return ListenerResult_SUCCESS;
 }
 
+ENUM iox_ListenerResult iox_listener_attach_client_event(iox_listener_t const self,
+                                                         iox_client_t const client,
+                                                         const ENUM iox_ClientEvent clientEvent,
+                                                         void (*callback)(iox_client_t))
+{
+    auto result = self->attachEvent(*client,
+                                    c2cpp::clientEvent(clientEvent),
+                                    NotificationCallback<cpp2c_Client, internal::NoType_t>{callback, nullptr});
+    if (result.has_error())
+    {
+        return cpp2c::listenerResult(result.get_error());
+    }
+    return ListenerResult_SUCCESS;
+}
+
+ENUM iox_ListenerResult iox_listener_attach_client_event_with_context_data(iox_listener_t const self,
+                                                                           iox_client_t const client,
+                                                                           const ENUM iox_ClientEvent clientEvent,
+                                                                           void (*callback)(iox_client_t, void*),
+                                                                           void* const contextData)
+{
+    auto result = self->attachEvent(
+        *client, c2cpp::clientEvent(clientEvent), NotificationCallback<cpp2c_Client, void>{callback, contextData});
+    if (result.has_error())
+    {
+        return cpp2c::listenerResult(result.get_error());
+    }
+    return ListenerResult_SUCCESS;
+}
+
+ENUM iox_ListenerResult iox_listener_attach_server_event(iox_listener_t const self,
+                                                         iox_server_t const server,
+                                                         const ENUM iox_ServerEvent serverEvent,
+                                                         void (*callback)(iox_server_t))
+{
+    auto result = self->attachEvent(*server,
+                                    c2cpp::serverEvent(serverEvent),
+                                    NotificationCallback<cpp2c_Server, internal::NoType_t>{callback, nullptr});
+    if (result.has_error())
+    {
+        return cpp2c::listenerResult(result.get_error());
+    }
+    return ListenerResult_SUCCESS;
+}
+
+ENUM iox_ListenerResult iox_listener_attach_server_event_with_context_data(iox_listener_t const self,
+                                                                           iox_server_t const server,
+                                                                           const ENUM iox_ServerEvent serverEvent,
+                                                                           void (*callback)(iox_server_t, void*),
+                                                                           void* const contextData)
+{
+    auto result = self->attachEvent(
+        *server, c2cpp::serverEvent(serverEvent), NotificationCallback<cpp2c_Server, void>{callback, contextData});
+    if (result.has_error())
+    {
+        return cpp2c::listenerResult(result.get_error());
+    }
+    return ListenerResult_SUCCESS;
+}
+
 ENUM iox_ListenerResult iox_listener_attach_user_trigger_event(iox_listener_t const self,
                                                                iox_user_trigger_t const userTrigger,
                                                                void (*callback)(iox_user_trigger_t))
@@ -117,6 +182,20 @@ void iox_listener_detach_subscriber_event(iox_listener_t const self,
     self->detachEvent(*subscriber, c2cpp::subscriberEvent(subscriberEvent));
 }
 
+void iox_listener_detach_client_event(iox_listener_t const self,
+                                      iox_client_t const client,
+                                      const ENUM iox_ClientEvent clientEvent)
+{
+    self->detachEvent(*client, c2cpp::clientEvent(clientEvent));
+}
+
+void iox_listener_detach_server_event(iox_listener_t const self,
+                                      iox_server_t const server,
+                                      const ENUM iox_ServerEvent serverEvent)
+{
+    self->detachEvent(*server, c2cpp::serverEvent(serverEvent));
+}
+
 void iox_listener_detach_user_trigger_event(iox_listener_t const self, iox_user_trigger_t const userTrigger)
 {
     self->detachEvent(*userTrigger);
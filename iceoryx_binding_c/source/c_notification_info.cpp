@@ -14,6 +14,8 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include "iceoryx_binding_c/internal/cpp2c_client.hpp"
+#include "iceoryx_binding_c/internal/cpp2c_server.hpp"
 #include "iceoryx_binding_c/internal/cpp2c_subscriber.hpp"
 #include "iceoryx_posh/popo/notification_info.hpp"
 #include "iceoryx_posh/popo/user_trigger.hpp"
@@ -38,6 +40,16 @@ bool iox_notification_info_does_originate_from_subscriber(iox_notification_info_
     return self->doesOriginateFrom(subscriber);
 }
 
+bool iox_notification_info_does_originate_from_client(iox_notification_info_t const self, iox_client_t const client)
+{
+    return self->doesOriginateFrom(client);
+}
+
+bool iox_notification_info_does_originate_from_server(iox_notification_info_t const self, iox_server_t const server)
+{
+    return self->doesOriginateFrom(server);
+}
+
 bool iox_notification_info_does_originate_from_user_trigger(iox_notification_info_t const self,
                                                             iox_user_trigger_t const user_trigger)
 {
@@ -49,6 +61,16 @@ iox_sub_t iox_notification_info_get_subscriber_origin(iox_notification_info_t co
     return self->getOrigin<cpp2c_Subscriber>();
 }
 
+iox_client_t iox_notification_info_get_client_origin(iox_notification_info_t const self)
+{
+    return self->getOrigin<cpp2c_Client>();
+}
+
+iox_server_t iox_notification_info_get_server_origin(iox_notification_info_t const self)
+{
+    return self->getOrigin<cpp2c_Server>();
+}
+
 iox_user_trigger_t iox_notification_info_get_user_trigger_origin(iox_notification_info_t const self)
 {
     return self->getOrigin<UserTrigger>();
@@ -150,6 +150,36 @@ iox_AllocationResult iox_pub_loan_aligned_chunk_with_user_header(iox_pub_t const
     return AllocationResult_SUCCESS;
 }
 
+iox_AllocationResult iox_pub_loan_chunks(iox_pub_t const self,
+                                         void** const userPayloads,
+                                         const uint32_t numberOfChunks,
+                                         const uint32_t userPayloadSize,
+                                         const uint32_t userPayloadAlignment,
+                                         const uint32_t userHeaderSize,
+                                         const uint32_t userHeaderAlignment,
+                                         uint32_t* const numberOfLoanedChunks)
+{
+    uint32_t index{0U};
+    auto result = PublisherPortUser(self->m_portData)
+                      .tryAllocateChunks(userPayloadSize,
+                                         userPayloadAlignment,
+                                         userHeaderSize,
+                                         userHeaderAlignment,
+                                         numberOfChunks,
+                                         [&](ChunkHeader* chunkHeader) {
+                                             userPayloads[index] = chunkHeader->userPayload();
+                                             ++index;
+                                         });
+    *numberOfLoanedChunks = index;
+
+    if (result.has_error())
+    {
+        return cpp2c::allocationResult(result.get_error());
+    }
+
+    return AllocationResult_SUCCESS;
+}
+
 void iox_pub_release_chunk(iox_pub_t const self, void* const userPayload)
 {
     PublisherPortUser(self->m_portData).releaseChunk(ChunkHeader::fromUserPayload(userPayload));
@@ -160,6 +190,24 @@ void iox_pub_publish_chunk(iox_pub_t const self, void* const userPayload)
     PublisherPortUser(self->m_portData).sendChunk(ChunkHeader::fromUserPayload(userPayload));
 }
 
+void iox_pub_publish_chunks(iox_pub_t const self, void* const* const userPayloads, const uint32_t numberOfChunks)
+{
+    PublisherPortUser publisherPort(self->m_portData);
+    ChunkHeader* chunkHeaders[MemoryManager::MAX_CHUNKS_PER_BATCH];
+    uint32_t numberOfChunkHeaders{0U};
+    for (uint32_t i = 0U; i < numberOfChunks; ++i)
+    {
+        chunkHeaders[numberOfChunkHeaders] = ChunkHeader::fromUserPayload(userPayloads[i]);
+        ++numberOfChunkHeaders;
+
+        if (numberOfChunkHeaders == MemoryManager::MAX_CHUNKS_PER_BATCH || i + 1U == numberOfChunks)
+        {
+            publisherPort.sendChunks(chunkHeaders, numberOfChunkHeaders);
+            numberOfChunkHeaders = 0U;
+        }
+    }
+}
+
 void iox_pub_offer(iox_pub_t const self)
 {
     PublisherPortUser(self->m_portData).offer();
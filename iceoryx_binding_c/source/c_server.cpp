@@ -0,0 +1,200 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_binding_c/internal/c2cpp_enum_translation.hpp"
+#include "iceoryx_binding_c/internal/cpp2c_enum_translation.hpp"
+#include "iceoryx_binding_c/internal/cpp2c_server.hpp"
+#include "iceoryx_binding_c/internal/cpp2c_service_description_translation.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_user.hpp"
+#include "iceoryx_posh/popo/rpc_header.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+
+using namespace iox;
+using namespace iox::cxx;
+using namespace iox::popo;
+using namespace iox::capro;
+using namespace iox::runtime;
+
+extern "C" {
+#include "iceoryx_binding_c/server.h"
+}
+
+constexpr uint64_t SERVER_OPTIONS_INIT_CHECK_CONSTANT = 31415926535;
+
+void iox_server_options_init(iox_server_options_t* options)
+{
+    if (options == nullptr)
+    {
+        LogWarn() << "server options initialization skipped - null pointer provided";
+        return;
+    }
+
+    ServerOptions serverOptions;
+    options->requestQueueCapacity = serverOptions.requestQueueCapacity;
+    options->nodeName = nullptr;
+    options->offerOnCreate = serverOptions.offerOnCreate;
+    options->requestQueueFullPolicy = cpp2c::queueFullPolicy(serverOptions.requestQueueFullPolicy);
+    options->clientTooSlowPolicy = cpp2c::consumerTooSlowPolicy(serverOptions.clientTooSlowPolicy);
+
+    options->initCheck = SERVER_OPTIONS_INIT_CHECK_CONSTANT;
+}
+
+bool iox_server_options_is_initialized(const iox_server_options_t* const options)
+{
+    return options && options->initCheck == SERVER_OPTIONS_INIT_CHECK_CONSTANT;
+}
+
+iox_server_t iox_server_init(iox_server_storage_t* self,
+                             const char* const service,
+                             const char* const instance,
+                             const char* const event,
+                             const iox_server_options_t* const options)
+{
+    if (self == nullptr)
+    {
+        LogWarn() << "server initialization skipped - null pointer provided for iox_server_storage_t";
+        return nullptr;
+    }
+
+    new (self) cpp2c_Server();
+    iox_server_t me = reinterpret_cast<iox_server_t>(self);
+
+    ServerOptions serverOptions;
+
+    // use default options otherwise
+    if (options != nullptr)
+    {
+        if (!iox_server_options_is_initialized(options))
+        {
+            // note that they may have been initialized but the initCheck
+            // pattern overwritten afterwards, we cannot be sure but it is a misuse
+            LogFatal() << "server options may not have been initialized with iox_server_options_init";
+            errorHandler(Error::kBINDING_C__SERVER_OPTIONS_NOT_INITIALIZED);
+        }
+        serverOptions.requestQueueCapacity = options->requestQueueCapacity;
+        if (options->nodeName != nullptr)
+        {
+            serverOptions.nodeName = NodeName_t(TruncateToCapacity, options->nodeName);
+        }
+        serverOptions.offerOnCreate = options->offerOnCreate;
+        serverOptions.requestQueueFullPolicy = c2cpp::queueFullPolicy2(options->requestQueueFullPolicy);
+        serverOptions.clientTooSlowPolicy = c2cpp::consumerTooSlowPolicy(options->clientTooSlowPolicy);
+    }
+
+    me->m_portData = PoshRuntime::getInstance().getMiddlewareServer(
+        ServiceDescription{
+            IdString_t(TruncateToCapacity, service),
+            IdString_t(TruncateToCapacity, instance),
+            IdString_t(TruncateToCapacity, event),
+        },
+        serverOptions);
+    return me;
+}
+
+void iox_server_deinit(iox_server_t const self)
+{
+    self->~cpp2c_Server();
+}
+
+iox_ChunkReceiveResult iox_server_take_request(iox_server_t const self, const void** const payload)
+{
+    auto result = ServerPortUser(self->m_portData).getRequest();
+    if (result.has_error())
+    {
+        return cpp2c::chunkReceiveResult(result.get_error());
+    }
+
+    *payload = result.value()->getUserPayload();
+    return ChunkReceiveResult_SUCCESS;
+}
+
+void iox_server_release_request(iox_server_t const self, const void* const payload)
+{
+    ServerPortUser(self->m_portData).releaseRequest(RequestHeader::fromPayload(payload));
+}
+
+iox_AllocationResult iox_server_loan_response(iox_server_t const self,
+                                              const void* const requestPayload,
+                                              void** const payload,
+                                              const uint32_t payloadSize)
+{
+    return iox_server_loan_aligned_response(
+        self, requestPayload, payload, payloadSize, IOX_C_CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+}
+
+iox_AllocationResult iox_server_loan_aligned_response(iox_server_t const self,
+                                                      const void* const requestPayload,
+                                                      void** const payload,
+                                                      const uint32_t payloadSize,
+                                                      const uint32_t payloadAlignment)
+{
+    auto result = ServerPortUser(self->m_portData)
+                      .allocateResponse(RequestHeader::fromPayload(requestPayload), payloadSize, payloadAlignment)
+                      .and_then([&payload](ResponseHeader* responseHeader) {
+                          *payload = responseHeader->getUserPayload();
+                      });
+    if (result.has_error())
+    {
+        return cpp2c::allocationResult(result.get_error());
+    }
+
+    return AllocationResult_SUCCESS;
+}
+
+void iox_server_send(iox_server_t const self, void* const payload)
+{
+    ServerPortUser(self->m_portData).sendResponse(ResponseHeader::fromPayload(payload));
+}
+
+void iox_server_release_response(iox_server_t const self, void* const payload)
+{
+    ServerPortUser(self->m_portData).freeResponse(ResponseHeader::fromPayload(payload));
+}
+
+void iox_server_offer(iox_server_t const self)
+{
+    ServerPortUser(self->m_portData).offer();
+}
+
+void iox_server_stop_offer(iox_server_t const self)
+{
+    ServerPortUser(self->m_portData).stopOffer();
+}
+
+bool iox_server_is_offered(iox_server_t const self)
+{
+    return ServerPortUser(self->m_portData).isOffered();
+}
+
+bool iox_server_has_clients(iox_server_t const self)
+{
+    return ServerPortUser(self->m_portData).hasClients();
+}
+
+bool iox_server_has_requests(iox_server_t const self)
+{
+    return ServerPortUser(self->m_portData).hasNewRequests();
+}
+
+bool iox_server_has_missed_requests(iox_server_t const self)
+{
+    return ServerPortUser(self->m_portData).hasLostRequestsSinceLastCall();
+}
+
+iox_service_description_t iox_server_get_service_description(iox_server_t const self)
+{
+    return TranslateServiceDescription(ServerPortUser(self->m_portData).getCaProServiceDescription());
+}
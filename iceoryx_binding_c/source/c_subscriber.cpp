@@ -141,6 +141,31 @@ iox_ChunkReceiveResult iox_sub_take_chunk(iox_sub_t const self, const void** con
     return ChunkReceiveResult_SUCCESS;
 }
 
+iox_ChunkReceiveResult iox_sub_take_chunks(iox_sub_t const self,
+                                           const void** const userPayloads,
+                                           const uint64_t maxNumberOfChunks,
+                                           uint64_t* const numberOfChunks)
+{
+    uint64_t index{0U};
+    auto result = SubscriberPortUser(self->m_portData)
+                      .tryGetChunks(maxNumberOfChunks, [&](const ChunkHeader* chunkHeader) {
+                          userPayloads[index] = chunkHeader->userPayload();
+                          ++index;
+                      });
+    *numberOfChunks = index;
+
+    if (result.has_error())
+    {
+        return cpp2c::chunkReceiveResult(result.get_error());
+    }
+
+    if (index == 0U)
+    {
+        return ChunkReceiveResult_NO_CHUNK_AVAILABLE;
+    }
+    return ChunkReceiveResult_SUCCESS;
+}
+
 void iox_sub_release_chunk(iox_sub_t const self, const void* const userPayload)
 {
     SubscriberPortUser(self->m_portData).releaseChunk(ChunkHeader::fromUserPayload(userPayload));
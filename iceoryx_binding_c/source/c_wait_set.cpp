@@ -17,6 +17,8 @@
 
 #include "iceoryx_binding_c/internal/c2cpp_enum_translation.hpp"
 #include "iceoryx_binding_c/internal/cpp2c_enum_translation.hpp"
+#include "iceoryx_binding_c/internal/cpp2c_client.hpp"
+#include "iceoryx_binding_c/internal/cpp2c_server.hpp"
 #include "iceoryx_binding_c/internal/cpp2c_subscriber.hpp"
 #include "iceoryx_binding_c/internal/cpp2c_waitset.hpp"
 #include "iceoryx_posh/popo/notification_callback.hpp"
@@ -103,6 +105,18 @@ uint64_t iox_ws_capacity(iox_ws_t const self)
     return self->capacity();
 }
 
+void iox_ws_set_busy_poll_duration(iox_ws_t const self, struct timespec busyPollDuration)
+{
+    self->setBusyPollDuration(units::Duration(busyPollDuration));
+}
+
+void iox_ws_get_wait_statistics(iox_ws_t const self, uint64_t* const spinHits, uint64_t* const sleeps)
+{
+    auto statistics = self->getWaitStatistics();
+    *spinHits = statistics.spinHits;
+    *sleeps = statistics.sleeps;
+}
+
 void iox_ws_mark_for_destruction(iox_ws_t const self)
 {
     self->markForDestruction();
@@ -160,6 +174,106 @@ iox_WaitSetResult iox_ws_attach_subscriber_event_with_context_data(iox_ws_t cons
     return (result.has_error()) ? cpp2c::waitSetResult(result.get_error()) : iox_WaitSetResult::WaitSetResult_SUCCESS;
 }
 
+iox_WaitSetResult iox_ws_attach_client_state(iox_ws_t const self,
+                                             iox_client_t const client,
+                                             const iox_ClientState clientState,
+                                             const uint64_t eventId,
+                                             void (*callback)(iox_client_t))
+{
+    auto result = self->attachState(*client, c2cpp::clientState(clientState), eventId, {callback, nullptr});
+    return (result.has_error()) ? cpp2c::waitSetResult(result.get_error()) : iox_WaitSetResult::WaitSetResult_SUCCESS;
+}
+
+iox_WaitSetResult iox_ws_attach_client_state_with_context_data(iox_ws_t const self,
+                                                               iox_client_t const client,
+                                                               const iox_ClientState clientState,
+                                                               const uint64_t eventId,
+                                                               void (*callback)(iox_client_t, void*),
+                                                               void* const contextData)
+{
+    NotificationCallback<cpp2c_Client, void> notificationCallback;
+    notificationCallback.m_callback = callback;
+    notificationCallback.m_contextData = contextData;
+
+    auto result = self->attachState(*client, c2cpp::clientState(clientState), eventId, notificationCallback);
+    return (result.has_error()) ? cpp2c::waitSetResult(result.get_error()) : iox_WaitSetResult::WaitSetResult_SUCCESS;
+}
+
+iox_WaitSetResult iox_ws_attach_client_event(iox_ws_t const self,
+                                             iox_client_t const client,
+                                             const iox_ClientEvent clientEvent,
+                                             const uint64_t eventId,
+                                             void (*callback)(iox_client_t))
+{
+    auto result = self->attachEvent(*client, c2cpp::clientEvent(clientEvent), eventId, {callback, nullptr});
+    return (result.has_error()) ? cpp2c::waitSetResult(result.get_error()) : iox_WaitSetResult::WaitSetResult_SUCCESS;
+}
+
+iox_WaitSetResult iox_ws_attach_client_event_with_context_data(iox_ws_t const self,
+                                                               iox_client_t const client,
+                                                               const iox_ClientEvent clientEvent,
+                                                               const uint64_t eventId,
+                                                               void (*callback)(iox_client_t, void*),
+                                                               void* const contextData)
+{
+    NotificationCallback<cpp2c_Client, void> notificationCallback;
+    notificationCallback.m_callback = callback;
+    notificationCallback.m_contextData = contextData;
+
+    auto result = self->attachEvent(*client, c2cpp::clientEvent(clientEvent), eventId, notificationCallback);
+    return (result.has_error()) ? cpp2c::waitSetResult(result.get_error()) : iox_WaitSetResult::WaitSetResult_SUCCESS;
+}
+
+iox_WaitSetResult iox_ws_attach_server_state(iox_ws_t const self,
+                                             iox_server_t const server,
+                                             const iox_ServerState serverState,
+                                             const uint64_t eventId,
+                                             void (*callback)(iox_server_t))
+{
+    auto result = self->attachState(*server, c2cpp::serverState(serverState), eventId, {callback, nullptr});
+    return (result.has_error()) ? cpp2c::waitSetResult(result.get_error()) : iox_WaitSetResult::WaitSetResult_SUCCESS;
+}
+
+iox_WaitSetResult iox_ws_attach_server_state_with_context_data(iox_ws_t const self,
+                                                               iox_server_t const server,
+                                                               const iox_ServerState serverState,
+                                                               const uint64_t eventId,
+                                                               void (*callback)(iox_server_t, void*),
+                                                               void* const contextData)
+{
+    NotificationCallback<cpp2c_Server, void> notificationCallback;
+    notificationCallback.m_callback = callback;
+    notificationCallback.m_contextData = contextData;
+
+    auto result = self->attachState(*server, c2cpp::serverState(serverState), eventId, notificationCallback);
+    return (result.has_error()) ? cpp2c::waitSetResult(result.get_error()) : iox_WaitSetResult::WaitSetResult_SUCCESS;
+}
+
+iox_WaitSetResult iox_ws_attach_server_event(iox_ws_t const self,
+                                             iox_server_t const server,
+                                             const iox_ServerEvent serverEvent,
+                                             const uint64_t eventId,
+                                             void (*callback)(iox_server_t))
+{
+    auto result = self->attachEvent(*server, c2cpp::serverEvent(serverEvent), eventId, {callback, nullptr});
+    return (result.has_error()) ? cpp2c::waitSetResult(result.get_error()) : iox_WaitSetResult::WaitSetResult_SUCCESS;
+}
+
+iox_WaitSetResult iox_ws_attach_server_event_with_context_data(iox_ws_t const self,
+                                                               iox_server_t const server,
+                                                               const iox_ServerEvent serverEvent,
+                                                               const uint64_t eventId,
+                                                               void (*callback)(iox_server_t, void*),
+                                                               void* const contextData)
+{
+    NotificationCallback<cpp2c_Server, void> notificationCallback;
+    notificationCallback.m_callback = callback;
+    notificationCallback.m_contextData = contextData;
+
+    auto result = self->attachEvent(*server, c2cpp::serverEvent(serverEvent), eventId, notificationCallback);
+    return (result.has_error()) ? cpp2c::waitSetResult(result.get_error()) : iox_WaitSetResult::WaitSetResult_SUCCESS;
+}
+
 iox_WaitSetResult iox_ws_attach_user_trigger_event(iox_ws_t const self,
                                                    iox_user_trigger_t const userTrigger,
                                                    const uint64_t eventId,
@@ -197,6 +311,26 @@ void iox_ws_detach_subscriber_state(iox_ws_t const self,
     self->detachState(*subscriber, c2cpp::subscriberState(subscriberState));
 }
 
+void iox_ws_detach_client_event(iox_ws_t const self, iox_client_t const client, const iox_ClientEvent clientEvent)
+{
+    self->detachEvent(*client, c2cpp::clientEvent(clientEvent));
+}
+
+void iox_ws_detach_client_state(iox_ws_t const self, iox_client_t const client, const iox_ClientState clientState)
+{
+    self->detachState(*client, c2cpp::clientState(clientState));
+}
+
+void iox_ws_detach_server_event(iox_ws_t const self, iox_server_t const server, const iox_ServerEvent serverEvent)
+{
+    self->detachEvent(*server, c2cpp::serverEvent(serverEvent));
+}
+
+void iox_ws_detach_server_state(iox_ws_t const self, iox_server_t const server, const iox_ServerState serverState)
+{
+    self->detachState(*server, c2cpp::serverState(serverState));
+}
+
 void iox_ws_detach_user_trigger_event(iox_ws_t const self, iox_user_trigger_t const userTrigger)
 {
     self->detachEvent(*userTrigger);
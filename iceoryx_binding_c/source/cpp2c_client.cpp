@@ -0,0 +1,97 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_binding_c/internal/cpp2c_client.hpp"
+
+using namespace iox::popo;
+
+cpp2c_Client::~cpp2c_Client() noexcept
+{
+    if (m_portData)
+    {
+        ClientPortUser(*m_portData).destroy();
+    }
+}
+
+void cpp2c_Client::enableEvent(TriggerHandle&& triggerHandle, const ClientEvent clientEvent) noexcept
+{
+    switch (clientEvent)
+    {
+    case ClientEvent::RESPONSE_RECEIVED:
+        m_trigger = std::move(triggerHandle);
+        ClientPortUser(*m_portData)
+            .setConditionVariable(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId());
+        break;
+    }
+}
+
+void cpp2c_Client::disableEvent(const ClientEvent clientEvent) noexcept
+{
+    switch (clientEvent)
+    {
+    case ClientEvent::RESPONSE_RECEIVED:
+        m_trigger.reset();
+        break;
+    }
+}
+
+void cpp2c_Client::enableState(TriggerHandle&& triggerHandle, const ClientState clientState) noexcept
+{
+    switch (clientState)
+    {
+    case ClientState::HAS_RESPONSE:
+        m_trigger = std::move(triggerHandle);
+        ClientPortUser(*m_portData)
+            .setConditionVariable(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId());
+        break;
+    }
+}
+
+void cpp2c_Client::disableState(const ClientState clientState) noexcept
+{
+    switch (clientState)
+    {
+    case ClientState::HAS_RESPONSE:
+        m_trigger.reset();
+        break;
+    }
+}
+
+WaitSetIsConditionSatisfiedCallback
+cpp2c_Client::getCallbackForIsStateConditionSatisfied(const ClientState clientState) const noexcept
+{
+    switch (clientState)
+    {
+    case ClientState::HAS_RESPONSE:
+        return {*this, &cpp2c_Client::hasResponses};
+    }
+
+    return {};
+}
+
+void cpp2c_Client::invalidateTrigger(const uint64_t uniqueTriggerId) noexcept
+{
+    if (m_trigger.getUniqueId() == uniqueTriggerId)
+    {
+        ClientPortUser(*m_portData).unsetConditionVariable();
+        m_trigger.invalidate();
+    }
+}
+
+bool cpp2c_Client::hasResponses() const noexcept
+{
+    return ClientPortUser(*m_portData).hasNewResponses();
+}
@@ -126,4 +126,46 @@ iox_QueueFullPolicy queueFullPolicy(const iox::popo::QueueFullPolicy policy) noe
     return QueueFullPolicy_DISCARD_OLDEST_DATA;
 }
 
+iox_QueueFullPolicy queueFullPolicy(const iox::popo::QueueFullPolicy2 policy) noexcept
+{
+    switch (policy)
+    {
+    case QueueFullPolicy2::BLOCK_PRODUCER:
+        return QueueFullPolicy_BLOCK_PUBLISHER;
+    case QueueFullPolicy2::DISCARD_OLDEST_DATA:
+        return QueueFullPolicy_DISCARD_OLDEST_DATA;
+    }
+    return QueueFullPolicy_DISCARD_OLDEST_DATA;
+}
+
+iox_ConsumerTooSlowPolicy consumerTooSlowPolicy(const iox::popo::ConsumerTooSlowPolicy policy) noexcept
+{
+    switch (policy)
+    {
+    case ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER:
+        return ConsumerTooSlowPolicy_WAIT_FOR_CONSUMER;
+    case ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA:
+        return ConsumerTooSlowPolicy_DISCARD_OLDEST_DATA;
+    }
+    return ConsumerTooSlowPolicy_DISCARD_OLDEST_DATA;
+}
+
+iox_ConnectionState connectionState(const iox::ConnectionState value) noexcept
+{
+    switch (value)
+    {
+    case iox::ConnectionState::NOT_CONNECTED:
+        return ConnectionState_NOT_CONNECTED;
+    case iox::ConnectionState::CONNECT_REQUESTED:
+        return ConnectionState_CONNECT_REQUESTED;
+    case iox::ConnectionState::CONNECTED:
+        return ConnectionState_CONNECTED;
+    case iox::ConnectionState::DISCONNECT_REQUESTED:
+        return ConnectionState_DISCONNECT_REQUESTED;
+    case iox::ConnectionState::WAIT_FOR_OFFER:
+        return ConnectionState_WAIT_FOR_OFFER;
+    }
+    return ConnectionState_UNDEFINED_ERROR;
+}
+
 } // namespace cpp2c
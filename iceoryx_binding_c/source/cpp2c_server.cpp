@@ -0,0 +1,97 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_binding_c/internal/cpp2c_server.hpp"
+
+using namespace iox::popo;
+
+cpp2c_Server::~cpp2c_Server() noexcept
+{
+    if (m_portData)
+    {
+        ServerPortUser(m_portData).destroy();
+    }
+}
+
+void cpp2c_Server::enableEvent(TriggerHandle&& triggerHandle, const ServerEvent serverEvent) noexcept
+{
+    switch (serverEvent)
+    {
+    case ServerEvent::REQUEST_RECEIVED:
+        m_trigger = std::move(triggerHandle);
+        ServerPortUser(m_portData)
+            .setConditionVariable(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId());
+        break;
+    }
+}
+
+void cpp2c_Server::disableEvent(const ServerEvent serverEvent) noexcept
+{
+    switch (serverEvent)
+    {
+    case ServerEvent::REQUEST_RECEIVED:
+        m_trigger.reset();
+        break;
+    }
+}
+
+void cpp2c_Server::enableState(TriggerHandle&& triggerHandle, const ServerState serverState) noexcept
+{
+    switch (serverState)
+    {
+    case ServerState::HAS_REQUEST:
+        m_trigger = std::move(triggerHandle);
+        ServerPortUser(m_portData)
+            .setConditionVariable(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId());
+        break;
+    }
+}
+
+void cpp2c_Server::disableState(const ServerState serverState) noexcept
+{
+    switch (serverState)
+    {
+    case ServerState::HAS_REQUEST:
+        m_trigger.reset();
+        break;
+    }
+}
+
+WaitSetIsConditionSatisfiedCallback
+cpp2c_Server::getCallbackForIsStateConditionSatisfied(const ServerState serverState) const noexcept
+{
+    switch (serverState)
+    {
+    case ServerState::HAS_REQUEST:
+        return {*this, &cpp2c_Server::hasRequests};
+    }
+
+    return {};
+}
+
+void cpp2c_Server::invalidateTrigger(const uint64_t uniqueTriggerId) noexcept
+{
+    if (m_trigger.getUniqueId() == uniqueTriggerId)
+    {
+        ServerPortUser(m_portData).unsetConditionVariable();
+        m_trigger.invalidate();
+    }
+}
+
+bool cpp2c_Server::hasRequests() const noexcept
+{
+    return ServerPortUser(m_portData).hasNewRequests();
+}
@@ -102,4 +102,55 @@ TEST(c2cpp_enum_translation_test, SubscriberEvent)
 #pragma GCC diagnostic pop
 }
 
+TEST(c2cpp_enum_translation_test, ClientState)
+{
+    EXPECT_EQ(c2cpp::clientState(ClientState_HAS_RESPONSE), iox::popo::ClientState::HAS_RESPONSE);
+}
+
+TEST(c2cpp_enum_translation_test, ClientEvent)
+{
+    EXPECT_EQ(c2cpp::clientEvent(ClientEvent_RESPONSE_RECEIVED), iox::popo::ClientEvent::RESPONSE_RECEIVED);
+}
+
+TEST(c2cpp_enum_translation_test, ServerState)
+{
+    EXPECT_EQ(c2cpp::serverState(ServerState_HAS_REQUEST), iox::popo::ServerState::HAS_REQUEST);
+}
+
+TEST(c2cpp_enum_translation_test, ServerEvent)
+{
+    EXPECT_EQ(c2cpp::serverEvent(ServerEvent_REQUEST_RECEIVED), iox::popo::ServerEvent::REQUEST_RECEIVED);
+}
+
+TEST(c2cpp_enum_translation_test, ConsumerTooSlowPolicy)
+{
+    EXPECT_EQ(c2cpp::consumerTooSlowPolicy(ConsumerTooSlowPolicy_WAIT_FOR_CONSUMER),
+              iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    EXPECT_EQ(c2cpp::consumerTooSlowPolicy(ConsumerTooSlowPolicy_DISCARD_OLDEST_DATA),
+              iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA);
+
+    // ignore the warning since we would like to test the behavior of an invalid enum value
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+// explicitly commented out since we are testing undefined behavior here and that we
+// return the default value DISCARD_OLDEST_DATA always in the undefined behavior case
+// the clang sanitizer detects this successfully and this leads to termination, and with this the test fails
+#if !defined(__clang__)
+    iox::Error errorValue = iox::Error::kNO_ERROR;
+    auto errorHandlerGuard = iox::ErrorHandler::setTemporaryErrorHandler(
+        [&](const iox::Error e, const std::function<void()>, const iox::ErrorLevel) { errorValue = e; });
+    EXPECT_EQ(c2cpp::consumerTooSlowPolicy(static_cast<iox_ConsumerTooSlowPolicy>(-1)),
+              iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA);
+    EXPECT_THAT(errorValue, Eq(iox::Error::kBINDING_C__UNDEFINED_STATE_IN_IOX_CONSUMER_TOO_SLOW_POLICY));
+#endif
+#pragma GCC diagnostic pop
+}
+
+TEST(c2cpp_enum_translation_test, QueueFullPolicy2)
+{
+    EXPECT_EQ(c2cpp::queueFullPolicy2(QueueFullPolicy_BLOCK_PUBLISHER), iox::popo::QueueFullPolicy2::BLOCK_PRODUCER);
+    EXPECT_EQ(c2cpp::queueFullPolicy2(QueueFullPolicy_DISCARD_OLDEST_DATA),
+              iox::popo::QueueFullPolicy2::DISCARD_OLDEST_DATA);
+}
+
 } // namespace
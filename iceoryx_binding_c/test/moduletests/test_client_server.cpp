@@ -0,0 +1,235 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_binding_c/internal/cpp2c_enum_translation.hpp"
+#include "iceoryx_posh/popo/client_options.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
+#include "iceoryx_posh/testing/roudi_gtest.hpp"
+
+extern "C" {
+#include "iceoryx_binding_c/client.h"
+#include "iceoryx_binding_c/notification_info.h"
+#include "iceoryx_binding_c/runtime.h"
+#include "iceoryx_binding_c/server.h"
+#include "iceoryx_binding_c/types.h"
+#include "iceoryx_binding_c/wait_set.h"
+}
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+
+class iox_client_server_test : public RouDi_GTest
+{
+  public:
+    void SetUp() override
+    {
+        iox_runtime_init("hypnotoad");
+    }
+
+    void TearDown() override
+    {
+    }
+
+    void createClientAndServer()
+    {
+        m_server = iox_server_init(&m_serverStorage, "all", "glory", "hypnotoad", nullptr);
+        ASSERT_NE(m_server, nullptr);
+        m_client = iox_client_init(&m_clientStorage, "all", "glory", "hypnotoad", nullptr);
+        ASSERT_NE(m_client, nullptr);
+        this->InterOpWait();
+    }
+
+    void destroyClientAndServer()
+    {
+        iox_client_deinit(m_client);
+        iox_server_deinit(m_server);
+    }
+
+    iox_client_storage_t m_clientStorage;
+    iox_server_storage_t m_serverStorage;
+    iox_client_t m_client{nullptr};
+    iox_server_t m_server{nullptr};
+};
+
+TEST(iox_client_options_test, clientOptionsAreInitializedWithDefaultValues)
+{
+    iox::popo::ClientOptions cppOptions;
+    iox_client_options_t sut;
+    iox_client_options_init(&sut);
+
+    EXPECT_EQ(sut.responseQueueCapacity, cppOptions.responseQueueCapacity);
+    EXPECT_EQ(sut.nodeName, nullptr);
+    EXPECT_EQ(sut.connectOnCreate, cppOptions.connectOnCreate);
+    EXPECT_EQ(sut.responseQueueFullPolicy, cpp2c::queueFullPolicy(cppOptions.responseQueueFullPolicy));
+    EXPECT_EQ(sut.serverTooSlowPolicy, cpp2c::consumerTooSlowPolicy(cppOptions.serverTooSlowPolicy));
+    EXPECT_TRUE(iox_client_options_is_initialized(&sut));
+}
+
+TEST(iox_client_options_test, clientOptionsInitializationCheckReturnsFalseWithoutInitialization)
+{
+    iox_client_options_t sut;
+    sut.initCheck = 0U;
+    EXPECT_FALSE(iox_client_options_is_initialized(&sut));
+    EXPECT_FALSE(iox_client_options_is_initialized(nullptr));
+}
+
+TEST(iox_server_options_test, serverOptionsAreInitializedWithDefaultValues)
+{
+    iox::popo::ServerOptions cppOptions;
+    iox_server_options_t sut;
+    iox_server_options_init(&sut);
+
+    EXPECT_EQ(sut.requestQueueCapacity, cppOptions.requestQueueCapacity);
+    EXPECT_EQ(sut.nodeName, nullptr);
+    EXPECT_EQ(sut.offerOnCreate, cppOptions.offerOnCreate);
+    EXPECT_EQ(sut.requestQueueFullPolicy, cpp2c::queueFullPolicy(cppOptions.requestQueueFullPolicy));
+    EXPECT_EQ(sut.clientTooSlowPolicy, cpp2c::consumerTooSlowPolicy(cppOptions.clientTooSlowPolicy));
+    EXPECT_TRUE(iox_server_options_is_initialized(&sut));
+}
+
+TEST(iox_server_options_test, serverOptionsInitializationCheckReturnsFalseWithoutInitialization)
+{
+    iox_server_options_t sut;
+    sut.initCheck = 0U;
+    EXPECT_FALSE(iox_server_options_is_initialized(&sut));
+    EXPECT_FALSE(iox_server_options_is_initialized(nullptr));
+}
+
+TEST_F(iox_client_server_test, initClientWithNullptrForStorageReturnsNullptr)
+{
+    EXPECT_EQ(iox_client_init(nullptr, "all", "glory", "hypnotoad", nullptr), nullptr);
+}
+
+TEST_F(iox_client_server_test, initServerWithNullptrForStorageReturnsNullptr)
+{
+    EXPECT_EQ(iox_server_init(nullptr, "all", "glory", "hypnotoad", nullptr), nullptr);
+}
+
+TEST_F(iox_client_server_test, clientConnectsToOfferedServer)
+{
+    createClientAndServer();
+
+    EXPECT_TRUE(iox_server_is_offered(m_server));
+    EXPECT_TRUE(iox_server_has_clients(m_server));
+    EXPECT_EQ(iox_client_get_connection_state(m_client), ConnectionState_CONNECTED);
+
+    destroyClientAndServer();
+}
+
+TEST_F(iox_client_server_test, clientWaitsForOfferWhenServerStopsOffer)
+{
+    createClientAndServer();
+
+    iox_server_stop_offer(m_server);
+    this->InterOpWait();
+
+    EXPECT_FALSE(iox_server_is_offered(m_server));
+    EXPECT_FALSE(iox_server_has_clients(m_server));
+    EXPECT_EQ(iox_client_get_connection_state(m_client), ConnectionState_WAIT_FOR_OFFER);
+
+    destroyClientAndServer();
+}
+
+TEST_F(iox_client_server_test, requestAndResponseAreTransferred)
+{
+    createClientAndServer();
+
+    void* requestPayload{nullptr};
+    ASSERT_EQ(iox_client_loan_request(m_client, &requestPayload, sizeof(uint64_t)), AllocationResult_SUCCESS);
+    *static_cast<uint64_t*>(requestPayload) = 42U;
+    iox_client_send(m_client, requestPayload);
+
+    EXPECT_TRUE(iox_server_has_requests(m_server));
+    const void* receivedRequestPayload{nullptr};
+    ASSERT_EQ(iox_server_take_request(m_server, &receivedRequestPayload), ChunkReceiveResult_SUCCESS);
+    EXPECT_EQ(*static_cast<const uint64_t*>(receivedRequestPayload), 42U);
+
+    void* responsePayload{nullptr};
+    ASSERT_EQ(iox_server_loan_response(m_server, receivedRequestPayload, &responsePayload, sizeof(uint64_t)),
+              AllocationResult_SUCCESS);
+    *static_cast<uint64_t*>(responsePayload) = 73U;
+    iox_server_send(m_server, responsePayload);
+    iox_server_release_request(m_server, receivedRequestPayload);
+
+    EXPECT_TRUE(iox_client_has_responses(m_client));
+    const void* receivedResponsePayload{nullptr};
+    ASSERT_EQ(iox_client_take_response(m_client, &receivedResponsePayload), ChunkReceiveResult_SUCCESS);
+    EXPECT_EQ(*static_cast<const uint64_t*>(receivedResponsePayload), 73U);
+    iox_client_release_response(m_client, receivedResponsePayload);
+
+    EXPECT_FALSE(iox_client_has_responses(m_client));
+    EXPECT_FALSE(iox_server_has_requests(m_server));
+
+    destroyClientAndServer();
+}
+
+TEST_F(iox_client_server_test, takeWithoutDataReturnsNoChunkAvailable)
+{
+    createClientAndServer();
+
+    const void* payload{nullptr};
+    EXPECT_EQ(iox_client_take_response(m_client, &payload), ChunkReceiveResult_NO_CHUNK_AVAILABLE);
+    EXPECT_EQ(iox_server_take_request(m_server, &payload), ChunkReceiveResult_NO_CHUNK_AVAILABLE);
+
+    destroyClientAndServer();
+}
+
+TEST_F(iox_client_server_test, waitSetIsTriggeredByRequestAndResponse)
+{
+    createClientAndServer();
+
+    iox_ws_storage_t waitSetStorage;
+    iox_ws_t waitSet = iox_ws_init(&waitSetStorage);
+    ASSERT_EQ(iox_ws_attach_server_state(waitSet, m_server, ServerState_HAS_REQUEST, 1U, nullptr),
+              WaitSetResult_SUCCESS);
+    ASSERT_EQ(iox_ws_attach_client_event(waitSet, m_client, ClientEvent_RESPONSE_RECEIVED, 2U, nullptr),
+              WaitSetResult_SUCCESS);
+
+    void* requestPayload{nullptr};
+    ASSERT_EQ(iox_client_loan_request(m_client, &requestPayload, sizeof(uint64_t)), AllocationResult_SUCCESS);
+    iox_client_send(m_client, requestPayload);
+
+    iox_notification_info_t notificationInfo[2];
+    uint64_t missedElements{0U};
+    struct timespec timeout = {1, 0};
+    ASSERT_EQ(iox_ws_timed_wait(waitSet, timeout, notificationInfo, 2U, &missedElements), 1U);
+    EXPECT_TRUE(iox_notification_info_does_originate_from_server(notificationInfo[0], m_server));
+    EXPECT_EQ(iox_notification_info_get_server_origin(notificationInfo[0]), m_server);
+
+    const void* receivedRequestPayload{nullptr};
+    ASSERT_EQ(iox_server_take_request(m_server, &receivedRequestPayload), ChunkReceiveResult_SUCCESS);
+    void* responsePayload{nullptr};
+    ASSERT_EQ(iox_server_loan_response(m_server, receivedRequestPayload, &responsePayload, sizeof(uint64_t)),
+              AllocationResult_SUCCESS);
+    iox_server_send(m_server, responsePayload);
+    iox_server_release_request(m_server, receivedRequestPayload);
+
+    ASSERT_EQ(iox_ws_timed_wait(waitSet, timeout, notificationInfo, 2U, &missedElements), 1U);
+    EXPECT_TRUE(iox_notification_info_does_originate_from_client(notificationInfo[0], m_client));
+    EXPECT_EQ(iox_notification_info_get_client_origin(notificationInfo[0]), m_client);
+
+    iox_ws_detach_server_state(waitSet, m_server, ServerState_HAS_REQUEST);
+    iox_ws_detach_client_event(waitSet, m_client, ClientEvent_RESPONSE_RECEIVED);
+    EXPECT_EQ(iox_ws_size(waitSet), 0U);
+    iox_ws_deinit(waitSet);
+
+    destroyClientAndServer();
+}
+
+} // namespace
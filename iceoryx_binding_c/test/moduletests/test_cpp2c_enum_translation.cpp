@@ -242,4 +242,71 @@ TEST(cpp2c_enum_translation_test, QueueFullPolicy)
 #pragma GCC diagnostic pop
 }
 
+TEST(cpp2c_enum_translation_test, QueueFullPolicy2)
+{
+    EXPECT_EQ(cpp2c::queueFullPolicy(iox::popo::QueueFullPolicy2::BLOCK_PRODUCER), QueueFullPolicy_BLOCK_PUBLISHER);
+    EXPECT_EQ(cpp2c::queueFullPolicy(iox::popo::QueueFullPolicy2::DISCARD_OLDEST_DATA),
+              QueueFullPolicy_DISCARD_OLDEST_DATA);
+    // ignore the warning since we would like to test the behavior of an invalid enum value
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+    EXPECT_EQ(cpp2c::queueFullPolicy(static_cast<iox::popo::QueueFullPolicy2>(-1)),
+              QueueFullPolicy_DISCARD_OLDEST_DATA);
+#pragma GCC diagnostic pop
+}
+
+TEST(cpp2c_enum_translation_test, ConsumerTooSlowPolicy)
+{
+    EXPECT_EQ(cpp2c::consumerTooSlowPolicy(iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER),
+              ConsumerTooSlowPolicy_WAIT_FOR_CONSUMER);
+    EXPECT_EQ(cpp2c::consumerTooSlowPolicy(iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA),
+              ConsumerTooSlowPolicy_DISCARD_OLDEST_DATA);
+    // ignore the warning since we would like to test the behavior of an invalid enum value
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+    EXPECT_EQ(cpp2c::consumerTooSlowPolicy(static_cast<iox::popo::ConsumerTooSlowPolicy>(-1)),
+              ConsumerTooSlowPolicy_DISCARD_OLDEST_DATA);
+#pragma GCC diagnostic pop
+}
+
+TEST(cpp2c_enum_translation_test, ConnectionStateCorrectAndFullTranslation)
+{
+    constexpr EnumMapping<iox::ConnectionState, iox_ConnectionState> CONNECTION_STATES[]{
+        {iox::ConnectionState::NOT_CONNECTED, ConnectionState_NOT_CONNECTED},
+        {iox::ConnectionState::CONNECT_REQUESTED, ConnectionState_CONNECT_REQUESTED},
+        {iox::ConnectionState::CONNECTED, ConnectionState_CONNECTED},
+        {iox::ConnectionState::DISCONNECT_REQUESTED, ConnectionState_DISCONNECT_REQUESTED},
+        {iox::ConnectionState::WAIT_FOR_OFFER, ConnectionState_WAIT_FOR_OFFER}};
+
+    for (const auto connectionState : CONNECTION_STATES)
+    {
+        switch (connectionState.cpp)
+        {
+        case iox::ConnectionState::NOT_CONNECTED:
+            EXPECT_EQ(cpp2c::connectionState(connectionState.cpp), connectionState.c);
+            break;
+        case iox::ConnectionState::CONNECT_REQUESTED:
+            EXPECT_EQ(cpp2c::connectionState(connectionState.cpp), connectionState.c);
+            break;
+        case iox::ConnectionState::CONNECTED:
+            EXPECT_EQ(cpp2c::connectionState(connectionState.cpp), connectionState.c);
+            break;
+        case iox::ConnectionState::DISCONNECT_REQUESTED:
+            EXPECT_EQ(cpp2c::connectionState(connectionState.cpp), connectionState.c);
+            break;
+        case iox::ConnectionState::WAIT_FOR_OFFER:
+            EXPECT_EQ(cpp2c::connectionState(connectionState.cpp), connectionState.c);
+            break;
+            // default intentionally left out in order to get a compiler warning if the enum gets extended and we forgot
+            // to extend the test
+        }
+    }
+
+    // ignore the warning since we would like to test the behavior of an invalid enum value
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+    EXPECT_EQ(cpp2c::connectionState(static_cast<iox::ConnectionState>(-1)), ConnectionState_UNDEFINED_ERROR);
+#pragma GCC diagnostic pop
+}
+
 } // namespace
@@ -321,6 +321,80 @@ TEST_F(iox_pub_test, sendDeliversChunk)
     EXPECT_TRUE(static_cast<DummySample*>(maybeSharedChunk->getUserPayload())->dummy == 4711);
 }
 
+TEST_F(iox_pub_test, loanChunksAcquiresRequestedNumberOfChunks)
+{
+    constexpr uint32_t NUMBER_OF_CHUNKS{3U};
+    void* chunks[NUMBER_OF_CHUNKS] = {nullptr, nullptr, nullptr};
+    uint32_t numberOfLoanedChunks{0U};
+    EXPECT_EQ(AllocationResult_SUCCESS,
+              iox_pub_loan_chunks(&m_sut,
+                                  chunks,
+                                  NUMBER_OF_CHUNKS,
+                                  100U,
+                                  IOX_C_CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                                  IOX_C_CHUNK_NO_USER_HEADER_SIZE,
+                                  IOX_C_CHUNK_NO_USER_HEADER_ALIGNMENT,
+                                  &numberOfLoanedChunks));
+
+    EXPECT_THAT(numberOfLoanedChunks, Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUMBER_OF_CHUNKS));
+    for (auto chunk : chunks)
+    {
+        EXPECT_NE(chunk, nullptr);
+    }
+}
+
+TEST_F(iox_pub_test, loanChunksStopsWhenHoldingToManyChunksInParallel)
+{
+    constexpr uint32_t NUMBER_OF_CHUNKS{iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY + 1U};
+    void* chunks[NUMBER_OF_CHUNKS];
+    uint32_t numberOfLoanedChunks{0U};
+    EXPECT_EQ(AllocationResult_SUCCESS,
+              iox_pub_loan_chunks(&m_sut,
+                                  chunks,
+                                  NUMBER_OF_CHUNKS,
+                                  100U,
+                                  IOX_C_CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                                  IOX_C_CHUNK_NO_USER_HEADER_SIZE,
+                                  IOX_C_CHUNK_NO_USER_HEADER_ALIGNMENT,
+                                  &numberOfLoanedChunks));
+
+    EXPECT_THAT(numberOfLoanedChunks, Eq(iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY));
+}
+
+TEST_F(iox_pub_test, publishChunksDeliversAllChunksInOrder)
+{
+    constexpr uint32_t NUMBER_OF_CHUNKS{3U};
+    void* chunks[NUMBER_OF_CHUNKS];
+    uint32_t numberOfLoanedChunks{0U};
+    iox_pub_offer(&m_sut);
+    this->Subscribe(&m_publisherPortData);
+    ASSERT_EQ(AllocationResult_SUCCESS,
+              iox_pub_loan_chunks(&m_sut,
+                                  chunks,
+                                  NUMBER_OF_CHUNKS,
+                                  sizeof(DummySample),
+                                  IOX_C_CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                                  IOX_C_CHUNK_NO_USER_HEADER_SIZE,
+                                  IOX_C_CHUNK_NO_USER_HEADER_ALIGNMENT,
+                                  &numberOfLoanedChunks));
+    ASSERT_THAT(numberOfLoanedChunks, Eq(NUMBER_OF_CHUNKS));
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        static_cast<DummySample*>(chunks[i])->dummy = 4711U + i;
+    }
+    iox_pub_publish_chunks(&m_sut, chunks, NUMBER_OF_CHUNKS);
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> m_chunkQueuePopper(&m_chunkQueueData);
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = m_chunkQueuePopper.tryPop();
+        ASSERT_TRUE(maybeSharedChunk.has_value());
+        EXPECT_TRUE(*maybeSharedChunk == chunks[i]);
+        EXPECT_THAT(static_cast<DummySample*>(maybeSharedChunk->getUserPayload())->dummy, Eq(4711U + i));
+    }
+}
+
 TEST_F(iox_pub_test, correctServiceDescriptionReturned)
 {
     auto serviceDescription = iox_pub_get_service_description(&m_sut);
@@ -268,6 +268,62 @@ TEST_F(iox_sub_test, receiveChunkWhenToManyChunksAreHold)
     EXPECT_EQ(iox_sub_take_chunk(m_sut, &chunk), ChunkReceiveResult_TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
 }
 
+TEST_F(iox_sub_test, initialStateNoChunksAvailableWithTakeChunks)
+{
+    const void* chunks[2U] = {nullptr, nullptr};
+    uint64_t numberOfChunks{1U};
+    EXPECT_EQ(iox_sub_take_chunks(m_sut, chunks, 2U, &numberOfChunks), ChunkReceiveResult_NO_CHUNK_AVAILABLE);
+    EXPECT_THAT(numberOfChunks, Eq(0U));
+}
+
+TEST_F(iox_sub_test, takeChunksReceivesChunksInOrderUpToMax)
+{
+    this->Subscribe(&m_portPtr);
+    struct data_t
+    {
+        int value;
+    };
+
+    constexpr uint64_t NUMBER_OF_PUSHED_CHUNKS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_PUSHED_CHUNKS; ++i)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        static_cast<data_t*>(sharedChunk.getUserPayload())->value = static_cast<int>(i);
+        m_chunkPusher.push(sharedChunk);
+    }
+
+    const void* chunks[NUMBER_OF_PUSHED_CHUNKS] = {nullptr, nullptr, nullptr};
+    uint64_t numberOfChunks{0U};
+    ASSERT_EQ(iox_sub_take_chunks(m_sut, chunks, 2U, &numberOfChunks), ChunkReceiveResult_SUCCESS);
+    ASSERT_THAT(numberOfChunks, Eq(2U));
+    ASSERT_EQ(iox_sub_take_chunks(m_sut, &chunks[2U], 2U, &numberOfChunks), ChunkReceiveResult_SUCCESS);
+    ASSERT_THAT(numberOfChunks, Eq(1U));
+
+    for (uint64_t i = 0U; i < NUMBER_OF_PUSHED_CHUNKS; ++i)
+    {
+        EXPECT_THAT(static_cast<const data_t*>(chunks[i])->value, Eq(static_cast<int>(i)));
+        iox_sub_release_chunk(m_sut, chunks[i]);
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(iox_sub_test, takeChunksWhenToManyChunksAreHold)
+{
+    this->Subscribe(&m_portPtr);
+    const void* chunk = nullptr;
+    for (uint64_t i = 0U; i < MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY + 1U; ++i)
+    {
+        m_chunkPusher.push(getChunkFromMemoryManager());
+        iox_sub_take_chunk(m_sut, &chunk);
+    }
+
+    m_chunkPusher.push(getChunkFromMemoryManager());
+    uint64_t numberOfChunks{1U};
+    EXPECT_EQ(iox_sub_take_chunks(m_sut, &chunk, 1U, &numberOfChunks),
+              ChunkReceiveResult_TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+    EXPECT_THAT(numberOfChunks, Eq(0U));
+}
+
 TEST_F(iox_sub_test, releaseChunkWorks)
 {
     this->Subscribe(&m_portPtr);
@@ -15,7 +15,9 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include "iceoryx_binding_c/internal/cpp2c_client.hpp"
 #include "iceoryx_binding_c/internal/cpp2c_publisher.hpp"
+#include "iceoryx_binding_c/internal/cpp2c_server.hpp"
 #include "iceoryx_binding_c/internal/cpp2c_subscriber.hpp"
 #include "iceoryx_posh/popo/listener.hpp"
 #include "iceoryx_posh/popo/user_trigger.hpp"
@@ -64,4 +66,16 @@ TEST(iox_types_test, cpp2c_PublisherStorageSizeFits)
     EXPECT_THAT(alignof(cpp2c_Publisher), Le(alignof(iox_pub_storage_t)));
 }
 
+TEST(iox_types_test, cpp2c_ClientStorageSizeFits)
+{
+    EXPECT_THAT(sizeof(cpp2c_Client), Le(sizeof(iox_client_storage_t)));
+    EXPECT_THAT(alignof(cpp2c_Client), Le(alignof(iox_client_storage_t)));
+}
+
+TEST(iox_types_test, cpp2c_ServerStorageSizeFits)
+{
+    EXPECT_THAT(sizeof(cpp2c_Server), Le(sizeof(iox_server_storage_t)));
+    EXPECT_THAT(alignof(cpp2c_Server), Le(alignof(iox_server_storage_t)));
+}
+
 } // namespace
@@ -687,4 +687,44 @@ TEST_F(iox_ws_test, UserTriggerCallbackWithContextDataIsCalled)
     EXPECT_THAT(m_contextData, Eq(&someContextData));
 }
 
+TEST_F(iox_ws_test, WaitStatisticsAreZeroAfterConstruction)
+{
+    uint64_t spinHits{1U};
+    uint64_t sleeps{1U};
+    iox_ws_get_wait_statistics(m_sut, &spinHits, &sleeps);
+
+    EXPECT_THAT(spinHits, Eq(0U));
+    EXPECT_THAT(sleeps, Eq(0U));
+}
+
+TEST_F(iox_ws_test, TimedWaitWithoutBusyPollIsCountedAsSleep)
+{
+    iox_ws_timed_wait(m_sut, m_timeout, m_eventInfoStorage, MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET, &m_missedElements);
+
+    uint64_t spinHits{0U};
+    uint64_t sleeps{0U};
+    iox_ws_get_wait_statistics(m_sut, &spinHits, &sleeps);
+    EXPECT_THAT(spinHits, Eq(0U));
+    EXPECT_THAT(sleeps, Eq(1U));
+}
+
+TEST_F(iox_ws_test, NotificationDuringBusyPollIsCountedAsSpinHit)
+{
+    iox_ws_attach_user_trigger_event(m_sut, m_userTrigger[0U], 0U, userTriggerCallback);
+    iox_ws_set_busy_poll_duration(m_sut, {10, 0});
+
+    std::thread t([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        iox_user_trigger_trigger(m_userTrigger[0U]);
+    });
+    EXPECT_EQ(iox_ws_wait(m_sut, m_eventInfoStorage, MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET, &m_missedElements), 1U);
+    t.join();
+
+    uint64_t spinHits{0U};
+    uint64_t sleeps{0U};
+    iox_ws_get_wait_statistics(m_sut, &spinHits, &sleeps);
+    EXPECT_THAT(spinHits, Eq(1U));
+    EXPECT_THAT(sleeps, Eq(0U));
+}
+
 } // namespace
@@ -33,20 +33,30 @@ void IcePerfBase::releaseFollower() noexcept
     sendPerfTopic(sizeof(PerfTopic), RunFlag::STOP);
 }
 
-iox::units::Duration IcePerfBase::latencyPerfTestLeader(const uint64_t numRoundTrips) noexcept
+iox::units::Duration IcePerfBase::latencyPerfTestLeader(const uint64_t numRoundTrips,
+                                                        LatencyHistogram& histogram) noexcept
 {
+    constexpr uint64_t TRANSMISSIONS_PER_ROUNDTRIP{2U};
+
+    histogram.reset();
     auto start = std::chrono::high_resolution_clock::now();
+    auto roundTripStart = start;
 
     // run the performance test
     for (auto i = 0U; i < numRoundTrips; ++i)
     {
         auto perfTopic = receivePerfTopic();
         sendPerfTopic(perfTopic.payloadSize, RunFlag::RUN);
+
+        auto roundTripFinish = std::chrono::high_resolution_clock::now();
+        auto roundTripDuration = std::chrono::duration_cast<std::chrono::nanoseconds>(roundTripFinish - roundTripStart);
+        histogram.record(iox::units::Duration::fromNanoseconds(static_cast<uint64_t>(roundTripDuration.count())
+                                                               / TRANSMISSIONS_PER_ROUNDTRIP));
+        roundTripStart = roundTripFinish;
     }
 
-    auto finish = std::chrono::high_resolution_clock::now();
+    auto finish = roundTripStart;
 
-    constexpr uint64_t TRANSMISSIONS_PER_ROUNDTRIP{2U};
     auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start);
     auto latencyInNanoSeconds =
         (static_cast<uint64_t>(duration.count()) / (numRoundTrips * TRANSMISSIONS_PER_ROUNDTRIP));
@@ -18,6 +18,7 @@
 #define IOX_EXAMPLES_ICEPERF_BASE_HPP
 
 #include "example_common.hpp"
+#include "latency_histogram.hpp"
 #include "topic_data.hpp"
 
 #include "iceoryx_hoofs/internal/units/duration.hpp"
@@ -39,7 +40,12 @@ class IcePerfBase
     void preLatencyPerfTestLeader(const uint32_t payloadSizeInBytes) noexcept;
     void postLatencyPerfTestLeader() noexcept;
     void releaseFollower() noexcept;
-    iox::units::Duration latencyPerfTestLeader(const uint64_t numRoundTrips) noexcept;
+
+    /// @brief performs the ping pong with the follower
+    /// @param[in] numRoundTrips is the number of round trips to perform
+    /// @param[out] histogram records the latency of every single round trip
+    /// @return the average latency of a transmission
+    iox::units::Duration latencyPerfTestLeader(const uint64_t numRoundTrips, LatencyHistogram& histogram) noexcept;
     void latencyPerfTestFollower() noexcept;
 
   private:
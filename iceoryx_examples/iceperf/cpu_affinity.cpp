@@ -0,0 +1,48 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "cpu_affinity.hpp"
+
+#include "iceoryx_hoofs/platform/pthread.hpp"
+
+#include <cstring>
+#include <iostream>
+
+bool setCpuAffinity(const uint32_t cpu) noexcept
+{
+#ifdef __linux__
+    if (cpu >= CPU_SETSIZE)
+    {
+        std::cerr << "The CPU " << cpu << " exceeds the maximum of " << CPU_SETSIZE - 1 << "!" << std::endl;
+        return false;
+    }
+
+    // Create a cpu_set_t object representing a set of CPUs. Clear it and mark only cpu as set.
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(cpu, &cpuset);
+    auto retVal = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+    if (retVal != 0)
+    {
+        std::cerr << "Could not pin the thread to CPU " << cpu << ": " << strerror(retVal) << std::endl;
+        return false;
+    }
+    return true;
+#else
+    std::cerr << "Pinning a thread to CPU " << cpu << " is not supported on this platform!" << std::endl;
+    return false;
+#endif
+}
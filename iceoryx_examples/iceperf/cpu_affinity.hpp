@@ -0,0 +1,26 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_EXAMPLES_ICEPERF_CPU_AFFINITY_HPP
+#define IOX_EXAMPLES_ICEPERF_CPU_AFFINITY_HPP
+
+#include <cstdint>
+
+/// @brief Pins the calling thread to a CPU to get reproducible measurements
+/// @param[in] cpu is the CPU the thread shall run on
+/// @return true if the affinity was set, false if it failed or if it is not supported on the platform
+bool setCpuAffinity(const uint32_t cpu) noexcept;
+
+#endif // IOX_EXAMPLES_ICEPERF_CPU_AFFINITY_HPP
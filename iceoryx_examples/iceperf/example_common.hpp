@@ -29,10 +29,17 @@ enum class Technology
     ALL,
     ICEORYX_CPP_API,
     ICEORYX_C_API,
+    ICEORYX_CPP_RPC,
     POSIX_MESSAGE_QUEUE,
     UNIX_DOMAIN_SOCKET
 };
 
+enum class ExportFormat
+{
+    CSV,
+    JSON
+};
+
 enum class RunFlag
 {
     STOP,
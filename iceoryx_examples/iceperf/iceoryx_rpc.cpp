@@ -0,0 +1,129 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_rpc.hpp"
+
+#include <chrono>
+#include <thread>
+
+const iox::capro::ServiceDescription IceoryxRpc::SERVICE_DESCRIPTION{"IcePerf", "RPC", "C++-API"};
+
+void IceoryxRpc::initLeader() noexcept
+{
+    iox::popo::ClientOptions options;
+    options.responseQueueCapacity = 1U;
+    m_client.emplace(SERVICE_DESCRIPTION, options);
+
+    std::cout << "Waiting for: server" << std::flush;
+    while (m_client->getConnectionState() != iox::ConnectionState::CONNECTED)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::cout << " [ success ]" << std::endl;
+}
+
+void IceoryxRpc::initFollower() noexcept
+{
+    iox::popo::ServerOptions options;
+    options.requestQueueCapacity = 1U;
+    m_server.emplace(SERVICE_DESCRIPTION, options);
+
+    std::cout << "Waiting for: client" << std::flush;
+    while (!m_server->hasClients())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::cout << " [ success ]" << std::endl;
+}
+
+void IceoryxRpc::shutdown() noexcept
+{
+    if (m_client.has_value())
+    {
+        m_client->disconnect();
+        m_client.reset();
+    }
+
+    if (m_server.has_value())
+    {
+        // the request with the stop flag is not answered
+        if (m_pendingRequest != nullptr)
+        {
+            m_server->releaseRequest(m_pendingRequest);
+            m_pendingRequest = nullptr;
+        }
+        m_server->stopOffer();
+        m_server.reset();
+    }
+    std::cout << "Shutdown [ finished ]" << std::endl;
+}
+
+void IceoryxRpc::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept
+{
+    auto fillPerfTopic = [&](void* userPayload) {
+        auto sendSample = static_cast<PerfTopic*>(userPayload);
+        sendSample->payloadSize = payloadSizeInBytes;
+        sendSample->runFlag = runFlag;
+        sendSample->subPackets = 1;
+    };
+
+    if (m_client.has_value())
+    {
+        m_client->loan(payloadSizeInBytes, alignof(PerfTopic)).and_then([&](void* userPayload) {
+            fillPerfTopic(userPayload);
+            m_client->send(userPayload);
+        });
+        return;
+    }
+
+    m_server
+        ->loan(iox::popo::RequestHeader::fromPayload(m_pendingRequest), payloadSizeInBytes, alignof(PerfTopic))
+        .and_then([&](void* userPayload) {
+            fillPerfTopic(userPayload);
+            m_server->send(userPayload);
+        });
+    m_server->releaseRequest(m_pendingRequest);
+    m_pendingRequest = nullptr;
+}
+
+PerfTopic IceoryxRpc::receivePerfTopic() noexcept
+{
+    bool hasReceivedSample{false};
+    PerfTopic receivedSample;
+
+    do
+    {
+        if (m_client.has_value())
+        {
+            m_client->take().and_then([&](const void* userPayload) {
+                receivedSample = *(static_cast<const PerfTopic*>(userPayload));
+                hasReceivedSample = true;
+                m_client->releaseResponse(userPayload);
+            });
+        }
+        else
+        {
+            // the request is kept until the response is sent since the response is loaned with its RequestHeader
+            m_server->take().and_then([&](const void* userPayload) {
+                receivedSample = *(static_cast<const PerfTopic*>(userPayload));
+                hasReceivedSample = true;
+                m_pendingRequest = userPayload;
+            });
+        }
+    } while (!hasReceivedSample);
+
+    return receivedSample;
+}
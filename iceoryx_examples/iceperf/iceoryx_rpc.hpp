@@ -0,0 +1,46 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_EXAMPLES_ICEPERF_ICEORYX_RPC_HPP
+#define IOX_EXAMPLES_ICEPERF_ICEORYX_RPC_HPP
+
+#include "base.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_posh/popo/untyped_client.hpp"
+#include "iceoryx_posh/popo/untyped_server.hpp"
+
+/// @brief performs the ping pong with request and response, the leader is the client which sends the requests and
+/// the follower is the server which answers every request
+class IceoryxRpc : public IcePerfBase
+{
+  public:
+    void initLeader() noexcept override;
+    void initFollower() noexcept override;
+    void shutdown() noexcept override;
+
+  private:
+    void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept override;
+    PerfTopic receivePerfTopic() noexcept override;
+
+    static const iox::capro::ServiceDescription SERVICE_DESCRIPTION;
+
+    iox::cxx::optional<iox::popo::UntypedClient> m_client;
+    iox::cxx::optional<iox::popo::UntypedServer> m_server;
+    /// @brief the request which was taken last by the server and is answered with the next response
+    const void* m_pendingRequest{nullptr};
+};
+
+#endif // IOX_EXAMPLES_ICEPERF_ICEORYX_RPC_HPP
@@ -16,9 +16,11 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceperf_follower.hpp"
+#include "cpu_affinity.hpp"
 #include "iceoryx.hpp"
 #include "iceoryx_c.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_rpc.hpp"
 #include "mq.hpp"
 #include "topic_data.hpp"
 #include "uds.hpp"
@@ -84,6 +86,11 @@ int IcePerfFollower::run() noexcept
     m_settings = getSettings(settingsSubscriber);
     //! [get settings from leader]
 
+    if (m_settings.followerCpu != NO_CPU_AFFINITY && !setCpuAffinity(m_settings.followerCpu))
+    {
+        return EXIT_FAILURE;
+    }
+
     //! [create an run technologies]
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::POSIX_MESSAGE_QUEUE)
     {
@@ -119,6 +126,13 @@ int IcePerfFollower::run() noexcept
         IceoryxC iceoryxc(PUBLISHER, SUBSCRIBER);
         doMeasurement(iceoryxc);
     }
+
+    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_RPC)
+    {
+        std::cout << std::endl << "******   ICEORYX C++ RPC  ********" << std::endl;
+        IceoryxRpc iceoryxRpc;
+        doMeasurement(iceoryxRpc);
+    }
     //! [create an run technologies]
 
     return EXIT_SUCCESS;
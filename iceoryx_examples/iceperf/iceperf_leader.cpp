@@ -16,16 +16,19 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceperf_leader.hpp"
+#include "cpu_affinity.hpp"
 #include "iceoryx.hpp"
 #include "iceoryx_c.hpp"
 #include "iceoryx_hoofs/cxx/convert.hpp"
 #include "iceoryx_posh/popo/publisher.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_rpc.hpp"
 #include "mq.hpp"
 #include "topic_data.hpp"
 #include "uds.hpp"
 
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <vector>
@@ -36,8 +39,12 @@ constexpr const char PUBLISHER[]{"Leader"};
 constexpr const char SUBSCRIBER[]{"Follower"};
 //! [use constants instead of magic values]
 
-IcePerfLeader::IcePerfLeader(const PerfSettings settings) noexcept
+IcePerfLeader::IcePerfLeader(const PerfSettings settings,
+                             const std::string& exportFile,
+                             const ExportFormat exportFormat) noexcept
     : m_settings(settings)
+    , m_exportFile(exportFile)
+    , m_exportFormat(exportFormat)
 {
     //! [cleanup outdated resources]
 #ifndef __APPLE__
@@ -48,11 +55,12 @@ IcePerfLeader::IcePerfLeader(const PerfSettings settings) noexcept
 }
 
 //! [do the measurement for a single technology]
-void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology) noexcept
+void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology, const std::string& technology) noexcept
 {
     ipcTechnology.initLeader();
 
-    std::vector<std::tuple<uint32_t, iox::units::Duration>> latencyMeasurements;
+    std::vector<LatencyResult> latencyMeasurements;
+    LatencyHistogram histogram;
     const std::vector<uint32_t> payloadSizesInKB{1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096};
     std::cout << "Measurement for:";
     const char* separator = " ";
@@ -64,9 +72,18 @@ void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology) noexcept
 
         ipcTechnology.preLatencyPerfTestLeader(payloadSizeInBytes);
 
-        auto latency = ipcTechnology.latencyPerfTestLeader(m_settings.numberOfSamples);
+        auto latency = ipcTechnology.latencyPerfTestLeader(m_settings.numberOfSamples, histogram);
 
-        latencyMeasurements.push_back(std::make_tuple(payloadSizeInKB, latency));
+        LatencyResult result;
+        result.technology = technology;
+        result.payloadSizeInKB = payloadSizeInKB;
+        result.average = latency;
+        result.p50 = histogram.percentile(50.0);
+        result.p99 = histogram.percentile(99.0);
+        result.p99_9 = histogram.percentile(99.9);
+        result.max = histogram.max();
+        result.jitter = histogram.standardDeviation();
+        latencyMeasurements.push_back(result);
 
         ipcTechnology.postLatencyPerfTestLeader();
     }
@@ -76,20 +93,31 @@ void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology) noexcept
 
     ipcTechnology.shutdown();
 
+    auto toMicroseconds = [](const iox::units::Duration duration) {
+        return static_cast<double>(duration.toNanoseconds()) / 1000.0;
+    };
+
     std::cout << std::endl;
     std::cout << "#### Measurement Result ####" << std::endl;
     std::cout << m_settings.numberOfSamples << " round trips for each payload." << std::endl;
     std::cout << std::endl;
-    std::cout << "| Payload Size [kB] | Average Latency [µs] |" << std::endl;
-    std::cout << "|------------------:|---------------------:|" << std::endl;
-    for (const auto& latencyMeasuement : latencyMeasurements)
+    std::cout << "| Payload Size [kB] | Average Latency [µs] "
+              << "| p50 [µs] | p99 [µs] | p99.9 [µs] |  Max [µs] | Jitter [µs] |" << std::endl;
+    std::cout << "|------------------:|---------------------:"
+              << "|---------:|---------:|-----------:|----------:|------------:|" << std::endl;
+    for (const auto& latencyMeasurement : latencyMeasurements)
     {
-        auto payloadSizeInKB = std::get<0>(latencyMeasuement);
-        auto latencyInMicroseconds = static_cast<double>(std::get<1>(latencyMeasuement).toNanoseconds()) / 1000.0;
-        std::cout << "| " << std::setw(17) << payloadSizeInKB << " | " << std::setw(20) << std::setprecision(2)
-                  << latencyInMicroseconds << " |" << std::endl;
+        std::cout << std::fixed << std::setprecision(2) << "| " << std::setw(17) << latencyMeasurement.payloadSizeInKB
+                  << " | " << std::setw(20) << toMicroseconds(latencyMeasurement.average) << " | " << std::setw(8)
+                  << toMicroseconds(latencyMeasurement.p50) << " | " << std::setw(8)
+                  << toMicroseconds(latencyMeasurement.p99) << " | " << std::setw(10)
+                  << toMicroseconds(latencyMeasurement.p99_9) << " | " << std::setw(9)
+                  << toMicroseconds(latencyMeasurement.max) << " | " << std::setw(11)
+                  << toMicroseconds(latencyMeasurement.jitter) << " |" << std::endl;
     }
 
+    m_results.insert(m_results.end(), latencyMeasurements.begin(), latencyMeasurements.end());
+
     std::cout << std::endl;
     std::cout << "Finished!" << std::endl;
 }
@@ -100,6 +128,11 @@ int IcePerfLeader::run() noexcept
 {
     iox::runtime::PoshRuntime::initRuntime(APP_NAME);
 
+    if (m_settings.leaderCpu != NO_CPU_AFFINITY && !setCpuAffinity(m_settings.leaderCpu))
+    {
+        return EXIT_FAILURE;
+    }
+
     //! [send setting to follower application]
     iox::capro::ServiceDescription serviceDescription{"IcePerf", "Settings", "Generic"};
     iox::popo::PublisherOptions options;
@@ -118,7 +151,7 @@ int IcePerfLeader::run() noexcept
 #ifndef __APPLE__
         std::cout << std::endl << "******   MESSAGE QUEUE    ********" << std::endl;
         MQ mq(PUBLISHER, SUBSCRIBER);
-        doMeasurement(mq);
+        doMeasurement(mq, "posix-message-queue");
 #else
         if (m_settings.technology == Technology::POSIX_MESSAGE_QUEUE)
         {
@@ -131,24 +164,96 @@ int IcePerfLeader::run() noexcept
     {
         std::cout << std::endl << "****** UNIX DOMAIN SOCKET ********" << std::endl;
         UDS uds(PUBLISHER, SUBSCRIBER);
-        doMeasurement(uds);
+        doMeasurement(uds, "unix-domain-sockets");
     }
 
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_API)
     {
         std::cout << std::endl << "******      ICEORYX       ********" << std::endl;
         Iceoryx iceoryx(PUBLISHER, SUBSCRIBER);
-        doMeasurement(iceoryx);
+        doMeasurement(iceoryx, "iceoryx-cpp-api");
     }
 
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_C_API)
     {
         std::cout << std::endl << "******   ICEORYX C API    ********" << std::endl;
         IceoryxC iceoryxc(PUBLISHER, SUBSCRIBER);
-        doMeasurement(iceoryxc);
+        doMeasurement(iceoryxc, "iceoryx-c-api");
+    }
+
+    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_RPC)
+    {
+        std::cout << std::endl << "******   ICEORYX C++ RPC  ********" << std::endl;
+        IceoryxRpc iceoryxRpc;
+        doMeasurement(iceoryxRpc, "iceoryx-cpp-rpc");
     }
     //! [create an run technologies]
 
+    if (!m_exportFile.empty() && !exportResults())
+    {
+        return EXIT_FAILURE;
+    }
+
     return EXIT_SUCCESS;
 }
 //! [run all technologies]
+
+bool IcePerfLeader::exportResults() const noexcept
+{
+    std::ofstream stream(m_exportFile);
+    if (!stream)
+    {
+        std::cerr << "Could not open '" << m_exportFile << "' to export the results!" << std::endl;
+        return false;
+    }
+
+    switch (m_exportFormat)
+    {
+    case ExportFormat::CSV:
+        exportAsCsv(stream);
+        break;
+    case ExportFormat::JSON:
+        exportAsJson(stream);
+        break;
+    }
+
+    if (!stream)
+    {
+        std::cerr << "Could not write the results to '" << m_exportFile << "'!" << std::endl;
+        return false;
+    }
+    std::cout << "Results exported to '" << m_exportFile << "'" << std::endl;
+    return true;
+}
+
+void IcePerfLeader::exportAsCsv(std::ostream& stream) const noexcept
+{
+    stream << "technology,payload_size_kb,round_trips,average_ns,p50_ns,p99_ns,p99_9_ns,max_ns,jitter_ns" << std::endl;
+    for (const auto& result : m_results)
+    {
+        stream << result.technology << "," << result.payloadSizeInKB << "," << m_settings.numberOfSamples << ","
+               << result.average.toNanoseconds() << "," << result.p50.toNanoseconds() << ","
+               << result.p99.toNanoseconds() << "," << result.p99_9.toNanoseconds() << ","
+               << result.max.toNanoseconds() << "," << result.jitter.toNanoseconds() << std::endl;
+    }
+}
+
+void IcePerfLeader::exportAsJson(std::ostream& stream) const noexcept
+{
+    stream << "{" << std::endl;
+    stream << "  \"roundTrips\": " << m_settings.numberOfSamples << "," << std::endl;
+    stream << "  \"results\": [";
+    const char* separator = "";
+    for (const auto& result : m_results)
+    {
+        stream << separator << std::endl;
+        stream << "    {\"technology\": \"" << result.technology << "\", \"payloadSizeKB\": " << result.payloadSizeInKB
+               << ", \"averageNs\": " << result.average.toNanoseconds() << ", \"p50Ns\": " << result.p50.toNanoseconds()
+               << ", \"p99Ns\": " << result.p99.toNanoseconds() << ", \"p99_9Ns\": " << result.p99_9.toNanoseconds()
+               << ", \"maxNs\": " << result.max.toNanoseconds() << ", \"jitterNs\": " << result.jitter.toNanoseconds()
+               << "}";
+        separator = ",";
+    }
+    stream << std::endl << "  ]" << std::endl;
+    stream << "}" << std::endl;
+}
@@ -22,18 +22,45 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 
+#include <string>
+#include <vector>
+
 class IcePerfLeader
 {
   public:
-    IcePerfLeader(const PerfSettings settings) noexcept;
+    /// @brief creates the leader application
+    /// @param[in] settings for the measurement, which are also sent to the follower
+    /// @param[in] exportFile to which the results of all technologies are written, nothing is exported if it is empty
+    /// @param[in] exportFormat of the exportFile
+    IcePerfLeader(const PerfSettings settings,
+                  const std::string& exportFile = "",
+                  const ExportFormat exportFormat = ExportFormat::CSV) noexcept;
 
     int run() noexcept;
 
   private:
-    void doMeasurement(IcePerfBase& ipcTechnology) noexcept;
+    struct LatencyResult
+    {
+        std::string technology;
+        uint32_t payloadSizeInKB{0U};
+        iox::units::Duration average{iox::units::Duration::fromNanoseconds(0U)};
+        iox::units::Duration p50{iox::units::Duration::fromNanoseconds(0U)};
+        iox::units::Duration p99{iox::units::Duration::fromNanoseconds(0U)};
+        iox::units::Duration p99_9{iox::units::Duration::fromNanoseconds(0U)};
+        iox::units::Duration max{iox::units::Duration::fromNanoseconds(0U)};
+        iox::units::Duration jitter{iox::units::Duration::fromNanoseconds(0U)};
+    };
+
+    void doMeasurement(IcePerfBase& ipcTechnology, const std::string& technology) noexcept;
+    bool exportResults() const noexcept;
+    void exportAsCsv(std::ostream& stream) const noexcept;
+    void exportAsJson(std::ostream& stream) const noexcept;
 
   private:
     const PerfSettings m_settings;
+    const std::string m_exportFile;
+    const ExportFormat m_exportFormat;
+    std::vector<LatencyResult> m_results;
 };
 
 #endif // IOX_EXAMPLES_ICEPERF_LEADER_HPP
@@ -0,0 +1,135 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+constexpr uint64_t LatencyHistogram::SUB_BUCKET_BITS;
+constexpr uint64_t LatencyHistogram::SUB_BUCKET_COUNT;
+constexpr uint64_t LatencyHistogram::SUB_BUCKET_HALF_COUNT;
+constexpr uint64_t LatencyHistogram::MAX_SHIFT;
+constexpr uint64_t LatencyHistogram::BUCKET_COUNT;
+
+LatencyHistogram::LatencyHistogram() noexcept
+    : m_buckets(BUCKET_COUNT, 0U)
+{
+}
+
+void LatencyHistogram::record(const iox::units::Duration latency) noexcept
+{
+    const auto nanoseconds = latency.toNanoseconds();
+
+    ++m_buckets[bucketIndex(nanoseconds)];
+
+    m_min = (m_count == 0U) ? nanoseconds : std::min(m_min, nanoseconds);
+    m_max = std::max(m_max, nanoseconds);
+
+    // Welford's algorithm to avoid the loss of precision of a sum of squares
+    ++m_count;
+    const auto value = static_cast<double>(nanoseconds);
+    const auto delta = value - m_mean;
+    m_mean += delta / static_cast<double>(m_count);
+    m_sumOfSquaredDeviations += delta * (value - m_mean);
+}
+
+void LatencyHistogram::reset() noexcept
+{
+    std::fill(m_buckets.begin(), m_buckets.end(), 0U);
+    m_count = 0U;
+    m_min = 0U;
+    m_max = 0U;
+    m_mean = 0.0;
+    m_sumOfSquaredDeviations = 0.0;
+}
+
+uint64_t LatencyHistogram::count() const noexcept
+{
+    return m_count;
+}
+
+iox::units::Duration LatencyHistogram::min() const noexcept
+{
+    return iox::units::Duration::fromNanoseconds(m_min);
+}
+
+iox::units::Duration LatencyHistogram::max() const noexcept
+{
+    return iox::units::Duration::fromNanoseconds(m_max);
+}
+
+iox::units::Duration LatencyHistogram::mean() const noexcept
+{
+    return iox::units::Duration::fromNanoseconds(static_cast<uint64_t>(std::llround(m_mean)));
+}
+
+iox::units::Duration LatencyHistogram::standardDeviation() const noexcept
+{
+    if (m_count == 0U)
+    {
+        return iox::units::Duration::fromNanoseconds(0U);
+    }
+    const auto variance = m_sumOfSquaredDeviations / static_cast<double>(m_count);
+    return iox::units::Duration::fromNanoseconds(static_cast<uint64_t>(std::llround(std::sqrt(variance))));
+}
+
+iox::units::Duration LatencyHistogram::percentile(const double percentile) const noexcept
+{
+    if (m_count == 0U)
+    {
+        return iox::units::Duration::fromNanoseconds(0U);
+    }
+
+    const auto clampedPercentile = std::min(std::max(percentile, 0.0), 100.0);
+    auto rank = static_cast<uint64_t>(std::ceil(clampedPercentile / 100.0 * static_cast<double>(m_count)));
+    rank = std::min(std::max(rank, static_cast<uint64_t>(1U)), m_count);
+
+    uint64_t accumulatedCount{0U};
+    for (uint64_t index = 0U; index < BUCKET_COUNT; ++index)
+    {
+        accumulatedCount += m_buckets[index];
+        if (accumulatedCount >= rank)
+        {
+            return iox::units::Duration::fromNanoseconds(std::min(highestValueInBucket(index), m_max));
+        }
+    }
+
+    return max();
+}
+
+uint64_t LatencyHistogram::bucketIndex(const uint64_t nanoseconds) noexcept
+{
+    // find the smallest shift which brings the value into the sub-bucket range; for all shifts larger than 0 the
+    // shifted value is in the upper half of the sub-bucket range, therefore only the upper half needs to be stored
+    uint64_t shift{0U};
+    while ((nanoseconds >> shift) >= SUB_BUCKET_COUNT)
+    {
+        ++shift;
+    }
+    return shift * SUB_BUCKET_HALF_COUNT + (nanoseconds >> shift);
+}
+
+uint64_t LatencyHistogram::highestValueInBucket(const uint64_t bucketIndex) noexcept
+{
+    if (bucketIndex < SUB_BUCKET_COUNT)
+    {
+        return bucketIndex;
+    }
+    const uint64_t shift = bucketIndex / SUB_BUCKET_HALF_COUNT - 1U;
+    const uint64_t subBucket = bucketIndex - shift * SUB_BUCKET_HALF_COUNT;
+    return ((subBucket + 1U) << shift) - 1U;
+}
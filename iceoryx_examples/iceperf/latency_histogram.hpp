@@ -0,0 +1,72 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_EXAMPLES_ICEPERF_LATENCY_HISTOGRAM_HPP
+#define IOX_EXAMPLES_ICEPERF_LATENCY_HISTOGRAM_HPP
+
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+
+#include <cstdint>
+#include <vector>
+
+/// @brief HDR style histogram which records latencies without storing every single value. Latencies below 128 ns
+/// are recorded exactly, larger latencies are recorded in buckets whose width doubles with every power of two, which
+/// keeps the relative error below 1/64 over the whole range.
+class LatencyHistogram
+{
+  public:
+    LatencyHistogram() noexcept;
+
+    /// @brief records a single latency
+    void record(const iox::units::Duration latency) noexcept;
+
+    /// @brief removes all recorded latencies
+    void reset() noexcept;
+
+    /// @brief returns the number of recorded latencies
+    uint64_t count() const noexcept;
+
+    iox::units::Duration min() const noexcept;
+    iox::units::Duration max() const noexcept;
+    iox::units::Duration mean() const noexcept;
+
+    /// @brief the standard deviation of the recorded latencies, i.e. the jitter
+    iox::units::Duration standardDeviation() const noexcept;
+
+    /// @brief returns the latency below or equal to which the given percentage of the recorded latencies is
+    /// @param[in] percentile in the range from 0.0 to 100.0
+    /// @note the result is the upper bound of the bucket which contains the percentile but never more than the max
+    iox::units::Duration percentile(const double percentile) const noexcept;
+
+  private:
+    static uint64_t bucketIndex(const uint64_t nanoseconds) noexcept;
+    static uint64_t highestValueInBucket(const uint64_t bucketIndex) noexcept;
+
+  private:
+    static constexpr uint64_t SUB_BUCKET_BITS{7U};
+    static constexpr uint64_t SUB_BUCKET_COUNT{1U << SUB_BUCKET_BITS};
+    static constexpr uint64_t SUB_BUCKET_HALF_COUNT{SUB_BUCKET_COUNT / 2U};
+    static constexpr uint64_t MAX_SHIFT{64U - SUB_BUCKET_BITS};
+    static constexpr uint64_t BUCKET_COUNT{MAX_SHIFT * SUB_BUCKET_HALF_COUNT + SUB_BUCKET_COUNT};
+
+    std::vector<uint64_t> m_buckets;
+    uint64_t m_count{0U};
+    uint64_t m_min{0U};
+    uint64_t m_max{0U};
+    double m_mean{0.0};
+    double m_sumOfSquaredDeviations{0.0};
+};
+
+#endif // IOX_EXAMPLES_ICEPERF_LATENCY_HISTOGRAM_HPP
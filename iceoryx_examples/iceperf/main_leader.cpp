@@ -24,19 +24,26 @@
 
 #include <cstring>
 #include <iostream>
+#include <string>
 
 int main(int argc, char* argv[])
 {
     PerfSettings settings;
+    std::string exportFile;
+    ExportFormat exportFormat{ExportFormat::CSV};
 
     constexpr option longOptions[] = {{"help", no_argument, nullptr, 'h'},
                                       {"benchmark", required_argument, nullptr, 'b'},
                                       {"technology", required_argument, nullptr, 't'},
-                                      {"number-of-samples", required_argument, nullptr, 't'},
+                                      {"number-of-samples", required_argument, nullptr, 'n'},
+                                      {"leader-cpu", required_argument, nullptr, 'l'},
+                                      {"follower-cpu", required_argument, nullptr, 'f'},
+                                      {"export-file", required_argument, nullptr, 'o'},
+                                      {"export-format", required_argument, nullptr, 'x'},
                                       {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* shortOptions = "hb:t:n:";
+    constexpr const char* shortOptions = "hb:t:n:l:f:o:x:";
     int32_t index{0};
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, shortOptions, longOptions, &index), opt != -1))
@@ -54,12 +61,20 @@ int main(int argc, char* argv[])
             std::cout << "                                  <TYPE> {all," << std::endl;
             std::cout << "                                          iceoryx-cpp-api," << std::endl;
             std::cout << "                                          iceoryx-c-api," << std::endl;
+            std::cout << "                                          iceoryx-cpp-rpc," << std::endl;
             std::cout << "                                          posix-message-queue," << std::endl;
             std::cout << "                                          unix-domain-sockets}" << std::endl;
             std::cout << "                                  default = 'all'" << std::endl;
             std::cout << "-n, --number-of-samples <N>       Set the number of samples sent in a benchmark round"
                       << std::endl;
             std::cout << "                                  default = '10000'" << std::endl;
+            std::cout << "-l, --leader-cpu <CPU>            Pins the leader to the given CPU" << std::endl;
+            std::cout << "-f, --follower-cpu <CPU>          Pins the follower to the given CPU" << std::endl;
+            std::cout << "-o, --export-file <FILE>          Exports the results of all technologies to the file"
+                      << std::endl;
+            std::cout << "-x, --export-format <FORMAT>      Selects the format of the exported results" << std::endl;
+            std::cout << "                                  <FORMAT> {csv, json}" << std::endl;
+            std::cout << "                                  default = 'csv'" << std::endl;
 
             return EXIT_SUCCESS;
         case 'b':
@@ -94,6 +109,10 @@ int main(int argc, char* argv[])
             {
                 settings.technology = Technology::ICEORYX_C_API;
             }
+            else if (strcmp(optarg, "iceoryx-cpp-rpc") == 0)
+            {
+                settings.technology = Technology::ICEORYX_CPP_RPC;
+            }
             else if (strcmp(optarg, "posix-message-queue") == 0)
             {
                 settings.technology = Technology::POSIX_MESSAGE_QUEUE;
@@ -105,7 +124,7 @@ int main(int argc, char* argv[])
             else
             {
                 std::cerr << "Options for 'technology' are 'all', 'iceoryx-cpp-api', 'iceoryx-c-api', "
-                             "'posix-message-queue' and 'unix-domain-sockets'!"
+                             "'iceoryx-cpp-rpc', 'posix-message-queue' and 'unix-domain-sockets'!"
                           << std::endl;
                 return EXIT_FAILURE;
             }
@@ -117,11 +136,43 @@ int main(int argc, char* argv[])
                 return EXIT_FAILURE;
             }
             break;
+        case 'l':
+            if (!iox::cxx::convert::fromString(optarg, settings.leaderCpu) || settings.leaderCpu == NO_CPU_AFFINITY)
+            {
+                std::cerr << "Could not parse 'leader-cpu' paramater!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'f':
+            if (!iox::cxx::convert::fromString(optarg, settings.followerCpu) || settings.followerCpu == NO_CPU_AFFINITY)
+            {
+                std::cerr << "Could not parse 'follower-cpu' paramater!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'o':
+            exportFile = optarg;
+            break;
+        case 'x':
+            if (strcmp(optarg, "csv") == 0)
+            {
+                exportFormat = ExportFormat::CSV;
+            }
+            else if (strcmp(optarg, "json") == 0)
+            {
+                exportFormat = ExportFormat::JSON;
+            }
+            else
+            {
+                std::cerr << "Options for 'export-format' are 'csv' and 'json'!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
         default:
             return EXIT_FAILURE;
         };
     }
 
-    IcePerfLeader app(settings);
+    IcePerfLeader app(settings, exportFile, exportFormat);
     return app.run();
 }
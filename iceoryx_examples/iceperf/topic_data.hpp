@@ -20,6 +20,9 @@
 #include "example_common.hpp"
 
 #include <cstdint>
+#include <limits>
+
+constexpr uint32_t NO_CPU_AFFINITY{std::numeric_limits<uint32_t>::max()};
 
 //! [topic data definitions]
 struct PerfSettings
@@ -27,6 +30,8 @@ struct PerfSettings
     Benchmark benchmark{Benchmark::ALL};
     Technology technology{Technology::ALL};
     uint64_t numberOfSamples{10000U};
+    uint32_t leaderCpu{NO_CPU_AFFINITY};
+    uint32_t followerCpu{NO_CPU_AFFINITY};
 };
 
 struct PerfTopic
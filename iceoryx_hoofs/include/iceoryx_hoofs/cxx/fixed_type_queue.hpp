@@ -0,0 +1,114 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_CXX_FIXED_TYPE_QUEUE_HPP
+#define IOX_HOOFS_CXX_FIXED_TYPE_QUEUE_HPP
+
+#include "iceoryx_hoofs/cxx/variant_queue.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace cxx
+{
+namespace internal
+{
+/// @brief maps a VariantQueueTypes value to the underlying queue and adapts the push and pop semantics of this queue
+///        to the ones of the VariantQueue
+template <typename ValueType, uint64_t Capacity, VariantQueueTypes QueueType>
+struct FixedTypeQueueTraits;
+} // namespace internal
+
+/// @brief queue with the interface of the VariantQueue whose underlying queue type is selected at compile time. It
+///        contains only the underlying queue, i.e. it requires only the memory of the selected type and not of the
+///        largest of all types, and every call goes directly to the underlying queue without a switch on the type.
+///        The multi producer queue types share the same underlying queue, therefore a FixedTypeQueue of one of them
+///        can also be constructed with the other one; this type only decides how a push into a full queue behaves.
+/// @param[in] ValueType type which should be stored
+/// @param[in] Capacity capacity of the underlying queue
+/// @param[in] QueueType type of the underlying queue
+/// @code
+///     cxx::FixedTypeQueue<int, 5, cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer> overflowingQueue(
+///         cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer);
+///
+///     auto overriddenElement = overflowingQueue.push(123);
+/// @endcode
+template <typename ValueType, uint64_t Capacity, VariantQueueTypes QueueType>
+class FixedTypeQueue
+{
+  public:
+    using Traits_t = internal::FixedTypeQueueTraits<ValueType, Capacity, QueueType>;
+    using fifo_t = typename Traits_t::Queue_t;
+
+    static constexpr VariantQueueTypes QUEUE_TYPE = QueueType;
+
+    /// @brief Constructor of a FixedTypeQueue, which can be used in place of a VariantQueue
+    /// @param[in] type type of the queue, must be QueueType or a type which shares the underlying queue with it
+    FixedTypeQueue(const VariantQueueTypes type = QueueType) noexcept;
+
+    /// @brief pushs an element into the fifo
+    /// @param[in] value value which should be added in the fifo
+    /// @return if the underlying queue has an overflow the optional will contain
+    ///         the value which was overridden (SOFI) or which was dropped (FIFO)
+    ///         otherwise the optional contains nullopt_t
+    optional<ValueType> push(const ValueType& value) noexcept;
+
+    /// @brief pops an element from the fifo
+    /// @return if the fifo did contain an element it is returned inside the optional
+    ///         otherwise the optional contains nullopt_t
+    optional<ValueType> pop() noexcept;
+
+    /// @brief pops up to the given number of elements from the fifo in one pass
+    /// @param[in] maxNumberOfElements the maximum number of elements which are popped
+    /// @param[in] callable is called with every popped element, signature bool(ValueType&); it returns true to
+    ///            continue and false to stop popping
+    /// @return the number of popped elements
+    template <typename Callable>
+    uint64_t popBatch(const uint64_t maxNumberOfElements, const Callable& callable) noexcept;
+
+    /// @brief returns true if empty otherwise false
+    bool empty() const noexcept;
+
+    /// @brief get the current size of the queue. Caution, another thread can have changed the size just after reading
+    /// it
+    /// @return queue size
+    uint64_t size() noexcept;
+
+    /// @brief set the capacity of the queue
+    /// @param[in] newCapacity valid values are 0 < newCapacity < Capacity
+    /// @return true if setting the new capacity succeeded, false otherwise
+    /// @note the FiFo_SingleProducerSingleConsumer cannot be resized, calling this method does not compile for it
+    /// @pre it is important that no pop or push calls occur during this call
+    /// @concurrent not thread safe
+    bool setCapacity(const uint64_t newCapacity) noexcept;
+
+    /// @brief get the capacity of the queue.
+    /// @return queue size
+    uint64_t capacity() const noexcept;
+
+    /// @brief returns reference to the underlying fifo
+    fifo_t& getUnderlyingFiFo() noexcept;
+
+  private:
+    VariantQueueTypes m_type;
+    fifo_t m_fifo;
+};
+} // namespace cxx
+} // namespace iox
+
+#include "iceoryx_hoofs/internal/cxx/fixed_type_queue.inl"
+
+#endif // IOX_HOOFS_CXX_FIXED_TYPE_QUEUE_HPP
@@ -91,6 +91,15 @@ class VariantQueue
     ///         otherwise the optional contains nullopt_t
     optional<ValueType> pop() noexcept;
 
+    /// @brief pops up to the given number of elements from the fifo in one pass, i.e. the type of the underlying
+    ///        fifo is dispatched only once for all elements
+    /// @param[in] maxNumberOfElements the maximum number of elements which are popped
+    /// @param[in] callable is called with every popped element, signature bool(ValueType&); it returns true to
+    ///            continue and false to stop popping
+    /// @return the number of popped elements
+    template <typename Callable>
+    uint64_t popBatch(const uint64_t maxNumberOfElements, const Callable& callable) noexcept;
+
     /// @brief returns true if empty otherwise true
     bool empty() const noexcept;
 
@@ -123,6 +132,10 @@ class VariantQueue
     /// @endcode
     fifo_t& getUnderlyingFiFo() noexcept;
 
+  private:
+    template <typename Fifo, typename Callable>
+    static uint64_t popBatchFromFifo(Fifo& fifo, const uint64_t maxNumberOfElements, const Callable& callable) noexcept;
+
   private:
     VariantQueueTypes m_type;
     fifo_t m_fifo;
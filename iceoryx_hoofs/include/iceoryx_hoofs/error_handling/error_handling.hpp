@@ -36,14 +36,21 @@ namespace iox
     error(POSH__RUNTIME_FACTORY_IS_NOT_SET) \
     error(POSH__RUNTIME_IS_CREATED_MULTIPLE_TIMES) \
     error(POSH__RUNTIME_PUBLISHER_PORT_NOT_UNIQUE) \
+    error(POSH__RUNTIME_SERVER_PORT_NOT_UNIQUE) \
     error(POSH__RUNTIME_PUBLISHER_PORT_CREATION_UNKNOWN_ERROR) \
     error(POSH__RUNTIME_SUBSCRIBER_PORT_CREATION_UNKNOWN_ERROR) \
+    error(POSH__RUNTIME_CLIENT_PORT_CREATION_UNKNOWN_ERROR) \
+    error(POSH__RUNTIME_SERVER_PORT_CREATION_UNKNOWN_ERROR) \
     error(POSH__RUNTIME_ROUDI_PUBLISHER_LIST_FULL) \
     error(POSH__RUNTIME_ROUDI_SUBSCRIBER_LIST_FULL) \
+    error(POSH__RUNTIME_ROUDI_CLIENT_LIST_FULL) \
+    error(POSH__RUNTIME_ROUDI_SERVER_LIST_FULL) \
     error(POSH__RUNTIME_ROUDI_CONDITION_VARIABLE_LIST_FULL) \
     error(POSH__RUNTIME_ROUDI_EVENT_VARIABLE_LIST_FULL) \
     error(POSH__RUNTIME_ROUDI_REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE) \
     error(POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE) \
+    error(POSH__RUNTIME_ROUDI_REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE) \
+    error(POSH__RUNTIME_ROUDI_REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE) \
     error(POSH__RUNTIME_ROUDI_REQUEST_CONDITION_VARIABLE_WRONG_IPC_MESSAGE_RESPONSE) \
     error(POSH__RUNTIME_ROUDI_REQUEST_EVENT_VARIABLE_WRONG_MESSAGE_QUEUE_RESPONSE) \
     error(POSH__RUNTIME_ROUDI_GET_MW_INTERFACE_WRONG_IPC_MESSAGE_RESPONSE) \
@@ -56,6 +63,7 @@ namespace iox
     error(POSH__RUNTIME_NAME_EMPTY) \
     error(POSH__RUNTIME_LEADING_SLASH_PROVIDED) \
     error(POSH__PORT_MANAGER_PUBLISHERPORT_NOT_UNIQUE) \
+    error(POSH__PORT_MANAGER_SERVERPORT_NOT_UNIQUE) \
     error(POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY) \
     error(POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE) \
     error(POSH__RECEIVERPORT_DELIVERYFIFO_OVERFLOW) \
@@ -66,6 +74,8 @@ namespace iox
     error(POSH__SENDERPORT_ALLOCATE_FAILED) \
     error(POSH__SENDERPORT_SUBSCRIBER_LIST_OVERFLOW) \
     error(POSH__PUBLISHING_EMPTY_SAMPLE) \
+    error(POSH__SENDING_EMPTY_REQUEST) \
+    error(POSH__SENDING_EMPTY_RESPONSE) \
     error(POSH__SHM_APP_BASEADDRESS_VIOLATES_SPECIFICATION) \
     error(POSH__SHM_APP_SEGMENT_BASEADDRESS_VIOLATES_SPECIFICATION) \
     error(POSH__SHM_APP_MAPP_ERR) \
@@ -77,7 +87,14 @@ namespace iox
     error(POPO__APPLICATION_PORT_QUEUE_OVERFLOW) \
     error(POPO__BASE_SUBSCRIBER_OVERRIDING_WITH_EVENT_SINCE_HAS_DATA_OR_DATA_RECEIVED_ALREADY_ATTACHED) \
     error(POPO__BASE_SUBSCRIBER_OVERRIDING_WITH_STATE_SINCE_HAS_DATA_OR_DATA_RECEIVED_ALREADY_ATTACHED) \
+    error(POPO__BASE_CLIENT_OVERRIDING_WITH_EVENT_SINCE_HAS_RESPONSE_OR_RESPONSE_RECEIVED_ATTACHED) \
+    error(POPO__BASE_CLIENT_OVERRIDING_WITH_STATE_SINCE_HAS_RESPONSE_OR_RESPONSE_RECEIVED_ATTACHED) \
+    error(POPO__BASE_SERVER_OVERRIDING_WITH_EVENT_SINCE_HAS_REQUEST_OR_REQUEST_RECEIVED_ATTACHED) \
+    error(POPO__BASE_SERVER_OVERRIDING_WITH_STATE_SINCE_HAS_REQUEST_OR_REQUEST_RECEIVED_ATTACHED) \
+    error(POPO__CHUNK_QUEUE_DATA_FAILED_TO_CREATE_SEMAPHORE) \
     error(POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION) \
+    error(POPO__CHUNK_QUEUE_SEMAPHORE_CORRUPT_IN_NOTIFY) \
+    error(POPO__CHUNK_QUEUE_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT) \
     error(POPO__CHUNK_DISTRIBUTOR_OVERFLOW_OF_QUEUE_CONTAINER) \
     error(POPO__CHUNK_DISTRIBUTOR_CLEANUP_DEADLOCK_BECAUSE_BAD_APPLICATION_TERMINATION) \
     error(POPO__CHUNK_SENDER_INVALID_CHUNK_TO_FREE_FROM_USER) \
@@ -97,7 +114,17 @@ namespace iox
     error(POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_DESTROY) \
     error(POPO__CONDITION_NOTIFIER_INDEX_TOO_LARGE) \
     error(POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY) \
+    error(POPO__DISCOVERY_NOTIFICATION_DATA_FAILED_TO_CREATE_SEMAPHORE) \
+    error(POPO__DISCOVERY_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT) \
+    error(POPO__DISCOVERY_NOTIFIER_INDEX_TOO_LARGE) \
+    error(POPO__DISCOVERY_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY) \
+    error(POPO__LISTENER_FAILED_TO_CREATE_WORKER_SEMAPHORE) \
+    error(POPO__LISTENER_WORKER_SEMAPHORE_CORRUPTED_IN_POST) \
+    error(POPO__LISTENER_WORKER_SEMAPHORE_CORRUPTED_IN_WAIT) \
     error(POPO__NOTIFICATION_INFO_TYPE_INCONSISTENCY_IN_GET_ORIGIN) \
+    error(POPO__SERVER_PORT_INVALID_REQUEST_TO_RELEASE_FROM_USER) \
+    error(POPO__SERVER_PORT_INVALID_RESPONSE_TO_FREE_FROM_USER) \
+    error(POPO__SERVER_PORT_INVALID_RESPONSE_TO_SEND_FROM_USER) \
     error(POPO__TRIGGER_INVALID_RESET_CALLBACK) \
     error(POPO__TRIGGER_INVALID_HAS_TRIGGERED_CALLBACK) \
     error(POPO__TRIGGER_HANDLE_INVALID_RESET_CALLBACK) \
@@ -121,6 +148,8 @@ namespace iox
     error(MEPOO__MAXIMUM_NUMBER_OF_MEMPOOLS_REACHED) \
     error(PORT_POOL__PUBLISHERLIST_OVERFLOW) \
     error(PORT_POOL__SUBSCRIBERLIST_OVERFLOW) \
+    error(PORT_POOL__CLIENTLIST_OVERFLOW) \
+    error(PORT_POOL__SERVERLIST_OVERFLOW) \
     error(PORT_POOL__INTERFACELIST_OVERFLOW) \
     error(PORT_POOL__APPLICATIONLIST_OVERFLOW) \
     error(PORT_POOL__NODELIST_OVERFLOW) \
@@ -130,6 +159,8 @@ namespace iox
     error(PORT_MANAGER__INTROSPECTION_MEMORY_MANAGER_UNAVAILABLE) \
     error(PORT_MANAGER__HANDLE_PUBLISHER_PORTS_INVALID_CAPRO_MESSAGE) \
     error(PORT_MANAGER__HANDLE_SUBSCRIBER_PORTS_INVALID_CAPRO_MESSAGE) \
+    error(PORT_MANAGER__HANDLE_CLIENT_PORTS_INVALID_CAPRO_MESSAGE) \
+    error(PORT_MANAGER__HANDLE_SERVER_PORTS_INVALID_CAPRO_MESSAGE) \
     error(PORT_MANAGER__NO_PUBLISHER_PORT_FOR_INTROSPECTIONPORTSERVICE) \
     error(PORT_MANAGER__NO_PUBLISHER_PORT_FOR_INTROSPECTIONPORTTHROUGHPUTSERVICE) \
     error(PORT_MANAGER__NO_PUBLISHER_PORT_FOR_INTROSPECTIONCHANGINGDATASERVICE) \
@@ -161,10 +192,17 @@ namespace iox
     error(POSIX_TIMER__CALLBACK_RUNTIME_EXCEEDS_RETRIGGER_TIME) \
     error(BINDING_C__UNDEFINED_STATE_IN_IOX_QUEUE_FULL_POLICY) \
     error(BINDING_C__UNDEFINED_STATE_IN_IOX_SUBSCRIBER_TOO_SLOW_POLICY) \
+    error(BINDING_C__UNDEFINED_STATE_IN_IOX_CONSUMER_TOO_SLOW_POLICY) \
     error(BINDING_C__PUBLISHER_OPTIONS_NOT_INITIALIZED) \
     error(BINDING_C__SUBSCRIBER_OPTIONS_NOT_INITIALIZED) \
+    error(BINDING_C__CLIENT_OPTIONS_NOT_INITIALIZED) \
+    error(BINDING_C__SERVER_OPTIONS_NOT_INITIALIZED) \
     error(BINDING_C__C2CPP_ENUM_TRANSLATION_INVALID_SUBSCRIBER_EVENT_VALUE) \
-    error(BINDING_C__C2CPP_ENUM_TRANSLATION_INVALID_SUBSCRIBER_STATE_VALUE)
+    error(BINDING_C__C2CPP_ENUM_TRANSLATION_INVALID_SUBSCRIBER_STATE_VALUE) \
+    error(BINDING_C__C2CPP_ENUM_TRANSLATION_INVALID_CLIENT_EVENT_VALUE) \
+    error(BINDING_C__C2CPP_ENUM_TRANSLATION_INVALID_CLIENT_STATE_VALUE) \
+    error(BINDING_C__C2CPP_ENUM_TRANSLATION_INVALID_SERVER_EVENT_VALUE) \
+    error(BINDING_C__C2CPP_ENUM_TRANSLATION_INVALID_SERVER_STATE_VALUE)
 
 // clang-format on
 
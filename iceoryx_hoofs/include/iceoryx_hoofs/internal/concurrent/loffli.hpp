@@ -89,6 +89,18 @@ class LoFFLi
     /// @return true if index is valid or not yet pushed, false otherwise
     bool push(const Index_t index) noexcept;
 
+    /// Pop up to numberOfIndices values from the free-list with a single update of the free-list head
+    /// @param [out] indices array with space for at least numberOfIndices elements to store the popped indices
+    /// @param [in] numberOfIndices the maximum number of indices to pop
+    /// @return the number of popped indices, less than numberOfIndices if the free-list has not enough elements left
+    uint32_t popN(Index_t* const indices, const uint32_t numberOfIndices) noexcept;
+
+    /// Push previously popped elements with a single update of the free-list head
+    /// @param [in] indices array with the indices of previously popped elements
+    /// @param [in] numberOfIndices the number of elements in indices
+    /// @return true if all indices are valid and not yet pushed, false otherwise; in the latter case no index is pushed
+    bool pushN(const Index_t* const indices, const uint32_t numberOfIndices) noexcept;
+
     /// Calculates the required memory size for a free-list
     /// @param [in] capacity is the number of elements of the free-list
     /// @return the required memory size for a free-list with the requested capacity
@@ -0,0 +1,202 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_CXX_FIXED_TYPE_QUEUE_INL
+#define IOX_HOOFS_CXX_FIXED_TYPE_QUEUE_INL
+
+#include "iceoryx_hoofs/cxx/helplets.hpp"
+
+namespace iox
+{
+namespace cxx
+{
+namespace internal
+{
+template <typename ValueType, uint64_t Capacity>
+struct FixedTypeQueueTraits<ValueType, Capacity, VariantQueueTypes::FiFo_SingleProducerSingleConsumer>
+{
+    using Queue_t = concurrent::FiFo<ValueType, Capacity>;
+
+    static constexpr bool isSupported(const VariantQueueTypes type) noexcept
+    {
+        return type == VariantQueueTypes::FiFo_SingleProducerSingleConsumer;
+    }
+
+    static optional<ValueType> push(Queue_t& queue, const VariantQueueTypes, const ValueType& value) noexcept
+    {
+        return (queue.push(value)) ? cxx::nullopt : cxx::make_optional<ValueType>(value);
+    }
+
+    static optional<ValueType> pop(Queue_t& queue) noexcept
+    {
+        return queue.pop();
+    }
+};
+
+template <typename ValueType, uint64_t Capacity>
+struct FixedTypeQueueTraits<ValueType, Capacity, VariantQueueTypes::SoFi_SingleProducerSingleConsumer>
+{
+    using Queue_t = concurrent::SoFi<ValueType, Capacity>;
+
+    static constexpr bool isSupported(const VariantQueueTypes type) noexcept
+    {
+        return type == VariantQueueTypes::SoFi_SingleProducerSingleConsumer;
+    }
+
+    static optional<ValueType> push(Queue_t& queue, const VariantQueueTypes, const ValueType& value) noexcept
+    {
+        ValueType overriddenValue;
+        return (queue.push(value, overriddenValue)) ? cxx::nullopt : cxx::make_optional<ValueType>(overriddenValue);
+    }
+
+    static optional<ValueType> pop(Queue_t& queue) noexcept
+    {
+        ValueType returnType;
+        return (queue.pop(returnType)) ? make_optional<ValueType>(returnType) : cxx::nullopt;
+    }
+
+    static bool setCapacity(Queue_t& queue, const uint64_t newCapacity) noexcept
+    {
+        return queue.setCapacity(newCapacity);
+    }
+};
+
+/// @brief the multi producer queue types share the ResizeableLockFreeQueue; the type which was given at construction
+/// only decides whether a push into a full queue overrides the oldest element (SoFi) or is rejected (FiFo)
+template <typename ValueType, uint64_t Capacity>
+struct MultiProducerSingleConsumerQueueTraits
+{
+    using Queue_t = concurrent::ResizeableLockFreeQueue<ValueType, Capacity>;
+
+    static constexpr bool isSupported(const VariantQueueTypes type) noexcept
+    {
+        return type == VariantQueueTypes::FiFo_MultiProducerSingleConsumer
+               || type == VariantQueueTypes::SoFi_MultiProducerSingleConsumer;
+    }
+
+    static optional<ValueType> push(Queue_t& queue, const VariantQueueTypes type, const ValueType& value) noexcept
+    {
+        if (type == VariantQueueTypes::SoFi_MultiProducerSingleConsumer)
+        {
+            return queue.push(value);
+        }
+        return (queue.tryPush(value)) ? cxx::nullopt : cxx::make_optional<ValueType>(value);
+    }
+
+    static optional<ValueType> pop(Queue_t& queue) noexcept
+    {
+        return queue.pop();
+    }
+
+    static bool setCapacity(Queue_t& queue, const uint64_t newCapacity) noexcept
+    {
+        // we may discard elements in the queue if the size is reduced and the fifo contains too many elements
+        return queue.setCapacity(newCapacity);
+    }
+};
+
+template <typename ValueType, uint64_t Capacity>
+struct FixedTypeQueueTraits<ValueType, Capacity, VariantQueueTypes::FiFo_MultiProducerSingleConsumer>
+    : public MultiProducerSingleConsumerQueueTraits<ValueType, Capacity>
+{
+};
+
+template <typename ValueType, uint64_t Capacity>
+struct FixedTypeQueueTraits<ValueType, Capacity, VariantQueueTypes::SoFi_MultiProducerSingleConsumer>
+    : public MultiProducerSingleConsumerQueueTraits<ValueType, Capacity>
+{
+};
+} // namespace internal
+
+template <typename ValueType, uint64_t Capacity, VariantQueueTypes QueueType>
+constexpr VariantQueueTypes FixedTypeQueue<ValueType, Capacity, QueueType>::QUEUE_TYPE;
+
+template <typename ValueType, uint64_t Capacity, VariantQueueTypes QueueType>
+inline FixedTypeQueue<ValueType, Capacity, QueueType>::FixedTypeQueue(const VariantQueueTypes type) noexcept
+    : m_type(type)
+{
+    Expects(Traits_t::isSupported(type));
+}
+
+template <typename ValueType, uint64_t Capacity, VariantQueueTypes QueueType>
+inline optional<ValueType> FixedTypeQueue<ValueType, Capacity, QueueType>::push(const ValueType& value) noexcept
+{
+    return Traits_t::push(m_fifo, m_type, value);
+}
+
+template <typename ValueType, uint64_t Capacity, VariantQueueTypes QueueType>
+inline optional<ValueType> FixedTypeQueue<ValueType, Capacity, QueueType>::pop() noexcept
+{
+    return Traits_t::pop(m_fifo);
+}
+
+template <typename ValueType, uint64_t Capacity, VariantQueueTypes QueueType>
+template <typename Callable>
+inline uint64_t FixedTypeQueue<ValueType, Capacity, QueueType>::popBatch(const uint64_t maxNumberOfElements,
+                                                                         const Callable& callable) noexcept
+{
+    uint64_t numberOfPoppedElements{0U};
+    while (numberOfPoppedElements < maxNumberOfElements)
+    {
+        auto element = Traits_t::pop(m_fifo);
+        if (!element.has_value())
+        {
+            break;
+        }
+        ++numberOfPoppedElements;
+        if (!callable(element.value()))
+        {
+            break;
+        }
+    }
+    return numberOfPoppedElements;
+}
+
+template <typename ValueType, uint64_t Capacity, VariantQueueTypes QueueType>
+inline bool FixedTypeQueue<ValueType, Capacity, QueueType>::empty() const noexcept
+{
+    return m_fifo.empty();
+}
+
+template <typename ValueType, uint64_t Capacity, VariantQueueTypes QueueType>
+inline uint64_t FixedTypeQueue<ValueType, Capacity, QueueType>::size() noexcept
+{
+    return m_fifo.size();
+}
+
+template <typename ValueType, uint64_t Capacity, VariantQueueTypes QueueType>
+inline bool FixedTypeQueue<ValueType, Capacity, QueueType>::setCapacity(const uint64_t newCapacity) noexcept
+{
+    static_assert(QueueType != VariantQueueTypes::FiFo_SingleProducerSingleConsumer,
+                  "the FiFo_SingleProducerSingleConsumer cannot be resized");
+    return Traits_t::setCapacity(m_fifo, newCapacity);
+}
+
+template <typename ValueType, uint64_t Capacity, VariantQueueTypes QueueType>
+inline uint64_t FixedTypeQueue<ValueType, Capacity, QueueType>::capacity() const noexcept
+{
+    return m_fifo.capacity();
+}
+
+template <typename ValueType, uint64_t Capacity, VariantQueueTypes QueueType>
+inline typename FixedTypeQueue<ValueType, Capacity, QueueType>::fifo_t&
+FixedTypeQueue<ValueType, Capacity, QueueType>::getUnderlyingFiFo() noexcept
+{
+    return m_fifo;
+}
+} // namespace cxx
+} // namespace iox
+
+#endif // IOX_HOOFS_CXX_FIXED_TYPE_QUEUE_INL
@@ -122,6 +122,71 @@ inline optional<ValueType> VariantQueue<ValueType, Capacity>::pop() noexcept
     return cxx::nullopt;
 }
 
+template <typename ValueType, uint64_t Capacity>
+template <typename Callable>
+inline uint64_t VariantQueue<ValueType, Capacity>::popBatch(const uint64_t maxNumberOfElements,
+                                                            const Callable& callable) noexcept
+{
+    switch (m_type)
+    {
+    case VariantQueueTypes::FiFo_SingleProducerSingleConsumer:
+    {
+        auto& fifo = *m_fifo.template get_at_index<static_cast<uint64_t>(
+            VariantQueueTypes::FiFo_SingleProducerSingleConsumer)>();
+        return popBatchFromFifo(fifo, maxNumberOfElements, callable);
+    }
+    case VariantQueueTypes::SoFi_SingleProducerSingleConsumer:
+    {
+        auto& sofi = *m_fifo.template get_at_index<static_cast<uint64_t>(
+            VariantQueueTypes::SoFi_SingleProducerSingleConsumer)>();
+
+        uint64_t numberOfPoppedElements{0U};
+        ValueType element;
+        while (numberOfPoppedElements < maxNumberOfElements && sofi.pop(element))
+        {
+            ++numberOfPoppedElements;
+            if (!callable(element))
+            {
+                break;
+            }
+        }
+        return numberOfPoppedElements;
+    }
+    case VariantQueueTypes::FiFo_MultiProducerSingleConsumer:
+    case VariantQueueTypes::SoFi_MultiProducerSingleConsumer:
+    {
+        auto& fifo = *m_fifo.template get_at_index<static_cast<uint64_t>(
+            VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>();
+        return popBatchFromFifo(fifo, maxNumberOfElements, callable);
+    }
+    }
+
+    return 0U;
+}
+
+template <typename ValueType, uint64_t Capacity>
+template <typename Fifo, typename Callable>
+inline uint64_t VariantQueue<ValueType, Capacity>::popBatchFromFifo(Fifo& fifo,
+                                                                    const uint64_t maxNumberOfElements,
+                                                                    const Callable& callable) noexcept
+{
+    uint64_t numberOfPoppedElements{0U};
+    while (numberOfPoppedElements < maxNumberOfElements)
+    {
+        auto element = fifo.pop();
+        if (!element.has_value())
+        {
+            break;
+        }
+        ++numberOfPoppedElements;
+        if (!callable(element.value()))
+        {
+            break;
+        }
+    }
+    return numberOfPoppedElements;
+}
+
 template <typename ValueType, uint64_t Capacity>
 inline bool VariantQueue<ValueType, Capacity>::empty() const noexcept
 {
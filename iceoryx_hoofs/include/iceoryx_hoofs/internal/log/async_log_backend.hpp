@@ -0,0 +1,134 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_HOOFS_LOG_ASYNC_LOG_BACKEND_HPP
+#define IOX_HOOFS_LOG_ASYNC_LOG_BACKEND_HPP
+
+#include "iceoryx_hoofs/log/logcommon.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace iox
+{
+namespace log
+{
+/// @brief Lock-free single producer single consumer ring buffer for LogRecords. Each thread which logs with
+/// LogMode::kAsync claims one of these buffers and is its only producer, the drain thread of the AsyncLogBackend is
+/// the only consumer.
+class LogRecordRingBuffer
+{
+  public:
+    static constexpr uint64_t CAPACITY{64U};
+
+    /// @brief tries to claim the buffer for the calling thread
+    /// @return true if the buffer was unclaimed, otherwise false
+    bool tryClaim() noexcept;
+
+    /// @brief releases the buffer; records which are not yet drained remain in the buffer
+    void release() noexcept;
+
+    /// @brief copies the entry into the next free record; must only be called by the thread which claimed the buffer
+    /// @return false if the buffer is full, in this case the entry is dropped and counted
+    bool push(const LogEntry& entry) noexcept;
+
+    /// @brief copies the record into the next free record; must only be called by the thread which claimed the buffer
+    /// @return false if the buffer is full, in this case the record is dropped and counted
+    bool push(const LogRecord& record) noexcept;
+
+    /// @brief removes the oldest record from the buffer; must only be called by a single consumer at a time
+    /// @return false if the buffer is empty
+    bool pop(LogEntry& entry) noexcept;
+
+    /// @brief returns true if all records are drained
+    bool empty() const noexcept;
+
+    /// @brief returns the number of entries which were dropped since the last call and resets the counter
+    uint64_t takeNumberOfDroppedEntries() noexcept;
+
+  private:
+    LogRecord m_records[CAPACITY];
+    std::atomic<uint64_t> m_writeIndex{0U};
+    std::atomic<uint64_t> m_readIndex{0U};
+    std::atomic<uint64_t> m_droppedEntries{0U};
+    std::atomic<bool> m_isClaimed{false};
+};
+
+/// @brief Active object which drains the LogRecordRingBuffers of all threads which log with LogMode::kAsync and
+/// prints the records in the background. Pushing an entry neither allocates memory nor performs a syscall. The order
+/// of the entries of one thread is preserved, the entries of different threads are only ordered by their time stamp.
+/// If a ring buffer is full or all MAX_NUMBER_OF_PRODUCERS buffers are claimed, the caller has to print the entry
+/// synchronously or drop it.
+class AsyncLogBackend
+{
+  public:
+    static constexpr uint64_t MAX_NUMBER_OF_PRODUCERS{32U};
+    static constexpr std::chrono::milliseconds DRAIN_INTERVAL{10};
+
+    AsyncLogBackend(const AsyncLogBackend&) = delete;
+    AsyncLogBackend(AsyncLogBackend&&) = delete;
+    AsyncLogBackend& operator=(const AsyncLogBackend&) = delete;
+    AsyncLogBackend& operator=(AsyncLogBackend&&) = delete;
+
+    /// @brief starts the drain thread if it is not already running
+    static void start() noexcept;
+
+    /// @brief stops the drain thread and prints all pending records; afterwards tryPush fails until start is called
+    static void stop() noexcept;
+
+    /// @brief returns true if the drain thread is running
+    static bool isRunning() noexcept;
+
+    /// @brief pushes the entry into the ring buffer of the calling thread
+    /// @return true if the entry was stored or dropped because the buffer is full, false if the drain thread is not
+    /// running or all ring buffers are claimed by other threads
+    static bool tryPush(const LogEntry& entry) noexcept;
+
+    /// @brief pushes the record, which was formatted by a LogStream, into the ring buffer of the calling thread
+    /// @return true if the record was stored or dropped because the buffer is full, false if the drain thread is not
+    /// running or all ring buffers are claimed by other threads
+    static bool tryPush(const LogRecord& record) noexcept;
+
+    /// @brief prints all records which are currently stored in the ring buffers from the calling thread
+    static void flush() noexcept;
+
+  private:
+    AsyncLogBackend() noexcept;
+    ~AsyncLogBackend() noexcept;
+
+    static AsyncLogBackend& instance() noexcept;
+    static LogRecordRingBuffer* ringBufferOfThisThread() noexcept;
+    static void drain() noexcept;
+
+    void startDrainThread() noexcept;
+    void stopDrainThread() noexcept;
+    void drainThreadLoop() noexcept;
+
+  private:
+    std::mutex m_startStopMutex;
+    std::mutex m_mutex;
+    std::condition_variable m_wakeUp;
+    bool m_keepRunning{false};
+    std::thread m_drainThread;
+};
+
+} // namespace log
+} // namespace iox
+
+#endif // IOX_HOOFS_LOG_ASYNC_LOG_BACKEND_HPP
@@ -39,10 +39,22 @@ enum class SharedMemoryObjectError
     MAPPING_SHARED_MEMORY_FAILED,
 };
 
+/// @brief defines how the pages of a newly created SharedMemoryObject are backed by the operating system; the
+/// options are hints and if the operating system cannot fulfill them a warning is printed and the plain pages are used
+struct PagingOptions
+{
+    /// @brief the memory is backed with transparent huge pages to reduce the TLB misses when large payloads are
+    /// accessed; the size of the memory is aligned to HUGE_PAGE_SIZE
+    bool useHugePages{false};
+    /// @brief the memory is locked into the RAM so that it cannot be swapped out
+    bool lockPages{false};
+};
+
 class SharedMemoryObject : public DesignPattern::Creation<SharedMemoryObject, SharedMemoryObjectError>
 {
   public:
     static constexpr void* NO_ADDRESS_HINT = nullptr;
+    static constexpr uint64_t HUGE_PAGE_SIZE = 2U * 1024U * 1024U;
     SharedMemoryObject(const SharedMemoryObject&) = delete;
     SharedMemoryObject& operator=(const SharedMemoryObject&) = delete;
     SharedMemoryObject(SharedMemoryObject&&) noexcept = default;
@@ -67,9 +79,14 @@ class SharedMemoryObject : public DesignPattern::Creation<SharedMemoryObject, Sh
                        const AccessMode accessMode,
                        const OpenMode openMode,
                        const void* baseAddressHint,
-                       const mode_t permissions = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP) noexcept;
+                       const mode_t permissions = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP,
+                       const PagingOptions pagingOptions = PagingOptions()) noexcept;
 
     bool isInitialized() const noexcept;
+    bool reserveMemory() noexcept;
+    void writeZeros() noexcept;
+    void adviseHugePages() noexcept;
+    void lockPages() noexcept;
 
   private:
     uint64_t m_memorySizeInBytes;
@@ -32,6 +32,8 @@ namespace rp
 /// Up to CAPACITY segments can be registered with MIN_ID = 1 to MAX_ID = CAPACITY - 1
 /// id 0 is reserved and allows relative pointers to behave like normal pointers
 /// (which is equivalent to measure the offset relative to 0).
+/// The segments are additionally kept in an index which is sorted by their start address, which allows to search the id
+/// of a pointer with a binary search instead of a linear search over all ids.
 template <typename id_t, typename ptr_t, uint64_t CAPACITY = 10000U>
 class PointerRepository
 {
@@ -42,6 +44,15 @@ class PointerRepository
         ptr_t endPtr{nullptr};
     };
 
+    struct Interval
+    {
+        Interval(ptr_t basePtr, ptr_t endPtr, id_t id) noexcept;
+
+        ptr_t basePtr;
+        ptr_t endPtr;
+        id_t id;
+    };
+
     /// @note 0 is a special purpose id and reserved
     /// id 0 is reserved to interpret the offset just as a raw pointer,
     /// i.e. its corresponding base ptr is 0
@@ -95,6 +106,11 @@ class PointerRepository
     /// @brief prints the ids and their associated base pointers
     void print() const noexcept;
 
+  private:
+    void addToIndex(id_t id) noexcept;
+    void removeFromIndex(id_t id) noexcept;
+    void updateOverlapState() noexcept;
+
   private:
     /// @todo: if required protect vector against concurrent modification
     /// whether this is required depends on the use case, we currently do not need it
@@ -104,6 +120,13 @@ class PointerRepository
 
     iox::cxx::vector<Info, CAPACITY> m_info;
     uint64_t m_maxRegistered{0U};
+
+    /// @note segments with a size of 0 are not part of the index since no pointer can be in them
+    iox::cxx::vector<Interval, CAPACITY> m_sortedIntervals;
+
+    /// @note if segments overlap, the binary search could find another id than the first id whose segment contains a
+    /// pointer, therefore the linear search is used in this case
+    bool m_hasOverlappingSegments{false};
 };
 
 } // namespace rp
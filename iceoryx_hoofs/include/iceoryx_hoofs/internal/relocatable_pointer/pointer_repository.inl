@@ -20,10 +20,20 @@
 
 #include "iceoryx_hoofs/internal/relocatable_pointer/pointer_repository.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 namespace rp
 {
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline PointerRepository<id_t, ptr_t, CAPACITY>::Interval::Interval(ptr_t basePtr, ptr_t endPtr, id_t id) noexcept
+    : basePtr(basePtr)
+    , endPtr(endPtr)
+    , id(id)
+{
+}
+
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline PointerRepository<id_t, ptr_t, CAPACITY>::PointerRepository() noexcept
     : m_info(CAPACITY)
@@ -45,6 +55,7 @@ inline bool PointerRepository<id_t, ptr_t, CAPACITY>::registerPtr(id_t id, ptr_t
         {
             m_maxRegistered = id;
         }
+        addToIndex(id);
         return true;
     }
     return false;
@@ -63,6 +74,7 @@ inline id_t PointerRepository<id_t, ptr_t, CAPACITY>::registerPtr(const ptr_t pt
             {
                 m_maxRegistered = id;
             }
+            addToIndex(id);
             return id;
         }
     }
@@ -77,7 +89,9 @@ inline bool PointerRepository<id_t, ptr_t, CAPACITY>::unregisterPtr(id_t id) noe
     {
         if (m_info[id].basePtr != nullptr)
         {
+            removeFromIndex(id);
             m_info[id].basePtr = nullptr;
+            m_info[id].endPtr = nullptr;
 
             /// @note do not search for next lower registered index but we could do it here
             return true;
@@ -93,8 +107,11 @@ inline void PointerRepository<id_t, ptr_t, CAPACITY>::unregisterAll() noexcept
     for (auto& info : m_info)
     {
         info.basePtr = nullptr;
+        info.endPtr = nullptr;
     }
     m_maxRegistered = 0U;
+    m_sortedIntervals.clear();
+    m_hasOverlappingSegments = false;
 }
 
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
@@ -115,12 +132,31 @@ inline ptr_t PointerRepository<id_t, ptr_t, CAPACITY>::getBasePtr(id_t id) const
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline id_t PointerRepository<id_t, ptr_t, CAPACITY>::searchId(ptr_t ptr) const noexcept
 {
-    for (id_t id = 1U; id <= m_maxRegistered; ++id)
+    if (m_hasOverlappingSegments)
     {
-        // return first id where the ptr is in the corresponding interval
-        if (ptr >= m_info[id].basePtr && ptr <= m_info[id].endPtr)
+        for (id_t id = 1U; id <= m_maxRegistered; ++id)
         {
-            return id;
+            // return first id where the ptr is in the corresponding interval
+            if (ptr >= m_info[id].basePtr && ptr <= m_info[id].endPtr)
+            {
+                return id;
+            }
+        }
+    }
+    else
+    {
+        // the only candidate is the segment with the largest start address which is not larger than ptr
+        auto next = std::upper_bound(m_sortedIntervals.begin(),
+                                     m_sortedIntervals.end(),
+                                     ptr,
+                                     [](const ptr_t p, const Interval& interval) { return p < interval.basePtr; });
+        if (next != m_sortedIntervals.begin())
+        {
+            auto candidate = next - 1;
+            if (ptr <= candidate->endPtr)
+            {
+                return candidate->id;
+            }
         }
     }
     /// @note implicitly interpret the pointer as a regular pointer if not found
@@ -150,6 +186,54 @@ inline void PointerRepository<id_t, ptr_t, CAPACITY>::print() const noexcept
     }
 }
 
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::addToIndex(id_t id) noexcept
+{
+    const auto& info = m_info[id];
+    if (info.basePtr == nullptr || info.endPtr < info.basePtr)
+    {
+        return;
+    }
+
+    auto position = std::upper_bound(
+        m_sortedIntervals.begin(), m_sortedIntervals.end(), info.basePtr, [](const ptr_t p, const Interval& interval) {
+            return p < interval.basePtr;
+        });
+    // the index has room for all ids, therefore the emplace cannot fail
+    const auto index = static_cast<uint64_t>(position - m_sortedIntervals.begin());
+    m_sortedIntervals.emplace(index, info.basePtr, info.endPtr, id);
+    updateOverlapState();
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::removeFromIndex(id_t id) noexcept
+{
+    for (auto interval = m_sortedIntervals.begin(); interval != m_sortedIntervals.end(); ++interval)
+    {
+        if (interval->id == id)
+        {
+            m_sortedIntervals.erase(interval);
+            break;
+        }
+    }
+    updateOverlapState();
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::updateOverlapState() noexcept
+{
+    // since the intervals are sorted by their start address, any overlap implies an overlap of neighbouring intervals
+    m_hasOverlappingSegments = false;
+    for (uint64_t i = 1U; i < m_sortedIntervals.size(); ++i)
+    {
+        if (m_sortedIntervals[i].basePtr <= m_sortedIntervals[i - 1U].endPtr)
+        {
+            m_hasOverlappingSegments = true;
+            return;
+        }
+    }
+}
+
 } // namespace rp
 } // namespace iox
 
@@ -18,6 +18,7 @@
 #define IOX_HOOFS_LOG_LOGCOMMON_HPP
 
 #include <chrono>
+#include <cstdint>
 #include <string>
 
 namespace iox
@@ -39,7 +40,11 @@ enum class LogMode : uint8_t
 {
     kRemote = 0x01,
     kFile = 0x02,
-    kConsole = 0x04
+    kConsole = 0x04,
+    /// @brief in combination with kConsole, the entries are stored in a lock-free ring buffer of the logging thread
+    /// and printed by a background thread; fatal entries are always printed synchronously; the LogStream passes its
+    /// entries to Logger::LogAsync instead of Logger::Log
+    kAsync = 0x08
 };
 
 constexpr const char* LogLevelColor[] = {
@@ -74,6 +79,19 @@ struct LogEntry
     std::string message;
 };
 
+/// @brief Fixed size binary representation of a LogEntry which can be stored without dynamic memory. Messages which
+/// are longer than MAX_MESSAGE_LENGTH are truncated.
+struct LogRecord
+{
+    static constexpr uint64_t RECORD_SIZE{256U};
+    static constexpr uint64_t MAX_MESSAGE_LENGTH{RECORD_SIZE - sizeof(std::chrono::milliseconds) - sizeof(uint32_t)};
+
+    std::chrono::milliseconds time{0};
+    LogLevel level{LogLevel::kVerbose};
+    uint16_t messageLength{0U};
+    char message[MAX_MESSAGE_LENGTH]{};
+};
+
 } // namespace log
 } // namespace iox
 
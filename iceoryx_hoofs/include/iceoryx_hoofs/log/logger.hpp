@@ -30,11 +30,13 @@ namespace iox
 {
 namespace log
 {
-/// @todo for asynchronous logging, make the logger an active object according to Herb Sutter
+/// @note for asynchronous logging with LogMode::kAsync, the AsyncLogBackend is an active object according to Herb
+/// Sutter
 /// https://herbsutter.com/2010/07/12/effective-concurrency-prefer-using-active-objects-instead-of-naked-threads/
 
 class Logger
 {
+    friend class AsyncLogBackend;
     friend class LogManager;
     /// @todo LogStream needs to call Log(); do we want to make Log() public?
     friend class LogStream;
@@ -88,7 +90,19 @@ class Logger
     // NOLINTNEXTLINE(readability-identifier-naming)
     virtual void Log(const LogEntry& entry) const noexcept;
 
+    /// @brief passes a record which was formatted by a LogStream to the AsyncLogBackend; with LogMode::kAsync the
+    /// LogStream calls this method instead of Log(), therefore a Logger which overrides Log() has to override this
+    /// method too in order to see all entries
+    // virtual because of Logger_Mock
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    virtual void LogAsync(const LogRecord& record) const noexcept;
+
   private:
+    /// @brief returns true if an entry with the given LogLevel is passed to the AsyncLogBackend, in this case the
+    /// LogStream formats the message directly into a LogRecord
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    bool IsAsyncEnabled(const LogLevel logLevel) const noexcept;
+
     // NOLINTNEXTLINE(readability-identifier-naming)
     static void Print(const LogEntry& entry) noexcept;
 
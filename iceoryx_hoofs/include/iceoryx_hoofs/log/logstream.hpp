@@ -22,9 +22,12 @@
 
 #include <bitset>
 #include <chrono>
+#include <cstdint>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <string>
+#include <type_traits>
 
 namespace iox
 {
@@ -130,37 +133,66 @@ class LogStream
     template <typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
     LogStream& operator<<(const T val) noexcept
     {
-        m_logEntry.message.append(cxx::convert::toString(val));
-        m_flushed = false;
+        // the value is formatted without dynamic memory; like with cxx::convert::toString a char is printed as
+        // character and all other types as number
+        if (std::is_same<T, char>::value)
+        {
+            const char character = static_cast<char>(val);
+            append(&character, 1U);
+        }
+        else if (std::is_floating_point<T>::value)
+        {
+            appendFloatingPoint(static_cast<long double>(val));
+        }
+        else if (std::is_signed<T>::value)
+        {
+            appendSigned(static_cast<int64_t>(val));
+        }
+        else
+        {
+            appendUnsigned(static_cast<uint64_t>(val));
+        }
         return *this;
     }
 
     template <typename T, typename std::enable_if<std::is_base_of<LogHex, T>::value, int>::type = 0>
     LogStream& operator<<(const T val) noexcept
     {
-        std::stringstream ss;
-        // the '+val' is there to not interpret the uint8_t as char and print the character instead of the hex value
-        ss << "0x" << std::hex << +val.value;
-        m_logEntry.message.append(ss.str());
-        m_flushed = false;
+        appendHex(static_cast<uint64_t>(val.value));
         return *this;
     }
 
     template <typename T, typename std::enable_if<std::is_base_of<LogBin, T>::value, int>::type = 0>
     LogStream& operator<<(const T val) noexcept
     {
-        m_logEntry.message.append("0b");
-        m_logEntry.message.append(std::bitset<std::numeric_limits<decltype(val.value)>::digits>(val.value).to_string());
-        m_flushed = false;
+        constexpr uint64_t NUMBER_OF_DIGITS{std::numeric_limits<decltype(val.value)>::digits};
+        char digits[NUMBER_OF_DIGITS];
+        for (uint64_t i = 0U; i < NUMBER_OF_DIGITS; ++i)
+        {
+            digits[i] = (((static_cast<uint64_t>(val.value) >> (NUMBER_OF_DIGITS - 1U - i)) & 1U) == 1U) ? '1' : '0';
+        }
+        append("0b", 2U);
+        append(digits, NUMBER_OF_DIGITS);
         return *this;
     }
 
     LogStream& operator<<(const LogRawBuffer& value) noexcept;
 
   private:
+    /// @brief appends the characters to the message; with LogMode::kAsync they are written into the fixed size record
+    /// and a message longer than LogRecord::MAX_MESSAGE_LENGTH is truncated
+    void append(const char* const data, const uint64_t length) noexcept;
+    void appendFormatted(const char* const buffer, const int formattedLength) noexcept;
+    void appendSigned(const int64_t value) noexcept;
+    void appendUnsigned(const uint64_t value) noexcept;
+    void appendFloatingPoint(const long double value) noexcept;
+    void appendHex(const uint64_t value) noexcept;
+
     Logger& m_logger;
     bool m_flushed{false};
+    bool m_isAsync{false};
     LogEntry m_logEntry;
+    LogRecord m_logRecord;
 };
 
 LogStream& operator<<(LogStream& out, LogLevel value) noexcept;
@@ -31,6 +31,12 @@ using ThreadName_t = cxx::string<MAX_THREAD_NAME_LENGTH>;
 void setThreadName(pthread_t thread, const ThreadName_t& name) noexcept;
 ThreadName_t getThreadName(pthread_t thread) noexcept;
 
+/// @brief restricts the thread to the given CPUs
+/// @param[in] thread the thread whose affinity shall be set
+/// @param[in] cpuMask bit n of the mask allows the thread to run on CPU n
+/// @return true if the affinity was set, false if it failed or if it is not supported on the platform
+bool setThreadAffinity(pthread_t thread, const uint64_t cpuMask) noexcept;
+
 } // namespace posix
 } // namespace iox
 
@@ -17,11 +17,27 @@
 #ifndef IOX_HOOFS_LINUX_PLATFORM_PTHREAD_HPP
 #define IOX_HOOFS_LINUX_PLATFORM_PTHREAD_HPP
 
+#include <cstdint>
 #include <pthread.h>
+#include <sched.h>
 
 inline int iox_pthread_setname_np(pthread_t thread, const char* name)
 {
     return pthread_setname_np(thread, name);
 }
 
+inline int iox_pthread_setaffinity_np(pthread_t thread, uint64_t cpuMask)
+{
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (uint64_t cpu = 0U; cpu < 64U && cpu < CPU_SETSIZE; ++cpu)
+    {
+        if ((cpuMask & (static_cast<uint64_t>(1U) << cpu)) != 0U)
+        {
+            CPU_SET(cpu, &cpuSet);
+        }
+    }
+    return pthread_setaffinity_np(thread, sizeof(cpu_set_t), &cpuSet);
+}
+
 #endif // IOX_HOOFS_LINUX_PLATFORM_PTHREAD_HPP
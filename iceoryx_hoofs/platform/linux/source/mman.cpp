@@ -27,3 +27,15 @@ int iox_shm_unlink(const char* name)
 {
     return shm_unlink(name);
 }
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_madvise_huge_pages(void* addr, size_t length)
+{
+    return madvise(addr, length, MADV_HUGEPAGE);
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_mlock(const void* addr, size_t length)
+{
+    return mlock(addr, length);
+}
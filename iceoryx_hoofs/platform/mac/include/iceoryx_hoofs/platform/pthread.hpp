@@ -17,6 +17,8 @@
 #ifndef IOX_HOOFS_MAC_PLATFORM_PTHREAD_HPP
 #define IOX_HOOFS_MAC_PLATFORM_PTHREAD_HPP
 
+#include <cerrno>
+#include <cstdint>
 #include <pthread.h>
 
 inline int iox_pthread_setname_np(pthread_t, const char*)
@@ -25,4 +27,10 @@ inline int iox_pthread_setname_np(pthread_t, const char*)
     return 0;
 }
 
+inline int iox_pthread_setaffinity_np(pthread_t, uint64_t)
+{
+    // Not implemented due to missing functionality in MacOS
+    return ENOTSUP;
+}
+
 #endif // IOX_HOOFS_MAC_PLATFORM_PTHREAD_HPP
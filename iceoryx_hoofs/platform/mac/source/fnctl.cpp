@@ -16,7 +16,15 @@
 
 #include "iceoryx_hoofs/platform/fcntl.hpp"
 
+#include <cerrno>
+
 int iox_open(const char* pathname, int flags, mode_t mode)
 {
     return open(pathname, flags, mode);
 }
+
+int iox_fallocate(int, off_t, off_t)
+{
+    // not supported, the storage of a shared memory can only be reserved by writing to it
+    return ENOTSUP;
+}
@@ -37,3 +37,15 @@ int iox_shm_unlink(const char* name)
     }
     return state;
 }
+
+int iox_madvise_huge_pages(void*, size_t)
+{
+    // transparent huge pages are not supported
+    errno = ENOTSUP;
+    return -1;
+}
+
+int iox_mlock(const void* addr, size_t length)
+{
+    return mlock(addr, length);
+}
@@ -21,4 +21,8 @@
 
 int iox_open(const char* pathname, int flags, mode_t mode);
 
+/// @brief reserves the storage of the given range of a file, e.g. of a shared memory
+/// @return 0 on success, otherwise the error number like posix_fallocate
+int iox_fallocate(int fd, off_t offset, off_t len);
+
 #endif // IOX_HOOFS_QNX_PLATFORM_FCNTL_HPP
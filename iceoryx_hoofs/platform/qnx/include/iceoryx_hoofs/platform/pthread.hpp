@@ -17,6 +17,8 @@
 #ifndef IOX_HOOFS_QNX_PLATFORM_PTHREAD_HPP
 #define IOX_HOOFS_QNX_PLATFORM_PTHREAD_HPP
 
+#include <cerrno>
+#include <cstdint>
 #include <pthread.h>
 
 inline int iox_pthread_setname_np(pthread_t thread, const char* name)
@@ -24,4 +26,10 @@ inline int iox_pthread_setname_np(pthread_t thread, const char* name)
     return pthread_setname_np(thread, name);
 }
 
+inline int iox_pthread_setaffinity_np(pthread_t, uint64_t)
+{
+    // Not implemented since QNX only supports to set the runmask of the calling thread
+    return ENOTSUP;
+}
+
 #endif // IOX_HOOFS_QNX_PLATFORM_PTHREAD_HPP
@@ -16,6 +16,8 @@
 
 #include "iceoryx_hoofs/platform/mman.hpp"
 
+#include <cerrno>
+
 int iox_shm_open(const char* name, int oflag, mode_t mode)
 {
     return shm_open(name, oflag, mode);
@@ -25,3 +27,15 @@ int iox_shm_unlink(const char* name)
 {
     return shm_unlink(name);
 }
+
+int iox_madvise_huge_pages(void*, size_t)
+{
+    // transparent huge pages are not supported
+    errno = ENOTSUP;
+    return -1;
+}
+
+int iox_mlock(const void* addr, size_t length)
+{
+    return mlock(addr, length);
+}
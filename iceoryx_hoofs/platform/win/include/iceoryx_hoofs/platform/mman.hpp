@@ -43,4 +43,12 @@ int munmap(void* addr, size_t length);
 int iox_shm_open(const char* name, int oflag, mode_t mode);
 
 int iox_shm_unlink(const char* name);
+
+/// @brief advises the operating system to back the given memory with transparent huge pages
+/// @return 0 on success, otherwise -1 and errno is set
+int iox_madvise_huge_pages(void* addr, size_t length);
+
+/// @brief locks the given memory into the RAM so that it cannot be swapped out
+/// @return 0 on success, otherwise -1 and errno is set
+int iox_mlock(const void* addr, size_t length);
 #endif // IOX_HOOFS_WIN_PLATFORM_MMAN_HPP
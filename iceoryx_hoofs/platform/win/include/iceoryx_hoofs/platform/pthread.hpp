@@ -56,6 +56,7 @@ int pthread_mutex_trylock(pthread_mutex_t* mutex);
 int pthread_mutex_unlock(pthread_mutex_t* mutex);
 
 int iox_pthread_setname_np(pthread_t thread, const char* name);
+int iox_pthread_setaffinity_np(pthread_t thread, uint64_t cpuMask);
 int pthread_getname_np(pthread_t thread, char* name, size_t len);
 
 #endif // IOX_HOOFS_WIN_PLATFORM_PTHREAD_HPP
@@ -39,3 +39,9 @@ int iox_open(const char* pathname, int flags, mode_t mode)
 
     return HandleTranslator::getInstance().add(handle);
 }
+
+int iox_fallocate(int, off_t, off_t)
+{
+    // the shared memory is backed by the page file and does not need to be reserved
+    return ENOTSUP;
+}
@@ -122,3 +122,21 @@ int iox_shm_unlink(const char* name)
     errno = ENOENT;
     return -1;
 }
+
+int iox_madvise_huge_pages(void*, size_t)
+{
+    // large pages are only available for memory which is allocated with MEM_LARGE_PAGES
+    errno = ENOTSUP;
+    return -1;
+}
+
+int iox_mlock(const void* addr, size_t length)
+{
+    if (Win32Call(VirtualLock, const_cast<void*>(addr), length).value)
+    {
+        return 0;
+    }
+
+    errno = ENOMEM;
+    return -1;
+}
@@ -36,6 +36,11 @@ int iox_pthread_setname_np(pthread_t thread, const char* name)
     return Win32Call(SetThreadDescription, static_cast<HANDLE>(thread), wName.data()).error;
 }
 
+int iox_pthread_setaffinity_np(pthread_t thread, uint64_t cpuMask)
+{
+    return Win32Call(SetThreadAffinityMask, static_cast<HANDLE>(thread), static_cast<DWORD_PTR>(cpuMask)).error;
+}
+
 int pthread_getname_np(pthread_t thread, char* name, size_t len)
 {
     wchar_t* wName;
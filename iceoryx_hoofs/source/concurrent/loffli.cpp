@@ -109,5 +109,91 @@ bool LoFFLi::push(const Index_t index) noexcept
     return true;
 }
 
+uint32_t LoFFLi::popN(Index_t* const indices, const uint32_t numberOfIndices) noexcept
+{
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+    uint32_t numberOfPoppedIndices{0U};
+
+    do
+    {
+        /// the chain of free indices is read without synchronization; if another thread modifies it in between, the
+        /// head has changed as well and the compare exchange fails
+        numberOfPoppedIndices = 0U;
+        Index_t nextFreeIndex = oldHead.indexToNextFreeIndex;
+        while (numberOfPoppedIndices < numberOfIndices && nextFreeIndex < m_size)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by caller
+            indices[numberOfPoppedIndices] = nextFreeIndex;
+            ++numberOfPoppedIndices;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by m_size
+            nextFreeIndex = m_nextFreeIndex[nextFreeIndex];
+        }
+
+        if (numberOfPoppedIndices == 0U)
+        {
+            return 0U;
+        }
+
+        newHead.indexToNextFreeIndex = nextFreeIndex;
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    for (uint32_t i = 0U; i < numberOfPoppedIndices; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) indices were validated in the loop above
+        m_nextFreeIndex[indices[i]] = m_invalidIndex;
+    }
+
+    /// we need to synchronize m_nextFreeIndex with push so that we can perform a validation
+    /// check right before push to avoid double free's
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return numberOfPoppedIndices;
+}
+
+bool LoFFLi::pushN(const Index_t* const indices, const uint32_t numberOfIndices) noexcept
+{
+    if (numberOfIndices == 0U)
+    {
+        return true;
+    }
+
+    /// we synchronize with m_nextFreeIndex in pop to perform the validity check
+    std::atomic_thread_fence(std::memory_order_release);
+
+    /// the indices are linked to a chain while they are validated; an index which occurs twice is detected since it
+    /// is already linked when it is validated the second time
+    for (uint32_t i = 0U; i < numberOfIndices; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+        if (indices[i] >= m_size || m_nextFreeIndex[indices[i]] != m_invalidIndex)
+        {
+            for (uint32_t k = 0U; k < i; ++k)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index was validated
+                m_nextFreeIndex[indices[k]] = m_invalidIndex;
+            }
+            return false;
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+        m_nextFreeIndex[indices[i]] = (i + 1U < numberOfIndices) ? indices[i + 1U] : m_size;
+    }
+
+    const Index_t lastIndex = indices[numberOfIndices - 1U];
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+
+    do
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+        m_nextFreeIndex[lastIndex] = oldHead.indexToNextFreeIndex;
+        newHead.indexToNextFreeIndex = indices[0U];
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    return true;
+}
+
 } // namespace concurrent
 } // namespace iox
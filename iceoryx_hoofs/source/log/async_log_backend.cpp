@@ -0,0 +1,310 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/log/async_log_backend.hpp"
+
+#include "iceoryx_hoofs/log/logger.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace iox
+{
+namespace log
+{
+constexpr uint64_t LogRecord::RECORD_SIZE;
+constexpr uint64_t LogRecord::MAX_MESSAGE_LENGTH;
+constexpr uint64_t LogRecordRingBuffer::CAPACITY;
+constexpr uint64_t AsyncLogBackend::MAX_NUMBER_OF_PRODUCERS;
+constexpr std::chrono::milliseconds AsyncLogBackend::DRAIN_INTERVAL;
+
+static_assert(sizeof(LogRecord) == LogRecord::RECORD_SIZE, "The LogRecord must not contain any padding");
+
+namespace
+{
+// the ring buffers and the state of the backend have static storage duration and a trivial destructor; this way they
+// remain usable for threads which log while the static objects are destroyed at the end of the program
+LogRecordRingBuffer g_ringBuffers[AsyncLogBackend::MAX_NUMBER_OF_PRODUCERS];
+std::atomic<bool> g_isRunning{false};
+std::mutex g_drainMutex;
+
+/// @brief releases the ring buffer of a thread when the thread terminates
+struct RingBufferClaim
+{
+    RingBufferClaim() noexcept = default;
+    RingBufferClaim(const RingBufferClaim&) = delete;
+    RingBufferClaim(RingBufferClaim&&) = delete;
+    RingBufferClaim& operator=(const RingBufferClaim&) = delete;
+    RingBufferClaim& operator=(RingBufferClaim&&) = delete;
+
+    ~RingBufferClaim() noexcept
+    {
+        if (ringBuffer != nullptr)
+        {
+            ringBuffer->release();
+        }
+    }
+
+    LogRecordRingBuffer* ringBuffer{nullptr};
+};
+
+LogRecordRingBuffer* tryClaimRingBuffer(const bool onlyEmptyRingBuffers) noexcept
+{
+    for (auto& ringBuffer : g_ringBuffers)
+    {
+        if ((!onlyEmptyRingBuffers || ringBuffer.empty()) && ringBuffer.tryClaim())
+        {
+            return &ringBuffer;
+        }
+    }
+    return nullptr;
+}
+} // namespace
+
+bool LogRecordRingBuffer::tryClaim() noexcept
+{
+    bool expected{false};
+    return m_isClaimed.compare_exchange_strong(expected, true, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+void LogRecordRingBuffer::release() noexcept
+{
+    m_isClaimed.store(false, std::memory_order_release);
+}
+
+bool LogRecordRingBuffer::push(const LogEntry& entry) noexcept
+{
+    const auto writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+    if (writeIndex - m_readIndex.load(std::memory_order_acquire) >= CAPACITY)
+    {
+        m_droppedEntries.fetch_add(1U, std::memory_order_relaxed);
+        return false;
+    }
+
+    auto& record = m_records[writeIndex % CAPACITY];
+    record.time = entry.time;
+    record.level = entry.level;
+    const auto messageLength = std::min(static_cast<uint64_t>(entry.message.size()), LogRecord::MAX_MESSAGE_LENGTH);
+    std::memcpy(record.message, entry.message.data(), messageLength);
+    record.messageLength = static_cast<uint16_t>(messageLength);
+
+    m_writeIndex.store(writeIndex + 1U, std::memory_order_release);
+    return true;
+}
+
+bool LogRecordRingBuffer::push(const LogRecord& record) noexcept
+{
+    const auto writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+    if (writeIndex - m_readIndex.load(std::memory_order_acquire) >= CAPACITY)
+    {
+        m_droppedEntries.fetch_add(1U, std::memory_order_relaxed);
+        return false;
+    }
+
+    auto& storedRecord = m_records[writeIndex % CAPACITY];
+    storedRecord.time = record.time;
+    storedRecord.level = record.level;
+    std::memcpy(storedRecord.message, record.message, record.messageLength);
+    storedRecord.messageLength = record.messageLength;
+
+    m_writeIndex.store(writeIndex + 1U, std::memory_order_release);
+    return true;
+}
+
+bool LogRecordRingBuffer::pop(LogEntry& entry) noexcept
+{
+    const auto readIndex = m_readIndex.load(std::memory_order_relaxed);
+    if (readIndex == m_writeIndex.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    const auto& record = m_records[readIndex % CAPACITY];
+    entry.time = record.time;
+    entry.level = record.level;
+    entry.message.assign(record.message, record.messageLength);
+
+    m_readIndex.store(readIndex + 1U, std::memory_order_release);
+    return true;
+}
+
+bool LogRecordRingBuffer::empty() const noexcept
+{
+    return m_readIndex.load(std::memory_order_relaxed) == m_writeIndex.load(std::memory_order_relaxed);
+}
+
+uint64_t LogRecordRingBuffer::takeNumberOfDroppedEntries() noexcept
+{
+    return m_droppedEntries.exchange(0U, std::memory_order_relaxed);
+}
+
+AsyncLogBackend::AsyncLogBackend() noexcept = default;
+
+AsyncLogBackend::~AsyncLogBackend() noexcept
+{
+    stopDrainThread();
+}
+
+AsyncLogBackend& AsyncLogBackend::instance() noexcept
+{
+    static AsyncLogBackend backend;
+    return backend;
+}
+
+void AsyncLogBackend::start() noexcept
+{
+    instance().startDrainThread();
+}
+
+void AsyncLogBackend::stop() noexcept
+{
+    instance().stopDrainThread();
+}
+
+void AsyncLogBackend::startDrainThread() noexcept
+{
+    std::lock_guard<std::mutex> startStopLock(m_startStopMutex);
+    if (m_drainThread.joinable())
+    {
+        return;
+    }
+
+    m_keepRunning = true;
+    m_drainThread = std::thread(&AsyncLogBackend::drainThreadLoop, this);
+    g_isRunning.store(true, std::memory_order_release);
+}
+
+void AsyncLogBackend::stopDrainThread() noexcept
+{
+    std::lock_guard<std::mutex> startStopLock(m_startStopMutex);
+    if (!m_drainThread.joinable())
+    {
+        return;
+    }
+
+    g_isRunning.store(false, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_keepRunning = false;
+    }
+    m_wakeUp.notify_one();
+    m_drainThread.join();
+
+    drain();
+}
+
+bool AsyncLogBackend::isRunning() noexcept
+{
+    return g_isRunning.load(std::memory_order_acquire);
+}
+
+LogRecordRingBuffer* AsyncLogBackend::ringBufferOfThisThread() noexcept
+{
+    thread_local RingBufferClaim claim;
+    if (claim.ringBuffer == nullptr)
+    {
+        // prefer a drained ring buffer since a released one may still be filled with the records of a terminated thread
+        constexpr bool ONLY_EMPTY_RING_BUFFERS{true};
+        claim.ringBuffer = tryClaimRingBuffer(ONLY_EMPTY_RING_BUFFERS);
+        if (claim.ringBuffer == nullptr)
+        {
+            claim.ringBuffer = tryClaimRingBuffer(!ONLY_EMPTY_RING_BUFFERS);
+        }
+    }
+    return claim.ringBuffer;
+}
+
+bool AsyncLogBackend::tryPush(const LogEntry& entry) noexcept
+{
+    if (!isRunning())
+    {
+        return false;
+    }
+
+    auto ringBuffer = ringBufferOfThisThread();
+    if (ringBuffer == nullptr)
+    {
+        return false;
+    }
+
+    // a full ring buffer drops the entry instead of blocking the caller
+    ringBuffer->push(entry);
+    return true;
+}
+
+bool AsyncLogBackend::tryPush(const LogRecord& record) noexcept
+{
+    if (!isRunning())
+    {
+        return false;
+    }
+
+    auto ringBuffer = ringBufferOfThisThread();
+    if (ringBuffer == nullptr)
+    {
+        return false;
+    }
+
+    // a full ring buffer drops the record instead of blocking the caller
+    ringBuffer->push(record);
+    return true;
+}
+
+void AsyncLogBackend::flush() noexcept
+{
+    drain();
+}
+
+void AsyncLogBackend::drain() noexcept
+{
+    std::lock_guard<std::mutex> lock(g_drainMutex);
+
+    LogEntry entry;
+    for (auto& ringBuffer : g_ringBuffers)
+    {
+        while (ringBuffer.pop(entry))
+        {
+            Logger::Print(entry);
+        }
+
+        const auto numberOfDroppedEntries = ringBuffer.takeNumberOfDroppedEntries();
+        if (numberOfDroppedEntries > 0U)
+        {
+            auto timePoint = std::chrono::high_resolution_clock::now();
+            entry.time = std::chrono::duration_cast<std::chrono::milliseconds>(timePoint.time_since_epoch());
+            entry.level = LogLevel::kWarn;
+            entry.message = std::to_string(numberOfDroppedEntries) + " log entries were dropped due to a full buffer";
+            Logger::Print(entry);
+        }
+    }
+}
+
+void AsyncLogBackend::drainThreadLoop() noexcept
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_keepRunning)
+    {
+        m_wakeUp.wait_for(lock, DRAIN_INTERVAL, [this] { return !m_keepRunning; });
+
+        lock.unlock();
+        drain();
+        lock.lock();
+    }
+}
+
+} // namespace log
+} // namespace iox
@@ -17,6 +17,7 @@
 
 #include "iceoryx_hoofs/log/logger.hpp"
 
+#include "iceoryx_hoofs/internal/log/async_log_backend.hpp"
 #include "iceoryx_hoofs/log/logging.hpp"
 #include "iceoryx_hoofs/log/logstream.hpp"
 
@@ -77,6 +78,11 @@ cxx::GenericRAII Logger::SetLogLevelForScope(const LogLevel logLevel) noexcept
 // NOLINTNEXTLINE(readability-identifier-naming)
 void Logger::SetLogMode(const LogMode logMode) noexcept
 {
+    if ((logMode & LogMode::kAsync) == LogMode::kAsync)
+    {
+        AsyncLogBackend::start();
+    }
+
     m_logMode.store(logMode, std::memory_order_relaxed);
 
     if ((logMode & LogMode::kRemote) == LogMode::kRemote)
@@ -163,6 +169,42 @@ void Logger::Log(const LogEntry& entry) const noexcept
     /// event if they are below the current log level and print them if case of kFatal?
     if (IsEnabled(entry.level))
     {
+        if ((m_logMode.load(std::memory_order_relaxed) & LogMode::kAsync) == LogMode::kAsync)
+        {
+            // a fatal entry is usually followed by the termination of the process, therefore all pending entries
+            // have to be printed before it
+            if (entry.level == LogLevel::kFatal)
+            {
+                AsyncLogBackend::flush();
+            }
+            else if (AsyncLogBackend::tryPush(entry))
+            {
+                return;
+            }
+        }
+        Print(entry);
+    }
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+bool Logger::IsAsyncEnabled(const LogLevel logLevel) const noexcept
+{
+    // a fatal entry is printed synchronously by Log(), see there
+    return IsEnabled(logLevel) && logLevel != LogLevel::kFatal
+           && (m_logMode.load(std::memory_order_relaxed) & LogMode::kAsync) == LogMode::kAsync
+           && AsyncLogBackend::isRunning();
+}
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+void Logger::LogAsync(const LogRecord& record) const noexcept
+{
+    if (!AsyncLogBackend::tryPush(record))
+    {
+        // the drain thread was stopped or all ring buffers are claimed by other threads
+        LogEntry entry;
+        entry.level = record.level;
+        entry.time = record.time;
+        entry.message.assign(record.message, record.messageLength);
         Print(entry);
     }
 }
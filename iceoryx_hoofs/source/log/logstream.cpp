@@ -20,14 +20,22 @@
 #include "iceoryx_hoofs/log/logger.hpp"
 #include "iceoryx_hoofs/log/logging.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
 #include <ctime>
-#include <iomanip>
 
 namespace iox
 {
 namespace log
 {
+namespace
+{
+constexpr uint64_t NUMBER_BUFFER_SIZE{32U};
+} // namespace
+
 LogStream::LogStream(Logger& logger, LogLevel logLevel) noexcept
     : m_logger(logger)
 {
@@ -35,6 +43,9 @@ LogStream::LogStream(Logger& logger, LogLevel logLevel) noexcept
     /// @todo do we want to do this only when loglevel is higher than global loglevel?
     auto timePoint = std::chrono::high_resolution_clock::now();
     m_logEntry.time = std::chrono::duration_cast<std::chrono::milliseconds>(timePoint.time_since_epoch());
+    // with LogMode::kAsync the message is formatted directly into a fixed size record which is copied into the ring
+    // buffer of the thread, this way logging does not allocate memory
+    m_isAsync = m_logger.IsAsyncEnabled(logLevel);
 }
 
 LogStream::~LogStream() noexcept
@@ -49,23 +60,81 @@ void LogStream::Flush() noexcept
     if (!m_flushed)
     {
         m_flushed = true;
-        m_logger.Log(m_logEntry);
-        m_logEntry.message.clear();
+        if (m_isAsync)
+        {
+            m_logRecord.time = m_logEntry.time;
+            m_logRecord.level = m_logEntry.level;
+            m_logger.LogAsync(m_logRecord);
+            m_logRecord.messageLength = 0U;
+        }
+        else
+        {
+            m_logger.Log(m_logEntry);
+            m_logEntry.message.clear();
+        }
         /// @todo do we need to reset the m_logTime? maybe just print a counter with each flush?
     }
 }
 
-LogStream& LogStream::operator<<(const char* cstr) noexcept
+void LogStream::append(const char* const data, const uint64_t length) noexcept
 {
-    m_logEntry.message.append(cstr);
+    if (m_isAsync)
+    {
+        const uint64_t remainingLength = LogRecord::MAX_MESSAGE_LENGTH - m_logRecord.messageLength;
+        const uint64_t appendedLength = std::min(length, remainingLength);
+        std::memcpy(&m_logRecord.message[m_logRecord.messageLength], data, appendedLength);
+        m_logRecord.messageLength = static_cast<uint16_t>(m_logRecord.messageLength + appendedLength);
+    }
+    else
+    {
+        m_logEntry.message.append(data, length);
+    }
     m_flushed = false;
+}
+
+void LogStream::appendFormatted(const char* const buffer, const int formattedLength) noexcept
+{
+    // snprintf returns the length of the untruncated output or a negative value on error
+    if (formattedLength > 0)
+    {
+        append(buffer, std::min(static_cast<uint64_t>(formattedLength), NUMBER_BUFFER_SIZE - 1U));
+    }
+}
+
+void LogStream::appendSigned(const int64_t value) noexcept
+{
+    char buffer[NUMBER_BUFFER_SIZE];
+    appendFormatted(buffer, std::snprintf(buffer, NUMBER_BUFFER_SIZE, "%" PRId64, value));
+}
+
+void LogStream::appendUnsigned(const uint64_t value) noexcept
+{
+    char buffer[NUMBER_BUFFER_SIZE];
+    appendFormatted(buffer, std::snprintf(buffer, NUMBER_BUFFER_SIZE, "%" PRIu64, value));
+}
+
+void LogStream::appendFloatingPoint(const long double value) noexcept
+{
+    // '%Lg' has the same output as the default formatting of a std::ostream
+    char buffer[NUMBER_BUFFER_SIZE];
+    appendFormatted(buffer, std::snprintf(buffer, NUMBER_BUFFER_SIZE, "%Lg", value));
+}
+
+void LogStream::appendHex(const uint64_t value) noexcept
+{
+    char buffer[NUMBER_BUFFER_SIZE];
+    appendFormatted(buffer, std::snprintf(buffer, NUMBER_BUFFER_SIZE, "0x%" PRIx64, value));
+}
+
+LogStream& LogStream::operator<<(const char* cstr) noexcept
+{
+    append(cstr, std::strlen(cstr));
     return *this;
 }
 
 LogStream& LogStream::operator<<(const std::string& str) noexcept
 {
-    m_logEntry.message.append(str);
-    m_flushed = false;
+    append(str.data(), str.size());
     return *this;
 }
 
@@ -94,20 +163,15 @@ LogStream& operator<<(LogStream& out, LogLevel value) noexcept
 
 LogStream& LogStream::operator<<(const LogRawBuffer& value) noexcept
 {
-    std::stringstream ss;
-    ss << "0x[";
-    ss << std::hex << std::setfill('0');
-    for (int8_t i = 0; i < value.size; ++i)
+    append("0x[", 3U);
+    for (uint8_t i = 0U; i < value.size; ++i)
     {
-        // the '+value' is there to not interpret the uint8_t as char and print the character instead of the hex value
-        ss << (i > 0 ? " " : "")
-           << std::setw(2)
-           // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-           << +value.data[i];
+        char buffer[NUMBER_BUFFER_SIZE];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        appendFormatted(buffer,
+                        std::snprintf(buffer, NUMBER_BUFFER_SIZE, (i > 0U) ? " %02x" : "%02x", value.data[i]));
     }
-    ss << "]";
-    m_logEntry.message.append(ss.str());
-    m_flushed = false;
+    append("]", 1U);
     return *this;
 }
 
@@ -17,22 +17,31 @@
 
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
 #include "iceoryx_hoofs/platform/fcntl.hpp"
+#include "iceoryx_hoofs/platform/mman.hpp"
 #include "iceoryx_hoofs/platform/unistd.hpp"
+#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
 #include "iceoryx_hoofs/posix_wrapper/signal_handler.hpp"
 
+#include <algorithm>
 #include <bitset>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 namespace iox
 {
 namespace posix
 {
 constexpr void* SharedMemoryObject::NO_ADDRESS_HINT;
+constexpr uint64_t SharedMemoryObject::HUGE_PAGE_SIZE;
 constexpr uint64_t SIGBUS_ERROR_MESSAGE_LENGTH = 1024U + platform::IOX_MAX_SHM_NAME_LENGTH;
+/// @brief below this size per thread, starting an additional thread to write zeros does not pay off
+constexpr uint64_t MIN_BYTES_TO_WRITE_ZEROS_PER_THREAD = 64U * 1024U * 1024U;
 
 static char sigbusErrorMessage[SIGBUS_ERROR_MESSAGE_LENGTH];
 static std::mutex sigbusHandlerMutex;
@@ -51,8 +60,10 @@ SharedMemoryObject::SharedMemoryObject(const SharedMemory::Name_t& name,
                                        const AccessMode accessMode,
                                        const OpenMode openMode,
                                        const void* baseAddressHint,
-                                       const mode_t permissions) noexcept
-    : m_memorySizeInBytes(cxx::align(memorySizeInBytes, Allocator::MEMORY_ALIGNMENT))
+                                       const mode_t permissions,
+                                       const PagingOptions pagingOptions) noexcept
+    : m_memorySizeInBytes(cxx::align(memorySizeInBytes,
+                                     (pagingOptions.useHugePages) ? HUGE_PAGE_SIZE : Allocator::MEMORY_ALIGNMENT))
 {
     m_isInitialized = true;
 
@@ -91,10 +102,20 @@ SharedMemoryObject::SharedMemoryObject(const SharedMemory::Name_t& name,
 
     m_allocator.emplace(m_memoryMap->getBaseAddress(), m_memorySizeInBytes);
 
+    // the advice has to be given before the pages are touched for the first time, otherwise the zeroing below
+    // already populates the memory with plain pages
+    if (pagingOptions.useHugePages)
+    {
+        adviseHugePages();
+    }
+
     if (m_isInitialized && m_sharedMemory->hasOwnership())
     {
         std::clog << "Reserving " << m_memorySizeInBytes << " bytes in the shared memory [" << name << "]" << std::endl;
-        if (platform::IOX_SHM_WRITE_ZEROS_ON_CREATION)
+        // the reserved memory of a shared memory cannot cause a SIGBUS later on and its pages are zeroed by the
+        // operating system on the first access; only without a reservation the memory has to be written to find out
+        // whether it is available
+        if (platform::IOX_SHM_WRITE_ZEROS_ON_CREATION && !reserveMemory())
         {
             // this lock is required for the case that multiple threads are creating multiple
             // shared memory objects concurrently
@@ -115,10 +136,81 @@ SharedMemoryObject::SharedMemoryObject(const SharedMemory::Name_t& name,
                 baseAddressHint,
                 std::bitset<sizeof(mode_t)>(permissions).to_ulong());
 
-            memset(m_memoryMap->getBaseAddress(), 0, m_memorySizeInBytes);
+            writeZeros();
         }
         std::clog << "[ Reserving shared memory successful ] " << std::endl;
     }
+
+    if (pagingOptions.lockPages)
+    {
+        lockPages();
+    }
+}
+
+bool SharedMemoryObject::reserveMemory() noexcept
+{
+    return !posixCall(iox_fallocate)(m_sharedMemory->getHandle(), 0, static_cast<off_t>(m_memorySizeInBytes))
+                .returnValueMatchesErrno()
+                .suppressErrorMessagesForErrnos(ENOTSUP, EOPNOTSUPP)
+                .evaluate()
+                .has_error();
+}
+
+void SharedMemoryObject::writeZeros() noexcept
+{
+    constexpr uint64_t ONE_THREAD{1U};
+    const uint64_t numberOfHardwareThreads =
+        std::max(static_cast<uint64_t>(std::thread::hardware_concurrency()), ONE_THREAD);
+    const uint64_t numberOfThreads = std::max(
+        std::min(numberOfHardwareThreads, m_memorySizeInBytes / MIN_BYTES_TO_WRITE_ZEROS_PER_THREAD), ONE_THREAD);
+    // the sections start at page boundaries so that no page is touched by two threads; rounding up the section size
+    // makes the last section smaller or empty
+    const uint64_t bytesPerThread = cxx::align(m_memorySizeInBytes / numberOfThreads, pageSize());
+
+    auto writeZerosToSection = [this, bytesPerThread](const uint64_t sectionIndex) {
+        const uint64_t begin = std::min(sectionIndex * bytesPerThread, m_memorySizeInBytes);
+        const uint64_t size = std::min(bytesPerThread, m_memorySizeInBytes - begin);
+        memset(static_cast<uint8_t*>(m_memoryMap->getBaseAddress()) + begin, 0, size);
+    };
+
+    // the SIGBUS handler is registered for the whole process and therefore also covers the additional threads
+    std::vector<std::thread> threads;
+    for (uint64_t sectionIndex = 1U; sectionIndex < numberOfThreads; ++sectionIndex)
+    {
+        threads.emplace_back(writeZerosToSection, sectionIndex);
+    }
+    writeZerosToSection(0U);
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+void SharedMemoryObject::adviseHugePages() noexcept
+{
+    auto result = posixCall(iox_madvise_huge_pages)(m_memoryMap->getBaseAddress(), m_memorySizeInBytes)
+                      .failureReturnValue(-1)
+                      .suppressErrorMessagesForErrnos(ENOTSUP, EINVAL)
+                      .evaluate();
+    if (result.has_error())
+    {
+        std::cerr << "Unable to back the shared memory with huge pages, continuing with regular pages" << std::endl;
+    }
+}
+
+void SharedMemoryObject::lockPages() noexcept
+{
+    auto result = posixCall(iox_mlock)(m_memoryMap->getBaseAddress(), m_memorySizeInBytes)
+                      .failureReturnValue(-1)
+                      .suppressErrorMessagesForErrnos(ENOMEM, EPERM, EAGAIN)
+                      .evaluate();
+    if (result.has_error())
+    {
+        std::cerr << "Unable to lock the shared memory into the RAM since it would exceed the RLIMIT_MEMLOCK or the "
+                     "required privileges are missing, the memory can be swapped out"
+                  << std::endl;
+    }
 }
 
 void* SharedMemoryObject::allocate(const uint64_t size, const uint64_t alignment) noexcept
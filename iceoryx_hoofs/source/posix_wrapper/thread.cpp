@@ -49,5 +49,16 @@ ThreadName_t getThreadName(pthread_t thread) noexcept
     return ThreadName_t(cxx::TruncateToCapacity, tempName);
 }
 
+bool setThreadAffinity(pthread_t thread, const uint64_t cpuMask) noexcept
+{
+    return !posixCall(iox_pthread_setaffinity_np)(thread, cpuMask)
+                .returnValueMatchesErrno()
+                .evaluate()
+                .or_else([](auto& r) {
+                    std::cerr << "Unable to set the thread affinity: " << r.getHumanReadableErrnum() << std::endl;
+                })
+                .has_error();
+}
+
 } // namespace posix
 } // namespace iox
\ No newline at end of file
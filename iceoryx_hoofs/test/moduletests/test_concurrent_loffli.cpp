@@ -199,4 +199,95 @@ TYPED_TEST(LoFFLi_test, PushToUninitializedLoFFLi)
     decltype(this->m_loffli) loFFLi;
     EXPECT_THAT(loFFLi.push(0), Eq(false));
 }
+
+TYPED_TEST(LoFFLi_test, PopNReturnsRequestedNumberOfIndices)
+{
+    constexpr uint32_t NUMBER_OF_INDICES{Size - 1U};
+    uint32_t indices[Size];
+    EXPECT_THAT(this->m_loffli.popN(indices, NUMBER_OF_INDICES), Eq(NUMBER_OF_INDICES));
+
+    for (uint32_t i = 0; i < NUMBER_OF_INDICES; i++)
+    {
+        EXPECT_THAT(indices[i], Eq(i));
+    }
+
+    uint32_t index;
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+    EXPECT_THAT(index, Eq(NUMBER_OF_INDICES));
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+}
+
+TYPED_TEST(LoFFLi_test, PopNReturnsRemainingIndicesWhenNotEnoughAreLeft)
+{
+    uint32_t index;
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+
+    uint32_t indices[Size + 1U];
+    EXPECT_THAT(this->m_loffli.popN(indices, Size + 1U), Eq(Size - 1U));
+    EXPECT_THAT(this->m_loffli.popN(indices, Size + 1U), Eq(0U));
+}
+
+TYPED_TEST(LoFFLi_test, PopNFromUninitializedLoFFLi)
+{
+    uint32_t indices[Size];
+    decltype(this->m_loffli) loFFLi;
+    EXPECT_THAT(loFFLi.popN(indices, Size), Eq(0U));
+}
+
+TYPED_TEST(LoFFLi_test, PushNReturnsAllIndices)
+{
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.popN(indices, Size), Eq(Size));
+
+    std::swap(indices[0], indices[Size - 1U]);
+    EXPECT_THAT(this->m_loffli.pushN(indices, Size), Eq(true));
+
+    std::vector<uint32_t> useListPoped;
+    uint32_t index;
+    while (this->m_loffli.pop(index))
+    {
+        useListPoped.push_back(index);
+    }
+
+    EXPECT_THAT(useListPoped, Eq(std::vector<uint32_t>(indices, indices + Size)));
+}
+
+TYPED_TEST(LoFFLi_test, PushNWithZeroIndicesSucceeds)
+{
+    uint32_t indices[Size]{};
+    EXPECT_THAT(this->m_loffli.pushN(indices, 0U), Eq(true));
+}
+
+TYPED_TEST(LoFFLi_test, PushNWithIndexNotPoppedFailsAndPushesNothing)
+{
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.popN(indices, 2U), Eq(2U));
+    indices[2U] = 3U;
+
+    EXPECT_THAT(this->m_loffli.pushN(indices, 3U), Eq(false));
+
+    // the valid indices are still popped and can be pushed afterwards
+    EXPECT_THAT(this->m_loffli.pushN(indices, 2U), Eq(true));
+    EXPECT_THAT(this->m_loffli.pushN(indices, 2U), Eq(false));
+}
+
+TYPED_TEST(LoFFLi_test, PushNWithDuplicatedIndexFails)
+{
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.popN(indices, 2U), Eq(2U));
+    indices[2U] = indices[0U];
+
+    EXPECT_THAT(this->m_loffli.pushN(indices, 3U), Eq(false));
+    EXPECT_THAT(this->m_loffli.pushN(indices, 2U), Eq(true));
+}
+
+TYPED_TEST(LoFFLi_test, PushNOutOfBoundIndex)
+{
+    uint32_t indices[Size];
+    ASSERT_THAT(this->m_loffli.popN(indices, 1U), Eq(1U));
+    indices[1U] = Size;
+
+    EXPECT_THAT(this->m_loffli.pushN(indices, 2U), Eq(false));
+}
+
 } // namespace
@@ -0,0 +1,213 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/fixed_type_queue.hpp"
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::cxx;
+
+template <VariantQueueTypes QueueType>
+using QueueType_t = std::integral_constant<VariantQueueTypes, QueueType>;
+
+template <typename T>
+class FixedTypeQueue_test : public Test
+{
+  public:
+    static constexpr VariantQueueTypes QUEUE_TYPE = T::value;
+    static constexpr uint64_t CAPACITY{5U};
+    using SutType_t = FixedTypeQueue<int, CAPACITY, QUEUE_TYPE>;
+
+    SutType_t sut;
+    VariantQueue<int, CAPACITY> variantQueue{QUEUE_TYPE};
+};
+
+template <typename T>
+constexpr VariantQueueTypes FixedTypeQueue_test<T>::QUEUE_TYPE;
+template <typename T>
+constexpr uint64_t FixedTypeQueue_test<T>::CAPACITY;
+
+typedef ::testing::Types<QueueType_t<VariantQueueTypes::FiFo_SingleProducerSingleConsumer>,
+                         QueueType_t<VariantQueueTypes::SoFi_SingleProducerSingleConsumer>,
+                         QueueType_t<VariantQueueTypes::FiFo_MultiProducerSingleConsumer>,
+                         QueueType_t<VariantQueueTypes::SoFi_MultiProducerSingleConsumer>>
+    QueueTypes;
+
+/// we require TYPED_TEST since we support gtest 1.8 for our safety targets
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+TYPED_TEST_CASE(FixedTypeQueue_test, QueueTypes);
+#pragma GCC diagnostic pop
+
+TYPED_TEST(FixedTypeQueue_test, isEmptyWhenCreated)
+{
+    EXPECT_THAT(this->sut.empty(), Eq(true));
+    EXPECT_THAT(this->sut.size(), Eq(0U));
+}
+
+TYPED_TEST(FixedTypeQueue_test, popsMultiElementsWhichWerePushed)
+{
+    this->sut.push(14123);
+    this->sut.push(24123);
+
+    auto element = this->sut.pop();
+    ASSERT_THAT(element.has_value(), Eq(true));
+    EXPECT_THAT(element.value(), Eq(14123));
+    element = this->sut.pop();
+    ASSERT_THAT(element.has_value(), Eq(true));
+    EXPECT_THAT(element.value(), Eq(24123));
+    EXPECT_THAT(this->sut.pop().has_value(), Eq(false));
+}
+
+TYPED_TEST(FixedTypeQueue_test, handlesOverflowLikeTheVariantQueue)
+{
+    // current SOFI can hold capacity +1 values, so push some more to ensure overflow
+    for (int i = 0; i < static_cast<int>(TestFixture::CAPACITY) + 3; ++i)
+    {
+        auto maybeOverflowValue = this->sut.push(i);
+        auto maybeVariantQueueOverflowValue = this->variantQueue.push(i);
+        ASSERT_THAT(maybeOverflowValue.has_value(), Eq(maybeVariantQueueOverflowValue.has_value()));
+        if (maybeOverflowValue.has_value())
+        {
+            EXPECT_THAT(maybeOverflowValue.value(), Eq(maybeVariantQueueOverflowValue.value()));
+        }
+    }
+    EXPECT_THAT(this->sut.size(), Eq(this->variantQueue.size()));
+
+    while (auto element = this->variantQueue.pop())
+    {
+        auto fixedTypeElement = this->sut.pop();
+        ASSERT_THAT(fixedTypeElement.has_value(), Eq(true));
+        EXPECT_THAT(fixedTypeElement.value(), Eq(element.value()));
+    }
+    EXPECT_THAT(this->sut.empty(), Eq(true));
+}
+
+TYPED_TEST(FixedTypeQueue_test, popBatchPopsNotMoreThanMaxNumberOfElementsInOrder)
+{
+    this->sut.push(14123);
+    this->sut.push(24123);
+    this->sut.push(34123);
+
+    std::vector<int> poppedElements;
+    auto numberOfPoppedElements = this->sut.popBatch(2U, [&](int& element) {
+        poppedElements.push_back(element);
+        return true;
+    });
+
+    EXPECT_THAT(numberOfPoppedElements, Eq(2U));
+    EXPECT_THAT(poppedElements, ElementsAre(14123, 24123));
+    EXPECT_THAT(this->sut.size(), Eq(1U));
+}
+
+TYPED_TEST(FixedTypeQueue_test, popBatchStopsWhenCallableReturnsFalse)
+{
+    this->sut.push(14123);
+    this->sut.push(24123);
+    this->sut.push(34123);
+
+    auto numberOfPoppedElements = this->sut.popBatch(5U, [&](int& element) { return element != 24123; });
+
+    EXPECT_THAT(numberOfPoppedElements, Eq(2U));
+    EXPECT_THAT(this->sut.size(), Eq(1U));
+}
+
+TYPED_TEST(FixedTypeQueue_test, hasTheCapacityOfTheVariantQueue)
+{
+    EXPECT_THAT(this->sut.capacity(), Eq(this->variantQueue.capacity()));
+}
+
+TYPED_TEST(FixedTypeQueue_test, requiresNotMoreMemoryThanTheVariantQueue)
+{
+    EXPECT_THAT(sizeof(typename TestFixture::SutType_t), Le(sizeof(VariantQueue<int, TestFixture::CAPACITY>)));
+    // besides the underlying queue, only the queue type is stored
+    EXPECT_THAT(sizeof(typename TestFixture::SutType_t),
+                Le(sizeof(typename TestFixture::SutType_t::fifo_t) + sizeof(VariantQueueTypes)));
+}
+
+TEST(FixedTypeQueueSingleType_test, singleProducerQueueRequiresLessMemoryThanTheVariantQueue)
+{
+    using SutType_t = FixedTypeQueue<int, 16U, VariantQueueTypes::SoFi_SingleProducerSingleConsumer>;
+    EXPECT_THAT(sizeof(SutType_t), Lt(sizeof(VariantQueue<int, 16U>)));
+}
+
+TEST(FixedTypeQueueSingleType_test, setCapacityOfResizeableQueueReducesCapacity)
+{
+    FixedTypeQueue<int, 5U, VariantQueueTypes::SoFi_MultiProducerSingleConsumer> sut;
+    EXPECT_THAT(sut.setCapacity(2U), Eq(true));
+    EXPECT_THAT(sut.capacity(), Eq(2U));
+}
+
+TEST(FixedTypeQueueSingleType_test, multiProducerFiFoConstructedWithSoFiTypeOverridesOldestElement)
+{
+    constexpr uint64_t CAPACITY{5U};
+    FixedTypeQueue<int, CAPACITY, VariantQueueTypes::FiFo_MultiProducerSingleConsumer> sut(
+        VariantQueueTypes::SoFi_MultiProducerSingleConsumer);
+    VariantQueue<int, CAPACITY> variantQueue(VariantQueueTypes::SoFi_MultiProducerSingleConsumer);
+
+    for (int i = 0; i < static_cast<int>(CAPACITY) + 3; ++i)
+    {
+        auto maybeOverflowValue = sut.push(i);
+        auto maybeVariantQueueOverflowValue = variantQueue.push(i);
+        ASSERT_THAT(maybeOverflowValue.has_value(), Eq(maybeVariantQueueOverflowValue.has_value()));
+        if (maybeOverflowValue.has_value())
+        {
+            EXPECT_THAT(maybeOverflowValue.value(), Eq(maybeVariantQueueOverflowValue.value()));
+        }
+    }
+
+    auto element = sut.pop();
+    ASSERT_THAT(element.has_value(), Eq(true));
+    EXPECT_THAT(element.value(), Eq(3));
+}
+
+TEST(FixedTypeQueueSingleType_test, multiProducerSoFiConstructedWithFiFoTypeRejectsNewElement)
+{
+    constexpr uint64_t CAPACITY{5U};
+    FixedTypeQueue<int, CAPACITY, VariantQueueTypes::SoFi_MultiProducerSingleConsumer> sut(
+        VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    for (int i = 0; i < static_cast<int>(CAPACITY); ++i)
+    {
+        EXPECT_THAT(sut.push(i).has_value(), Eq(false));
+    }
+
+    auto rejectedElement = sut.push(42);
+    ASSERT_THAT(rejectedElement.has_value(), Eq(true));
+    EXPECT_THAT(rejectedElement.value(), Eq(42));
+    auto element = sut.pop();
+    ASSERT_THAT(element.has_value(), Eq(true));
+    EXPECT_THAT(element.value(), Eq(0));
+}
+
+TEST(FixedTypeQueueSingleType_test, constructionWithDifferentQueueTypeTerminates)
+{
+    using SutType_t = FixedTypeQueue<int, 5U, VariantQueueTypes::FiFo_SingleProducerSingleConsumer>;
+    std::set_terminate([]() { std::cout << "", std::abort(); });
+    EXPECT_DEATH({ SutType_t sut(VariantQueueTypes::SoFi_SingleProducerSingleConsumer); }, ".*");
+}
+
+TEST(FixedTypeQueueSingleType_test, constructionOfMultiProducerQueueWithSingleProducerTypeTerminates)
+{
+    using SutType_t = FixedTypeQueue<int, 5U, VariantQueueTypes::FiFo_MultiProducerSingleConsumer>;
+    std::set_terminate([]() { std::cout << "", std::abort(); });
+    EXPECT_DEATH({ SutType_t sut(VariantQueueTypes::FiFo_SingleProducerSingleConsumer); }, ".*");
+}
+} // namespace
@@ -18,6 +18,8 @@
 #include "iceoryx_hoofs/cxx/variant_queue.hpp"
 #include "test.hpp"
 
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -131,6 +133,79 @@ TEST_F(VariantQueue_test, noPopWhenEmpty)
     });
 }
 
+TEST_F(VariantQueue_test, popBatchPopsAllElementsInOrderWhenMaxIsLarger)
+{
+    PerformTestForQueueTypes([](uint64_t typeID) {
+        VariantQueue<int, 5> sut(static_cast<VariantQueueTypes>(typeID));
+        sut.push(14123);
+        sut.push(24123);
+        sut.push(34123);
+
+        std::vector<int> poppedElements;
+        auto numberOfPoppedElements = sut.popBatch(5U, [&](int& element) {
+            poppedElements.push_back(element);
+            return true;
+        });
+
+        EXPECT_THAT(numberOfPoppedElements, Eq(3U));
+        EXPECT_THAT(poppedElements, ElementsAre(14123, 24123, 34123));
+        EXPECT_THAT(sut.empty(), Eq(true));
+    });
+}
+
+TEST_F(VariantQueue_test, popBatchPopsNotMoreThanMaxNumberOfElements)
+{
+    PerformTestForQueueTypes([](uint64_t typeID) {
+        VariantQueue<int, 5> sut(static_cast<VariantQueueTypes>(typeID));
+        sut.push(14123);
+        sut.push(24123);
+        sut.push(34123);
+
+        std::vector<int> poppedElements;
+        auto numberOfPoppedElements = sut.popBatch(2U, [&](int& element) {
+            poppedElements.push_back(element);
+            return true;
+        });
+
+        EXPECT_THAT(numberOfPoppedElements, Eq(2U));
+        EXPECT_THAT(poppedElements, ElementsAre(14123, 24123));
+        auto element = sut.pop();
+        ASSERT_THAT(element.has_value(), Eq(true));
+        EXPECT_THAT(element.value(), Eq(34123));
+    });
+}
+
+TEST_F(VariantQueue_test, popBatchStopsWhenCallableReturnsFalse)
+{
+    PerformTestForQueueTypes([](uint64_t typeID) {
+        VariantQueue<int, 5> sut(static_cast<VariantQueueTypes>(typeID));
+        sut.push(14123);
+        sut.push(24123);
+        sut.push(34123);
+
+        auto numberOfPoppedElements = sut.popBatch(5U, [&](int& element) { return element != 24123; });
+
+        EXPECT_THAT(numberOfPoppedElements, Eq(2U));
+        EXPECT_THAT(sut.size(), Eq(1U));
+    });
+}
+
+TEST_F(VariantQueue_test, popBatchOnEmptyQueueDoesNotCallCallable)
+{
+    PerformTestForQueueTypes([](uint64_t typeID) {
+        VariantQueue<int, 5> sut(static_cast<VariantQueueTypes>(typeID));
+
+        bool callableCalled{false};
+        auto numberOfPoppedElements = sut.popBatch(5U, [&](int&) {
+            callableCalled = true;
+            return true;
+        });
+
+        EXPECT_THAT(numberOfPoppedElements, Eq(0U));
+        EXPECT_THAT(callableCalled, Eq(false));
+    });
+}
+
 TEST_F(VariantQueue_test, underlyingTypeIsEmptyWhenCreated)
 {
     VariantQueue<int, 5> sut(static_cast<VariantQueueTypes>(0));
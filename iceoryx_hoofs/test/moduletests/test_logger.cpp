@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/internal/log/async_log_backend.hpp"
 #include "iceoryx_hoofs/log/logger.hpp"
 #include "iceoryx_hoofs/log/logging.hpp"
 #include "test.hpp"
@@ -24,6 +25,8 @@
 #include <iostream>
 #include <regex>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 namespace
 {
@@ -102,6 +105,8 @@ class IoxLogger_test : public Test, public IoxLogger_testBase
 
     void TearDown() override
     {
+        // the drain thread is global; stop it to not print into the output buffer of the following tests
+        iox::log::AsyncLogBackend::stop();
     }
 };
 
@@ -145,6 +150,115 @@ TEST_F(IoxLogger_test, SettingTheLogLevelForScopeResetsLogLevelAtEndOfScope)
     EXPECT_THAT(m_sut.GetLogLevel(), Eq(initialLogLevel));
 }
 
+TEST_F(IoxLogger_test, AsyncLogModePrintsEntryAfterFlush)
+{
+    m_sut.SetLogMode(iox::log::LogMode::kConsole | iox::log::LogMode::kAsync);
+
+    iox::log::LogEntry entry;
+    entry.level = iox::log::LogLevel::kError;
+    entry.message = "42";
+    m_sut.Log(entry);
+    iox::log::AsyncLogBackend::flush();
+
+    const std::string expected = formatDateTime(entry.time) + " [ Error ]: 42\n";
+    std::string output = std::regex_replace(outBuffer.str(), colorCode, std::string(""));
+
+    EXPECT_THAT(output, Eq(expected));
+}
+
+TEST_F(IoxLogger_test, AsyncLogModePrintsFormattedLogStreamAfterFlush)
+{
+    m_sut.SetLogMode(iox::log::LogMode::kConsole | iox::log::LogMode::kAsync);
+
+    m_sut.LogInfo() << "answer " << 42 << " " << -13 << " " << 1.5 << " " << iox::log::HexFormat(uint8_t(0xAB)) << " "
+                    << iox::log::BinFormat(uint8_t(0xA5)) << " " << std::string("done");
+    iox::log::AsyncLogBackend::flush();
+
+    std::string output = std::regex_replace(outBuffer.str(), colorCode, std::string(""));
+
+    EXPECT_THAT(output, HasSubstr("[ Info  ]: answer 42 -13 1.5 0xab 0b10100101 done\n"));
+}
+
+TEST_F(IoxLogger_test, AsyncLogModeTruncatesTooLongMessage)
+{
+    m_sut.SetLogMode(iox::log::LogMode::kConsole | iox::log::LogMode::kAsync);
+
+    iox::log::LogEntry entry;
+    entry.level = iox::log::LogLevel::kInfo;
+    entry.message = std::string(iox::log::LogRecord::MAX_MESSAGE_LENGTH + 10U, 'x');
+    m_sut.Log(entry);
+    iox::log::AsyncLogBackend::flush();
+
+    const std::string expected = std::string(iox::log::LogRecord::MAX_MESSAGE_LENGTH, 'x') + "\n";
+    const std::string output = outBuffer.str();
+
+    ASSERT_THAT(output.size(), Ge(expected.size()));
+    EXPECT_THAT(output.substr(output.size() - expected.size()), Eq(expected));
+    EXPECT_THAT(output.find(std::string(iox::log::LogRecord::MAX_MESSAGE_LENGTH + 1U, 'x')), Eq(std::string::npos));
+}
+
+TEST_F(IoxLogger_test, AsyncLogModePrintsFatalEntrySynchronouslyAfterPendingEntries)
+{
+    m_sut.SetLogMode(iox::log::LogMode::kConsole | iox::log::LogMode::kAsync);
+
+    iox::log::LogEntry entry;
+    entry.level = iox::log::LogLevel::kError;
+    entry.message = "pending";
+    m_sut.Log(entry);
+    entry.level = iox::log::LogLevel::kFatal;
+    entry.message = "fatal";
+    m_sut.Log(entry);
+
+    const std::string output = outBuffer.str();
+    const auto pendingPosition = output.find("pending");
+    const auto fatalPosition = output.find("fatal");
+
+    ASSERT_THAT(pendingPosition, Ne(std::string::npos));
+    ASSERT_THAT(fatalPosition, Ne(std::string::npos));
+    EXPECT_THAT(pendingPosition, Lt(fatalPosition));
+}
+
+TEST_F(IoxLogger_test, AsyncLogModePrintsEntriesOfAllThreadsInOrder)
+{
+    m_sut.SetLogMode(iox::log::LogMode::kConsole | iox::log::LogMode::kAsync);
+
+    constexpr uint64_t NUMBER_OF_THREADS{4U};
+    // less than the capacity of a ring buffer to never drop an entry
+    constexpr uint64_t NUMBER_OF_ENTRIES_PER_THREAD{iox::log::LogRecordRingBuffer::CAPACITY / 2U};
+
+    std::vector<std::thread> threads;
+    for (uint64_t threadIndex = 0U; threadIndex < NUMBER_OF_THREADS; ++threadIndex)
+    {
+        threads.emplace_back([&, threadIndex] {
+            for (uint64_t i = 0U; i < NUMBER_OF_ENTRIES_PER_THREAD; ++i)
+            {
+                iox::log::LogEntry entry;
+                entry.level = iox::log::LogLevel::kInfo;
+                entry.message = "t" + std::to_string(threadIndex) + "e" + std::to_string(i) + ";";
+                m_sut.Log(entry);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    iox::log::AsyncLogBackend::flush();
+
+    const std::string output = outBuffer.str();
+    for (uint64_t threadIndex = 0U; threadIndex < NUMBER_OF_THREADS; ++threadIndex)
+    {
+        std::string::size_type previousPosition{0U};
+        for (uint64_t i = 0U; i < NUMBER_OF_ENTRIES_PER_THREAD; ++i)
+        {
+            const auto position = output.find("t" + std::to_string(threadIndex) + "e" + std::to_string(i) + ";");
+            ASSERT_THAT(position, Ne(std::string::npos));
+            EXPECT_THAT(position, Ge(previousPosition));
+            previousPosition = position;
+        }
+    }
+}
+
 class IoxLoggerLogLevel_test : public TestWithParam<iox::log::LogLevel>, public IoxLogger_testBase
 {
   public:
@@ -155,6 +269,8 @@ class IoxLoggerLogLevel_test : public TestWithParam<iox::log::LogLevel>, public
 
     void TearDown() override
     {
+        // the drain thread is global; stop it to not print into the output buffer of the following tests
+        iox::log::AsyncLogBackend::stop();
     }
 };
 
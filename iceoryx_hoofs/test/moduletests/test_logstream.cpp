@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/internal/log/async_log_backend.hpp"
 #include "iceoryx_hoofs/log/logging.hpp"
 #include "iceoryx_hoofs/log/logstream.hpp"
 #include "iceoryx_hoofs/testing/mocks/logger_mock.hpp"
@@ -158,6 +159,20 @@ TEST_F(IoxLogStream_test, StreamOperatorLogLevel)
     EXPECT_THAT(loggerMock.m_logs[0].message, Eq("This is the iceoryx logger!Warn"));
 }
 
+TEST_F(IoxLogStream_test, AsyncLogModePassesFormattedMessageToLogger)
+{
+    loggerMock.SetLogMode(iox::log::LogMode::kConsole | iox::log::LogMode::kAsync);
+
+    iox::log::LogStream(loggerMock, iox::log::LogLevel::kInfo) << "The answer is " << 42;
+
+    // the drain thread is global; stop it to not influence the following tests
+    iox::log::AsyncLogBackend::stop();
+
+    ASSERT_THAT(loggerMock.m_logs.size(), Eq(1u));
+    EXPECT_THAT(loggerMock.m_logs[0].message, Eq("The answer is 42"));
+    EXPECT_THAT(loggerMock.m_logs[0].level, Eq(iox::log::LogLevel::kInfo));
+}
+
 TEST_F(IoxLogStream_test, StreamOperatorLogRawBuffer)
 {
     struct DummyStruct
@@ -94,4 +94,30 @@ TEST_F(Thread_test, SetAndGetSmallStringIsWorking)
     EXPECT_THAT(getResult, StrEq(stringShorterThanThreadNameCapacitiy));
 }
 #endif
+
+#if defined(__linux__)
+TEST_F(Thread_test, SetThreadAffinityRestrictsThreadToGivenCpu)
+{
+    cpu_set_t allowedCpus;
+    ASSERT_THAT(pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &allowedCpus), Eq(0));
+    uint64_t cpu{0U};
+    while (!CPU_ISSET(cpu, &allowedCpus))
+    {
+        ++cpu;
+    }
+    ASSERT_THAT(cpu, Lt(64U));
+
+    EXPECT_TRUE(setThreadAffinity(m_thread->native_handle(), static_cast<uint64_t>(1U) << cpu));
+
+    cpu_set_t cpusOfThread;
+    ASSERT_THAT(pthread_getaffinity_np(m_thread->native_handle(), sizeof(cpu_set_t), &cpusOfThread), Eq(0));
+    EXPECT_THAT(CPU_COUNT(&cpusOfThread), Eq(1));
+    EXPECT_TRUE(CPU_ISSET(cpu, &cpusOfThread));
+}
+
+TEST_F(Thread_test, SetThreadAffinityWithoutCpuFails)
+{
+    EXPECT_FALSE(setThreadAffinity(m_thread->native_handle(), 0U));
+}
+#endif
 } // namespace
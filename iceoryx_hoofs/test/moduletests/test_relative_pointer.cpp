@@ -438,6 +438,55 @@ TYPED_TEST(base_relative_ptr_test, memoryRemapping)
     }
 }
 
+TYPED_TEST(base_relative_ptr_test, searchIdFindsSegmentsRegisteredInArbitraryOrder)
+{
+    EXPECT_EQ(BaseRelativePointer::registerPtr(1, this->memoryPartition[1], SHARED_MEMORY_SIZE), true);
+    EXPECT_EQ(BaseRelativePointer::registerPtr(2, this->memoryPartition[0], SHARED_MEMORY_SIZE), true);
+
+    const uint64_t offsets[]{0U, SHARED_MEMORY_SIZE / 2U, SHARED_MEMORY_SIZE - 1U};
+    for (auto offset : offsets)
+    {
+        RelativePointer<TypeParam> rp1(reinterpret_cast<TypeParam*>(this->memoryPartition[1] + offset));
+        RelativePointer<TypeParam> rp2(reinterpret_cast<TypeParam*>(this->memoryPartition[0] + offset));
+        EXPECT_EQ(rp1.getId(), 1U);
+        EXPECT_EQ(rp1.getOffset(), offset);
+        EXPECT_EQ(rp2.getId(), 2U);
+        EXPECT_EQ(rp2.getOffset(), offset);
+    }
+
+    TypeParam notInSegment{};
+    RelativePointer<TypeParam> rp(&notInSegment);
+    EXPECT_EQ(rp.getId(), 0U);
+}
+
+TYPED_TEST(base_relative_ptr_test, searchIdDoesNotFindUnregisteredSegment)
+{
+    EXPECT_EQ(BaseRelativePointer::registerPtr(1, this->memoryPartition[0], SHARED_MEMORY_SIZE), true);
+    EXPECT_EQ(BaseRelativePointer::registerPtr(2, this->memoryPartition[1], SHARED_MEMORY_SIZE), true);
+    EXPECT_EQ(BaseRelativePointer::unregisterPtr(1), true);
+
+    RelativePointer<TypeParam> rp1(reinterpret_cast<TypeParam*>(this->memoryPartition[0]));
+    RelativePointer<TypeParam> rp2(reinterpret_cast<TypeParam*>(this->memoryPartition[1]));
+    EXPECT_EQ(rp1.getId(), 0U);
+    EXPECT_EQ(rp2.getId(), 2U);
+}
+
+TYPED_TEST(base_relative_ptr_test, searchIdReturnsFirstIdForOverlappingSegments)
+{
+    constexpr uint64_t OFFSET{SHARED_MEMORY_SIZE / 2};
+    EXPECT_EQ(BaseRelativePointer::registerPtr(1, this->memoryPartition[0] + OFFSET, OFFSET), true);
+    EXPECT_EQ(BaseRelativePointer::registerPtr(2, this->memoryPartition[0], SHARED_MEMORY_SIZE), true);
+
+    RelativePointer<TypeParam> rp1(reinterpret_cast<TypeParam*>(this->memoryPartition[0] + OFFSET));
+    RelativePointer<TypeParam> rp2(reinterpret_cast<TypeParam*>(this->memoryPartition[0]));
+    EXPECT_EQ(rp1.getId(), 1U);
+    EXPECT_EQ(rp2.getId(), 2U);
+
+    EXPECT_EQ(BaseRelativePointer::unregisterPtr(1), true);
+    RelativePointer<TypeParam> rp3(reinterpret_cast<TypeParam*>(this->memoryPartition[0] + OFFSET));
+    EXPECT_EQ(rp3.getId(), 2U);
+}
+
 TYPED_TEST(base_relative_ptr_test, compileTest)
 {
     // No functional test. Tests if code compiles
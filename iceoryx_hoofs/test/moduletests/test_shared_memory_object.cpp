@@ -19,6 +19,8 @@
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
 #include "test.hpp"
 
+#include <algorithm>
+
 namespace
 {
 using namespace testing;
@@ -177,4 +179,61 @@ TEST_F(SharedMemoryObject_Test, OpeningSharedMemoryAndReadMultipleContents)
     EXPECT_THAT(*sutValue1, Eq(4557));
     EXPECT_THAT(*sutValue2, Eq(8912));
 }
+
+TEST_F(SharedMemoryObject_Test, CreatedMemoryIsZeroedAndWritable)
+{
+    constexpr uint64_t MEMORY_SIZE{3U * 4096U + 128U};
+    auto sut = iox::posix::SharedMemoryObject::create("/shmZeroing",
+                                                      MEMORY_SIZE,
+                                                      iox::posix::AccessMode::READ_WRITE,
+                                                      iox::posix::OpenMode::PURGE_AND_CREATE,
+                                                      iox::posix::SharedMemoryObject::NO_ADDRESS_HINT,
+                                                      S_IRUSR | S_IWUSR);
+    ASSERT_FALSE(sut.has_error());
+
+    auto memory = static_cast<uint8_t*>(sut->getBaseAddress());
+    EXPECT_TRUE(std::all_of(memory, memory + sut->getSizeInBytes(), [](const uint8_t byte) { return byte == 0U; }));
+
+    std::fill(memory, memory + sut->getSizeInBytes(), 0xAAU);
+    EXPECT_THAT(memory[sut->getSizeInBytes() - 1U], Eq(0xAAU));
+}
+
+TEST_F(SharedMemoryObject_Test, SizeIsAlignedToHugePageSizeWhenHugePagesAreUsed)
+{
+    constexpr uint64_t MEMORY_SIZE{3U * 4096U + 128U};
+    iox::posix::PagingOptions pagingOptions;
+    pagingOptions.useHugePages = true;
+    auto sut = iox::posix::SharedMemoryObject::create("/shmHugePages",
+                                                      MEMORY_SIZE,
+                                                      iox::posix::AccessMode::READ_WRITE,
+                                                      iox::posix::OpenMode::PURGE_AND_CREATE,
+                                                      iox::posix::SharedMemoryObject::NO_ADDRESS_HINT,
+                                                      S_IRUSR | S_IWUSR,
+                                                      pagingOptions);
+    ASSERT_FALSE(sut.has_error());
+
+    EXPECT_THAT(sut->getSizeInBytes(), Eq(iox::posix::SharedMemoryObject::HUGE_PAGE_SIZE));
+    auto memory = static_cast<uint8_t*>(sut->getBaseAddress());
+    EXPECT_TRUE(std::all_of(memory, memory + sut->getSizeInBytes(), [](const uint8_t byte) { return byte == 0U; }));
+}
+
+TEST_F(SharedMemoryObject_Test, MemoryIsUsableWhenPagesAreLocked)
+{
+    constexpr uint64_t MEMORY_SIZE{3U * 4096U + 128U};
+    iox::posix::PagingOptions pagingOptions;
+    pagingOptions.lockPages = true;
+    // locking might fail due to the RLIMIT_MEMLOCK, which only results in a warning
+    auto sut = iox::posix::SharedMemoryObject::create("/shmLockedPages",
+                                                      MEMORY_SIZE,
+                                                      iox::posix::AccessMode::READ_WRITE,
+                                                      iox::posix::OpenMode::PURGE_AND_CREATE,
+                                                      iox::posix::SharedMemoryObject::NO_ADDRESS_HINT,
+                                                      S_IRUSR | S_IWUSR,
+                                                      pagingOptions);
+    ASSERT_FALSE(sut.has_error());
+
+    auto memory = static_cast<uint8_t*>(sut->getBaseAddress());
+    std::fill(memory, memory + sut->getSizeInBytes(), 0xAAU);
+    EXPECT_THAT(memory[sut->getSizeInBytes() - 1U], Eq(0xAAU));
+}
 } // namespace
@@ -0,0 +1,114 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace iox;
+
+constexpr uint64_t MEMORY_SIZE{512U * 1024U * 1024U};
+constexpr uint64_t STRIDE{4096U};
+constexpr uint64_t NUMBER_OF_ROUNDS{10U};
+
+/// @brief reads one word of every page in a random order; with regular pages nearly every access misses the TLB,
+/// with huge pages 512 pages share one TLB entry
+double scanPagesInRandomOrder(const uint64_t* memory, const std::vector<uint32_t>& pageOrder, uint64_t& checksum)
+{
+    constexpr uint64_t WORDS_PER_STRIDE{STRIDE / sizeof(uint64_t)};
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t round = 0U; round < NUMBER_OF_ROUNDS; ++round)
+    {
+        for (auto page : pageOrder)
+        {
+            checksum += memory[page * WORDS_PER_STRIDE];
+        }
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count())
+           / static_cast<double>(NUMBER_OF_ROUNDS * pageOrder.size());
+}
+
+/// @brief reads the whole memory sequentially like a subscriber which processes a large payload
+double scanSequentially(const uint64_t* memory, uint64_t& checksum)
+{
+    constexpr uint64_t NUMBER_OF_WORDS{MEMORY_SIZE / sizeof(uint64_t)};
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t round = 0U; round < NUMBER_OF_ROUNDS; ++round)
+    {
+        checksum += std::accumulate(memory, memory + NUMBER_OF_WORDS, static_cast<uint64_t>(0U));
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count())
+           / static_cast<double>(NUMBER_OF_ROUNDS * NUMBER_OF_WORDS);
+}
+
+void benchmarkPayloadScan(const bool useHugePages, const std::vector<uint32_t>& pageOrder)
+{
+    posix::PagingOptions pagingOptions;
+    pagingOptions.useHugePages = useHugePages;
+    auto sharedMemoryObject = posix::SharedMemoryObject::create("/iox-bm-payload-scan",
+                                                                MEMORY_SIZE,
+                                                                posix::AccessMode::READ_WRITE,
+                                                                posix::OpenMode::PURGE_AND_CREATE,
+                                                                posix::SharedMemoryObject::NO_ADDRESS_HINT,
+                                                                S_IRUSR | S_IWUSR,
+                                                                pagingOptions);
+    if (sharedMemoryObject.has_error())
+    {
+        std::cerr << "Could not create the shared memory!" << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    auto memory = static_cast<uint64_t*>(sharedMemoryObject->getBaseAddress());
+    std::fill(memory, memory + MEMORY_SIZE / sizeof(uint64_t), 1U);
+
+    // the checksum is printed to prevent the compiler from removing the scans
+    uint64_t checksum{0U};
+    auto randomPageAccess = scanPagesInRandomOrder(memory, pageOrder, checksum);
+    auto sequentialAccess = scanSequentially(memory, checksum);
+
+    std::cout << std::setw(8) << (useHugePages ? "huge" : "regular") << " | " << std::setw(21) << std::fixed
+              << std::setprecision(2) << randomPageAccess << " | " << std::setw(25) << sequentialAccess << " | "
+              << checksum << std::endl;
+}
+
+int main()
+{
+    std::vector<uint32_t> pageOrder(MEMORY_SIZE / STRIDE);
+    std::iota(pageOrder.begin(), pageOrder.end(), 0U);
+    // a fixed seed makes the runs comparable
+    std::shuffle(pageOrder.begin(), pageOrder.end(), std::mt19937(42U));
+
+    std::cout << "   Pages | Random page read [ns] | Sequential word read [ns] | Checksum" << std::endl;
+    std::cout << "---------|-----------------------|---------------------------|---------" << std::endl;
+
+    for (bool useHugePages : {false, true})
+    {
+        benchmarkPayloadScan(useHugePages, pageOrder);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,88 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace iox;
+
+constexpr uint64_t NUMBER_OF_ITERATIONS{10000000U};
+constexpr uint64_t SEGMENT_SIZE{4096U};
+constexpr uint32_t MAX_SEGMENTS{100U};
+
+/// @brief measures the average time to construct a RelativePointer from a raw pointer, which requires to search the
+/// id of the segment the pointer belongs to, when the given number of segments is registered
+void benchmarkConstructionFromRawPointer(const uint32_t numberOfSegments)
+{
+    std::unique_ptr<uint8_t[]> memory(new uint8_t[MAX_SEGMENTS * SEGMENT_SIZE]);
+
+    // register the segments in reverse order of their addresses like they would be registered with arbitrary
+    // addresses returned by mmap
+    std::vector<uint8_t*> pointersInSegments;
+    for (uint32_t i = 0U; i < numberOfSegments; ++i)
+    {
+        auto segment = memory.get() + (numberOfSegments - 1U - i) * SEGMENT_SIZE;
+        if (!rp::BaseRelativePointer::isValid(rp::BaseRelativePointer::registerPtr(segment, SEGMENT_SIZE)))
+        {
+            std::cerr << "Could not register a segment!" << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        pointersInSegments.push_back(segment + SEGMENT_SIZE / 2U);
+    }
+
+    uint64_t idSum{0U};
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+    {
+        rp::RelativePointer<uint8_t> relativePointer(pointersInSegments[i % numberOfSegments]);
+        idSum += relativePointer.getId();
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    // every segment is hit equally often, therefore the sum of the ids is known
+    const uint64_t hitsPerSegment = NUMBER_OF_ITERATIONS / numberOfSegments;
+    if (idSum != hitsPerSegment * numberOfSegments * (numberOfSegments + 1U) / 2U)
+    {
+        std::cerr << "A pointer was assigned to the wrong segment!" << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    auto averageLatency = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count())
+                          / static_cast<double>(NUMBER_OF_ITERATIONS);
+    std::cout << std::setw(9) << numberOfSegments << " | " << std::setw(17) << std::fixed << std::setprecision(2)
+              << averageLatency << std::endl;
+
+    rp::BaseRelativePointer::unregisterAll();
+}
+
+int main()
+{
+    std::cout << " Segments | Construction [ns]" << std::endl;
+    std::cout << "----------|------------------" << std::endl;
+
+    for (uint32_t numberOfSegments : {1U, 10U, 100U})
+    {
+        benchmarkConstructionFromRawPointer(numberOfSegments);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -35,6 +35,15 @@ class Logger_Mock : public iox::log::Logger
         m_logs.push_back(entry);
     }
 
+    void LogAsync(const iox::log::LogRecord& record) const noexcept override
+    {
+        iox::log::LogEntry entry;
+        entry.level = record.level;
+        entry.time = record.time;
+        entry.message.assign(record.message, record.messageLength);
+        m_logs.push_back(entry);
+    }
+
     mutable std::vector<iox::log::LogEntry> m_logs;
 };
 
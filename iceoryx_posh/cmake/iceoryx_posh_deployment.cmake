@@ -37,6 +37,16 @@ if(NOT IOX_MAX_SUBSCRIBERS)
 endif()
 message(STATUS "[i] IOX_MAX_SUBSCRIBERS:" ${IOX_MAX_SUBSCRIBERS})
 
+if(NOT IOX_MAX_CLIENTS)
+    set(IOX_MAX_CLIENTS 512)
+endif()
+message(STATUS "[i] IOX_MAX_CLIENTS:" ${IOX_MAX_CLIENTS})
+
+if(NOT IOX_MAX_SERVERS)
+    set(IOX_MAX_SERVERS 128)
+endif()
+message(STATUS "[i] IOX_MAX_SERVERS:" ${IOX_MAX_SERVERS})
+
 if(NOT IOX_MAX_INTERFACE_NUMBER)
     set(IOX_MAX_INTERFACE_NUMBER 4)
 endif()
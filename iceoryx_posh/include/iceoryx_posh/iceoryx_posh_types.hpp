@@ -83,12 +83,12 @@ constexpr uint32_t MAX_INTERFACE_CAPRO_FIFO_SIZE = MAX_PUBLISHERS;
 constexpr uint32_t MAX_CHANNEL_NUMBER = MAX_PUBLISHERS + MAX_SUBSCRIBERS;
 constexpr uint32_t MAX_GATEWAY_SERVICES = 2 * MAX_CHANNEL_NUMBER;
 // Client
-constexpr uint32_t MAX_CLIENTS = build::IOX_MAX_SUBSCRIBERS; /// @todo
+constexpr uint32_t MAX_CLIENTS = build::IOX_MAX_CLIENTS;
 constexpr uint32_t MAX_REQUESTS_ALLOCATED_SIMULTANEOUSLY = 4U;
 constexpr uint32_t MAX_RESPONSES_PROCESSED_SIMULTANEOUSLY = 16U;
 constexpr uint32_t MAX_RESPONSE_QUEUE_CAPACITY = 16U;
 // Server
-constexpr uint32_t MAX_SERVERS = build::IOX_MAX_PUBLISHERS; /// @todo
+constexpr uint32_t MAX_SERVERS = build::IOX_MAX_SERVERS;
 constexpr uint32_t MAX_CLIENTS_PER_SERVER = 256U;
 constexpr uint32_t MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY = 4U;
 constexpr uint32_t MAX_RESPONSES_ALLOCATED_SIMULTANEOUSLY = MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY;
@@ -107,6 +107,7 @@ static_assert(MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET <= MAX_NUMBER_OF_NOTIFIERS_P
 constexpr uint8_t MAX_NUMBER_OF_EVENTS_PER_LISTENER = 128U;
 static_assert(MAX_NUMBER_OF_EVENTS_PER_LISTENER <= MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE,
               "The Listener capacity is restricted by the maximum amount of notifiers per condition variable.");
+constexpr uint32_t MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER = 16U;
 //--------- Communication Resources End---------------------
 
 constexpr uint32_t MAX_APPLICATION_CAPRO_FIFO_SIZE = 128U;
@@ -117,6 +118,8 @@ constexpr uint32_t MAX_SHM_SEGMENTS = 100U;
 
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_PROVIDER = 8U;
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_BLOCKS_PER_MEMORY_PROVIDER = 64U;
+/// @brief number of chunks a publisher keeps in its chunk cache when the chunk cache is enabled for the segment
+constexpr uint32_t CHUNK_CACHE_CAPACITY{8U};
 
 constexpr uint32_t CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT{8U};
 constexpr uint32_t CHUNK_NO_USER_HEADER_SIZE{0U};
@@ -188,7 +191,8 @@ struct DefaultChunkDistributorConfig
     static constexpr uint64_t MAX_HISTORY_CAPACITY = MAX_PUBLISHER_HISTORY;
 };
 
-// Default properties of ChunkQueueData
+// Default properties of ChunkQueueData; there is no QUEUE_TYPE since the queue type of a subscriber depends on its
+// QueueFullPolicy, which is only known at runtime
 struct DefaultChunkQueueConfig
 {
     static constexpr uint64_t MAX_QUEUE_CAPACITY = MAX_SUBSCRIBER_QUEUE_CAPACITY;
@@ -221,6 +225,11 @@ constexpr units::Duration PROCESS_DEFAULT_KILL_DELAY = 45_s;
 constexpr units::Duration PROCESS_TERMINATED_CHECK_INTERVAL = 250_ms;
 constexpr units::Duration DISCOVERY_INTERVAL = 100_ms;
 
+/// @brief the messages of the runtimes are processed by worker threads, the messages of one runtime are always
+/// processed by the same worker thread to preserve their order
+constexpr uint32_t DEFAULT_NUMBER_OF_RUNTIME_MESSAGE_WORKER_THREADS{4U};
+constexpr uint32_t MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKER_THREADS{64U};
+
 /// @brief Controls process alive monitoring. Upon timeout, a monitored process is removed
 /// and its resources are made available. The process can then start and register itself again.
 /// Contrarily, unmonitored processes can be restarted but registration will fail.
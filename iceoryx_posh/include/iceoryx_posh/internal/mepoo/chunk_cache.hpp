@@ -0,0 +1,50 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_MEPOO_CHUNK_CACHE_HPP
+#define IOX_POSH_MEPOO_CHUNK_CACHE_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <cstdint>
+#include <limits>
+
+namespace iox
+{
+namespace mepoo
+{
+/// @brief Chunks which were acquired in advance from a single mempool of a MemoryManager. The chunks are acquired
+/// and returned in batches by the MemoryManager, which reduces the contention on the free lists of the mempool when
+/// multiple publishers loan chunks concurrently.
+/// @note The ChunkCache is not thread-safe and must be used only by one thread at a time. It stores only indices and
+/// can therefore be placed in shared memory, e.g. in the data of a publisher port. This allows RouDi to return the
+/// cached chunks to the mempools with MemoryManager::releaseChunkCache if the owning process terminates.
+struct ChunkCache
+{
+    static constexpr uint32_t CAPACITY{CHUNK_CACHE_CAPACITY};
+    static constexpr uint32_t NO_MEMPOOL{std::numeric_limits<uint32_t>::max()};
+
+    /// @brief index of the mempool the cached chunks belong to or NO_MEMPOOL if nothing was cached yet
+    uint32_t m_memPoolIndex{NO_MEMPOOL};
+    uint32_t m_size{0U};
+    uint32_t m_chunkIndices[CAPACITY]{};
+    uint32_t m_chunkManagementIndices[CAPACITY]{};
+};
+
+} // namespace mepoo
+} // namespace iox
+
+#endif // IOX_POSH_MEPOO_CHUNK_CACHE_HPP
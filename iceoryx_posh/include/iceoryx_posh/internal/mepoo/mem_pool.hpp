@@ -36,12 +36,14 @@ struct MemPoolInfo
     MemPoolInfo(const uint32_t usedChunks,
                 const uint32_t minFreeChunks,
                 const uint32_t numChunks,
-                const uint32_t chunkSize) noexcept;
+                const uint32_t chunkSize,
+                const uint64_t spilledChunks = 0U) noexcept;
 
     uint32_t m_usedChunks{0};
     uint32_t m_minFreeChunks{0};
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
+    uint64_t m_spilledChunks{0};
 };
 
 class MemPool
@@ -65,10 +67,33 @@ class MemPool
     uint32_t getChunkCount() const noexcept;
     uint32_t getUsedChunks() const noexcept;
     uint32_t getMinFree() const noexcept;
+    uint64_t getSpilledChunks() const noexcept;
     MemPoolInfo getInfo() const noexcept;
 
+    /// @brief records that a chunk request which fits into this mempool was served by a larger mempool since this
+    /// one was exhausted
+    void increaseSpilledChunks() noexcept;
+
     void freeChunk(const void* chunk) noexcept;
 
+    /// @brief acquires up to numberOfChunks chunks at once; the chunk statistics are updated only once for all of them
+    /// @param[out] chunkIndices array with space for at least numberOfChunks elements which is filled with the indices
+    /// of the acquired chunks
+    /// @param[in] numberOfChunks the maximum number of chunks to acquire
+    /// @return the number of acquired chunks, less than numberOfChunks if the mempool is running out of chunks
+    uint32_t getChunks(uint32_t* const chunkIndices, const uint32_t numberOfChunks) noexcept;
+
+    /// @brief returns multiple chunks at once; the chunk statistics are updated only once for all of them
+    /// @param[in] chunkIndices array with the indices of the chunks to return
+    /// @param[in] numberOfChunks the number of elements in chunkIndices
+    void freeChunks(const uint32_t* const chunkIndices, const uint32_t numberOfChunks) noexcept;
+
+    /// @brief converts the index of a chunk acquired with getChunks into the address of that chunk
+    void* indexToPointer(const uint32_t index) const noexcept;
+
+    /// @brief converts the address of a chunk of this mempool into its index, e.g. to return it with freeChunks
+    uint32_t pointerToIndex(const void* const chunk) const noexcept;
+
   private:
     void adjustMinFree() noexcept;
     bool isMultipleOfAlignment(const uint32_t value) const noexcept;
@@ -84,6 +109,7 @@ class MemPool
     std::atomic<uint32_t> m_usedChunks{0U};
     std::atomic<uint32_t> m_minFree{0U};
     /// @todo: end
+    std::atomic<uint64_t> m_spilledChunks{0U};
 
     freeList_t m_freeIndices;
 };
@@ -20,9 +20,12 @@
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_cache.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
 
 #include <cstdint>
 #include <limits>
@@ -39,13 +42,24 @@ class LogStream;
 }
 namespace mepoo
 {
-struct MePooConfig;
-
 class MemoryManager
 {
     using MaxChunkPayloadSize_t = cxx::range<uint32_t, 1, std::numeric_limits<uint32_t>::max() - sizeof(ChunkHeader)>;
 
+    /// @brief every power of two range of chunk sizes is split into 2^SIZE_CLASS_SUBDIVISION_BITS size classes
+    static constexpr uint32_t SIZE_CLASS_SUBDIVISION_BITS{3U};
+    static constexpr uint32_t SIZE_CLASSES_PER_POWER_OF_TWO{1U << SIZE_CLASS_SUBDIVISION_BITS};
+    static constexpr uint32_t NUMBER_OF_SIZE_CLASSES{(32U - SIZE_CLASS_SUBDIVISION_BITS + 1U)
+                                                     * SIZE_CLASSES_PER_POWER_OF_TWO};
+
+    using MemPoolIndex_t = uint8_t;
+    static_assert(MAX_NUMBER_OF_MEMPOOLS <= std::numeric_limits<MemPoolIndex_t>::max(),
+                  "MemPoolIndex_t is too small to index all mempools");
+
   public:
+    /// @brief the maximum number of chunks which are acquired or released with one operation on a free list
+    static constexpr uint32_t MAX_CHUNKS_PER_BATCH{32U};
+
     MemoryManager() noexcept = default;
     MemoryManager(const MemoryManager&) = delete;
     MemoryManager(MemoryManager&&) = delete;
@@ -59,6 +73,36 @@ class MemoryManager
 
     SharedChunk getChunk(const ChunkSettings& chunkSettings) noexcept;
 
+    /// @brief acquires a chunk like getChunk(chunkSettings) but serves it from the chunk cache if the chunk cache is
+    /// enabled in the MePooConfig; an empty chunk cache is refilled with up to ChunkCache::CAPACITY chunks of the best
+    /// fitting mempool at once and a chunk cache holding chunks of another mempool is released first
+    /// @param[in] chunkSettings for the requested chunk
+    /// @param[in] chunkCache the chunk cache of the caller
+    /// @return a SharedChunk to the acquired chunk or a SharedChunk to a nullptr if no chunk could be acquired
+    SharedChunk getChunk(const ChunkSettings& chunkSettings, ChunkCache& chunkCache) noexcept;
+
+    /// @brief returns all chunks of the chunk cache to their mempool and leaves an empty chunk cache behind
+    /// @param[in] chunkCache the chunk cache to release
+    void releaseChunkCache(ChunkCache& chunkCache) noexcept;
+
+    /// @brief acquires multiple chunks at once with only a few operations on the free lists of the mempools
+    /// @param[in] chunkSettings for the requested chunks
+    /// @param[out] chunks array with space for at least numberOfChunks elements which is filled with the acquired
+    /// chunks
+    /// @param[in] numberOfChunks the number of chunks to acquire
+    /// @return the number of acquired chunks; less than numberOfChunks if the fitting mempools are running out of
+    /// chunks, which is not reported as error
+    uint32_t getChunks(const ChunkSettings& chunkSettings,
+                       SharedChunk* const chunks,
+                       const uint32_t numberOfChunks) noexcept;
+
+    /// @brief drops the reference of every given chunk; the chunks without other owners are returned to their
+    /// mempools with a single operation on the free lists per mempool
+    /// @param[in] chunks array of chunks to release; they are logical nullptr afterwards
+    /// @param[in] numberOfChunks the number of elements in chunks
+    /// @note the chunks may belong to different MemoryManager
+    static void releaseChunks(ShmSafeUnmanagedChunk* const chunks, const uint64_t numberOfChunks) noexcept;
+
     uint32_t getNumberOfMemPools() const noexcept;
 
     MemPoolInfo getMemPoolInfo(const uint32_t index) const noexcept;
@@ -70,19 +114,41 @@ class MemoryManager
   private:
     static uint32_t sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept;
 
+    /// @brief maps a chunk size to its size class; the mapping is monotonic, i.e. a larger chunk size never results
+    /// in a smaller size class
+    static uint32_t sizeClassOf(const uint32_t chunkSize) noexcept;
+
     void printMemPoolVector(log::LogStream& log) const noexcept;
     void addMemPool(posix::Allocator& managementAllocator,
                     posix::Allocator& chunkMemoryAllocator,
                     const cxx::greater_or_equal<uint32_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
                     const cxx::greater_or_equal<uint32_t, 1> numberOfChunks) noexcept;
     void generateChunkManagementPool(posix::Allocator& managementAllocator) noexcept;
+    void generateSizeClassIndex() noexcept;
+    uint32_t bestFittingMemPoolIndex(const uint32_t requiredChunkSize) const noexcept;
+    uint32_t acquireChunkIndices(MemPool& memPool,
+                                 uint32_t* const chunkIndices,
+                                 uint32_t* const chunkManagementIndices,
+                                 const uint32_t numberOfChunks) noexcept;
+    SharedChunk createSharedChunk(MemPool& memPool,
+                                  const uint32_t chunkIndex,
+                                  const uint32_t chunkManagementIndex,
+                                  const ChunkSettings& chunkSettings) noexcept;
+    static void freeUnreferencedChunks(ChunkManagement** const chunkManagements,
+                                       const uint32_t numberOfChunks) noexcept;
 
   private:
     bool m_denyAddMemPool{false};
+    MemPoolOverflowPolicy m_overflowPolicy{MemPoolOverflowPolicy::REJECT_ALLOCATION};
+    bool m_chunkCacheEnabled{false};
     uint32_t m_totalNumberOfChunks{0};
 
     cxx::vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
     cxx::vector<MemPool, 1> m_chunkManagementPool;
+
+    /// @brief for every size class the index of the first mempool which could contain a chunk of that size class;
+    /// since the mempools are ordered by increasing chunk size, all mempools before this index are too small
+    MemPoolIndex_t m_sizeClassIndex[NUMBER_OF_SIZE_CLASSES]{};
 };
 
 } // namespace mepoo
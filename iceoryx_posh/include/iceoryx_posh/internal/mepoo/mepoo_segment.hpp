@@ -42,13 +42,15 @@ class MePooSegment
     posix::PosixGroup getWriterGroup() const noexcept;
     posix::PosixGroup getReaderGroup() const noexcept;
     const SharedMemoryObjectType& getSharedMemoryObject() const noexcept;
+    const iox::mepoo::MemoryInfo& getMemoryInfo() const noexcept;
     MemoryManagerType& getMemoryManager() noexcept;
 
     uint64_t getSegmentId() const noexcept;
 
   protected:
     SharedMemoryObjectType createSharedMemoryObject(const MePooConfig& mempoolConfig,
-                                                    const posix::PosixGroup& writerGroup) noexcept;
+                                                    const posix::PosixGroup& writerGroup,
+                                                    const iox::mepoo::MemoryInfo& memoryInfo) noexcept;
 
   protected:
     SharedMemoryObjectType m_sharedMemoryObject;
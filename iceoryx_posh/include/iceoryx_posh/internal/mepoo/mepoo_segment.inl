@@ -34,7 +34,7 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
     const posix::PosixGroup& readerGroup,
     const posix::PosixGroup& writerGroup,
     const iox::mepoo::MemoryInfo& memoryInfo) noexcept
-    : m_sharedMemoryObject(std::move(createSharedMemoryObject(mempoolConfig, writerGroup)))
+    : m_sharedMemoryObject(std::move(createSharedMemoryObject(mempoolConfig, writerGroup, memoryInfo)))
     , m_readerGroup(readerGroup)
     , m_writerGroup(writerGroup)
     , m_memoryInfo(memoryInfo)
@@ -63,7 +63,9 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
 
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManagerType>::createSharedMemoryObject(
-    const MePooConfig& mempoolConfig, const posix::PosixGroup& writerGroup) noexcept
+    const MePooConfig& mempoolConfig,
+    const posix::PosixGroup& writerGroup,
+    const iox::mepoo::MemoryInfo& memoryInfo) noexcept
 {
     // we let the OS decide where to map the shm segments
     constexpr void* BASE_ADDRESS_HINT{nullptr};
@@ -78,7 +80,8 @@ inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManager
                                        posix::AccessMode::READ_WRITE,
                                        posix::OpenMode::PURGE_AND_CREATE,
                                        BASE_ADDRESS_HINT,
-                                       static_cast<mode_t>(S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP))
+                                       static_cast<mode_t>(S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP),
+                                       posix::PagingOptions{memoryInfo.useHugePages, memoryInfo.lockMemory})
             .and_then([this](auto& sharedMemoryObject) {
                 this->setSegmentId(iox::rp::BaseRelativePointer::registerPtr(sharedMemoryObject.getBaseAddress(),
                                                                              sharedMemoryObject.getSizeInBytes()));
@@ -116,6 +119,13 @@ MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSharedMemoryObject()
     return m_sharedMemoryObject;
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline const iox::mepoo::MemoryInfo&
+MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getMemoryInfo() const noexcept
+{
+    return m_memoryInfo;
+}
+
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline uint64_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSegmentId() const noexcept
 {
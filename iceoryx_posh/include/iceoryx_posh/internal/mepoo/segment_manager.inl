@@ -72,7 +72,8 @@ SegmentManager<SegmentType>::getSegmentMappings(const posix::PosixUser& user) no
                                                   segment.getSharedMemoryObject().getBaseAddress(),
                                                   segment.getSharedMemoryObject().getSizeInBytes(),
                                                   true,
-                                                  segment.getSegmentId());
+                                                  segment.getSegmentId(),
+                                                  segment.getMemoryInfo());
                     foundInWriterGroup = true;
                 }
                 else
@@ -97,7 +98,8 @@ SegmentManager<SegmentType>::getSegmentMappings(const posix::PosixUser& user) no
                                               segment.getSharedMemoryObject().getBaseAddress(),
                                               segment.getSharedMemoryObject().getSizeInBytes(),
                                               false,
-                                              segment.getSegmentId());
+                                              segment.getSegmentId(),
+                                              segment.getMemoryInfo());
             }
         }
     }
@@ -0,0 +1,189 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BASE_CLIENT_INL
+#define IOX_POSH_POPO_BASE_CLIENT_INL
+
+namespace iox
+{
+namespace popo
+{
+template <typename port_t>
+inline BaseClient<port_t>::BaseClient(const capro::ServiceDescription& service,
+                                      const ClientOptions& clientOptions) noexcept
+    : m_port(*iox::runtime::PoshRuntime::getInstance().getMiddlewareClient(service, clientOptions))
+{
+}
+
+template <typename port_t>
+inline BaseClient<port_t>::~BaseClient() noexcept
+{
+    m_trigger.reset();
+    m_port.destroy();
+}
+
+template <typename port_t>
+inline uid_t BaseClient<port_t>::getUid() const noexcept
+{
+    return m_port.getUniqueID();
+}
+
+template <typename port_t>
+inline capro::ServiceDescription BaseClient<port_t>::getServiceDescription() const noexcept
+{
+    return m_port.getCaProServiceDescription();
+}
+
+template <typename port_t>
+inline void BaseClient<port_t>::connect() noexcept
+{
+    m_port.connect();
+}
+
+template <typename port_t>
+inline ConnectionState BaseClient<port_t>::getConnectionState() const noexcept
+{
+    return m_port.getConnectionState();
+}
+
+template <typename port_t>
+inline void BaseClient<port_t>::disconnect() noexcept
+{
+    m_port.disconnect();
+}
+
+template <typename port_t>
+inline bool BaseClient<port_t>::hasResponses() const noexcept
+{
+    return m_port.hasNewResponses();
+}
+
+template <typename port_t>
+inline bool BaseClient<port_t>::hasMissedResponses() noexcept
+{
+    return m_port.hasLostResponsesSinceLastCall();
+}
+
+template <typename port_t>
+inline void BaseClient<port_t>::invalidateTrigger(const uint64_t uniqueTriggerId) noexcept
+{
+    if (m_trigger.getUniqueId() == uniqueTriggerId)
+    {
+        m_port.unsetConditionVariable();
+        m_trigger.invalidate();
+    }
+}
+
+template <typename port_t>
+inline void BaseClient<port_t>::enableState(iox::popo::TriggerHandle&& triggerHandle,
+                                            const ClientState clientState) noexcept
+{
+    switch (clientState)
+    {
+    case ClientState::HAS_RESPONSE:
+        if (m_trigger)
+        {
+            LogWarn() << "The client is already attached with either the ClientState::HAS_RESPONSE or "
+                         "ClientEvent::RESPONSE_RECEIVED to a WaitSet/Listener. Detaching it from previous one and "
+                         "attaching it to the new one with ClientState::HAS_RESPONSE. Best practice is to call "
+                         "detach first.";
+            errorHandler(
+                Error::kPOPO__BASE_CLIENT_OVERRIDING_WITH_STATE_SINCE_HAS_RESPONSE_OR_RESPONSE_RECEIVED_ATTACHED,
+                nullptr,
+                ErrorLevel::MODERATE);
+        }
+        m_trigger = std::move(triggerHandle);
+        m_port.setConditionVariable(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId());
+        break;
+    }
+}
+
+template <typename port_t>
+inline WaitSetIsConditionSatisfiedCallback
+BaseClient<port_t>::getCallbackForIsStateConditionSatisfied(const ClientState clientState) const noexcept
+{
+    switch (clientState)
+    {
+    case ClientState::HAS_RESPONSE:
+        return {*this, &SelfType::hasResponses};
+    }
+    return {};
+}
+
+template <typename port_t>
+inline void BaseClient<port_t>::disableState(const ClientState clientState) noexcept
+{
+    switch (clientState)
+    {
+    case ClientState::HAS_RESPONSE:
+        m_trigger.reset();
+        m_port.unsetConditionVariable();
+        break;
+    }
+}
+
+template <typename port_t>
+inline void BaseClient<port_t>::enableEvent(iox::popo::TriggerHandle&& triggerHandle,
+                                            const ClientEvent clientEvent) noexcept
+{
+    switch (clientEvent)
+    {
+    case ClientEvent::RESPONSE_RECEIVED:
+        if (m_trigger)
+        {
+            LogWarn() << "The client is already attached with either the ClientState::HAS_RESPONSE or "
+                         "ClientEvent::RESPONSE_RECEIVED to a WaitSet/Listener. Detaching it from previous one and "
+                         "attaching it to the new one with ClientEvent::RESPONSE_RECEIVED. Best practice is to call "
+                         "detach first.";
+            errorHandler(
+                Error::kPOPO__BASE_CLIENT_OVERRIDING_WITH_EVENT_SINCE_HAS_RESPONSE_OR_RESPONSE_RECEIVED_ATTACHED,
+                nullptr,
+                ErrorLevel::MODERATE);
+        }
+        m_trigger = std::move(triggerHandle);
+        m_port.setConditionVariable(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId());
+        break;
+    }
+}
+
+template <typename port_t>
+inline void BaseClient<port_t>::disableEvent(const ClientEvent clientEvent) noexcept
+{
+    switch (clientEvent)
+    {
+    case ClientEvent::RESPONSE_RECEIVED:
+        m_trigger.reset();
+        m_port.unsetConditionVariable();
+        break;
+    }
+}
+
+template <typename port_t>
+inline const port_t& BaseClient<port_t>::port() const noexcept
+{
+    return m_port;
+}
+
+template <typename port_t>
+inline port_t& BaseClient<port_t>::port() noexcept
+{
+    return m_port;
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BASE_CLIENT_INL
@@ -91,6 +91,14 @@ inline cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> BaseSubscrib
     return m_port.tryGetChunk();
 }
 
+template <typename port_t>
+inline cxx::expected<uint64_t, ChunkReceiveResult>
+BaseSubscriber<port_t>::takeChunks(const uint64_t maxNumberOfChunks,
+                                   const cxx::function_ref<void(const mepoo::ChunkHeader*)> callable) noexcept
+{
+    return m_port.tryGetChunks(maxNumberOfChunks, callable);
+}
+
 template <typename port_t>
 inline void BaseSubscriber<port_t>::releaseQueuedData() noexcept
 {
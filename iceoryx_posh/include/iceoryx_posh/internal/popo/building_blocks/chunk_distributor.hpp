@@ -17,7 +17,10 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_HPP
 
+#include "iceoryx_hoofs/cxx/deadline_timer.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
@@ -47,8 +50,11 @@ enum class ChunkDistributorError
 /// This ChunkDistributor can be used with different LockingPolicies for different scenarios
 /// When different threads operate on it (e.g. application sends chunks and RouDi adds and removes queues),
 /// a locking policy must be used that ensures consistent data in the ChunkDistributorData.
+/// The stored queues are read without a lock when chunks are delivered. A modification of the queues is done on a copy
+/// which then replaces the queues that are read, see ChunkDistributorData::m_queues. Only modifications are serialized
+/// by the lock.
 /// @todo There are currently some challenge:
-/// For the stored queues and the history, containers are used which are not thread safe. Therefore we use an
+/// For the history, a container is used which is not thread safe. Therefore we use an
 /// inter-process mutex. But this can lead to deadlocks if a user process gets terminated while one of its
 /// threads is in the ChunkDistributor and holds a lock. An easier setup would be if changing the queues
 /// by a middleware thread and sending chunks by the user process would not interleave. I.e. there is no concurrent
@@ -66,6 +72,10 @@ class ChunkDistributor
     using ChunkQueueData_t = typename ChunkDistributorDataType::ChunkQueueData_t;
     using ChunkQueuePusher_t = typename ChunkDistributorDataType::ChunkQueuePusher_t;
 
+    /// @brief with SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER, a blocked delivery wakes up at least with this period
+    /// to check whether the subscribers it waits for are still connected
+    static constexpr units::Duration WAIT_FOR_SUBSCRIBER_RECHECK_PERIOD{units::Duration::fromMilliseconds(10U)};
+
     explicit ChunkDistributor(cxx::not_null<MemberType_t* const> chunkDistrubutorDataPtr) noexcept;
 
     ChunkDistributor(const ChunkDistributor& other) = delete;
@@ -96,9 +106,21 @@ class ChunkDistributor
     bool hasStoredQueues() const noexcept;
 
     /// @brief Deliver the provided shared chunk to all the stored chunk queues. The chunk will be added to the chunk
-    /// history
+    /// history. With SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER and full queues with QueueFullPolicy::BLOCK_PUBLISHER,
+    /// the call sleeps until these subscribers took a chunk or the maximum blocking time has passed
     /// @param[in] shared chunk to be delivered
-    void deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept;
+    /// @return the number of chunk queues which lost the chunk because they were full
+    uint64_t deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief Deliver the provided shared chunks in the given order to all the stored chunk queues and add them to the
+    /// chunk history. The stored queues are read once for all chunks and every chunk queue is notified once. With
+    /// SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER the chunks are delivered one by one like with
+    /// deliverToAllStoredQueues since a blocked delivery must not overtake the following chunks
+    /// @param[in] chunks array of shared chunks to be delivered
+    /// @param[in] numberOfChunks the number of elements in chunks
+    /// @return the sum of the number of chunk queues which lost a chunk over all chunks
+    uint64_t deliverBatchToAllStoredQueues(const mepoo::SharedChunk* const chunks,
+                                           const uint64_t numberOfChunks) noexcept;
 
     /// @brief Deliver the provided shared chunk to the provided chunk queue. The chunk will NOT be added to the chunk
     /// history
@@ -107,6 +129,26 @@ class ChunkDistributor
     /// @return false if a queue overflow occured, otherwise true
     bool deliverToQueue(cxx::not_null<ChunkQueueData_t* const> queue, mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Deliver the provided shared chunk only to the stored chunk queue with the provided unique id, e.g. a
+    /// response to the client which sent the request. The chunk will NOT be added to the chunk history. Like with
+    /// deliverToAllStoredQueues, a full queue with QueueFullPolicy::BLOCK_PUBLISHER blocks the call with
+    /// SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER, otherwise the chunk is lost for this queue
+    /// @param[in] uniqueQueueId is the unique id of the chunk queue to which the chunk shall be delivered
+    /// @param[in] lastKnownQueueIndex is the index of the chunk queue in the stored queues when it was looked up the
+    /// last time; the stored queues are only searched when the queue at this index has another unique id
+    /// @param[in] chunk is the shared chunk to be delivered
+    /// @return if there is no stored chunk queue with the unique id it returns ChunkDistributorError, otherwise success
+    cxx::expected<ChunkDistributorError> deliverToQueue(const UniquePortId uniqueQueueId,
+                                                        const uint32_t lastKnownQueueIndex,
+                                                        mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief Get the index of the stored chunk queue with the provided unique id
+    /// @param[in] uniqueQueueId is the unique id of the chunk queue
+    /// @param[in] lastKnownQueueIndex is the index which is checked before the stored queues are searched
+    /// @return the index of the chunk queue, an empty optional if there is no stored chunk queue with the unique id
+    cxx::optional<uint32_t> getQueueIndex(const UniquePortId uniqueQueueId,
+                                          const uint32_t lastKnownQueueIndex) const noexcept;
+
     /// @brief Update the chunk history but do not deliver the chunk to any chunk queue. E.g. use case is to to update a
     /// non offered field in ara
     /// @param[in] shared chunk add to the chunk history
@@ -131,6 +173,25 @@ class ChunkDistributor
     MemberType_t* getMembers() noexcept;
 
   private:
+    /// @brief calls the reader with the active version of the queue container without holding the lock
+    template <typename Reader>
+    void readQueues(const Reader& reader) const noexcept;
+
+    /// @brief calls the writer with a copy of the active version of the queue container, makes the modified copy the
+    /// active version and waits until the previous version is no longer read; the lock must be held by the caller
+    template <typename Writer>
+    void updateQueues(const Writer& writer) noexcept;
+
+    void waitForQueueReaders(const uint32_t version) const noexcept;
+
+    static cxx::optional<uint32_t> findQueueIndex(const typename MemberType_t::QueueContainer_t& queues,
+                                                  const UniquePortId uniqueQueueId,
+                                                  const uint32_t lastKnownQueueIndex) noexcept;
+
+    /// @brief like addToHistoryWithoutDelivery for multiple chunks but the lock is acquired only once
+    void addBatchToHistoryWithoutDelivery(const mepoo::SharedChunk* const chunks,
+                                          const uint64_t numberOfChunks) noexcept;
+
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
 };
 
@@ -21,6 +21,9 @@ namespace iox
 {
 namespace popo
 {
+template <typename ChunkDistributorDataType>
+constexpr units::Duration ChunkDistributor<ChunkDistributorDataType>::WAIT_FOR_SUBSCRIBER_RECHECK_PERIOD;
+
 template <typename ChunkDistributorDataType>
 inline ChunkDistributor<ChunkDistributorDataType>::ChunkDistributor(
     cxx::not_null<MemberType_t* const> chunkDistrubutorDataPtr) noexcept
@@ -42,6 +45,68 @@ ChunkDistributor<ChunkDistributorDataType>::getMembers() noexcept
     return m_chunkDistrubutorDataPtr;
 }
 
+template <typename ChunkDistributorDataType>
+template <typename Reader>
+inline void ChunkDistributor<ChunkDistributorDataType>::readQueues(const Reader& reader) const noexcept
+{
+    auto members = getMembers();
+
+    // announce the reader for the active version; if a writer switched the active version in between, the writer
+    // might not have seen the announcement and the new version has to be used instead
+    uint32_t version = members->m_activeQueues.load(std::memory_order_seq_cst);
+    members->m_queueReaders[version].fetch_add(1U, std::memory_order_seq_cst);
+    while (version != members->m_activeQueues.load(std::memory_order_seq_cst))
+    {
+        members->m_queueReaders[version].fetch_sub(1U, std::memory_order_seq_cst);
+        version = members->m_activeQueues.load(std::memory_order_seq_cst);
+        members->m_queueReaders[version].fetch_add(1U, std::memory_order_seq_cst);
+    }
+
+    reader(members->m_queues[version]);
+
+    members->m_queueReaders[version].fetch_sub(1U, std::memory_order_release);
+}
+
+template <typename ChunkDistributorDataType>
+template <typename Writer>
+inline void ChunkDistributor<ChunkDistributorDataType>::updateQueues(const Writer& writer) noexcept
+{
+    auto members = getMembers();
+
+    // the lock is held by the caller, therefore there are no concurrent writers
+    const uint32_t activeVersion = members->m_activeQueues.load(std::memory_order_relaxed);
+    const uint32_t nextVersion = (activeVersion + 1U) % MemberType_t::NUMBER_OF_QUEUE_CONTAINER_VERSIONS;
+
+    waitForQueueReaders(nextVersion);
+    members->m_queues[nextVersion] = members->m_queues[activeVersion];
+    writer(members->m_queues[nextVersion]);
+    members->m_activeQueues.store(nextVersion, std::memory_order_seq_cst);
+
+    // a delivery which waits for a subscriber reads the previous version until it rechecks the queues; it is woken up
+    // to not block the modification for the rest of its waiting time
+    if (members->m_subscriberTooSlowPolicy == SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER)
+    {
+        for (auto& queue : members->m_queues[activeVersion])
+        {
+            ChunkQueuePusher_t(queue.get()).wakeUpBlockedPublisher();
+        }
+    }
+
+    // when the readers of the previous version are gone, removed queues are no longer accessed and can be destroyed
+    waitForQueueReaders(activeVersion);
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::waitForQueueReaders(const uint32_t version) const noexcept
+{
+    /// @todo like with the lock before, a user process which gets terminated while delivering a chunk blocks the
+    /// modification of the queues; this needs to be solved together with the cleanup() challenge
+    while (getMembers()->m_queueReaders[version].load(std::memory_order_seq_cst) != 0U)
+    {
+        std::this_thread::yield();
+    }
+}
+
 template <typename ChunkDistributorDataType>
 inline cxx::expected<ChunkDistributorError>
 ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(cxx::not_null<ChunkQueueData_t* const> queueToAdd,
@@ -49,19 +114,15 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(cxx::not_null<ChunkQueue
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    const auto alreadyKnownReceiver =
-        std::find_if(getMembers()->m_queues.begin(),
-                     getMembers()->m_queues.end(),
-                     [&](const ChunkQueueData_t* const queue) { return queue == queueToAdd; });
+    const auto& queues = getMembers()->m_queues[getMembers()->m_activeQueues.load(std::memory_order_relaxed)];
+    const auto alreadyKnownReceiver = std::find_if(
+        queues.begin(), queues.end(), [&](const ChunkQueueData_t* const queue) { return queue == queueToAdd; });
 
     // check if the queue is not already in the list
-    if (alreadyKnownReceiver == getMembers()->m_queues.end())
+    if (alreadyKnownReceiver == queues.end())
     {
-        if (getMembers()->m_queues.size() < getMembers()->m_queues.capacity())
+        if (queues.size() < queues.capacity())
         {
-            // PRQA S 3804 1 # we checked the capacity, so pushing will be fine
-            getMembers()->m_queues.push_back(rp::RelativePointer<ChunkQueueData_t>(queueToAdd));
-
             const auto currChunkHistorySize = getMembers()->m_history.size();
 
             if (requestedHistory > getMembers()->m_historyCapacity)
@@ -71,7 +132,8 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(cxx::not_null<ChunkQueue
             }
 
             // if the current history is large enough we send the requested number of chunks, else we send the
-            // total history
+            // total history; this is done before the queue is added in order to deliver the history before the chunks
+            // which are sent concurrently
             const auto startIndex =
                 (requestedHistory <= currChunkHistorySize) ? currChunkHistorySize - requestedHistory : 0u;
             for (auto i = startIndex; i < currChunkHistorySize; ++i)
@@ -79,6 +141,11 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(cxx::not_null<ChunkQueue
                 deliverToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
             }
 
+            updateQueues([&](typename MemberType_t::QueueContainer_t& queuesToUpdate) {
+                // PRQA S 3804 1 # we checked the capacity, so pushing will be fine
+                queuesToUpdate.push_back(rp::RelativePointer<ChunkQueueData_t>(queueToAdd));
+            });
+
             return cxx::success<void>();
         }
         else
@@ -100,11 +167,13 @@ inline cxx::expected<ChunkDistributorError> ChunkDistributor<ChunkDistributorDat
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    const auto iter = std::find(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), queueToRemove);
-    if (iter != getMembers()->m_queues.end())
+    const auto& queues = getMembers()->m_queues[getMembers()->m_activeQueues.load(std::memory_order_relaxed)];
+    if (std::find(queues.begin(), queues.end(), queueToRemove) != queues.end())
     {
-        // PRQA S 3804 1 # we don't use iter any longer so return value can be ignored
-        getMembers()->m_queues.erase(iter);
+        updateQueues([&](typename MemberType_t::QueueContainer_t& queuesToUpdate) {
+            // PRQA S 3804 1 # we don't use the returned iterator, so return value can be ignored
+            queuesToUpdate.erase(std::find(queuesToUpdate.begin(), queuesToUpdate.end(), queueToRemove));
+        });
 
         return cxx::success<void>();
     }
@@ -119,28 +188,30 @@ inline void ChunkDistributor<ChunkDistributorDataType>::removeAllQueues() noexce
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    getMembers()->m_queues.clear();
+    updateQueues([](typename MemberType_t::QueueContainer_t& queuesToUpdate) { queuesToUpdate.clear(); });
 }
 
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::hasStoredQueues() const noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    bool hasQueues{false};
+    readQueues([&](const typename MemberType_t::QueueContainer_t& queues) { hasQueues = !queues.empty(); });
 
-    return !getMembers()->m_queues.empty();
+    return hasQueues;
 }
 
 template <typename ChunkDistributorDataType>
-inline void ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept
 {
+    uint64_t numberOfLostChunks{0U};
     typename ChunkDistributorDataType::QueueContainer_t remainingQueues;
-    {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
+    bool willWaitForSubscriber =
+        getMembers()->m_subscriberTooSlowPolicy == SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER;
 
-        bool willWaitForSubscriber =
-            getMembers()->m_subscriberTooSlowPolicy == SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER;
-        // send to all the queues
-        for (auto& queue : getMembers()->m_queues)
+    // send to all the queues; the queues are read without the lock, therefore RouDi can add and remove queues
+    // concurrently
+    readQueues([&](const typename MemberType_t::QueueContainer_t& queues) {
+        for (auto& queue : queues)
         {
             bool isBlockingQueue =
                 (willWaitForSubscriber && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PUBLISHER);
@@ -154,26 +225,32 @@ inline void ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues
                 else
                 {
                     ChunkQueuePusher_t(queue.get()).lostAChunk();
+                    ++numberOfLostChunks;
                 }
             }
         }
-    }
+    });
 
-    // busy waiting until every queue is served
+    // wait until every blocking queue is served; the delivery sleeps until a subscriber takes a chunk out of its queue;
+    // the timer is only started when a blocking queue is full to keep the clock out of the regular delivery
+    cxx::optional<cxx::DeadlineTimer> blockingTimer;
+    if (!remainingQueues.empty())
+    {
+        blockingTimer.emplace(getMembers()->m_maxBlockingTime);
+    }
     while (!remainingQueues.empty())
     {
-        std::this_thread::yield();
-        {
-            // create intersection of current queues and remainingQueues
-            // reason: it is possible that since the last iteration some subscriber have already unsubscribed
-            //          and without this intersection we would deliver to dead queues
-            typename MemberType_t::LockGuard_t lock(*getMembers());
+        // create intersection of current queues and remainingQueues
+        // reason: it is possible that since the last iteration some subscriber have already unsubscribed
+        //          and without this intersection we would deliver to dead queues
+        readQueues([&](const typename MemberType_t::QueueContainer_t& queues) {
+            typename ChunkDistributorDataType::QueueContainer_t currentQueues(queues);
             typename ChunkDistributorDataType::QueueContainer_t queueIntersection(remainingQueues.size());
-            std::sort(getMembers()->m_queues.begin(), getMembers()->m_queues.end());
+            std::sort(currentQueues.begin(), currentQueues.end());
             std::sort(remainingQueues.begin(), remainingQueues.end());
 
-            auto iter = std::set_intersection(getMembers()->m_queues.begin(),
-                                              getMembers()->m_queues.end(),
+            auto iter = std::set_intersection(currentQueues.begin(),
+                                              currentQueues.end(),
                                               remainingQueues.begin(),
                                               remainingQueues.end(),
                                               queueIntersection.begin());
@@ -194,10 +271,73 @@ inline void ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues
                     break;
                 }
             }
-        }
+
+            if (remainingQueues.empty())
+            {
+                return;
+            }
+
+            if (blockingTimer->hasExpired())
+            {
+                for (auto& queue : remainingQueues)
+                {
+                    ChunkQueuePusher_t(queue.get()).lostAChunk();
+                }
+                numberOfLostChunks += remainingQueues.size();
+                remainingQueues.clear();
+                return;
+            }
+
+            // the queues are read while waiting, therefore the waiting time is limited to recheck the queues and to
+            // not block RouDi longer than necessary when it modifies the queues
+            const auto remainingTime = blockingTimer->remainingTime();
+            const auto timeToWait = (remainingTime < WAIT_FOR_SUBSCRIBER_RECHECK_PERIOD)
+                                        ? remainingTime
+                                        : WAIT_FOR_SUBSCRIBER_RECHECK_PERIOD;
+            if (ChunkQueuePusher_t(remainingQueues.back().get()).pushOrWaitForSubscriber(chunk, timeToWait))
+            {
+                remainingQueues.pop_back();
+            }
+        });
     }
 
     addToHistoryWithoutDelivery(chunk);
+
+    return numberOfLostChunks;
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t
+ChunkDistributor<ChunkDistributorDataType>::deliverBatchToAllStoredQueues(const mepoo::SharedChunk* const chunks,
+                                                                          const uint64_t numberOfChunks) noexcept
+{
+    uint64_t numberOfLostChunks{0U};
+
+    if (getMembers()->m_subscriberTooSlowPolicy == SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER)
+    {
+        for (uint64_t i = 0U; i < numberOfChunks; ++i)
+        {
+            numberOfLostChunks += deliverToAllStoredQueues(chunks[i]);
+        }
+        return numberOfLostChunks;
+    }
+
+    readQueues([&](const typename MemberType_t::QueueContainer_t& queues) {
+        for (auto& queue : queues)
+        {
+            ChunkQueuePusher_t pusher(queue.get());
+            const auto numberOfLostChunksOfQueue = pusher.pushBatch(chunks, numberOfChunks);
+            if (numberOfLostChunksOfQueue > 0U)
+            {
+                pusher.lostAChunk();
+                numberOfLostChunks += numberOfLostChunksOfQueue;
+            }
+        }
+    });
+
+    addBatchToHistoryWithoutDelivery(chunks, numberOfChunks);
+
+    return numberOfLostChunks;
 }
 
 template <typename ChunkDistributorDataType>
@@ -208,12 +348,115 @@ inline bool ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(cxx::not_
 }
 
 template <typename ChunkDistributorDataType>
-inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDelivery(mepoo::SharedChunk chunk) noexcept
+inline cxx::expected<ChunkDistributorError>
+ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const UniquePortId uniqueQueueId,
+                                                           const uint32_t lastKnownQueueIndex,
+                                                           mepoo::SharedChunk chunk) noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    bool willWaitForSubscriber =
+        getMembers()->m_subscriberTooSlowPolicy == SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER;
+    bool isQueueStored{true};
+    bool isDeliveryFinished{false};
+    cxx::optional<cxx::DeadlineTimer> blockingTimer;
+
+    // the queue is looked up in every iteration since it could have been removed while the delivery waits for it
+    while (isQueueStored && !isDeliveryFinished)
+    {
+        readQueues([&](const typename MemberType_t::QueueContainer_t& queues) {
+            const auto queueIndex = findQueueIndex(queues, uniqueQueueId, lastKnownQueueIndex);
+            if (!queueIndex.has_value())
+            {
+                isQueueStored = false;
+                return;
+            }
+
+            ChunkQueueData_t* const queue = queues[queueIndex.value()].get();
+            if (deliverToQueue(queue, chunk))
+            {
+                isDeliveryFinished = true;
+                return;
+            }
+
+            bool isBlockingQueue =
+                (willWaitForSubscriber && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PUBLISHER);
+            if (!isBlockingQueue)
+            {
+                ChunkQueuePusher_t(queue).lostAChunk();
+                isDeliveryFinished = true;
+                return;
+            }
+
+            // the timer is only started when the queue is full to keep the clock out of the regular delivery
+            if (!blockingTimer.has_value())
+            {
+                blockingTimer.emplace(getMembers()->m_maxBlockingTime);
+            }
+            else if (blockingTimer->hasExpired())
+            {
+                ChunkQueuePusher_t(queue).lostAChunk();
+                isDeliveryFinished = true;
+                return;
+            }
 
+            const auto remainingTime = blockingTimer->remainingTime();
+            const auto timeToWait = (remainingTime < WAIT_FOR_SUBSCRIBER_RECHECK_PERIOD)
+                                        ? remainingTime
+                                        : WAIT_FOR_SUBSCRIBER_RECHECK_PERIOD;
+            isDeliveryFinished = ChunkQueuePusher_t(queue).pushOrWaitForSubscriber(chunk, timeToWait);
+        });
+    }
+
+    if (!isQueueStored)
+    {
+        return cxx::error<ChunkDistributorError>(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
+    }
+
+    return cxx::success<void>();
+}
+
+template <typename ChunkDistributorDataType>
+inline cxx::optional<uint32_t>
+ChunkDistributor<ChunkDistributorDataType>::getQueueIndex(const UniquePortId uniqueQueueId,
+                                                          const uint32_t lastKnownQueueIndex) const noexcept
+{
+    cxx::optional<uint32_t> queueIndex;
+    readQueues([&](const typename MemberType_t::QueueContainer_t& queues) {
+        queueIndex = findQueueIndex(queues, uniqueQueueId, lastKnownQueueIndex);
+    });
+
+    return queueIndex;
+}
+
+template <typename ChunkDistributorDataType>
+inline cxx::optional<uint32_t>
+ChunkDistributor<ChunkDistributorDataType>::findQueueIndex(const typename MemberType_t::QueueContainer_t& queues,
+                                                           const UniquePortId uniqueQueueId,
+                                                           const uint32_t lastKnownQueueIndex) noexcept
+{
+    if (lastKnownQueueIndex < queues.size() && queues[lastKnownQueueIndex]->m_uniqueId == uniqueQueueId)
+    {
+        return lastKnownQueueIndex;
+    }
+
+    for (uint32_t i = 0U; i < queues.size(); ++i)
+    {
+        if (queues[i]->m_uniqueId == uniqueQueueId)
+        {
+            return i;
+        }
+    }
+
+    return cxx::nullopt;
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDelivery(mepoo::SharedChunk chunk) noexcept
+{
+    // the history capacity is constant, the lock is only required if there is a history
     if (0u < getMembers()->m_historyCapacity)
     {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+
         if (getMembers()->m_history.size() >= getMembers()->m_historyCapacity)
         {
             auto chunkToRemove = getMembers()->m_history.begin();
@@ -226,6 +469,34 @@ inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDeliv
     }
 }
 
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::addBatchToHistoryWithoutDelivery(const mepoo::SharedChunk* const chunks,
+                                                                             const uint64_t numberOfChunks) noexcept
+{
+    const auto historyCapacity = getMembers()->m_historyCapacity;
+    if (0u < historyCapacity)
+    {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+
+        // only the newest chunks which fit into the history are kept
+        const uint64_t firstChunk = (numberOfChunks > historyCapacity) ? numberOfChunks - historyCapacity : 0U;
+        for (uint64_t i = firstChunk; i < numberOfChunks; ++i)
+        {
+            auto& history = getMembers()->m_history;
+            if (history.size() >= historyCapacity)
+            {
+                auto chunkToRemove = history.begin();
+                chunkToRemove->releaseToSharedChunk();
+                // PRQA S 3804 1 # we are not iterating here, so return value can be ignored
+                history.erase(chunkToRemove);
+            }
+            // PRQA S 3804 1 # we ensured that there is space in the history, so return value can be ignored
+            history.push_back(chunks[i]); // PRQA S 3804
+        }
+    }
+}
+
 template <typename ChunkDistributorDataType>
 inline uint64_t ChunkDistributor<ChunkDistributorDataType>::getHistorySize() noexcept
 {
@@ -245,12 +516,9 @@ inline void ChunkDistributor<ChunkDistributorDataType>::clearHistory() noexcept
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    for (auto& unmanagedChunk : getMembers()->m_history)
-    {
-        unmanagedChunk.releaseToSharedChunk();
-    }
-
-    getMembers()->m_history.clear();
+    auto& history = getMembers()->m_history;
+    mepoo::MemoryManager::releaseChunks(history.begin(), history.size());
+    history.clear();
 }
 
 template <typename ChunkDistributorDataType>
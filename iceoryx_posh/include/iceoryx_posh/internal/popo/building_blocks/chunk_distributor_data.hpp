@@ -22,12 +22,14 @@
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
 #include "iceoryx_hoofs/internal/posix_wrapper/mutex.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <mutex>
 
@@ -44,13 +46,22 @@ struct ChunkDistributorData : public LockingPolicy
     using ChunkQueueData_t = typename ChunkQueuePusherType::MemberType_t;
     using ChunkDistributorDataProperties_t = ChunkDistributorDataProperties;
 
-    ChunkDistributorData(const SubscriberTooSlowPolicy policy, const uint64_t historyCapacity = 0u) noexcept;
+    ChunkDistributorData(const SubscriberTooSlowPolicy policy,
+                         const uint64_t historyCapacity = 0u,
+                         const units::Duration maxBlockingTime = units::Duration::max()) noexcept;
 
     const uint64_t m_historyCapacity;
 
     using QueueContainer_t =
         cxx::vector<rp::RelativePointer<ChunkQueueData_t>, ChunkDistributorDataProperties_t::MAX_QUEUES>;
-    QueueContainer_t m_queues;
+    static constexpr uint32_t NUMBER_OF_QUEUE_CONTAINER_VERSIONS{2U};
+
+    /// @brief The queues are stored in two versions. The version m_activeQueues refers to is read without the lock
+    /// while a modification is prepared in the other version, which then becomes the active one. m_queueReaders counts
+    /// the readers of each version; a version is modified only if it has no readers.
+    QueueContainer_t m_queues[NUMBER_OF_QUEUE_CONTAINER_VERSIONS];
+    std::atomic<uint32_t> m_activeQueues{0U};
+    mutable std::atomic<uint64_t> m_queueReaders[NUMBER_OF_QUEUE_CONTAINER_VERSIONS]{};
 
     /// @todo If we would make the ChunkDistributor lock-free, can we than extend the UsedChunkList to
     /// be like a ring buffer and use this for the history? This would be needed to be able to safely cleanup.
@@ -60,6 +71,10 @@ struct ChunkDistributorData : public LockingPolicy
         cxx::vector<mepoo::ShmSafeUnmanagedChunk, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY>;
     HistoryContainer_t m_history;
     const SubscriberTooSlowPolicy m_subscriberTooSlowPolicy;
+
+    /// @brief with SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER, the maximum time a delivery waits for subscribers
+    /// with a full queue; when it has passed, the chunk is dropped for these subscribers
+    const units::Duration m_maxBlockingTime;
 };
 
 } // namespace popo
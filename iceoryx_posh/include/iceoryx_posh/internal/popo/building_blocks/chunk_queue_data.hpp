@@ -17,6 +17,8 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_DATA_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_DATA_HPP
 
+#include "iceoryx_hoofs/cxx/fixed_type_queue.hpp"
+#include "iceoryx_hoofs/cxx/type_traits.hpp"
 #include "iceoryx_hoofs/cxx/variant_queue.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
 #include "iceoryx_hoofs/posix_wrapper/semaphore.hpp"
@@ -24,12 +26,35 @@
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/typed_unique_id.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 
+#include <atomic>
+
 namespace iox
 {
 namespace popo
 {
+namespace internal
+{
+/// @brief selects the queue of the ChunkQueueData. The queue type of a VariantQueue is selected at runtime, which
+/// requires the memory of the largest queue type and a switch on the type for every call. ChunkQueueDataProperties
+/// which define a QUEUE_TYPE get a FixedTypeQueue of this type instead, like the request and response queues.
+template <typename ChunkQueueDataProperties, typename = void>
+struct ChunkQueueSelector
+{
+    using Queue_t = cxx::VariantQueue<mepoo::ShmSafeUnmanagedChunk, ChunkQueueDataProperties::MAX_QUEUE_CAPACITY>;
+};
+
+template <typename ChunkQueueDataProperties>
+struct ChunkQueueSelector<ChunkQueueDataProperties, cxx::void_t<decltype(ChunkQueueDataProperties::QUEUE_TYPE)>>
+{
+    using Queue_t = cxx::FixedTypeQueue<mepoo::ShmSafeUnmanagedChunk,
+                                        ChunkQueueDataProperties::MAX_QUEUE_CAPACITY,
+                                        ChunkQueueDataProperties::QUEUE_TYPE>;
+};
+} // namespace internal
+
 template <typename ChunkQueueDataProperties, typename LockingPolicy>
 struct ChunkQueueData : public LockingPolicy
 {
@@ -40,12 +65,41 @@ struct ChunkQueueData : public LockingPolicy
     ChunkQueueData(const QueueFullPolicy policy, const cxx::VariantQueueTypes queueType) noexcept;
 
     static constexpr uint64_t MAX_CAPACITY = ChunkQueueDataProperties_t::MAX_QUEUE_CAPACITY;
-    cxx::VariantQueue<mepoo::ShmSafeUnmanagedChunk, MAX_CAPACITY> m_queue;
+    using Queue_t = typename internal::ChunkQueueSelector<ChunkQueueDataProperties_t>::Queue_t;
+    Queue_t m_queue;
     std::atomic_bool m_queueHasLostChunks{false};
 
+    /// @brief publishers with SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER wait on this semaphore when the queue is
+    /// full; m_numberOfBlockedPublishers counts the waiting publishers which were not woken up yet, a chunk taken out
+    /// of the queue claims one of them and posts the semaphore once
+    posix::Semaphore m_blockedPublishersSemaphore =
+        std::move(posix::Semaphore::create(posix::CreateUnnamedSharedMemorySemaphore, 0U)
+                      .or_else([](posix::SemaphoreError&) {
+                          errorHandler(
+                              Error::kPOPO__CHUNK_QUEUE_DATA_FAILED_TO_CREATE_SEMAPHORE, nullptr, ErrorLevel::FATAL);
+                      })
+                      .value());
+    std::atomic<uint64_t> m_numberOfBlockedPublishers{0U};
+
+    /// @brief The attach state of the condition variable is published in m_conditionVariableState which allows to
+    /// notify without the lock when a chunk is pushed. The word contains a flag whether a condition variable is
+    /// attached, the notification index and the number of pushers which are currently notifying. A detach clears the
+    /// flag and waits until there are no notifying pushers before the condition variable can be released.
+    static constexpr uint64_t CONDITION_VARIABLE_ATTACHED{1ULL << 63U};
+    static constexpr uint64_t NOTIFICATION_INDEX_SHIFT{32U};
+    static constexpr uint64_t NOTIFICATION_INDEX_MASK{0x7FFFFFFFULL << NOTIFICATION_INDEX_SHIFT};
+    static constexpr uint64_t ACTIVE_NOTIFIERS_MASK{0xFFFFFFFFULL};
+    static_assert(MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE
+                      <= (NOTIFICATION_INDEX_MASK >> NOTIFICATION_INDEX_SHIFT),
+                  "the notification index must fit into the condition variable state");
+
     rp::RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
-    cxx::optional<uint64_t> m_conditionVariableNotificationIndex;
+    std::atomic<uint64_t> m_conditionVariableState{0U};
     const QueueFullPolicy m_queueFullPolicy;
+
+    /// @brief identifies the queue for a delivery to a single queue of a ChunkDistributor, e.g. a response which is
+    /// sent to the response queue of one client; it is invalid for queues which only receive from all senders
+    UniquePortId m_uniqueId{popo::InvalidId};
 };
 
 } // namespace popo
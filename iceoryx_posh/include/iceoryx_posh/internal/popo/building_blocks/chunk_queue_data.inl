@@ -21,6 +21,15 @@ namespace iox
 {
 namespace popo
 {
+template <typename ChunkQueueProperties, typename LockingPolicy>
+constexpr uint64_t ChunkQueueData<ChunkQueueProperties, LockingPolicy>::CONDITION_VARIABLE_ATTACHED;
+template <typename ChunkQueueProperties, typename LockingPolicy>
+constexpr uint64_t ChunkQueueData<ChunkQueueProperties, LockingPolicy>::NOTIFICATION_INDEX_SHIFT;
+template <typename ChunkQueueProperties, typename LockingPolicy>
+constexpr uint64_t ChunkQueueData<ChunkQueueProperties, LockingPolicy>::NOTIFICATION_INDEX_MASK;
+template <typename ChunkQueueProperties, typename LockingPolicy>
+constexpr uint64_t ChunkQueueData<ChunkQueueProperties, LockingPolicy>::ACTIVE_NOTIFIERS_MASK;
+
 template <typename ChunkQueueProperties, typename LockingPolicy>
 inline ChunkQueueData<ChunkQueueProperties, LockingPolicy>::ChunkQueueData(
     const QueueFullPolicy policy, const cxx::VariantQueueTypes queueType) noexcept
@@ -19,10 +19,13 @@
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 
+#include <thread>
+
 namespace iox
 {
 namespace popo
@@ -50,6 +53,16 @@ class ChunkQueuePopper
     /// @return optional for a shared chunk that is set if the queue is not empty
     cxx::optional<mepoo::SharedChunk> tryPop() noexcept;
 
+    /// @brief pop up to the given number of chunks from the chunk queue in one pass; a blocked publisher is notified
+    /// only once per pass
+    /// @param[in] maxNumberOfChunks the maximum number of chunks which are popped
+    /// @param[in] callable is called with every popped chunk, signature bool(mepoo::SharedChunk&); it returns true to
+    /// continue and false to stop popping
+    /// @return the number of popped chunks, including the chunks which were dropped due to an incompatible
+    /// CHUNK_HEADER_VERSION
+    template <typename Callable>
+    uint64_t tryPopBatch(const uint64_t maxNumberOfChunks, const Callable& callable) noexcept;
+
     /// @brief check if chunks were lost and reset flag
     /// @return true if the underlying queue has lost chunks due to an overflow since the last call of this method
     bool hasLostChunks() noexcept;
@@ -97,6 +110,12 @@ class ChunkQueuePopper
     MemberType_t* getMembers() noexcept;
 
   private:
+    /// @brief clears the attach state and waits until no pusher uses the condition variable anymore
+    void detachConditionVariable() noexcept;
+
+    /// @brief wakes up a publisher which waits for space in the queue, see ChunkQueuePusher::pushOrWaitForSubscriber
+    void notifyBlockedPublisher() noexcept;
+
     MemberType_t* m_chunkQueueDataPtr;
 };
 
@@ -52,6 +52,8 @@ inline cxx::optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::t
     // check if queue had an element that was poped and return if so
     if (retVal.has_value())
     {
+        notifyBlockedPublisher();
+
         auto chunk = retVal.value().releaseToSharedChunk();
 
         auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
@@ -72,6 +74,36 @@ inline cxx::optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::t
     }
 }
 
+template <typename ChunkQueueDataType>
+template <typename Callable>
+inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::tryPopBatch(const uint64_t maxNumberOfChunks,
+                                                                  const Callable& callable) noexcept
+{
+    auto numberOfPoppedChunks =
+        getMembers()->m_queue.popBatch(maxNumberOfChunks, [&](mepoo::ShmSafeUnmanagedChunk& unmanagedChunk) {
+            auto chunk = unmanagedChunk.releaseToSharedChunk();
+
+            auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
+            if (receivedChunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
+            {
+                LogError() << "Received chunk with CHUNK_HEADER_VERSION '" << receivedChunkHeaderVersion
+                           << "' but expected '" << mepoo::ChunkHeader::CHUNK_HEADER_VERSION << "'! Dropping chunk!";
+                errorHandler(Error::kPOPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION,
+                             nullptr,
+                             ErrorLevel::SEVERE);
+                return true;
+            }
+            return callable(chunk);
+        });
+
+    if (numberOfPoppedChunks > 0U)
+    {
+        notifyBlockedPublisher();
+    }
+
+    return numberOfPoppedChunks;
+}
+
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::hasLostChunks() noexcept
 {
@@ -116,21 +148,38 @@ inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::getMaximumCapacity() const
 template <typename ChunkQueueDataType>
 inline void ChunkQueuePopper<ChunkQueueDataType>::clear() noexcept
 {
+    // the chunks are collected and released in batches to reduce the operations on the free lists of the mempools
+    mepoo::ShmSafeUnmanagedChunk unmanagedChunks[mepoo::MemoryManager::MAX_CHUNKS_PER_BATCH];
+    uint32_t numberOfChunks{0U};
     while (auto maybeUnmanagedChunk = getMembers()->m_queue.pop())
     {
-        // PRQA S 4117 4 # d'tor of SharedChunk will release the memory, so RAII has the side effect here
-        maybeUnmanagedChunk.value().releaseToSharedChunk();
+        unmanagedChunks[numberOfChunks] = maybeUnmanagedChunk.value();
+        ++numberOfChunks;
+        if (numberOfChunks == mepoo::MemoryManager::MAX_CHUNKS_PER_BATCH)
+        {
+            mepoo::MemoryManager::releaseChunks(unmanagedChunks, numberOfChunks);
+            numberOfChunks = 0U;
+        }
     }
+    mepoo::MemoryManager::releaseChunks(unmanagedChunks, numberOfChunks);
+
+    notifyBlockedPublisher();
 }
 
 template <typename ChunkQueueDataType>
 inline void ChunkQueuePopper<ChunkQueueDataType>::setConditionVariable(ConditionVariableData& conditionVariableDataRef,
                                                                        const uint64_t notificationIndex) noexcept
 {
+    // the lock serializes the attach and detach calls, the pushers only use m_conditionVariableState
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
+    detachConditionVariable();
+
     getMembers()->m_conditionVariableDataPtr = &conditionVariableDataRef;
-    getMembers()->m_conditionVariableNotificationIndex.emplace(notificationIndex);
+    getMembers()->m_conditionVariableState.fetch_or(
+        MemberType_t::CONDITION_VARIABLE_ATTACHED
+            | ((notificationIndex << MemberType_t::NOTIFICATION_INDEX_SHIFT) & MemberType_t::NOTIFICATION_INDEX_MASK),
+        std::memory_order_release);
 }
 
 template <typename ChunkQueueDataType>
@@ -138,14 +187,64 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::unsetConditionVariable() noexc
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
+    detachConditionVariable();
+
     getMembers()->m_conditionVariableDataPtr = nullptr;
-    getMembers()->m_conditionVariableNotificationIndex.reset();
 }
 
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::isConditionVariableSet() const noexcept
 {
-    return getMembers()->m_conditionVariableDataPtr;
+    return (getMembers()->m_conditionVariableState.load(std::memory_order_relaxed)
+            & MemberType_t::CONDITION_VARIABLE_ATTACHED)
+           != 0U;
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::detachConditionVariable() noexcept
+{
+    getMembers()->m_conditionVariableState.fetch_and(
+        ~(MemberType_t::CONDITION_VARIABLE_ATTACHED | MemberType_t::NOTIFICATION_INDEX_MASK),
+        std::memory_order_relaxed);
+
+    /// @todo like with the lock before, a process which gets terminated while it notifies blocks the detach
+    while ((getMembers()->m_conditionVariableState.load(std::memory_order_acquire)
+            & MemberType_t::ACTIVE_NOTIFIERS_MASK)
+           != 0U)
+    {
+        std::this_thread::yield();
+    }
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::notifyBlockedPublisher() noexcept
+{
+    // only a publisher with SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER waits for the queue and it does so only when
+    // the queue blocks the publisher; all other queues skip the fence
+    if (getMembers()->m_queueFullPolicy != QueueFullPolicy::BLOCK_PUBLISHER)
+    {
+        return;
+    }
+
+    // pairs with the fence in ChunkQueuePusher::pushOrWaitForSubscriber; either the blocked publisher is seen here or
+    // the publisher sees the space in the queue when it retries the push
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // the announcement of a blocked publisher is claimed before the semaphore is posted, this way every waiting
+    // publisher is woken up once and not once per taken chunk
+    auto numberOfBlockedPublishers = getMembers()->m_numberOfBlockedPublishers.load(std::memory_order_relaxed);
+    while (numberOfBlockedPublishers > 0U
+           && !getMembers()->m_numberOfBlockedPublishers.compare_exchange_weak(
+               numberOfBlockedPublishers, numberOfBlockedPublishers - 1U, std::memory_order_relaxed))
+    {
+    }
+
+    if (numberOfBlockedPublishers > 0U)
+    {
+        getMembers()->m_blockedPublishersSemaphore.post().or_else([](auto) {
+            errorHandler(Error::kPOPO__CHUNK_QUEUE_SEMAPHORE_CORRUPT_IN_NOTIFY, nullptr, ErrorLevel::FATAL);
+        });
+    }
 }
 
 } // namespace popo
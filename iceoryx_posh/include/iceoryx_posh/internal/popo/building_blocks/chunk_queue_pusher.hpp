@@ -19,6 +19,7 @@
 
 #include "iceoryx_hoofs/cxx/expected.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
@@ -50,6 +51,22 @@ class ChunkQueuePusher
     /// @return false if a queue overflow occurred, otherwise true
     bool push(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief push multiple chunks to the chunk queue in the given order; the condition variable is notified only once
+    /// @param[in] chunks array of shared chunk objects
+    /// @param[in] numberOfChunks the number of elements in chunks
+    /// @return the number of chunks which were lost due to queue overflows
+    uint64_t pushBatch(const mepoo::SharedChunk* const chunks, const uint64_t numberOfChunks) noexcept;
+
+    /// @brief push a new chunk to the chunk queue; if the queue is full, wait until the subscriber took a chunk out of
+    /// the queue or the timeout has passed
+    /// @param[in] chunk shared chunk object
+    /// @param[in] timeout maximum time to wait for the subscriber
+    /// @return true if the chunk was pushed, false if the queue is still full and the push must be retried
+    bool pushOrWaitForSubscriber(mepoo::SharedChunk chunk, const units::Duration timeout) noexcept;
+
+    /// @brief wakes up all publishers which wait in pushOrWaitForSubscriber, e.g. because the queues are modified
+    void wakeUpBlockedPublisher() noexcept;
+
     /// @brief tell the queue that it lost a chunk (e.g. because push failed and there will be no retry)
     void lostAChunk() noexcept;
 
@@ -58,6 +75,8 @@ class ChunkQueuePusher
     MemberType_t* getMembers() noexcept;
 
   private:
+    void notifyConditionVariable() noexcept;
+
     MemberType_t* m_chunkQueueDataPtr{nullptr};
 };
 
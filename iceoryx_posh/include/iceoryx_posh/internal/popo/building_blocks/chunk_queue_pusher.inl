@@ -57,17 +57,96 @@ inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk)
         hasQueueOverflow = true;
     }
 
+    notifyConditionVariable();
+
+    return !hasQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline uint64_t ChunkQueuePusher<ChunkQueueDataType>::pushBatch(const mepoo::SharedChunk* const chunks,
+                                                                const uint64_t numberOfChunks) noexcept
+{
+    uint64_t numberOfLostChunks{0U};
+    for (uint64_t i = 0U; i < numberOfChunks; ++i)
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
-        if (getMembers()->m_conditionVariableDataPtr)
+        auto pushRet = getMembers()->m_queue.push(chunks[i]);
+        if (pushRet.has_value())
         {
-            ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
-                              *getMembers()->m_conditionVariableNotificationIndex)
+            pushRet.value().releaseToSharedChunk();
+            ++numberOfLostChunks;
+        }
+    }
+
+    if (numberOfChunks > 0U)
+    {
+        notifyConditionVariable();
+    }
+
+    return numberOfLostChunks;
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::notifyConditionVariable() noexcept
+{
+    // the pusher is counted as active notifier while it uses the condition variable, this prevents that the condition
+    // variable is detached and released in the meantime
+    if ((getMembers()->m_conditionVariableState.load(std::memory_order_relaxed)
+         & MemberType_t::CONDITION_VARIABLE_ATTACHED)
+        != 0U)
+    {
+        const uint64_t state = getMembers()->m_conditionVariableState.fetch_add(1U, std::memory_order_acquire);
+        if ((state & MemberType_t::CONDITION_VARIABLE_ATTACHED) != 0U)
+        {
+            ConditionNotifier(
+                *getMembers()->m_conditionVariableDataPtr.get(),
+                (state & MemberType_t::NOTIFICATION_INDEX_MASK) >> MemberType_t::NOTIFICATION_INDEX_SHIFT)
                 .notify();
         }
+        getMembers()->m_conditionVariableState.fetch_sub(1U, std::memory_order_release);
     }
+}
 
-    return !hasQueueOverflow;
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::pushOrWaitForSubscriber(mepoo::SharedChunk chunk,
+                                                                          const units::Duration timeout) noexcept
+{
+    // announce the blocked publisher before the push is retried; the subscriber either sees the announcement after
+    // taking a chunk and posts the semaphore or the retried push succeeds
+    getMembers()->m_numberOfBlockedPublishers.fetch_add(1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    bool hasPushed = push(chunk);
+    if (!hasPushed)
+    {
+        if (getMembers()->m_blockedPublishersSemaphore.timedWait(timeout).has_error())
+        {
+            errorHandler(Error::kPOPO__CHUNK_QUEUE_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT, nullptr, ErrorLevel::FATAL);
+        }
+    }
+
+    // withdraw the announcement unless a subscriber or wakeUpBlockedPublisher already claimed it for its post
+    auto numberOfBlockedPublishers = getMembers()->m_numberOfBlockedPublishers.load(std::memory_order_relaxed);
+    while (numberOfBlockedPublishers > 0U
+           && !getMembers()->m_numberOfBlockedPublishers.compare_exchange_weak(
+               numberOfBlockedPublishers, numberOfBlockedPublishers - 1U, std::memory_order_relaxed))
+    {
+    }
+
+    return hasPushed;
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::wakeUpBlockedPublisher() noexcept
+{
+    // all announcements are claimed at once and every blocked publisher gets exactly one post
+    const auto numberOfBlockedPublishers =
+        getMembers()->m_numberOfBlockedPublishers.exchange(0U, std::memory_order_relaxed);
+    for (uint64_t i = 0U; i < numberOfBlockedPublishers; ++i)
+    {
+        getMembers()->m_blockedPublishersSemaphore.post().or_else([](auto) {
+            errorHandler(Error::kPOPO__CHUNK_QUEUE_SEMAPHORE_CORRUPT_IN_NOTIFY, nullptr, ErrorLevel::FATAL);
+        });
+    }
 }
 
 template <typename ChunkQueueDataType>
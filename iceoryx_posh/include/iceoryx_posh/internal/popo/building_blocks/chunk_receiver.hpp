@@ -63,6 +63,17 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
     /// or if there are no new chunks in the underlying queue
     cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGet() noexcept;
 
+    /// @brief Tries to get up to the given number of received chunks in one pass. The chunks are handed over in the
+    /// order in which they were received and must be released like the chunks obtained with tryGet
+    /// @param[in] maxNumberOfChunks the maximum number of chunks to get
+    /// @param[in] callable is called with the ChunkHeader of every chunk, signature void(const mepoo::ChunkHeader*)
+    /// @return the number of chunks handed over to the callable, which is zero if no chunk is available; the
+    /// ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL error if the pass was stopped since the maximum number of
+    /// held chunks was reached, the chunks handed over before must still be released
+    template <typename Callable>
+    cxx::expected<uint64_t, ChunkReceiveResult> tryGetBatch(const uint64_t maxNumberOfChunks,
+                                                            const Callable& callable) noexcept;
+
     /// @brief Release a chunk that was obtained with get
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -71,6 +71,34 @@ ChunkReceiver<ChunkReceiverDataType>::tryGet() noexcept
     return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
 }
 
+template <typename ChunkReceiverDataType>
+template <typename Callable>
+inline cxx::expected<uint64_t, ChunkReceiveResult>
+ChunkReceiver<ChunkReceiverDataType>::tryGetBatch(const uint64_t maxNumberOfChunks, const Callable& callable) noexcept
+{
+    uint64_t numberOfChunks{0U};
+    bool tooManyChunksHeldInParallel{false};
+
+    this->tryPopBatch(maxNumberOfChunks, [&](mepoo::SharedChunk& sharedChunk) {
+        // if the application holds too many chunks, don't provide more; the chunk is released like in tryGet
+        if (!getMembers()->m_chunksInUse.insert(sharedChunk))
+        {
+            tooManyChunksHeldInParallel = true;
+            return false;
+        }
+
+        ++numberOfChunks;
+        callable(const_cast<const mepoo::ChunkHeader*>(sharedChunk.getChunkHeader()));
+        return true;
+    });
+
+    if (tooManyChunksHeldInParallel)
+    {
+        return cxx::error<ChunkReceiveResult>(ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+    }
+    return cxx::success<uint64_t>(numberOfChunks);
+}
+
 template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
@@ -76,6 +76,28 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
                                                                     const uint32_t userHeaderSize,
                                                                     const uint32_t userHeaderAlignment) noexcept;
 
+    /// @brief allocate multiple chunks with the same settings at once; the chunks are acquired with a few operations
+    /// on the free lists of the mempools and, unlike with tryAllocate, the last sent chunk is not reused
+    /// @param[in] originId, the unique id of the entity which requested this allocate
+    /// @param[in] userPayloadSize, size of the user-payload without additional headers
+    /// @param[in] userPayloadAlignment, alignment of the user-payload
+    /// @param[in] userHeaderSize, size of the user-header; use iox::CHUNK_NO_USER_HEADER_SIZE to omit a
+    /// user-header
+    /// @param[in] userHeaderAlignment, alignment of the user-header; use iox::CHUNK_NO_USER_HEADER_ALIGNMENT
+    /// to omit a user-header
+    /// @param[in] numberOfChunks, the number of chunks to allocate
+    /// @param[in] callable, is called with the ChunkHeader of every allocated chunk, signature void(ChunkHeader*)
+    /// @return on success the number of allocated chunks, which is less than numberOfChunks if the mempools run out of
+    /// chunks or too many chunks are allocated in parallel; error if not a single chunk could be allocated
+    template <typename Callable>
+    cxx::expected<uint32_t, AllocationError> tryAllocateBatch(const UniquePortId originId,
+                                                              const uint32_t userPayloadSize,
+                                                              const uint32_t userPayloadAlignment,
+                                                              const uint32_t userHeaderSize,
+                                                              const uint32_t userHeaderAlignment,
+                                                              const uint32_t numberOfChunks,
+                                                              const Callable& callable) noexcept;
+
     /// @brief Release an allocated chunk without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -84,6 +106,21 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send
     void send(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send multiple allocated chunks in the given order to all connected ChunkQueuePopper; the chunk queues are
+    /// read and notified once per batch of up to MemoryManager::MAX_CHUNKS_PER_BATCH chunks
+    /// @param[in] chunkHeaders, array of pointers to the ChunkHeaders to send
+    /// @param[in] numberOfChunks, the number of elements in chunkHeaders
+    void sendBatch(mepoo::ChunkHeader* const* const chunkHeaders, const uint32_t numberOfChunks) noexcept;
+
+    /// @brief Send an allocated chunk only to the connected ChunkQueuePopper with the provided unique queue id
+    /// @param[in] chunkHeader, pointer to the ChunkHeader to send
+    /// @param[in] uniqueQueueId, the unique id of the chunk queue to which the chunk shall be sent
+    /// @param[in] lastKnownQueueIndex, the index of the chunk queue which is checked before the queues are searched
+    /// @return true if there is a connected chunk queue with the unique id, otherwise false
+    bool sendToQueue(mepoo::ChunkHeader* const chunkHeader,
+                     const UniquePortId uniqueQueueId,
+                     const uint32_t lastKnownQueueIndex) noexcept;
+
     /// @brief Push an allocated chunk to the history without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to push to the history
     void pushToHistory(mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -104,6 +141,11 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @return true if there was a matching chunk with this header, false if not
     bool getChunkReadyForSend(const mepoo::ChunkHeader* const chunkHeader, mepoo::SharedChunk& chunk) noexcept;
 
+    /// @brief Update the statistics which are read by the port introspection after a chunk was sent
+    /// @param[in] chunkHeader of the chunk that was sent
+    /// @param[in] numberOfLostChunks is the number of chunk queues which lost the sent chunk
+    void updateStatistics(const mepoo::ChunkHeader* const chunkHeader, const uint64_t numberOfLostChunks) noexcept;
+
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 };
@@ -85,7 +85,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     {
         // BEGIN of critical section, chunk will be lost if process gets hard terminated in between
         // get a new chunk
-        mepoo::SharedChunk chunk = getMembers()->m_memoryMgr->getChunk(chunkSettings);
+        mepoo::SharedChunk chunk = getMembers()->m_memoryMgr->getChunk(chunkSettings, getMembers()->m_chunkCache);
 
         if (chunk)
         {
@@ -110,6 +110,70 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     }
 }
 
+template <typename ChunkSenderDataType>
+template <typename Callable>
+inline cxx::expected<uint32_t, AllocationError>
+ChunkSender<ChunkSenderDataType>::tryAllocateBatch(const UniquePortId originId,
+                                                   const uint32_t userPayloadSize,
+                                                   const uint32_t userPayloadAlignment,
+                                                   const uint32_t userHeaderSize,
+                                                   const uint32_t userHeaderAlignment,
+                                                   const uint32_t numberOfChunks,
+                                                   const Callable& callable) noexcept
+{
+    const auto chunkSettingsResult =
+        mepoo::ChunkSettings::create(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
+    if (chunkSettingsResult.has_error())
+    {
+        return cxx::error<AllocationError>(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+
+    const auto& chunkSettings = chunkSettingsResult.value();
+    uint32_t numberOfAllocatedChunks{0U};
+    bool tooManyChunksAllocatedInParallel{false};
+
+    mepoo::SharedChunk chunks[mepoo::MemoryManager::MAX_CHUNKS_PER_BATCH];
+    while (numberOfAllocatedChunks < numberOfChunks && !tooManyChunksAllocatedInParallel)
+    {
+        const uint32_t missingChunks = numberOfChunks - numberOfAllocatedChunks;
+        const uint32_t requestedChunks = (missingChunks < mepoo::MemoryManager::MAX_CHUNKS_PER_BATCH)
+                                             ? missingChunks
+                                             : mepoo::MemoryManager::MAX_CHUNKS_PER_BATCH;
+
+        // BEGIN of critical section, chunks will be lost if process gets hard terminated in between
+        const uint32_t acquiredChunks = getMembers()->m_memoryMgr->getChunks(chunkSettings, chunks, requestedChunks);
+        for (uint32_t i = 0U; i < acquiredChunks; ++i)
+        {
+            // if the application allocated too much chunks, the remaining chunks are released
+            if (!tooManyChunksAllocatedInParallel && getMembers()->m_chunksInUse.insert(chunks[i]))
+            {
+                // END of critical section, chunk will be lost if process gets hard terminated in between
+                chunks[i].getChunkHeader()->setOriginId(originId);
+                callable(chunks[i].getChunkHeader());
+                ++numberOfAllocatedChunks;
+            }
+            else
+            {
+                tooManyChunksAllocatedInParallel = true;
+            }
+            chunks[i] = nullptr;
+        }
+
+        if (acquiredChunks < requestedChunks)
+        {
+            break;
+        }
+    }
+
+    if (numberOfAllocatedChunks == 0U && numberOfChunks > 0U)
+    {
+        return cxx::error<AllocationError>(tooManyChunksAllocatedInParallel
+                                               ? AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL
+                                               : AllocationError::RUNNING_OUT_OF_CHUNKS);
+    }
+    return cxx::success<uint32_t>(numberOfAllocatedChunks);
+}
+
 template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
@@ -128,12 +192,76 @@ inline void ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const chu
     // BEGIN of critical section, chunk will be lost if process gets hard terminated in between
     if (getChunkReadyForSend(chunkHeader, chunk))
     {
-        this->deliverToAllStoredQueues(chunk);
+        const auto numberOfLostChunks = this->deliverToAllStoredQueues(chunk);
+        updateStatistics(chunk.getChunkHeader(), numberOfLostChunks);
+
+        getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+        getMembers()->m_lastChunkUnmanaged = chunk;
+    }
+    // END of critical section, chunk will be lost if process gets hard terminated in between
+}
+
+template <typename ChunkSenderDataType>
+inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* const chunkHeader,
+                                                          const UniquePortId uniqueQueueId,
+                                                          const uint32_t lastKnownQueueIndex) noexcept
+{
+    bool isQueueConnected{false};
+    mepoo::SharedChunk chunk(nullptr);
+    // BEGIN of critical section, chunk will be lost if process gets hard terminated in between
+    if (getChunkReadyForSend(chunkHeader, chunk))
+    {
+        isQueueConnected = !this->deliverToQueue(uniqueQueueId, lastKnownQueueIndex, chunk).has_error();
+        updateStatistics(chunk.getChunkHeader(), 0U);
 
         getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
         getMembers()->m_lastChunkUnmanaged = chunk;
     }
     // END of critical section, chunk will be lost if process gets hard terminated in between
+
+    return isQueueConnected;
+}
+
+template <typename ChunkSenderDataType>
+inline void ChunkSender<ChunkSenderDataType>::sendBatch(mepoo::ChunkHeader* const* const chunkHeaders,
+                                                        const uint32_t numberOfChunks) noexcept
+{
+    mepoo::SharedChunk chunks[mepoo::MemoryManager::MAX_CHUNKS_PER_BATCH];
+    uint32_t index{0U};
+    while (index < numberOfChunks)
+    {
+        // BEGIN of critical section, chunks will be lost if process gets hard terminated in between
+        uint64_t numberOfReadyChunks{0U};
+        for (; index < numberOfChunks && numberOfReadyChunks < mepoo::MemoryManager::MAX_CHUNKS_PER_BATCH; ++index)
+        {
+            if (getChunkReadyForSend(chunkHeaders[index], chunks[numberOfReadyChunks]))
+            {
+                ++numberOfReadyChunks;
+            }
+        }
+
+        if (numberOfReadyChunks == 0U)
+        {
+            continue;
+        }
+
+        // the lost chunks cannot be assigned to single chunks anymore, they are accounted with the last chunk
+        const auto numberOfLostChunks = this->deliverBatchToAllStoredQueues(chunks, numberOfReadyChunks);
+        for (uint64_t i = 0U; i < numberOfReadyChunks; ++i)
+        {
+            const bool isLastChunk = (i + 1U == numberOfReadyChunks);
+            updateStatistics(chunks[i].getChunkHeader(), isLastChunk ? numberOfLostChunks : 0U);
+        }
+
+        getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+        getMembers()->m_lastChunkUnmanaged = chunks[numberOfReadyChunks - 1U];
+
+        for (uint64_t i = 0U; i < numberOfReadyChunks; ++i)
+        {
+            chunks[i] = nullptr;
+        }
+        // END of critical section, chunks will be lost if process gets hard terminated in between
+    }
 }
 
 template <typename ChunkSenderDataType>
@@ -170,6 +298,7 @@ inline void ChunkSender<ChunkSenderDataType>::releaseAll() noexcept
     getMembers()->m_chunksInUse.cleanup();
     this->cleanup();
     getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+    getMembers()->m_memoryMgr->releaseChunkCache(getMembers()->m_chunkCache);
 }
 
 template <typename ChunkSenderDataType>
@@ -188,6 +317,36 @@ inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::
     }
 }
 
+template <typename ChunkSenderDataType>
+inline void ChunkSender<ChunkSenderDataType>::updateStatistics(const mepoo::ChunkHeader* const chunkHeader,
+                                                               const uint64_t numberOfLostChunks) noexcept
+{
+    // the ChunkSender is the only writer, therefore a load followed by a store is sufficient and cheaper than an
+    // atomic read-modify-write
+    auto& statistics = getMembers()->m_statistics;
+    statistics.m_sentChunks.store(statistics.m_sentChunks.load(std::memory_order_relaxed) + 1U,
+                                  std::memory_order_relaxed);
+    statistics.m_sentUserPayloadBytes.store(statistics.m_sentUserPayloadBytes.load(std::memory_order_relaxed)
+                                                + chunkHeader->userPayloadSize(),
+                                            std::memory_order_relaxed);
+    if (numberOfLostChunks > 0U)
+    {
+        statistics.m_lostChunks.store(statistics.m_lostChunks.load(std::memory_order_relaxed) + numberOfLostChunks,
+                                      std::memory_order_relaxed);
+    }
+    statistics.m_lastChunkSize.store(chunkHeader->chunkSize(), std::memory_order_relaxed);
+    statistics.m_lastUserPayloadSize.store(chunkHeader->userPayloadSize(), std::memory_order_relaxed);
+
+    const int64_t now = std::chrono::duration_cast<mepoo::DurationNs_t>(mepoo::BaseClock_t::now().time_since_epoch())
+                            .count();
+    const auto lastSendTimestamp = statistics.m_lastSendTimestampInNanoseconds.load(std::memory_order_relaxed);
+    if (lastSendTimestamp != 0)
+    {
+        statistics.m_lastSendIntervalInNanoseconds.store(now - lastSendTimestamp, std::memory_order_relaxed);
+    }
+    statistics.m_lastSendTimestampInNanoseconds.store(now, std::memory_order_relaxed);
+}
+
 } // namespace popo
 } // namespace iox
 
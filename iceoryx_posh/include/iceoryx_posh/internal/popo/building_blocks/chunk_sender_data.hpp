@@ -19,23 +19,43 @@
 
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_cache.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 
+#include <atomic>
+
 namespace iox
 {
 namespace popo
 {
+/// @brief Counters of a ChunkSender which are updated with every send and read by RouDi for the port introspection.
+/// The ChunkSender is the only writer, therefore relaxed loads and stores are sufficient and no read-modify-write
+/// operation is required on the hot path
+struct ChunkSenderStatistics
+{
+    std::atomic<uint64_t> m_sentChunks{0U};
+    std::atomic<uint64_t> m_sentUserPayloadBytes{0U};
+    /// @brief the number of chunks which were lost by subscribers with a full queue
+    std::atomic<uint64_t> m_lostChunks{0U};
+    std::atomic<uint32_t> m_lastChunkSize{0U};
+    std::atomic<uint32_t> m_lastUserPayloadSize{0U};
+    /// @brief time since epoch of mepoo::BaseClock_t
+    std::atomic<int64_t> m_lastSendTimestampInNanoseconds{0};
+    std::atomic<int64_t> m_lastSendIntervalInNanoseconds{0};
+};
+
 template <uint32_t MaxChunksAllocatedSimultaneously, typename ChunkDistributorDataType>
 struct ChunkSenderData : public ChunkDistributorDataType
 {
     explicit ChunkSenderData(cxx::not_null<mepoo::MemoryManager* const> memoryManager,
                              const SubscriberTooSlowPolicy subscriberTooSlowPolicy,
                              const uint64_t historyCapacity = 0U,
-                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo(),
+                             const units::Duration maxBlockingTime = units::Duration::max()) noexcept;
 
     using ChunkDistributorData_t = ChunkDistributorDataType;
 
@@ -44,6 +64,8 @@ struct ChunkSenderData : public ChunkDistributorDataType
     UsedChunkList<MaxChunksAllocatedSimultaneously> m_chunksInUse;
     mepoo::SequenceNumber_t m_sequenceNumber{0U};
     mepoo::ShmSafeUnmanagedChunk m_lastChunkUnmanaged;
+    mepoo::ChunkCache m_chunkCache;
+    ChunkSenderStatistics m_statistics;
 };
 
 } // namespace popo
@@ -26,8 +26,9 @@ inline ChunkSenderData<MaxChunksAllocatedSimultaneously, ChunkDistributorDataTyp
     cxx::not_null<mepoo::MemoryManager* const> memoryManager,
     const SubscriberTooSlowPolicy subscriberTooSlowPolicy,
     const uint64_t historyCapacity,
-    const mepoo::MemoryInfo& memoryInfo) noexcept
-    : ChunkDistributorDataType(subscriberTooSlowPolicy, historyCapacity)
+    const mepoo::MemoryInfo& memoryInfo,
+    const units::Duration maxBlockingTime) noexcept
+    : ChunkDistributorDataType(subscriberTooSlowPolicy, historyCapacity, maxBlockingTime)
     , m_memoryMgr(memoryManager)
     , m_memoryInfo(memoryInfo)
 {
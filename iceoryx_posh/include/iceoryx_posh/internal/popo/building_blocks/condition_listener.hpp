@@ -21,10 +21,21 @@
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 
+#include <atomic>
+
 namespace iox
 {
 namespace popo
 {
+/// @brief Statistics about how the waits of a ConditionListener ended
+struct WaitStatistics
+{
+    /// @brief the number of waits in which a notification arrived during the busy poll so that no sleep was required
+    uint64_t spinHits{0U};
+    /// @brief the number of times the listener went to sleep on the semaphore
+    uint64_t sleeps{0U};
+};
+
 /// @brief ConditionListener allows one to wait using a shared memory condition variable
 class ConditionListener
 {
@@ -65,19 +76,42 @@ class ConditionListener
     /// @return a sorted vector of active notifications
     NotificationVector_t timedWait(const units::Duration& timeToWait) noexcept;
 
+    /// @brief Sets the time wait() and timedWait() poll the notifications before they sleep on the semaphore. A
+    /// notification which arrives during the busy poll is returned without the latency of a wakeup but the polling
+    /// thread keeps its CPU busy, which makes it only useful on isolated cores. The default of zero disables the busy
+    /// poll. timedWait() polls at most for its timeout.
+    /// @param[in] busyPollDuration the time the notifications are polled before the listener sleeps
+    /// @note must not be called concurrently to wait() or timedWait()
+    void setBusyPollDuration(const units::Duration busyPollDuration) noexcept;
+
+    /// @brief Returns the time wait() and timedWait() poll the notifications before they sleep
+    /// @return the busy poll duration
+    units::Duration getBusyPollDuration() const noexcept;
+
+    /// @brief Returns how often the waits were ended by the busy poll and how often the listener had to sleep. It
+    /// can be called concurrently to wait() and timedWait().
+    /// @return the wait statistics since the construction of the ConditionListener
+    WaitStatistics getWaitStatistics() const noexcept;
+
   protected:
     const ConditionVariableData* getMembers() const noexcept;
     ConditionVariableData* getMembers() noexcept;
 
   private:
-    void reset(const uint64_t index) noexcept;
     void resetSemaphore() noexcept;
 
-    NotificationVector_t waitImpl(const cxx::function_ref<bool()>& waitCall) noexcept;
+    NotificationVector_t waitImpl(const cxx::function_ref<bool()>& waitCall,
+                                  const units::Duration busyPollDuration) noexcept;
+
+    bool busyPollForNotifications(const units::Duration busyPollDuration) const noexcept;
 
   private:
     ConditionVariableData* m_condVarDataPtr{nullptr};
     std::atomic_bool m_toBeDestroyed{false};
+    units::Duration m_busyPollDuration{units::Duration::fromNanoseconds(0U)};
+    // only the waiting thread writes the statistics, the atomics make it safe to read them from another thread
+    std::atomic<uint64_t> m_spinHits{0U};
+    std::atomic<uint64_t> m_sleeps{0U};
 };
 
 } // namespace popo
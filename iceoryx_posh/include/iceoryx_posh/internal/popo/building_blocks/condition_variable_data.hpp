@@ -29,6 +29,12 @@ namespace popo
 {
 struct ConditionVariableData
 {
+    /// @brief the notifications are stored as bits of atomic words, therefore a listener collects up to
+    /// NOTIFICATIONS_PER_WORD notifications with a single atomic operation
+    static constexpr uint64_t NOTIFICATIONS_PER_WORD{64U};
+    static constexpr uint64_t NUMBER_OF_NOTIFICATION_WORDS{
+        (MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE + NOTIFICATIONS_PER_WORD - 1U) / NOTIFICATIONS_PER_WORD};
+
     ConditionVariableData() noexcept;
     ConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
@@ -38,6 +44,14 @@ struct ConditionVariableData
     ConditionVariableData& operator=(ConditionVariableData&& rhs) = delete;
     ~ConditionVariableData() noexcept = default;
 
+    /// @brief activates the notification with the given index
+    /// @param[in] index of the notification, has to be less than MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE
+    void setNotification(const uint64_t index) noexcept;
+
+    /// @brief returns true if the notification with the given index is active, otherwise false
+    /// @param[in] index of the notification, has to be less than MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE
+    bool isNotificationSet(const uint64_t index) const noexcept;
+
     posix::Semaphore m_semaphore =
         std::move(posix::Semaphore::create(posix::CreateUnnamedSharedMemorySemaphore, 0u)
                       .or_else([](posix::SemaphoreError&) {
@@ -49,7 +63,7 @@ struct ConditionVariableData
 
     RuntimeName_t m_runtimeName;
     std::atomic_bool m_toBeDestroyed{false};
-    std::atomic_bool m_activeNotifications[MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE];
+    std::atomic<uint64_t> m_activeNotifications[NUMBER_OF_NOTIFICATION_WORDS];
 };
 
 } // namespace popo
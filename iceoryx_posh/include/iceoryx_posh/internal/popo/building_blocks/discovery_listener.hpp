@@ -0,0 +1,59 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_LISTENER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_LISTENER_HPP
+
+#include "iceoryx_hoofs/cxx/function_ref.hpp"
+#include "iceoryx_hoofs/internal/units/duration.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notification_data.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief DiscoveryListener is used by RouDi to wait for and to take the pending notifications of the
+/// DiscoveryNotifier
+class DiscoveryListener
+{
+  public:
+    explicit DiscoveryListener(DiscoveryNotificationData& dataRef) noexcept;
+
+    DiscoveryListener(const DiscoveryListener& rhs) = delete;
+    DiscoveryListener(DiscoveryListener&& rhs) noexcept = delete;
+    DiscoveryListener& operator=(const DiscoveryListener& rhs) = delete;
+    DiscoveryListener& operator=(DiscoveryListener&& rhs) noexcept = delete;
+    ~DiscoveryListener() noexcept = default;
+
+    /// @brief Blocks until a notifier was triggered or the timeout has passed
+    /// @param[in] timeout the maximum time to wait
+    /// @return true if a notifier was triggered before the timeout passed, otherwise false
+    /// @note since a notifier wakes up the listener at most once until the notifications are taken, a wake up can
+    /// be spurious when the corresponding notifications were already taken
+    bool timedWait(const units::Duration timeout) noexcept;
+
+    /// @brief Resets all pending notifications and calls the callback with the index of each of them in ascending
+    /// order
+    /// @param[in] callback which is called with the index of every pending notifier
+    void takeNotifications(const cxx::function_ref<void(const uint64_t)> callback) noexcept;
+
+  private:
+    DiscoveryNotificationData* m_dataPtr{nullptr};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_LISTENER_HPP
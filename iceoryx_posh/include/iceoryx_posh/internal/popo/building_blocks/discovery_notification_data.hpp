@@ -0,0 +1,61 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFICATION_DATA_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFICATION_DATA_HPP
+
+#include "iceoryx_hoofs/error_handling/error_handling.hpp"
+#include "iceoryx_hoofs/posix_wrapper/semaphore.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <atomic>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Shared memory data with which the ports announce a pending CaPro message to RouDi. Every port has its own
+/// bit in the pending notifications. The semaphore is only posted when the bit was not already set, i.e. RouDi is
+/// woken up at most once per port until it took the notifications.
+struct DiscoveryNotificationData
+{
+    static constexpr uint64_t MAX_NUMBER_OF_NOTIFIERS{MAX_PUBLISHERS + MAX_SUBSCRIBERS + MAX_CLIENTS + MAX_SERVERS};
+    static constexpr uint64_t BITS_PER_WORD{64U};
+    static constexpr uint64_t NUMBER_OF_WORDS{(MAX_NUMBER_OF_NOTIFIERS + BITS_PER_WORD - 1U) / BITS_PER_WORD};
+
+    DiscoveryNotificationData() noexcept;
+
+    DiscoveryNotificationData(const DiscoveryNotificationData& rhs) = delete;
+    DiscoveryNotificationData(DiscoveryNotificationData&& rhs) = delete;
+    DiscoveryNotificationData& operator=(const DiscoveryNotificationData& rhs) = delete;
+    DiscoveryNotificationData& operator=(DiscoveryNotificationData&& rhs) = delete;
+    ~DiscoveryNotificationData() noexcept = default;
+
+    posix::Semaphore m_semaphore =
+        std::move(posix::Semaphore::create(posix::CreateUnnamedSharedMemorySemaphore, 0u)
+                      .or_else([](posix::SemaphoreError&) {
+                          errorHandler(Error::kPOPO__DISCOVERY_NOTIFICATION_DATA_FAILED_TO_CREATE_SEMAPHORE,
+                                       nullptr,
+                                       ErrorLevel::FATAL);
+                      })
+                      .value());
+
+    std::atomic<uint64_t> m_pendingNotifications[NUMBER_OF_WORDS];
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFICATION_DATA_HPP
@@ -0,0 +1,51 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_HPP
+
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notification_data.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief DiscoveryNotifier is used by the user side of a port to announce a pending CaPro message to RouDi
+class DiscoveryNotifier
+{
+  public:
+    /// @param[in] dataPtr pointer to the notification data, with a nullptr the notifier does nothing, e.g. for ports
+    /// which were not created by the port pool of RouDi
+    /// @param[in] index of the notifier, has to be in the range of [0, MAX_NUMBER_OF_NOTIFIERS[
+    DiscoveryNotifier(DiscoveryNotificationData* const dataPtr, const uint64_t index) noexcept;
+
+    DiscoveryNotifier(const DiscoveryNotifier& rhs) = default;
+    DiscoveryNotifier(DiscoveryNotifier&& rhs) noexcept = default;
+    DiscoveryNotifier& operator=(const DiscoveryNotifier& rhs) = default;
+    DiscoveryNotifier& operator=(DiscoveryNotifier&& rhs) noexcept = default;
+    ~DiscoveryNotifier() noexcept = default;
+
+    /// @brief Marks the notifier as pending and wakes up RouDi if it was not already pending
+    void notify() noexcept;
+
+  private:
+    DiscoveryNotificationData* m_dataPtr{nullptr};
+    uint64_t m_index{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_NOTIFIER_HPP
@@ -0,0 +1,67 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_CLIENT_INL
+#define IOX_POSH_POPO_CLIENT_INL
+
+namespace iox
+{
+namespace popo
+{
+template <typename Req, typename Res, typename BaseClient_t>
+inline ClientImpl<Req, Res, BaseClient_t>::ClientImpl(const capro::ServiceDescription& service,
+                                                      const ClientOptions& clientOptions) noexcept
+    : BaseClient_t(service, clientOptions)
+{
+}
+
+template <typename Req, typename Res, typename BaseClient_t>
+template <typename... Args>
+inline cxx::expected<Request<Req>, AllocationError> ClientImpl<Req, Res, BaseClient_t>::loan(Args&&... args) noexcept
+{
+    auto result = port().allocateRequest(sizeof(Req), alignof(Req));
+    if (result.has_error())
+    {
+        return cxx::error<AllocationError>(result.get_error());
+    }
+    auto payload = new (result.value()->getUserPayload()) Req(std::forward<Args>(args)...);
+    return cxx::success<Request<Req>>(cxx::unique_ptr<Req>(payload, m_requestDeleter), *this);
+}
+
+template <typename Req, typename Res, typename BaseClient_t>
+inline void ClientImpl<Req, Res, BaseClient_t>::send(Request<Req>&& request) noexcept
+{
+    // release the Requests ownership of the chunk before sending it
+    auto payload = request.release();
+    port().sendRequest(RequestHeader::fromPayload(payload));
+}
+
+template <typename Req, typename Res, typename BaseClient_t>
+inline cxx::expected<Response<const Res>, ChunkReceiveResult> ClientImpl<Req, Res, BaseClient_t>::take() noexcept
+{
+    auto result = port().getResponse();
+    if (result.has_error())
+    {
+        return cxx::error<ChunkReceiveResult>(result.get_error());
+    }
+    auto payload = static_cast<const Res*>(result.value()->getUserPayload());
+    return cxx::success<Response<const Res>>(cxx::unique_ptr<const Res>(payload, m_responseDeleter));
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_CLIENT_INL
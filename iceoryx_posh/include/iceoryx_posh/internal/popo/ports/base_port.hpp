@@ -18,6 +18,7 @@
 #define IOX_POSH_POPO_PORTS_BASE_PORT_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port_data.hpp"
 
 namespace iox
@@ -85,6 +86,9 @@ class BasePort
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+    /// @brief returns the notifier with which RouDi is woken up to process a pending CaPro message of this port
+    DiscoveryNotifier getDiscoveryNotifier() noexcept;
+
   private:
     MemberType_t* m_basePortDataPtr;
 };
@@ -21,6 +21,7 @@
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/capro/capro_message.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notification_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/typed_unique_id.hpp"
 
 #include <atomic>
@@ -54,6 +55,11 @@ struct BasePortData
     NodeName_t m_nodeName;
     UniquePortId m_uniqueId;
     std::atomic_bool m_toBeDestroyed{false};
+
+    /// @brief set by the port pool of RouDi, used to announce pending CaPro messages without waiting for the next
+    /// discovery cycle; a nullptr disables the notification
+    rp::RelativePointer<DiscoveryNotificationData> m_discoveryNotificationData;
+    uint64_t m_discoveryNotifierIndex{0U};
 };
 
 } // namespace popo
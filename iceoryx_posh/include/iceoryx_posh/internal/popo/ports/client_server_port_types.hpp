@@ -20,6 +20,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_sender_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/popo/port_queue_policies.hpp"
 
 #include <cstdint>
 
@@ -39,16 +40,27 @@ struct ServerChunkDistributorConfig
     static constexpr uint64_t MAX_HISTORY_CAPACITY = 1; // could be 0, but problem for the container then
 };
 
+/// @note the request and response queues are always multi producer queues, see getQueueType; the FiFo and the SoFi
+/// share the underlying queue, therefore the queue is fixed at compile time and the policy only selects at runtime
+/// how a full queue behaves
 struct ClientChunkQueueConfig
 {
     static constexpr uint64_t MAX_QUEUE_CAPACITY = MAX_RESPONSE_QUEUE_CAPACITY;
+    static constexpr cxx::VariantQueueTypes QUEUE_TYPE = cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer;
 };
 
 struct ServerChunkQueueConfig
 {
     static constexpr uint64_t MAX_QUEUE_CAPACITY = MAX_REQUEST_QUEUE_CAPACITY;
+    static constexpr cxx::VariantQueueTypes QUEUE_TYPE = cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer;
 };
 
+/// @brief the request and response queues are filled by multiple producers; a SoFi overrides the oldest chunk when
+/// the queue is full and a FiFo rejects the new chunk
+/// @param[in] policy the QueueFullPolicy2 of the queue
+/// @return the queue type which realizes the policy
+cxx::VariantQueueTypes getQueueType(const QueueFullPolicy2 policy) noexcept;
+
 using ClientChunkQueueData_t = ChunkQueueData<ClientChunkQueueConfig, ThreadSafePolicy>;
 
 using ServerChunkQueueData_t = ChunkQueueData<ServerChunkQueueConfig, ThreadSafePolicy>;
@@ -18,6 +18,7 @@
 #define IOX_POSH_POPO_PORTS_PUBLISHER_PORT_USER_HPP
 
 #include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/function_ref.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
@@ -63,6 +64,24 @@ class PublisherPortUser : public BasePort
                      const uint32_t userHeaderSize = 0U,
                      const uint32_t userHeaderAlignment = 1U) noexcept;
 
+    /// @brief Allocate multiple chunks with the same settings at once, see tryAllocateChunk
+    /// @param[in] userPayloadSize, size of the user-payload without additional headers
+    /// @param[in] userPayloadAlignment, alignment of the user-payload
+    /// @param[in] userHeaderSize, size of the user-header; use iox::CHUNK_NO_USER_HEADER_SIZE to omit a user-header
+    /// @param[in] userHeaderAlignment, alignment of the user-header; use iox::CHUNK_NO_USER_HEADER_ALIGNMENT
+    /// to omit a user-header
+    /// @param[in] numberOfChunks, the number of chunks to allocate
+    /// @param[in] callable, is called with the ChunkHeader of every allocated chunk
+    /// @return on success the number of allocated chunks which might be less than numberOfChunks, error if not a
+    /// single chunk could be allocated
+    cxx::expected<uint32_t, AllocationError>
+    tryAllocateChunks(const uint32_t userPayloadSize,
+                      const uint32_t userPayloadAlignment,
+                      const uint32_t userHeaderSize,
+                      const uint32_t userHeaderAlignment,
+                      const uint32_t numberOfChunks,
+                      const cxx::function_ref<void(mepoo::ChunkHeader*)> callable) noexcept;
+
     /// @brief Free an allocated chunk without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to free
     void releaseChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -71,6 +90,12 @@ class PublisherPortUser : public BasePort
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send
     void sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send multiple allocated chunks in the given order to all connected subscriber ports; every subscriber is
+    /// notified once per batch instead of once per chunk
+    /// @param[in] chunkHeaders, array of pointers to the ChunkHeaders to send
+    /// @param[in] numberOfChunks, the number of elements in chunkHeaders
+    void sendChunks(mepoo::ChunkHeader* const* const chunkHeaders, const uint32_t numberOfChunks) noexcept;
+
     /// @brief Returns the last sent chunk if there is one
     /// @return pointer to the ChunkHeader of the last sent Chunk if there is one, empty optional if not
     cxx::optional<const mepoo::ChunkHeader*> tryGetPreviousChunk() const noexcept;
@@ -49,14 +49,14 @@ class ServerPortUser : public BasePort
     ServerPortUser& operator=(ServerPortUser&& rhs) noexcept = default;
     ~ServerPortUser() = default;
 
-    /// @brief Tries to get the next request from the queue. If there is a new one, the ChunkHeader of the oldest
+    /// @brief Tries to get the next request from the queue. If there is a new one, the RequestHeader of the oldest
     /// request in the queue is returned (FiFo queue)
-    /// @return optional that has a new chunk header or no value if there are no new requests in the underlying queue,
+    /// @return cxx::expected that has a new RequestHeader if there are new requests in the underlying queue,
     /// ChunkReceiveResult on error
-    cxx::expected<cxx::optional<const RequestHeader*>, ChunkReceiveResult> getRequest() noexcept;
+    cxx::expected<const RequestHeader*, ChunkReceiveResult> getRequest() noexcept;
 
     /// @brief Release a request that was obtained with getRequest
-    /// @param[in] chunkHeader, pointer to the ChunkHeader to release
+    /// @param[in] requestHeader, pointer to the RequestHeader to release
     void releaseRequest(const RequestHeader* const requestHeader) noexcept;
 
     /// @brief check if there are requests in the queue
@@ -67,20 +67,26 @@ class ServerPortUser : public BasePort
     /// @return true if the underlying queue overflowed since last call of this method, otherwise false
     bool hasLostRequestsSinceLastCall() noexcept;
 
-    /// @brief Allocate a response, the ownerhip of the SharedChunk remains in the ServerPortUser for being able to
-    /// cleanup if the user process disappears
-    /// @param[in] userPayloadSize, size of the user user-paylaod without additional headers
-    /// @return on success pointer to a ChunkHeader which can be used to access the chunk-header, user-header and
+    /// @brief Allocate a response for a request, the ownerhip of the SharedChunk remains in the ServerPortUser for
+    /// being able to cleanup if the user process disappears
+    /// @param[in] requestHeader, pointer to the RequestHeader of the request which shall be answered; the response is
+    /// addressed to the client which sent the request and carries the sequence id of the request
+    /// @param[in] userPayloadSize, size of the user-paylaod without additional headers
+    /// @param[in] userPayloadAlignment, alignment of the user-paylaod without additional headers
+    /// @return on success pointer to a ResponseHeader which can be used to access the chunk-header, user-header and
     /// user-payload fields, error if not
-    cxx::expected<ResponseHeader*, AllocationError> allocateResponse(const uint32_t userPayloadSize) noexcept;
+    cxx::expected<ResponseHeader*, AllocationError> allocateResponse(const RequestHeader* const requestHeader,
+                                                                     const uint32_t userPayloadSize,
+                                                                     const uint32_t userPayloadAlignment) noexcept;
 
     /// @brief Free an allocated response without sending it
-    /// @param[in] chunkHeader, pointer to the ChunkHeader to free
+    /// @param[in] responseHeader, pointer to the ResponseHeader to free
     void freeResponse(ResponseHeader* const responseHeader) noexcept;
 
-    /// @brief Send an allocated request chunk to the server port
-    /// @param[in] chunkHeader, pointer to the ChunkHeader to send
-    void sendResponse(ResponseHeader* const responseHeader) noexcept;
+    /// @brief Send an allocated response chunk to the client port which sent the request
+    /// @param[in] responseHeader, pointer to the ResponseHeader to send
+    /// @return true if the client is still connected, otherwise false and the response is dropped
+    bool sendResponse(ResponseHeader* const responseHeader) noexcept;
 
     /// @brief offer this server port in the system
     void offer() noexcept;
@@ -96,11 +102,10 @@ class ServerPortUser : public BasePort
     /// @return true if there are clients otherwise false
     bool hasClients() const noexcept;
 
-    /// @brief set a condition variable (via its pointer) to the client
-    /// @return true if attachment worked, otherwise false
+    /// @brief set a condition variable (via its pointer) to the server
     void setConditionVariable(ConditionVariableData& conditionVariableData, const uint64_t notificationIndex) noexcept;
 
-    /// @brief unset a condition variable from the client
+    /// @brief unset a condition variable from the server
     void unsetConditionVariable() noexcept;
 
     /// @brief check if there's a condition variable set
@@ -118,4 +123,4 @@ class ServerPortUser : public BasePort
 } // namespace popo
 } // namespace iox
 
-#endif // IOX_POSH_POPO_PORTS_PUBLISHER_PORT_USER_HPP
+#endif // IOX_POSH_POPO_PORTS_SERVER_PORT_USER_HPP
@@ -19,6 +19,7 @@
 #define IOX_POPO_SUBSCRIBER_PORT_USER_HPP_
 
 #include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/function_ref.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
@@ -68,6 +69,16 @@ class SubscriberPortUser : public BasePort
     /// or if there are no new chunks in the underlying queue
     cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGetChunk() noexcept;
 
+    /// @brief Tries to get up to the given number of chunks from the queue in one pass. The chunks are handed over
+    /// in the order in which they were received (FiFo queue)
+    /// @param[in] maxNumberOfChunks the maximum number of chunks to get
+    /// @param[in] callable is called with the ChunkHeader of every chunk
+    /// @return the number of chunks handed over to the callable, which is zero if there are no new chunks in the
+    /// underlying queue, or ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL if the pass was stopped early
+    cxx::expected<uint64_t, ChunkReceiveResult>
+    tryGetChunks(const uint64_t maxNumberOfChunks,
+                 const cxx::function_ref<void(const mepoo::ChunkHeader*)> callable) noexcept;
+
     /// @brief Release a chunk that was obtained with tryGetChunk
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept;
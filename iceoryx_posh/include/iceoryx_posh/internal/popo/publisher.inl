@@ -88,6 +88,53 @@ inline void PublisherImpl<T, H, BasePublisher_t>::publish(Sample<T, H>&& sample)
     port().sendChunk(chunkHeader);
 }
 
+template <typename T, typename H, typename BasePublisher_t>
+template <typename Callable>
+inline cxx::expected<uint32_t, AllocationError>
+PublisherImpl<T, H, BasePublisher_t>::loanBatch(const uint32_t numberOfSamples, const Callable& callable) noexcept
+{
+    static constexpr uint32_t USER_HEADER_SIZE{std::is_same<H, mepoo::NoUserHeader>::value ? 0U : sizeof(H)};
+
+    return port().tryAllocateChunks(
+        sizeof(T), alignof(T), USER_HEADER_SIZE, alignof(H), numberOfSamples, [&](mepoo::ChunkHeader* chunkHeader) {
+            auto sample = convertChunkHeaderToSample(chunkHeader);
+            new (sample.get()) T();
+            callable(std::move(sample));
+        });
+}
+
+template <typename T, typename H, typename BasePublisher_t>
+inline void PublisherImpl<T, H, BasePublisher_t>::publishBatch(Sample<T, H>* const samples,
+                                                               const uint32_t numberOfSamples) noexcept
+{
+    mepoo::ChunkHeader* chunkHeaders[mepoo::MemoryManager::MAX_CHUNKS_PER_BATCH];
+    uint32_t numberOfChunkHeaders{0U};
+    for (uint32_t i = 0U; i < numberOfSamples; ++i)
+    {
+        if (samples[i].get() == nullptr)
+        {
+            LogError() << "Tried to publish empty Sample! Might be an already published or moved Sample!";
+            errorHandler(Error::kPOSH__PUBLISHING_EMPTY_SAMPLE, nullptr, ErrorLevel::MODERATE);
+            continue;
+        }
+
+        // release the Samples ownership of the chunk before publishing
+        chunkHeaders[numberOfChunkHeaders] = mepoo::ChunkHeader::fromUserPayload(samples[i].release());
+        ++numberOfChunkHeaders;
+
+        if (numberOfChunkHeaders == mepoo::MemoryManager::MAX_CHUNKS_PER_BATCH)
+        {
+            port().sendChunks(chunkHeaders, numberOfChunkHeaders);
+            numberOfChunkHeaders = 0U;
+        }
+    }
+
+    if (numberOfChunkHeaders > 0U)
+    {
+        port().sendChunks(chunkHeaders, numberOfChunkHeaders);
+    }
+}
+
 template <typename T, typename H, typename BasePublisher_t>
 inline Sample<T, H>
 PublisherImpl<T, H, BasePublisher_t>::convertChunkHeaderToSample(mepoo::ChunkHeader* const header) noexcept
@@ -0,0 +1,76 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_RPC_DELETER_HPP
+#define IOX_POSH_POPO_RPC_DELETER_HPP
+
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/popo/rpc_header.hpp"
+
+namespace iox
+{
+namespace popo
+{
+/// @brief The deleter of the Request; a loaned request is freed by the client and a taken request is released by the
+/// server
+template <typename Port>
+struct RequestDeleter
+{
+  public:
+    explicit RequestDeleter(Port& port) noexcept;
+
+    /// @brief Handles the deletion of a loaned request.
+    /// @param[in] userPayload The pointer to the user-payload of the request.
+    template <typename T>
+    void operator()(T* const userPayload) noexcept;
+
+    /// @brief Handles the deletion of a taken request.
+    /// @param[in] userPayload The pointer to the user-payload of the request.
+    template <typename T>
+    void operator()(const T* const userPayload) noexcept;
+
+  private:
+    Port* m_port{nullptr};
+};
+
+/// @brief The deleter of the Response; a loaned response is freed by the server and a taken response is released by
+/// the client
+template <typename Port>
+struct ResponseDeleter
+{
+  public:
+    explicit ResponseDeleter(Port& port) noexcept;
+
+    /// @brief Handles the deletion of a loaned response.
+    /// @param[in] userPayload The pointer to the user-payload of the response.
+    template <typename T>
+    void operator()(T* const userPayload) noexcept;
+
+    /// @brief Handles the deletion of a taken response.
+    /// @param[in] userPayload The pointer to the user-payload of the response.
+    template <typename T>
+    void operator()(const T* const userPayload) noexcept;
+
+  private:
+    Port* m_port{nullptr};
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/rpc_deleter.inl"
+
+#endif // IOX_POSH_POPO_RPC_DELETER_HPP
@@ -0,0 +1,69 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_RPC_DELETER_INL
+#define IOX_POSH_POPO_RPC_DELETER_INL
+
+#include "iceoryx_posh/internal/popo/rpc_deleter.hpp"
+
+namespace iox
+{
+namespace popo
+{
+template <typename Port>
+inline RequestDeleter<Port>::RequestDeleter(Port& port) noexcept
+    : m_port(&port)
+{
+}
+
+template <typename Port>
+template <typename T>
+inline void RequestDeleter<Port>::operator()(T* const userPayload) noexcept
+{
+    m_port->freeRequest(RequestHeader::fromPayload(userPayload));
+}
+
+template <typename Port>
+template <typename T>
+inline void RequestDeleter<Port>::operator()(const T* const userPayload) noexcept
+{
+    m_port->releaseRequest(RequestHeader::fromPayload(userPayload));
+}
+
+template <typename Port>
+inline ResponseDeleter<Port>::ResponseDeleter(Port& port) noexcept
+    : m_port(&port)
+{
+}
+
+template <typename Port>
+template <typename T>
+inline void ResponseDeleter<Port>::operator()(T* const userPayload) noexcept
+{
+    m_port->freeResponse(ResponseHeader::fromPayload(userPayload));
+}
+
+template <typename Port>
+template <typename T>
+inline void ResponseDeleter<Port>::operator()(const T* const userPayload) noexcept
+{
+    m_port->releaseResponse(ResponseHeader::fromPayload(userPayload));
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_RPC_DELETER_INL
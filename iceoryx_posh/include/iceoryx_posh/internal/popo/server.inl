@@ -0,0 +1,68 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_SERVER_INL
+#define IOX_POSH_POPO_SERVER_INL
+
+namespace iox
+{
+namespace popo
+{
+template <typename Req, typename Res, typename BaseServer_t>
+inline ServerImpl<Req, Res, BaseServer_t>::ServerImpl(const capro::ServiceDescription& service,
+                                                      const ServerOptions& serverOptions) noexcept
+    : BaseServer_t(service, serverOptions)
+{
+}
+
+template <typename Req, typename Res, typename BaseServer_t>
+inline cxx::expected<Request<const Req>, ChunkReceiveResult> ServerImpl<Req, Res, BaseServer_t>::take() noexcept
+{
+    auto result = port().getRequest();
+    if (result.has_error())
+    {
+        return cxx::error<ChunkReceiveResult>(result.get_error());
+    }
+    auto payload = static_cast<const Req*>(result.value()->getUserPayload());
+    return cxx::success<Request<const Req>>(cxx::unique_ptr<const Req>(payload, m_requestDeleter));
+}
+
+template <typename Req, typename Res, typename BaseServer_t>
+template <typename... Args>
+inline cxx::expected<Response<Res>, AllocationError>
+ServerImpl<Req, Res, BaseServer_t>::loan(const Request<const Req>& request, Args&&... args) noexcept
+{
+    auto result = port().allocateResponse(&request.getRequestHeader(), sizeof(Res), alignof(Res));
+    if (result.has_error())
+    {
+        return cxx::error<AllocationError>(result.get_error());
+    }
+    auto payload = new (result.value()->getUserPayload()) Res(std::forward<Args>(args)...);
+    return cxx::success<Response<Res>>(cxx::unique_ptr<Res>(payload, m_responseDeleter), *this);
+}
+
+template <typename Req, typename Res, typename BaseServer_t>
+inline void ServerImpl<Req, Res, BaseServer_t>::send(Response<Res>&& response) noexcept
+{
+    // release the Responses ownership of the chunk before sending it
+    auto payload = response.release();
+    port().sendResponse(ResponseHeader::fromPayload(payload));
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_SERVER_INL
@@ -43,6 +43,17 @@ SubscriberImpl<T, H, BaseSubscriber_t>::take() noexcept
     return cxx::success<Sample<const T, const H>>(std::move(samplePtr));
 }
 
+template <typename T, typename H, typename BaseSubscriber_t>
+template <typename Callable>
+inline cxx::expected<uint64_t, ChunkReceiveResult>
+SubscriberImpl<T, H, BaseSubscriber_t>::takeBatch(const uint64_t maxNumberOfSamples, const Callable& callable) noexcept
+{
+    return BaseSubscriber_t::takeChunks(maxNumberOfSamples, [&](const mepoo::ChunkHeader* chunkHeader) {
+        auto userPayloadPtr = static_cast<const T*>(chunkHeader->userPayload());
+        callable(Sample<const T, const H>(cxx::unique_ptr<const T>(userPayloadPtr, m_sampleDeleter)));
+    });
+}
+
 template <typename T, typename H, typename BaseSubscriber_t>
 inline SubscriberImpl<T, H, BaseSubscriber_t>::~SubscriberImpl() noexcept
 {
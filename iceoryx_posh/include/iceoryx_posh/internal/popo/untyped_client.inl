@@ -0,0 +1,75 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_UNTYPED_CLIENT_INL
+#define IOX_POSH_POPO_UNTYPED_CLIENT_INL
+
+namespace iox
+{
+namespace popo
+{
+template <typename BaseClient_t>
+inline UntypedClientImpl<BaseClient_t>::UntypedClientImpl(const capro::ServiceDescription& service,
+                                                          const ClientOptions& clientOptions) noexcept
+    : BaseClient_t(service, clientOptions)
+{
+}
+
+template <typename BaseClient_t>
+inline cxx::expected<void*, AllocationError>
+UntypedClientImpl<BaseClient_t>::loan(const uint32_t userPayloadSize, const uint32_t userPayloadAlignment) noexcept
+{
+    auto result = port().allocateRequest(userPayloadSize, userPayloadAlignment);
+    if (result.has_error())
+    {
+        return cxx::error<AllocationError>(result.get_error());
+    }
+    return cxx::success<void*>(result.value()->getUserPayload());
+}
+
+template <typename BaseClient_t>
+inline void UntypedClientImpl<BaseClient_t>::send(void* const requestPayload) noexcept
+{
+    port().sendRequest(RequestHeader::fromPayload(requestPayload));
+}
+
+template <typename BaseClient_t>
+inline void UntypedClientImpl<BaseClient_t>::releaseRequest(void* const requestPayload) noexcept
+{
+    port().freeRequest(RequestHeader::fromPayload(requestPayload));
+}
+
+template <typename BaseClient_t>
+inline cxx::expected<const void*, ChunkReceiveResult> UntypedClientImpl<BaseClient_t>::take() noexcept
+{
+    auto result = port().getResponse();
+    if (result.has_error())
+    {
+        return cxx::error<ChunkReceiveResult>(result.get_error());
+    }
+    return cxx::success<const void*>(result.value()->getUserPayload());
+}
+
+template <typename BaseClient_t>
+inline void UntypedClientImpl<BaseClient_t>::releaseResponse(const void* const responsePayload) noexcept
+{
+    port().releaseResponse(ResponseHeader::fromPayload(responsePayload));
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_UNTYPED_CLIENT_INL
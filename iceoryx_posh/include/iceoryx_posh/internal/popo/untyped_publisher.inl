@@ -54,6 +54,43 @@ UntypedPublisherImpl<BasePublisher_t>::loan(const uint32_t userPayloadSize,
     }
 }
 
+template <typename BasePublisher_t>
+template <typename Callable>
+inline cxx::expected<uint32_t, AllocationError>
+UntypedPublisherImpl<BasePublisher_t>::loanBatch(const uint32_t numberOfChunks,
+                                                 const Callable& callable,
+                                                 const uint32_t userPayloadSize,
+                                                 const uint32_t userPayloadAlignment,
+                                                 const uint32_t userHeaderSize,
+                                                 const uint32_t userHeaderAlignment) noexcept
+{
+    return port().tryAllocateChunks(userPayloadSize,
+                                    userPayloadAlignment,
+                                    userHeaderSize,
+                                    userHeaderAlignment,
+                                    numberOfChunks,
+                                    [&](mepoo::ChunkHeader* chunkHeader) { callable(chunkHeader->userPayload()); });
+}
+
+template <typename BasePublisher_t>
+inline void UntypedPublisherImpl<BasePublisher_t>::publishBatch(void* const* const userPayloads,
+                                                                const uint32_t numberOfChunks) noexcept
+{
+    mepoo::ChunkHeader* chunkHeaders[mepoo::MemoryManager::MAX_CHUNKS_PER_BATCH];
+    uint32_t numberOfChunkHeaders{0U};
+    for (uint32_t i = 0U; i < numberOfChunks; ++i)
+    {
+        chunkHeaders[numberOfChunkHeaders] = mepoo::ChunkHeader::fromUserPayload(userPayloads[i]);
+        ++numberOfChunkHeaders;
+
+        if (numberOfChunkHeaders == mepoo::MemoryManager::MAX_CHUNKS_PER_BATCH || i + 1U == numberOfChunks)
+        {
+            port().sendChunks(chunkHeaders, numberOfChunkHeaders);
+            numberOfChunkHeaders = 0U;
+        }
+    }
+}
+
 template <typename BasePublisher_t>
 inline void UntypedPublisherImpl<BasePublisher_t>::release(void* const userPayload) noexcept
 {
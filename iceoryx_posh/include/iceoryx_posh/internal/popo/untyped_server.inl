@@ -0,0 +1,77 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_UNTYPED_SERVER_INL
+#define IOX_POSH_POPO_UNTYPED_SERVER_INL
+
+namespace iox
+{
+namespace popo
+{
+template <typename BaseServer_t>
+inline UntypedServerImpl<BaseServer_t>::UntypedServerImpl(const capro::ServiceDescription& service,
+                                                          const ServerOptions& serverOptions) noexcept
+    : BaseServer_t(service, serverOptions)
+{
+}
+
+template <typename BaseServer_t>
+inline cxx::expected<const void*, ChunkReceiveResult> UntypedServerImpl<BaseServer_t>::take() noexcept
+{
+    auto result = port().getRequest();
+    if (result.has_error())
+    {
+        return cxx::error<ChunkReceiveResult>(result.get_error());
+    }
+    return cxx::success<const void*>(result.value()->getUserPayload());
+}
+
+template <typename BaseServer_t>
+inline void UntypedServerImpl<BaseServer_t>::releaseRequest(const void* const requestPayload) noexcept
+{
+    port().releaseRequest(RequestHeader::fromPayload(requestPayload));
+}
+
+template <typename BaseServer_t>
+inline cxx::expected<void*, AllocationError>
+UntypedServerImpl<BaseServer_t>::loan(const RequestHeader* const requestHeader,
+                                      const uint32_t userPayloadSize,
+                                      const uint32_t userPayloadAlignment) noexcept
+{
+    auto result = port().allocateResponse(requestHeader, userPayloadSize, userPayloadAlignment);
+    if (result.has_error())
+    {
+        return cxx::error<AllocationError>(result.get_error());
+    }
+    return cxx::success<void*>(result.value()->getUserPayload());
+}
+
+template <typename BaseServer_t>
+inline void UntypedServerImpl<BaseServer_t>::send(void* const responsePayload) noexcept
+{
+    port().sendResponse(ResponseHeader::fromPayload(responsePayload));
+}
+
+template <typename BaseServer_t>
+inline void UntypedServerImpl<BaseServer_t>::releaseResponse(void* const responsePayload) noexcept
+{
+    port().freeResponse(ResponseHeader::fromPayload(responsePayload));
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_UNTYPED_SERVER_INL
@@ -40,6 +40,16 @@ inline cxx::expected<const void*, ChunkReceiveResult> UntypedSubscriberImpl<Base
     return cxx::success<const void*>(result.value()->userPayload());
 }
 
+template <typename BaseSubscriber_t>
+template <typename Callable>
+inline cxx::expected<uint64_t, ChunkReceiveResult>
+UntypedSubscriberImpl<BaseSubscriber_t>::takeBatch(const uint64_t maxNumberOfChunks, const Callable& callable) noexcept
+{
+    return BaseSubscriber::takeChunks(maxNumberOfChunks, [&](const mepoo::ChunkHeader* chunkHeader) {
+        callable(static_cast<const void*>(chunkHeader->userPayload()));
+    });
+}
+
 template <typename BaseSubscriber_t>
 inline void UntypedSubscriberImpl<BaseSubscriber_t>::release(const void* const userPayload) noexcept
 {
@@ -28,6 +28,21 @@ namespace iox
 {
 namespace popo
 {
+namespace internal
+{
+/// @brief the hash table of the UsedChunkList has a power of two capacity which is at least twice the capacity of the
+/// list to keep the probe sequences short
+constexpr uint32_t hashTableCapacity(const uint32_t listCapacity) noexcept
+{
+    uint32_t capacity{1U};
+    while (capacity < 2U * listCapacity)
+    {
+        capacity *= 2U;
+    }
+    return capacity;
+}
+} // namespace internal
+
 /// @brief This class is used to keep track of the chunks currently in use by the application.
 ///        In case the application terminates while holding chunks, this list is used by RouDi to retain ownership of
 ///        the chunks and prevent a chunk leak.
@@ -38,6 +53,9 @@ namespace popo
 ///        accessed. Additionally, the type stored is this array must be less or equal to 64 bit in order to write it
 ///        within one clock cycle to prevent torn writes, which would corrupt the list and could potentially crash
 ///        RouDi.
+///        To find the chunk to remove in constant time, the list indices of the used chunks are additionally stored in
+///        an open addressing hash table with the ChunkHeader address as key. The hash table is not needed for the
+///        cleanup by RouDi, therefore it doesn't matter if it is inconsistent when the application terminates.
 template <uint32_t Capacity>
 class UsedChunkList
 {
@@ -68,18 +86,27 @@ class UsedChunkList
   private:
     void init() noexcept;
 
+    /// @brief the slot in the hash table where the search for the list index of a chunk starts
+    static uint32_t homeSlot(const mepoo::ChunkHeader* chunkHeader) noexcept;
+
+    /// @brief removes the entry in the given slot from the hash table and moves the following entries of the probe
+    /// sequence backwards to close the gap
+    void eraseSlot(uint32_t slot) noexcept;
+
   private:
     static constexpr uint32_t INVALID_INDEX{Capacity};
+    static constexpr uint32_t HASH_TABLE_CAPACITY{internal::hashTableCapacity(Capacity)};
+    static constexpr uint32_t HASH_TABLE_INDEX_MASK{HASH_TABLE_CAPACITY - 1U};
 
     using DataElement_t = mepoo::ShmSafeUnmanagedChunk;
     static constexpr DataElement_t DATA_ELEMENT_LOGICAL_NULLPTR{};
 
   private:
     std::atomic_flag m_synchronizer = ATOMIC_FLAG_INIT;
-    uint32_t m_usedListHead{INVALID_INDEX};
     uint32_t m_freeListHead{0u};
     uint32_t m_listIndices[Capacity];
     DataElement_t m_listData[Capacity];
+    uint32_t m_hashTable[HASH_TABLE_CAPACITY];
 };
 
 } // namespace popo
@@ -31,6 +31,7 @@ UsedChunkList<Capacity>::UsedChunkList() noexcept
     static_assert(sizeof(DataElement_t) <= 8U, "The size of the data element type must not exceed 64 bit!");
     static_assert(std::is_trivially_copyable<DataElement_t>::value,
                   "The data element type must be trivially copyable!");
+    static_assert(HASH_TABLE_CAPACITY > Capacity, "The hash table must have more slots than the list!");
 
     init();
 }
@@ -41,17 +42,21 @@ bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
     auto hasFreeSpace = m_freeListHead != INVALID_INDEX;
     if (hasFreeSpace)
     {
-        // get next free entry after freelistHead
-        auto nextFree = m_listIndices[m_freeListHead];
+        auto index = m_freeListHead;
 
-        // freeListHead is getting new usedListHead, next of this entry is updated to next in usedList
-        m_listIndices[m_freeListHead] = m_usedListHead;
-        m_usedListHead = m_freeListHead;
+        // set freeListHead to the next free entry
+        m_freeListHead = m_listIndices[index];
+        m_listIndices[index] = INVALID_INDEX;
 
-        m_listData[m_usedListHead] = DataElement_t(chunk);
+        m_listData[index] = DataElement_t(chunk);
 
-        // set freeListHead to the next free entry
-        m_freeListHead = nextFree;
+        // the hash table has more slots than the list, therefore there is always a free slot
+        auto slot = homeSlot(m_listData[index].getChunkHeader());
+        while (m_hashTable[slot] != INVALID_INDEX)
+        {
+            slot = (slot + 1U) & HASH_TABLE_INDEX_MASK;
+        }
+        m_hashTable[slot] = index;
 
         /// @todo can we do this cheaper with a global fence in cleanup?
         m_synchronizer.clear(std::memory_order_release);
@@ -66,42 +71,60 @@ bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
 template <uint32_t Capacity>
 bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept
 {
-    auto previous = INVALID_INDEX;
-
-    // go through usedList with stored chunks
-    for (auto current = m_usedListHead; current != INVALID_INDEX; current = m_listIndices[current])
+    // follow the probe sequence of the chunkHeader until the entry is found or a free slot terminates the search
+    for (auto slot = homeSlot(chunkHeader); m_hashTable[slot] != INVALID_INDEX;
+         slot = (slot + 1U) & HASH_TABLE_INDEX_MASK)
     {
-        if (!m_listData[current].isLogicalNullptr())
+        auto index = m_hashTable[slot];
+        if (m_listData[index].getChunkHeader() == chunkHeader)
         {
-            // does the entry match the one we want to remove?
-            if (m_listData[current].getChunkHeader() == chunkHeader)
-            {
-                chunk = m_listData[current].releaseToSharedChunk();
-
-                // remove index from used list
-                if (current == m_usedListHead)
-                {
-                    m_usedListHead = m_listIndices[current];
-                }
-                else
-                {
-                    m_listIndices[previous] = m_listIndices[current];
-                }
-
-                // insert index to free list
-                m_listIndices[current] = m_freeListHead;
-                m_freeListHead = current;
-
-                /// @todo can we do this cheaper with a global fence in cleanup?
-                m_synchronizer.clear(std::memory_order_release);
-                return true;
-            }
+            chunk = m_listData[index].releaseToSharedChunk();
+
+            eraseSlot(slot);
+
+            // insert index to free list
+            m_listIndices[index] = m_freeListHead;
+            m_freeListHead = index;
+
+            /// @todo can we do this cheaper with a global fence in cleanup?
+            m_synchronizer.clear(std::memory_order_release);
+            return true;
         }
-        previous = current;
     }
     return false;
 }
 
+template <uint32_t Capacity>
+uint32_t UsedChunkList<Capacity>::homeSlot(const mepoo::ChunkHeader* chunkHeader) noexcept
+{
+    // Fibonacci hashing; the low bits of the address are always zero due to the alignment of the ChunkHeader
+    // therefore the bits in the middle of the product are used
+    constexpr uint64_t FIBONACCI_MULTIPLIER{11400714819323198485ULL};
+    constexpr uint64_t SHIFT{32U};
+    return static_cast<uint32_t>((reinterpret_cast<uint64_t>(chunkHeader) * FIBONACCI_MULTIPLIER) >> SHIFT)
+           & HASH_TABLE_INDEX_MASK;
+}
+
+template <uint32_t Capacity>
+void UsedChunkList<Capacity>::eraseSlot(uint32_t slot) noexcept
+{
+    auto hole = slot;
+    for (auto next = (hole + 1U) & HASH_TABLE_INDEX_MASK; m_hashTable[next] != INVALID_INDEX;
+         next = (next + 1U) & HASH_TABLE_INDEX_MASK)
+    {
+        // the entry can be moved into the hole if the hole is between its home slot and its current slot
+        auto home = homeSlot(m_listData[m_hashTable[next]].getChunkHeader());
+        auto distanceFromHome = (next - home) & HASH_TABLE_INDEX_MASK;
+        auto distanceFromHole = (next - hole) & HASH_TABLE_INDEX_MASK;
+        if (distanceFromHome >= distanceFromHole)
+        {
+            m_hashTable[hole] = m_hashTable[next];
+            hole = next;
+        }
+    }
+    m_hashTable[hole] = INVALID_INDEX;
+}
+
 template <uint32_t Capacity>
 void UsedChunkList<Capacity>::cleanup() noexcept
 {
@@ -137,10 +160,13 @@ void UsedChunkList<Capacity>::init() noexcept
         m_listIndices[0U] = INVALID_INDEX;
     }
 
-
-    m_usedListHead = INVALID_INDEX;
     m_freeListHead = 0U;
 
+    for (auto& slot : m_hashTable)
+    {
+        slot = INVALID_INDEX;
+    }
+
     // clear data
     for (auto& data : m_listData)
     {
@@ -272,6 +272,18 @@ inline typename WaitSet<Capacity>::NotificationInfoVector WaitSet<Capacity>::wai
     return waitAndReturnTriggeredTriggers([this] { return this->m_conditionListener.wait(); });
 }
 
+template <uint64_t Capacity>
+inline void WaitSet<Capacity>::setBusyPollDuration(const units::Duration busyPollDuration) noexcept
+{
+    m_conditionListener.setBusyPollDuration(busyPollDuration);
+}
+
+template <uint64_t Capacity>
+inline WaitStatistics WaitSet<Capacity>::getWaitStatistics() const noexcept
+{
+    return m_conditionListener.getWaitStatistics();
+}
+
 template <uint64_t Capacity>
 inline typename WaitSet<Capacity>::NotificationInfoVector
 WaitSet<Capacity>::createVectorWithTriggeredTriggers() noexcept
@@ -84,8 +84,10 @@ class PortIntrospection
 
             using TimePointNs_t = mepoo::TimePointNs_t;
             using DurationNs_t = mepoo::DurationNs_t;
-            TimePointNs_t m_sequenceNumberTimestamp{DurationNs_t(0)};
-            mepoo::SequenceNumber_t m_sequenceNumber{0U};
+            /// snapshot of the publisher statistics at the last throughput update to calculate the rates
+            TimePointNs_t m_statisticsTimestamp{DurationNs_t(0)};
+            uint64_t m_sentChunks{0U};
+            uint64_t m_sentUserPayloadBytes{0U};
 
             /// map from indices to object pointers
             std::map<int, ConnectionInfo*> connectionMap;
@@ -580,9 +580,60 @@ PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortInt
 
 template <typename PublisherPort, typename SubscriberPort>
 inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(
-    PortThroughputIntrospectionTopic& topic IOX_MAYBE_UNUSED) noexcept
+    PortThroughputIntrospectionTopic& topic) noexcept
 {
-    /// @todo #402 re-add port throughput
+    auto& m_throughputList = topic.m_throughputList;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto now = mepoo::BaseClock_t::now();
+    // same order as the publisher list of the PortIntrospectionTopic to allow a fast lookup by index
+    for (auto& pub : m_publisherMap)
+    {
+        auto& innerPublisherMap = pub.second;
+        for (auto& pair : innerPublisherMap)
+        {
+            auto m_publisherIndex = pair.second;
+            if (m_publisherIndex >= 0)
+            {
+                auto& publisherInfo = m_publisherContainer[m_publisherIndex];
+                const auto& statistics = publisherInfo.portData->m_chunkSenderData.m_statistics;
+                const auto sentChunks = statistics.m_sentChunks.load(std::memory_order_relaxed);
+                const auto sentUserPayloadBytes = statistics.m_sentUserPayloadBytes.load(std::memory_order_relaxed);
+
+                PortThroughputData throughputData;
+                PublisherPort port(publisherInfo.portData);
+                throughputData.m_publisherPortID = static_cast<uint64_t>(port.getUniqueID());
+                throughputData.m_sampleSize = statistics.m_lastUserPayloadSize.load(std::memory_order_relaxed);
+                throughputData.m_chunkSize = statistics.m_lastChunkSize.load(std::memory_order_relaxed);
+                throughputData.m_lastSendIntervalInNanoseconds = static_cast<uint64_t>(
+                    statistics.m_lastSendIntervalInNanoseconds.load(std::memory_order_relaxed));
+                throughputData.m_sentChunks = sentChunks;
+                throughputData.m_lostChunks = statistics.m_lostChunks.load(std::memory_order_relaxed);
+
+                // the rates are only known from the second update on since they need a previous snapshot
+                if (publisherInfo.m_statisticsTimestamp.time_since_epoch().count() != 0)
+                {
+                    const auto elapsedMinutes =
+                        std::chrono::duration<double, std::ratio<60>>(now - publisherInfo.m_statisticsTimestamp)
+                            .count();
+                    if (elapsedMinutes > 0.0)
+                    {
+                        throughputData.m_chunksPerMinute =
+                            static_cast<double>(sentChunks - publisherInfo.m_sentChunks) / elapsedMinutes;
+                        throughputData.m_userPayloadBytesPerMinute =
+                            static_cast<double>(sentUserPayloadBytes - publisherInfo.m_sentUserPayloadBytes)
+                            / elapsedMinutes;
+                    }
+                }
+                publisherInfo.m_statisticsTimestamp = now;
+                publisherInfo.m_sentChunks = sentChunks;
+                publisherInfo.m_sentUserPayloadBytes = sentUserPayloadBytes;
+
+                m_throughputList.emplace_back(throughputData);
+            }
+        }
+    }
 }
 
 template <typename PublisherPort, typename SubscriberPort>
@@ -26,9 +26,13 @@
 #include "iceoryx_posh/internal/capro/capro_message.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/popo/ports/application_port.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_roudi.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_user.hpp"
 #include "iceoryx_posh/internal/popo/ports/interface_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_roudi.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_roudi.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_user.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_multi_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_single_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
@@ -43,7 +47,10 @@
 #include "iceoryx_posh/roudi/port_pool.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
 
+#include <algorithm>
+#include <map>
 #include <mutex>
+#include <vector>
 
 namespace iox
 {
@@ -64,6 +71,15 @@ class PortManager
 
     void doDiscovery() noexcept;
 
+    /// @brief Blocks until a port announced a pending CaPro message or the timeout has passed
+    /// @param[in] timeout the maximum time to wait
+    /// @return true if a port announced a pending CaPro message before the timeout passed, otherwise false
+    bool waitForDiscoveryNotification(const units::Duration timeout) noexcept;
+
+    /// @brief Handles only the publisher, subscriber, client and server ports which announced a pending CaPro message
+    /// since the last call; everything else, e.g. interfaces and nodes, is still handled with doDiscovery
+    void doDiscoveryForNotifiedPorts() noexcept;
+
     cxx::expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     acquirePublisherPortData(const capro::ServiceDescription& service,
                              const popo::PublisherOptions& publisherOptions,
@@ -77,6 +93,22 @@ class PortManager
                               const RuntimeName_t& runtimeName,
                               const PortConfigInfo& portConfigInfo) noexcept;
 
+    cxx::expected<popo::ClientPortData*, PortPoolError>
+    acquireClientPortData(const capro::ServiceDescription& service,
+                          const popo::ClientOptions& clientOptions,
+                          const RuntimeName_t& runtimeName,
+                          mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
+                          const PortConfigInfo& portConfigInfo) noexcept;
+
+    /// @note there can only be one server per service, since a client connects to the server which offers its service
+    /// and follows the offer state of this service
+    cxx::expected<popo::ServerPortData*, PortPoolError>
+    acquireServerPortData(const capro::ServiceDescription& service,
+                          const popo::ServerOptions& serverOptions,
+                          const RuntimeName_t& runtimeName,
+                          mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
+                          const PortConfigInfo& portConfigInfo) noexcept;
+
     popo::InterfacePortData* acquireInterfacePortData(capro::Interfaces interface,
                                                       const RuntimeName_t& runtimeName,
                                                       const NodeName_t& nodeName = {""}) noexcept;
@@ -104,18 +136,40 @@ class PortManager
   protected:
     void makeAllPublisherPortsToStopOffer() noexcept;
 
+    void makeAllServerPortsToStopOffer() noexcept;
+
     void destroyPublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept;
 
     void destroySubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept;
 
+    void destroyClientPort(popo::ClientPortData* const clientPortData) noexcept;
+
+    void destroyServerPort(popo::ServerPortData* const serverPortData) noexcept;
+
     void handlePublisherPorts() noexcept;
 
+    void handlePublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept;
+
     void doDiscoveryForPublisherPort(PublisherPortRouDiType& publisherPort) noexcept;
 
     void handleSubscriberPorts() noexcept;
 
+    void handleSubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept;
+
     void doDiscoveryForSubscriberPort(SubscriberPortType& subscriberPort) noexcept;
 
+    void handleClientPorts() noexcept;
+
+    void handleClientPort(popo::ClientPortData* const clientPortData) noexcept;
+
+    void doDiscoveryForClientPort(popo::ClientPortRouDi& clientPort) noexcept;
+
+    void handleServerPorts() noexcept;
+
+    void handleServerPort(popo::ServerPortData* const serverPortData) noexcept;
+
+    void doDiscoveryForServerPort(popo::ServerPortRouDi& serverPort) noexcept;
+
     void handleInterfaces() noexcept;
 
     void handleApplications() noexcept;
@@ -130,6 +184,15 @@ class PortManager
     void sendToAllMatchingSubscriberPorts(const capro::CaproMessage& message,
                                           PublisherPortRouDiType& publisherSource) noexcept;
 
+    /// @brief forwards a CONNECT or DISCONNECT of a client to the servers of its service and the acknowledgement of
+    /// the server back to the client
+    /// @return true if a server acknowledged the message, otherwise false
+    bool sendToMatchingServerPorts(const capro::CaproMessage& message, popo::ClientPortRouDi& clientSource) noexcept;
+
+    /// @brief forwards an OFFER of a server to the clients of its service which wait for an offer and a STOP_OFFER to
+    /// the connected clients of its service
+    void sendToAllMatchingClientPorts(const capro::CaproMessage& message, popo::ServerPortRouDi& serverSource) noexcept;
+
     void sendToAllMatchingInterfacePorts(const capro::CaproMessage& message) noexcept;
 
     void addEntryToServiceRegistry(const capro::ServiceDescription& service) noexcept;
@@ -143,11 +206,28 @@ class PortManager
     cxx::optional<RuntimeName_t>
     doesViolateCommunicationPolicy(const capro::ServiceDescription& service IOX_MAYBE_UNUSED) const noexcept;
 
+    /// @brief index from a service description to the ports with this service, in the order of their creation
+    template <typename PortDataType>
+    using PortsOfService_t = std::map<capro::ServiceDescription, std::vector<PortDataType*>>;
+
+    template <typename PortDataType>
+    static void addToServiceIndex(PortsOfService_t<PortDataType>& index, PortDataType* const portData) noexcept;
+
+    template <typename PortDataType>
+    static void removeFromServiceIndex(PortsOfService_t<PortDataType>& index, PortDataType* const portData) noexcept;
+
   private:
     RouDiMemoryInterface* m_roudiMemoryInterface{nullptr};
     PortPool* m_portPool{nullptr};
     ServiceRegistry m_serviceRegistry;
     PortIntrospectionType m_portIntrospection;
+    // the indices are updated when ports are acquired or destroyed; the matching of publishers and subscribers as well
+    // as of clients and servers therefore only has to look at the ports with the same service instead of all ports in
+    // the port pool
+    PortsOfService_t<PublisherPortRouDiType::MemberType_t> m_publishersOfService;
+    PortsOfService_t<SubscriberPortType::MemberType_t> m_subscribersOfService;
+    PortsOfService_t<popo::ClientPortData> m_clientsOfService;
+    PortsOfService_t<popo::ServerPortData> m_serversOfService;
 };
 } // namespace roudi
 } // namespace iox
@@ -24,14 +24,11 @@ template <typename T, std::enable_if_t<std::is_same<T, iox::build::OneToManyPoli
 inline cxx::optional<RuntimeName_t>
 PortManager::doesViolateCommunicationPolicy(const capro::ServiceDescription& service) const noexcept
 {
-    // check if the publisher is already in the list
-    for (auto publisherPortData : m_portPool->getPublisherPortDataList())
+    // check if there is already a publisher with this service
+    auto publishers = m_publishersOfService.find(service);
+    if (publishers != m_publishersOfService.end() && !publishers->second.empty())
     {
-        popo::PublisherPortRouDi publisherPort(publisherPortData);
-        if (service == publisherPort.getCaProServiceDescription())
-        {
-            return cxx::make_optional<RuntimeName_t>(publisherPortData->m_runtimeName);
-        }
+        return cxx::make_optional<RuntimeName_t>(publishers->second.front()->m_runtimeName);
     }
     return cxx::nullopt;
 }
@@ -44,6 +41,31 @@ PortManager::doesViolateCommunicationPolicy(const capro::ServiceDescription& ser
     return cxx::nullopt;
 }
 
+template <typename PortDataType>
+inline void PortManager::addToServiceIndex(PortsOfService_t<PortDataType>& index,
+                                           PortDataType* const portData) noexcept
+{
+    index[portData->m_serviceDescription].push_back(portData);
+}
+
+template <typename PortDataType>
+inline void PortManager::removeFromServiceIndex(PortsOfService_t<PortDataType>& index,
+                                                PortDataType* const portData) noexcept
+{
+    auto portsOfService = index.find(portData->m_serviceDescription);
+    if (portsOfService == index.end())
+    {
+        return;
+    }
+
+    auto& ports = portsOfService->second;
+    ports.erase(std::remove(ports.begin(), ports.end(), portData), ports.end());
+    if (ports.empty())
+    {
+        index.erase(portsOfService);
+    }
+}
+
 } // namespace roudi
 } // namespace iox
 
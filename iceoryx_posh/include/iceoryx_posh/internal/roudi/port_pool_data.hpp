@@ -21,9 +21,12 @@
 #include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notification_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/application_port.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/interface_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
 
@@ -47,6 +50,13 @@ class FixedPositionContainer
 
     cxx::vector<T*, Capacity> content() noexcept;
 
+    /// @brief returns the position of the element in the container, which does not change until it is erased; if the
+    /// element is not contained an index which is larger than all positions in use is returned
+    uint64_t indexOf(const T* const element) const noexcept;
+
+    /// @brief returns the element at the given position or a nullptr if there is none
+    T* get(const uint64_t index) noexcept;
+
   private:
     cxx::vector<cxx::optional<T>, Capacity> m_data;
 };
@@ -60,10 +70,15 @@ struct PortPoolData
 
     FixedPositionContainer<iox::popo::PublisherPortData, MAX_PUBLISHERS> m_publisherPortMembers;
     FixedPositionContainer<iox::popo::SubscriberPortData, MAX_SUBSCRIBERS> m_subscriberPortMembers;
+    FixedPositionContainer<iox::popo::ClientPortData, MAX_CLIENTS> m_clientPortMembers;
+    FixedPositionContainer<iox::popo::ServerPortData, MAX_SERVERS> m_serverPortMembers;
 
     // required to be atomic since a service can be offered or stopOffered while reading
     // this variable in a user application
     std::atomic<uint64_t> m_serviceRegistryChangeCounter{0};
+
+    // the ports announce pending CaPro messages with it to RouDi
+    popo::DiscoveryNotificationData m_discoveryNotificationData;
 };
 
 } // namespace roudi
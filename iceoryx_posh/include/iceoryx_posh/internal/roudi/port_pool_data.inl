@@ -84,6 +84,31 @@ cxx::vector<T*, Capacity> FixedPositionContainer<T, Capacity>::content() noexcep
     return returnValue;
 }
 
+template <typename T, uint64_t Capacity>
+uint64_t FixedPositionContainer<T, Capacity>::indexOf(const T* const element) const noexcept
+{
+    uint64_t index{0U};
+    for (auto& e : m_data)
+    {
+        if (e.has_value() && &e.value() == element)
+        {
+            break;
+        }
+        ++index;
+    }
+    return index;
+}
+
+template <typename T, uint64_t Capacity>
+T* FixedPositionContainer<T, Capacity>::get(const uint64_t index) noexcept
+{
+    if (index >= m_data.size() || !m_data[index].has_value())
+    {
+        return nullptr;
+    }
+    return &m_data[index].value();
+}
+
 } // namespace roudi
 } // namespace iox
 
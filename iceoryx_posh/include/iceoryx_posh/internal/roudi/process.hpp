@@ -28,8 +28,10 @@
 #include "iceoryx_posh/version/compatibility_check_level.hpp"
 #include "iceoryx_posh/version/version_info.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <ctime>
+#include <mutex>
 
 namespace iox
 {
@@ -77,13 +79,19 @@ class Process
 
     bool isMonitored() const noexcept;
 
+    /// @brief The mutex is held while a request of the process is handled and while the process is removed, which
+    /// prevents the removal of a process whose request is currently handled by another thread
+    /// @return the mutex of this process
+    std::mutex& getMutex() noexcept;
+
   private:
     const uint32_t m_pid{0U};
     runtime::IpcInterfaceUser m_ipcChannel;
-    mepoo::TimePointNs_t m_timestamp;
+    std::atomic<mepoo::TimePointNs_t> m_timestamp;
     posix::PosixUser m_user;
     bool m_isMonitored{true};
     std::atomic<uint64_t> m_sessionId{0U};
+    std::mutex m_mutex;
 };
 
 } // namespace roudi
@@ -31,6 +31,7 @@
 
 #include <cstdint>
 #include <ctime>
+#include <mutex>
 
 namespace iox
 {
@@ -45,6 +46,12 @@ class ProcessManagerInterface
     virtual ~ProcessManagerInterface() noexcept = default;
 };
 
+/// @brief The ProcessManager handles the requests of the registered processes. It is thread-safe and the requests of
+/// different processes can be handled concurrently. The locks are always acquired in the order process list, process
+/// and PortManager. The process list is only locked to find, add or remove a process, the lock of the process is held
+/// while a request of the process is handled and the PortManager is only locked while ports are acquired or released.
+/// Therefore, the communication with a process is done without holding the lock of the process list or the
+/// PortManager.
 class ProcessManager : public ProcessManagerInterface
 {
   public:
@@ -128,12 +135,25 @@ class ProcessManager : public ProcessManagerInterface
                                 const popo::PublisherOptions& publisherOptions,
                                 const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
 
+    void addClientForProcess(const RuntimeName_t& name,
+                             const capro::ServiceDescription& service,
+                             const popo::ClientOptions& clientOptions,
+                             const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
+
+    void addServerForProcess(const RuntimeName_t& name,
+                             const capro::ServiceDescription& service,
+                             const popo::ServerOptions& serverOptions,
+                             const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
+
     void addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept;
 
     void initIntrospection(ProcessIntrospectionType* processIntrospection) noexcept;
 
     void run() noexcept;
 
+    /// @brief Handles only the publisher, subscriber, client and server ports which announced a pending CaPro message
+    void discoveryUpdateForNotifiedPorts() noexcept;
+
     popo::PublisherPortData* addIntrospectionPublisherPort(const capro::ServiceDescription& service,
                                                            const RuntimeName_t& process_name) noexcept;
 
@@ -150,6 +170,7 @@ class ProcessManager : public ProcessManagerInterface
     void monitorProcesses() noexcept;
     void discoveryUpdate() noexcept override;
 
+    /// @param [in] processListLock is the lock of the process list; it is released before the REG_ACK is sent
     /// @param [in] name of the process; this is equal to the IPC channel name, which is used for communication
     /// @param [in] pid is the host system process id
     /// @param [in] user is user used in the operating system for this process
@@ -158,7 +179,8 @@ class ProcessManager : public ProcessManagerInterface
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated IPC channel transmission
     /// @param [in] versionInfo Version of iceoryx used
     /// @return Returns if the process could be added successfully.
-    bool addProcess(const RuntimeName_t& name,
+    bool addProcess(std::unique_lock<std::mutex>& processListLock,
+                    const RuntimeName_t& name,
                     const uint32_t pid,
                     const posix::PosixUser& user,
                     const bool isMonitored,
@@ -173,7 +195,7 @@ class ProcessManager : public ProcessManagerInterface
     bool searchForProcessAndRemoveIt(const RuntimeName_t& name, const TerminationFeedback feedback) noexcept;
 
     /// @brief Removes the given process from the managed client process list and the respective resources in shared
-    /// memory
+    /// memory; the process list must be locked by the caller
     /// @param [in] processIter The process which should be removed.
     /// @param [in] sendAckToProcess Informs process that the termination messsage was received
     /// @return Returns true if the process was found and removed from the internal list.
@@ -214,7 +236,10 @@ class ProcessManager : public ProcessManagerInterface
     mepoo::SegmentManager<>* m_segmentManager{nullptr};
     mepoo::MemoryManager* m_introspectionMemoryManager{nullptr};
     rp::BaseRelativePointer::id_t m_mgmtSegmentId{rp::BaseRelativePointer::NULL_POINTER_ID};
+    std::mutex m_processListMutex;
     ProcessList_t m_processList;
+    /// @note guards the PortManager as well as the SegmentManager
+    std::mutex m_portManagerMutex;
     ProcessIntrospectionType* m_processIntrospection{nullptr};
     version::CompatibilityCheckLevel m_compatibilityCheckLevel;
 };
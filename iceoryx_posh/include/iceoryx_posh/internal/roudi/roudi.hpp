@@ -18,7 +18,7 @@
 #define IOX_POSH_ROUDI_ROUDI_MULTI_PROCESS_HPP
 
 #include "iceoryx_hoofs/cxx/generic_raii.hpp"
-#include "iceoryx_hoofs/internal/concurrent/smart_lock.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_hoofs/internal/relocatable_pointer/relative_pointer.hpp"
 #include "iceoryx_hoofs/platform/file.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
@@ -32,8 +32,11 @@
 #include "iceoryx_posh/roudi/memory/roudi_memory_manager.hpp"
 #include "iceoryx_posh/roudi/roudi_app.hpp"
 
+#include <condition_variable>
 #include <cstdint>
 #include <cstdio>
+#include <deque>
+#include <mutex>
 #include <thread>
 
 namespace iox
@@ -60,12 +63,15 @@ class RouDi
             const bool killProcessesInDestructor = true,
             const RuntimeMessagesThreadStart RuntimeMessagesThreadStart = RuntimeMessagesThreadStart::IMMEDIATE,
             const version::CompatibilityCheckLevel compatibilityCheckLevel = version::CompatibilityCheckLevel::PATCH,
-            const units::Duration processKillDelay = roudi::PROCESS_DEFAULT_KILL_DELAY) noexcept
+            const units::Duration processKillDelay = roudi::PROCESS_DEFAULT_KILL_DELAY,
+            const uint32_t numberOfRuntimeMessageWorkerThreads =
+                roudi::DEFAULT_NUMBER_OF_RUNTIME_MESSAGE_WORKER_THREADS) noexcept
             : m_monitoringMode(monitoringMode)
             , m_killProcessesInDestructor(killProcessesInDestructor)
             , m_runtimesMessagesThreadStart(RuntimeMessagesThreadStart)
             , m_compatibilityCheckLevel(compatibilityCheckLevel)
             , m_processKillDelay(processKillDelay)
+            , m_numberOfRuntimeMessageWorkerThreads(numberOfRuntimeMessageWorkerThreads)
         {
         }
 
@@ -74,6 +80,9 @@ class RouDi
         const RuntimeMessagesThreadStart m_runtimesMessagesThreadStart;
         const version::CompatibilityCheckLevel m_compatibilityCheckLevel;
         const units::Duration m_processKillDelay;
+        /// @brief with zero worker threads, all messages are processed by the thread which receives them; the number
+        /// is limited to MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKER_THREADS
+        const uint32_t m_numberOfRuntimeMessageWorkerThreads;
     };
 
     RouDi& operator=(const RouDi& other) = delete;
@@ -125,14 +134,42 @@ class RouDi
     static uint64_t getUniqueSessionIdForProcess() noexcept;
 
   private:
+    /// @brief a received message which waits in the queue of a worker thread
+    struct RuntimeMessage
+    {
+        runtime::IpcMessage message;
+        runtime::IpcMessageType cmd;
+        RuntimeName_t runtimeName;
+    };
+
+    struct RuntimeMessageWorker
+    {
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable wakeup;
+        std::deque<RuntimeMessage> queue;
+    };
+
     void processRuntimeMessages() noexcept;
 
+    /// @brief hands the message over to the worker thread of the runtime; since all messages of a runtime are
+    /// processed by the same worker thread, they are processed in the order in which they were received
+    void dispatchRuntimeMessage(const runtime::IpcMessage& message,
+                                const runtime::IpcMessageType cmd,
+                                const RuntimeName_t& runtimeName) noexcept;
+
+    void processRuntimeMessagesOfWorker(RuntimeMessageWorker& worker) noexcept;
+
+    void stopRuntimeMessageWorkerThreads() noexcept;
+
     void monitorAndDiscoveryUpdate() noexcept;
 
     cxx::GenericRAII m_unregisterRelativePtr{[] {}, [] { rp::BaseRelativePointer::unregisterAll(); }};
     bool m_killProcessesInDestructor;
     std::atomic_bool m_runMonitoringAndDiscoveryThread;
     std::atomic_bool m_runHandleRuntimeMessageThread;
+    std::atomic_bool m_runRuntimeMessageWorkerThreads;
+    uint32_t m_numberOfRuntimeMessageWorkerThreads{0U};
 
     const units::Duration m_runtimeMessagesThreadTimeout{100_ms};
 
@@ -149,11 +186,13 @@ class RouDi
                                                      };
                                                  }};
     PortManager* m_portManager{nullptr};
-    concurrent::smart_lock<ProcessManager> m_prcMgr;
+    /// @note the ProcessManager is thread-safe, the runtime messages are processed concurrently by the worker threads
+    ProcessManager m_prcMgr;
 
   private:
     std::thread m_monitoringAndDiscoveryThread;
     std::thread m_handleRuntimeMessageThread;
+    cxx::vector<RuntimeMessageWorker, MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKER_THREADS> m_runtimeMessageWorkers;
 
   protected:
     ProcessIntrospectionType m_processIntrospection;
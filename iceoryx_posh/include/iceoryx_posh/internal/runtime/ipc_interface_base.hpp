@@ -56,6 +56,10 @@ enum class IpcMessageType : int32_t
     CREATE_PUBLISHER_ACK,
     CREATE_SUBSCRIBER,
     CREATE_SUBSCRIBER_ACK,
+    CREATE_CLIENT,
+    CREATE_CLIENT_ACK,
+    CREATE_SERVER,
+    CREATE_SERVER_ACK,
     CREATE_INTERFACE,
     CREATE_INTERFACE_ACK,
     CREATE_APPLICATION,
@@ -86,15 +90,21 @@ enum class IpcMessageErrorType : int32_t
     BEGIN,
     INVALID_STATE,
     NOTYPE,
-    /// A publisher could not be created unique
+    /// A publisher or server could not be created unique
     NO_UNIQUE_CREATED,
     REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE,
     REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT,
     REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE,
+    REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE,
+    REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT,
+    REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE,
+    REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT,
     REQUEST_CONDITION_VARIABLE_WRONG_IPC_MESSAGE_RESPONSE,
     REQUEST_EVENT_VARIABLE_WRONG_IPC_MESSAGE_RESPONSE,
     PUBLISHER_LIST_FULL,
     SUBSCRIBER_LIST_FULL,
+    CLIENT_LIST_FULL,
+    SERVER_LIST_FULL,
     CONDITION_VARIABLE_LIST_FULL,
     EVENT_VARIABLE_LIST_FULL,
     NODE_DATA_LIST_FULL,
@@ -17,6 +17,8 @@
 #ifndef IOX_POSH_RUNTIME_IPC_MESSAGE_HPP
 #define IOX_POSH_RUNTIME_IPC_MESSAGE_HPP
 
+#include "iceoryx_hoofs/cxx/string.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
 
 #include <cstdint>
@@ -39,6 +41,10 @@ namespace runtime
 ///    separator. A message is defined as valid if all entries contained in
 ///    that message are valid and it ends with the separator or it is empty,
 ///    otherwise it is defined as invalid.
+///
+///    The positions of the separators are stored when the message is set or
+///    an entry is added. Therefore an entry can be accessed without
+///    searching and copying the message.
 class IpcMessage
 {
   public:
@@ -77,6 +83,16 @@ class IpcMessage
     //          If the message is invalid the return value is undefined.
     std::string getElementAtIndex(const uint32_t index) const noexcept;
 
+    /// @brief Copies the entry at position index directly into a cxx::string
+    ///         without creating an intermediate std::string. If the entry
+    ///         is longer than the capacity it is truncated.
+    /// @param[in] index desired entry position
+    /// @param[out] element the cxx::string which is assigned with the entry
+    /// @return true if the entry exists, otherwise false and element is not
+    ///         modified
+    template <uint64_t Capacity>
+    bool getElementAtIndex(const uint32_t index, cxx::string<Capacity>& element) const noexcept;
+
     /// @brief returns if an entry is valid.
     ///      Non valid entries are containing at least one separator
     /// @param[in] entry sstring to check
@@ -114,15 +130,42 @@ class IpcMessage
     template <typename T>
     void addEntry(const T& entry) noexcept;
 
+    /// @brief Adds a new entry to the IpcMessage without converting it with
+    ///         a std::stringstream
+    /// @param[in] entry to add to the message
+    void addEntry(const std::string& entry) noexcept;
+
+    /// @brief Adds a new entry to the IpcMessage without converting it with
+    ///         a std::stringstream
+    /// @param[in] entry to add to the message
+    template <uint64_t Capacity>
+    void addEntry(const cxx::string<Capacity>& entry) noexcept;
+
     /// @brief Compares two IpcMessages to be equal
     /// @param rhs IpcMessage to compare with
     bool operator==(const IpcMessage& rhs) const noexcept;
 
+  private:
+    /// @brief the messages between the runtime and RouDi have less entries; the separator positions of further
+    /// entries are not stored and searched in the message on access
+    static constexpr uint64_t MAX_NUMBER_OF_INDEXED_ELEMENTS{16U};
+
+    /// @brief determines the position of the entry at position index in the message
+    /// @param[in] index desired entry position
+    /// @param[out] startPosition the position of the first character of the entry
+    /// @param[out] endPosition the position of the separator which terminates the entry
+    /// @return true if the entry exists, otherwise false and the positions are not modified
+    bool getPositionOfElement(const uint32_t index, uint64_t& startPosition, uint64_t& endPosition) const noexcept;
+
+    /// @brief stores the position of a separator as long as there is space left in m_separatorPositions
+    void indexSeparator(const uint64_t position) noexcept;
+
   private:
     static const char m_separator; // default value is ,
     std::string m_msg;
     bool m_isValid{true};
     uint32_t m_numberOfElements{0};
+    cxx::vector<uint64_t, MAX_NUMBER_OF_INDEXED_ELEMENTS> m_separatorPositions;
 };
 
 } // namespace runtime
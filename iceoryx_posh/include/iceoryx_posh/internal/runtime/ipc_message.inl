@@ -28,17 +28,27 @@ void IpcMessage::addEntry(const T& entry) noexcept
 {
     std::stringstream newEntry;
     newEntry << entry;
+    addEntry(newEntry.str());
+}
 
-    if (!isValidEntry(newEntry.str()))
-    {
-        LogError() << "\'" << newEntry.str().c_str() << "\' is an invalid IPC channel entry";
-        m_isValid = false;
-    }
-    else
+template <uint64_t Capacity>
+void IpcMessage::addEntry(const cxx::string<Capacity>& entry) noexcept
+{
+    addEntry(std::string(entry.c_str(), entry.size()));
+}
+
+template <uint64_t Capacity>
+bool IpcMessage::getElementAtIndex(const uint32_t index, cxx::string<Capacity>& element) const noexcept
+{
+    uint64_t startPosition{0U};
+    uint64_t endPosition{0U};
+    if (!getPositionOfElement(index, startPosition, endPosition))
     {
-        m_msg.append(newEntry.str() + m_separator);
-        ++m_numberOfElements;
+        return false;
     }
+
+    element = cxx::string<Capacity>(cxx::TruncateToCapacity, m_msg.data() + startPosition, endPosition - startPosition);
+    return true;
 }
 
 template <typename T>
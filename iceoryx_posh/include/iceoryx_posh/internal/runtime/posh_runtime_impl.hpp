@@ -66,6 +66,18 @@ class PoshRuntimeImpl : public PoshRuntime
                             const popo::SubscriberOptions& subscriberOptions = popo::SubscriberOptions(),
                             const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept override;
 
+    /// @copydoc PoshRuntime::getMiddlewareClient
+    popo::ClientPortData*
+    getMiddlewareClient(const capro::ServiceDescription& service,
+                        const popo::ClientOptions& clientOptions = popo::ClientOptions(),
+                        const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept override;
+
+    /// @copydoc PoshRuntime::getMiddlewareServer
+    popo::ServerPortData*
+    getMiddlewareServer(const capro::ServiceDescription& service,
+                        const popo::ServerOptions& serverOptions = popo::ServerOptions(),
+                        const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept override;
+
     /// @copydoc PoshRuntime::getMiddlewareInterface
     popo::InterfacePortData* getMiddlewareInterface(const capro::Interfaces interface,
                                                     const NodeName_t& nodeName = {""}) noexcept override;
@@ -100,6 +112,12 @@ class PoshRuntimeImpl : public PoshRuntime
     cxx::expected<SubscriberPortUserType::MemberType_t*, IpcMessageErrorType>
     requestSubscriberFromRoudi(const IpcMessage& sendBuffer) noexcept;
 
+    cxx::expected<popo::ClientPortData*, IpcMessageErrorType>
+    requestClientFromRoudi(const IpcMessage& sendBuffer) noexcept;
+
+    cxx::expected<popo::ServerPortData*, IpcMessageErrorType>
+    requestServerFromRoudi(const IpcMessage& sendBuffer) noexcept;
+
     cxx::expected<popo::ConditionVariableData*, IpcMessageErrorType>
     requestConditionVariableFromRoudi(const IpcMessage& sendBuffer) noexcept;
 
@@ -37,6 +37,11 @@ struct MemoryInfo
     uint32_t deviceId{DEFAULT_DEVICE_ID};
     uint32_t memoryType{DEFAULT_MEMORY_TYPE};
 
+    /// @brief the memory of a segment is backed with huge pages to reduce the TLB misses on large payloads
+    bool useHugePages{false};
+    /// @brief the memory of a segment is locked into the RAM so that it cannot be swapped out
+    bool lockMemory{false};
+
     MemoryInfo(const MemoryInfo&) noexcept = default;
     MemoryInfo(MemoryInfo&&) noexcept = default;
     MemoryInfo& operator=(const MemoryInfo&) noexcept = default;
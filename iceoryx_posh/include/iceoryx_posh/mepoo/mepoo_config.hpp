@@ -29,6 +29,15 @@ class PortManager;
 }
 namespace mepoo
 {
+/// @brief defines how a chunk is acquired when the best fitting mempool has no free chunks left
+enum class MemPoolOverflowPolicy : uint8_t
+{
+    /// @brief the chunk allocation fails
+    REJECT_ALLOCATION,
+    /// @brief the chunk is acquired from the next larger mempool which has free chunks left
+    USE_LARGER_MEMPOOL
+};
+
 struct MePooConfig
 {
   public:
@@ -46,6 +55,8 @@ struct MePooConfig
 
     using MePooConfigContainerType = cxx::vector<Entry, MAX_NUMBER_OF_MEMPOOLS>;
     MePooConfigContainerType m_mempoolConfig;
+    MemPoolOverflowPolicy m_overflowPolicy{MemPoolOverflowPolicy::REJECT_ALLOCATION};
+    bool m_chunkCacheEnabled{false};
 
     /// @brief Default constructor to set the configuration for memory pools
     MePooConfig() noexcept = default;
@@ -58,6 +69,14 @@ struct MePooConfig
     /// @param[in] Entry structure of mempool configuration
     void addMemPool(Entry f_entry) noexcept;
 
+    /// @brief Function for setting the policy which is applied when the best fitting mempool is exhausted
+    /// @param[in] policy the MemPoolOverflowPolicy to use
+    MePooConfig& setOverflowPolicy(const MemPoolOverflowPolicy policy) noexcept;
+
+    /// @brief Function for enabling the chunk cache of the publishers, which acquires chunks in batches
+    /// @param[in] enabled true to enable the chunk cache, false to acquire every chunk separately from the mempools
+    MePooConfig& setChunkCacheEnabled(const bool enabled) noexcept;
+
     /// @brief Function for creating default memory pools
     MePooConfig& setDefaults() noexcept;
 
@@ -0,0 +1,155 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BASE_CLIENT_HPP
+#define IOX_POSH_POPO_BASE_CLIENT_HPP
+
+#include "iceoryx_posh/internal/popo/ports/client_port_user.hpp"
+#include "iceoryx_posh/popo/client_options.hpp"
+#include "iceoryx_posh/popo/enum_trigger_type.hpp"
+#include "iceoryx_posh/popo/trigger_handle.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+
+namespace iox
+{
+namespace popo
+{
+using uid_t = UniquePortId;
+
+enum class ClientEvent : EventEnumIdentifier
+{
+    RESPONSE_RECEIVED
+};
+
+enum class ClientState : StateEnumIdentifier
+{
+    HAS_RESPONSE
+};
+
+///
+/// @brief The BaseClient class contains the common implementation for the different client specializations.
+/// @param[in] port_t type of the underlying port, required for testing
+///
+template <typename port_t = ClientPortUser>
+class BaseClient
+{
+  public:
+    using PortType = port_t;
+
+    BaseClient(const BaseClient& other) = delete;
+    BaseClient& operator=(const BaseClient&) = delete;
+    BaseClient(BaseClient&& rhs) = delete;
+    BaseClient& operator=(BaseClient&& rhs) = delete;
+    virtual ~BaseClient() noexcept;
+
+    ///
+    /// @brief uid Get the UID of the client.
+    /// @return The client's UID.
+    ///
+    uid_t getUid() const noexcept;
+
+    ///
+    /// @brief getServiceDescription Get the service description of the client.
+    /// @return The service description.
+    ///
+    capro::ServiceDescription getServiceDescription() const noexcept;
+
+    ///
+    /// @brief Initiates the connection to the server when it was not already connected via the client options.
+    ///
+    void connect() noexcept;
+
+    ///
+    /// @brief Get the current connection state of the client.
+    /// @return The current connection state.
+    ///
+    ConnectionState getConnectionState() const noexcept;
+
+    ///
+    /// @brief Disconnects from the server.
+    ///
+    void disconnect() noexcept;
+
+    ///
+    /// @brief Check if responses are available.
+    /// @return True if responses are available.
+    ///
+    bool hasResponses() const noexcept;
+
+    ///
+    /// @brief Check if responses have been missed since the last call of this method.
+    /// @return True if responses have been missed.
+    /// @details Responses may be missed due to overflowing receive queue.
+    ///
+    bool hasMissedResponses() noexcept;
+
+    friend class NotificationAttorney;
+
+  protected:
+    using SelfType = BaseClient<port_t>;
+
+    BaseClient(const capro::ServiceDescription& service, const ClientOptions& clientOptions) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Invalidates the internal triggerHandle.
+    /// @param[in] uniqueTriggerId the id of the corresponding trigger
+    void invalidateTrigger(const uint64_t uniqueTriggerId) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Attaches the triggerHandle to the internal trigger.
+    /// @param[in] triggerHandle rvalue reference to the triggerHandle. This class takes the ownership of that handle.
+    /// @param[in] clientState the state which should be attached
+    void enableState(iox::popo::TriggerHandle&& triggerHandle, const ClientState clientState) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Returns method pointer to the event corresponding
+    /// hasTriggered method callback
+    /// @param[in] clientState the state to which the hasTriggeredCallback is required
+    WaitSetIsConditionSatisfiedCallback
+    getCallbackForIsStateConditionSatisfied(const ClientState clientState) const noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Resets the internal triggerHandle
+    /// @param[in] clientState the state which should be detached
+    void disableState(const ClientState clientState) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Attaches the triggerHandle to the internal trigger.
+    /// @param[in] triggerHandle rvalue reference to the triggerHandle. This class takes the ownership of that handle.
+    /// @param[in] clientEvent the event which should be attached
+    void enableEvent(iox::popo::TriggerHandle&& triggerHandle, const ClientEvent clientEvent) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Resets the internal triggerHandle
+    /// @param[in] clientEvent the event which should be detached
+    void disableEvent(const ClientEvent clientEvent) noexcept;
+
+    ///
+    /// @brief const accessor of the underlying port
+    ///
+    const port_t& port() const noexcept;
+
+    ///
+    /// @brief accessor of the underlying port
+    ///
+    port_t& port() noexcept;
+
+  protected:
+    port_t m_port;
+    TriggerHandle m_trigger;
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/base_client.inl"
+
+#endif // IOX_POSH_POPO_BASE_CLIENT_HPP
@@ -0,0 +1,161 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BASE_SERVER_HPP
+#define IOX_POSH_POPO_BASE_SERVER_HPP
+
+#include "iceoryx_posh/internal/popo/ports/server_port_user.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
+#include "iceoryx_posh/popo/enum_trigger_type.hpp"
+#include "iceoryx_posh/popo/trigger_handle.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+
+namespace iox
+{
+namespace popo
+{
+using uid_t = UniquePortId;
+
+enum class ServerEvent : EventEnumIdentifier
+{
+    REQUEST_RECEIVED
+};
+
+enum class ServerState : StateEnumIdentifier
+{
+    HAS_REQUEST
+};
+
+///
+/// @brief The BaseServer class contains the common implementation for the different server specializations.
+/// @param[in] port_t type of the underlying port, required for testing
+///
+template <typename port_t = ServerPortUser>
+class BaseServer
+{
+  public:
+    using PortType = port_t;
+
+    BaseServer(const BaseServer& other) = delete;
+    BaseServer& operator=(const BaseServer&) = delete;
+    BaseServer(BaseServer&& rhs) = delete;
+    BaseServer& operator=(BaseServer&& rhs) = delete;
+    virtual ~BaseServer() noexcept;
+
+    ///
+    /// @brief uid Get the UID of the server.
+    /// @return The server's UID.
+    ///
+    uid_t getUid() const noexcept;
+
+    ///
+    /// @brief getServiceDescription Get the service description of the server.
+    /// @return The service description.
+    ///
+    capro::ServiceDescription getServiceDescription() const noexcept;
+
+    ///
+    /// @brief Offers the service of the server to the clients.
+    ///
+    void offer() noexcept;
+
+    ///
+    /// @brief Stops offering the service; connected clients are disconnected.
+    ///
+    void stopOffer() noexcept;
+
+    ///
+    /// @brief Check if the server is currently offering its service.
+    /// @return True if the server is offering.
+    ///
+    bool isOffered() const noexcept;
+
+    ///
+    /// @brief Check if clients are connected to the server.
+    /// @return True if at least one client is connected.
+    ///
+    bool hasClients() const noexcept;
+
+    ///
+    /// @brief Check if requests are available.
+    /// @return True if requests are available.
+    ///
+    bool hasRequests() const noexcept;
+
+    ///
+    /// @brief Check if requests have been missed since the last call of this method.
+    /// @return True if requests have been missed.
+    /// @details Requests may be missed due to overflowing receive queue.
+    ///
+    bool hasMissedRequests() noexcept;
+
+    friend class NotificationAttorney;
+
+  protected:
+    using SelfType = BaseServer<port_t>;
+
+    BaseServer(const capro::ServiceDescription& service, const ServerOptions& serverOptions) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Invalidates the internal triggerHandle.
+    /// @param[in] uniqueTriggerId the id of the corresponding trigger
+    void invalidateTrigger(const uint64_t uniqueTriggerId) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Attaches the triggerHandle to the internal trigger.
+    /// @param[in] triggerHandle rvalue reference to the triggerHandle. This class takes the ownership of that handle.
+    /// @param[in] serverState the state which should be attached
+    void enableState(iox::popo::TriggerHandle&& triggerHandle, const ServerState serverState) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Returns method pointer to the event corresponding
+    /// hasTriggered method callback
+    /// @param[in] serverState the state to which the hasTriggeredCallback is required
+    WaitSetIsConditionSatisfiedCallback
+    getCallbackForIsStateConditionSatisfied(const ServerState serverState) const noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Resets the internal triggerHandle
+    /// @param[in] serverState the state which should be detached
+    void disableState(const ServerState serverState) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Attaches the triggerHandle to the internal trigger.
+    /// @param[in] triggerHandle rvalue reference to the triggerHandle. This class takes the ownership of that handle.
+    /// @param[in] serverEvent the event which should be attached
+    void enableEvent(iox::popo::TriggerHandle&& triggerHandle, const ServerEvent serverEvent) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Resets the internal triggerHandle
+    /// @param[in] serverEvent the event which should be detached
+    void disableEvent(const ServerEvent serverEvent) noexcept;
+
+    ///
+    /// @brief const accessor of the underlying port
+    ///
+    const port_t& port() const noexcept;
+
+    ///
+    /// @brief accessor of the underlying port
+    ///
+    port_t& port() noexcept;
+
+  protected:
+    port_t m_port;
+    TriggerHandle m_trigger;
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/base_server.inl"
+
+#endif // IOX_POSH_POPO_BASE_SERVER_HPP
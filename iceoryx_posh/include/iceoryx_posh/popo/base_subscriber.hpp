@@ -19,6 +19,7 @@
 #define IOX_POSH_POPO_BASE_SUBSCRIBER_HPP
 
 #include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/function_ref.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/cxx/unique_ptr.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
@@ -118,6 +119,11 @@ class BaseSubscriber
     /// port
     cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> takeChunk() noexcept;
 
+    /// @brief takes up to the given number of chunks in one pass with the `tryGetChunks` method of the port
+    cxx::expected<uint64_t, ChunkReceiveResult>
+    takeChunks(const uint64_t maxNumberOfChunks,
+               const cxx::function_ref<void(const mepoo::ChunkHeader*)> callable) noexcept;
+
     void invalidateTrigger(const uint64_t trigger) noexcept;
 
     /// @brief Only usable by the WaitSet, not for public use. Attaches the triggerHandle to the internal trigger.
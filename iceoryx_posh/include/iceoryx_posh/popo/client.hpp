@@ -0,0 +1,90 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_CLIENT_HPP
+#define IOX_POSH_POPO_CLIENT_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_posh/internal/popo/rpc_deleter.hpp"
+#include "iceoryx_posh/popo/base_client.hpp"
+#include "iceoryx_posh/popo/request.hpp"
+#include "iceoryx_posh/popo/response.hpp"
+#include "iceoryx_posh/popo/rpc_interface.hpp"
+
+namespace iox
+{
+namespace popo
+{
+///
+/// @brief The Client sends requests of type Req to the server of its service and receives the responses of type Res.
+/// The requests and responses are loaned from the shared memory and are never copied on the way.
+///
+template <typename Req, typename Res, typename BaseClient_t = BaseClient<>>
+class ClientImpl : public BaseClient_t, public RpcInterface<Request<Req>>
+{
+    static_assert(!std::is_void<Req>::value, "The type `Req` must not be void. Use the UntypedClient for void types.");
+    static_assert(!std::is_void<Res>::value, "The type `Res` must not be void. Use the UntypedClient for void types.");
+
+  public:
+    ClientImpl(const capro::ServiceDescription& service, const ClientOptions& clientOptions = ClientOptions()) noexcept;
+    ClientImpl(const ClientImpl&) = delete;
+    ClientImpl(ClientImpl&&) = delete;
+    ClientImpl& operator=(const ClientImpl&) = delete;
+    ClientImpl& operator=(ClientImpl&&) = delete;
+    virtual ~ClientImpl() noexcept = default;
+
+    ///
+    /// @brief Get a Request from loaned shared memory and construct the data with the given arguments.
+    /// @param args Arguments used to construct the data.
+    /// @return A Request or an AllocationError if no chunk could be loaned.
+    /// @details The loaned Request is automatically released when it goes out of scope.
+    ///
+    template <typename... Args>
+    cxx::expected<Request<Req>, AllocationError> loan(Args&&... args) noexcept;
+
+    ///
+    /// @brief Sends the given Request to the server and releases its ownership of the chunk.
+    /// @param request The Request which shall be sent.
+    ///
+    void send(Request<Req>&& request) noexcept override;
+
+    ///
+    /// @brief Take the Response from the top of the receive queue.
+    /// @return Either a Response or a ChunkReceiveResult.
+    /// @details The Response takes care of the cleanup. Don't store the raw pointer to the content of the Response,
+    /// but always the whole Response.
+    ///
+    cxx::expected<Response<const Res>, ChunkReceiveResult> take() noexcept;
+
+    using PortType = typename BaseClient_t::PortType;
+
+  protected:
+    using BaseClient_t::port;
+
+  private:
+    RequestDeleter<PortType> m_requestDeleter{port()};
+    ResponseDeleter<PortType> m_responseDeleter{port()};
+};
+
+template <typename Req, typename Res>
+using Client = ClientImpl<Req, Res>;
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/client.inl"
+
+#endif // IOX_POSH_POPO_CLIENT_HPP
@@ -17,13 +17,17 @@
 #ifndef IOX_POSH_POPO_LISTENER_HPP
 #define IOX_POSH_POPO_LISTENER_HPP
 
+#include "iceoryx_hoofs/concurrent/lockfree_queue.hpp"
 #include "iceoryx_hoofs/cxx/expected.hpp"
 #include "iceoryx_hoofs/cxx/method_callback.hpp"
 #include "iceoryx_hoofs/cxx/type_traits.hpp"
+#include "iceoryx_hoofs/cxx/vector.hpp"
 #include "iceoryx_hoofs/internal/concurrent/loffli.hpp"
 #include "iceoryx_hoofs/internal/concurrent/smart_lock.hpp"
+#include "iceoryx_hoofs/posix_wrapper/semaphore.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/popo/enum_trigger_type.hpp"
+#include "iceoryx_posh/popo/listener_options.hpp"
 #include "iceoryx_posh/popo/notification_attorney.hpp"
 #include "iceoryx_posh/popo/notification_callback.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
@@ -45,7 +49,8 @@ enum class ListenerError
 
 /// @brief The Listener is a class which reacts to registered events by
 ///        executing a corresponding callback concurrently. This is achieved via
-///        an encapsulated thread inside this class.
+///        an encapsulated thread inside this class. Optionally, the callbacks are
+///        executed by a pool of worker threads, see ListenerOptions.
 /// @note  The Listener is threadsafe and can be used without any restrictions concurrently.
 /// @attention Calling detachEvent for the same event from multiple threads is supported but
 ///            can cause a race condition if you attach the same event again concurrently from
@@ -68,6 +73,11 @@ class Listener
 {
   public:
     Listener() noexcept;
+
+    /// @brief Creates a listener with the given options, e.g. the number of worker threads
+    /// @param[in] options the options of the listener
+    explicit Listener(const ListenerOptions& options) noexcept;
+
     Listener(const Listener&) = delete;
     Listener(Listener&&) = delete;
     ~Listener() noexcept;
@@ -132,13 +142,22 @@ class Listener
     /// @return size of the Listener
     uint64_t size() const noexcept;
 
+    /// @brief Returns how often the listener thread received an event during the busy poll and how often it had to
+    ///        sleep, see ListenerOptions::busyPollDuration
+    /// @return the wait statistics of the Listener
+    WaitStatistics getWaitStatistics() const noexcept;
+
   protected:
-    Listener(ConditionVariableData& conditionVariableData) noexcept;
+    Listener(ConditionVariableData& conditionVariableData, const ListenerOptions& options = ListenerOptions()) noexcept;
 
   private:
     class Event_t;
 
     void threadLoop() noexcept;
+    void workerThreadLoop() noexcept;
+    void dispatchToWorkerThreads(const uint32_t index) noexcept;
+    void enqueueForWorkerThreads(const uint32_t index) noexcept;
+    void executeDispatchedCallback(const uint32_t index) noexcept;
     cxx::expected<uint32_t, ListenerError>
     addEvent(void* const origin,
              void* const userType,
@@ -205,7 +224,28 @@ class Listener
     } m_indexManager;
 
 
+    /// @brief the dispatch state of an event ensures that its callback is never executed by two worker threads at
+    /// the same time and that a notification which arrives while the callback is running is not lost
+    enum class DispatchState : uint8_t
+    {
+        IDLE,
+        QUEUED,
+        RUNNING,
+        RUNNING_AND_NOTIFIED_AGAIN
+    };
+
     std::thread m_thread;
+    cxx::vector<std::thread, MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER> m_workerThreads;
+    concurrent::LockFreeQueue<uint32_t, MAX_NUMBER_OF_EVENTS_PER_LISTENER> m_dispatchQueue;
+    std::atomic<DispatchState> m_dispatchStates[MAX_NUMBER_OF_EVENTS_PER_LISTENER];
+    posix::Semaphore m_workerSemaphore =
+        std::move(posix::Semaphore::create(posix::CreateUnnamedSingleProcessSemaphore, 0U)
+                      .or_else([](posix::SemaphoreError&) {
+                          errorHandler(Error::kPOPO__LISTENER_FAILED_TO_CREATE_WORKER_SEMAPHORE,
+                                       nullptr,
+                                       ErrorLevel::FATAL);
+                      })
+                      .value());
     concurrent::smart_lock<Event_t, std::recursive_mutex> m_events[MAX_NUMBER_OF_EVENTS_PER_LISTENER];
     std::mutex m_addEventMutex;
 
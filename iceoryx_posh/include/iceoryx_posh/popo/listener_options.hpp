@@ -0,0 +1,47 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_LISTENER_OPTIONS_HPP
+#define IOX_POSH_POPO_LISTENER_OPTIONS_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief This struct is used to configure the listener
+struct ListenerOptions
+{
+    /// @brief The number of worker threads which execute the callbacks. With 0 the callbacks are executed one after
+    /// another by the thread which waits for the events. Otherwise the callbacks of different events are executed
+    /// concurrently, but the callback of a single event never runs concurrently to itself. At most
+    /// MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER are used.
+    uint64_t numberOfWorkerThreads{0U};
+
+    /// @brief The CPUs the threads of the listener are restricted to, bit n of the mask stands for CPU n; with 0 the
+    /// affinity of the threads is not changed
+    uint64_t cpuAffinityMask{0U};
+
+    /// @brief The time the listener polls for notifications before it sleeps, this avoids the wakeup latency of
+    /// events which arrive shortly after each other but keeps a CPU busy; with 0 the listener sleeps immediately
+    units::Duration busyPollDuration{units::Duration::fromNanoseconds(0U)};
+};
+
+} // namespace popo
+} // namespace iox
+#endif // IOX_POSH_POPO_LISTENER_OPTIONS_HPP
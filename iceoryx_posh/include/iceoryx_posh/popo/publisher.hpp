@@ -81,6 +81,28 @@ class PublisherImpl : public BasePublisher_t, public PublisherInterface<T, H>
     ///
     void publish(Sample<T, H>&& sample) noexcept override;
 
+    ///
+    /// @brief loanBatch Get up to numberOfSamples default constructed samples from loaned shared memory at once, which
+    /// is cheaper than calling loan in a loop.
+    /// @param numberOfSamples The number of samples to loan.
+    /// @param callable Is called with every loaned sample, signature void(Sample<T, H>&&).
+    /// @return The number of loaned samples, which is less than numberOfSamples if the shared memory is running out of
+    /// chunks, or an error if not a single sample could be loaned.
+    /// @details Like with loan, the samples are automatically released when they go out of scope. Unlike loan, the
+    /// chunk of the last published sample is never reused, therefore loan is cheaper for a single sample.
+    ///
+    template <typename Callable>
+    cxx::expected<uint32_t, AllocationError> loanBatch(const uint32_t numberOfSamples,
+                                                       const Callable& callable) noexcept;
+
+    ///
+    /// @brief publishBatch Publishes the given samples in the given order and then releases their loans. Every
+    /// subscriber is notified once per batch instead of once per sample.
+    /// @param samples Array of samples to publish, the samples are empty afterwards.
+    /// @param numberOfSamples The number of samples in the array.
+    ///
+    void publishBatch(Sample<T, H>* const samples, const uint32_t numberOfSamples) noexcept;
+
     ///
     /// @brief publishCopyOf Copy the provided value into a loaned shared memory chunk and publish it.
     /// @param val Value to copy.
@@ -17,6 +17,7 @@
 #ifndef IOX_POSH_POPO_PUBLISHER_OPTIONS_HPP
 #define IOX_POSH_POPO_PUBLISHER_OPTIONS_HPP
 
+#include "iceoryx_hoofs/internal/units/duration.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "port_queue_policies.hpp"
 #include <cstdint>
@@ -39,6 +40,10 @@ struct PublisherOptions
 
     /// @brief The option whether the publisher should block when the subscriber queue is full
     SubscriberTooSlowPolicy subscriberTooSlowPolicy{SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA};
+
+    /// @brief The maximum time the publisher blocks on subscribers with a full queue when the subscriberTooSlowPolicy
+    /// is WAIT_FOR_SUBSCRIBER; when it has passed, the sample is dropped for these subscribers
+    units::Duration maxBlockingTime{units::Duration::max()};
 };
 
 } // namespace popo
@@ -0,0 +1,74 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_RESPONSE_HPP
+#define IOX_POSH_POPO_RESPONSE_HPP
+
+#include "iceoryx_posh/popo/rpc_header.hpp"
+#include "iceoryx_posh/popo/rpc_interface.hpp"
+#include "iceoryx_posh/popo/smart_chunk.hpp"
+
+namespace iox
+{
+namespace popo
+{
+///
+/// @brief The Response class is a mutable abstraction over types which are written to loaned shared memory.
+/// These responses are sent by the Server and received by the Client.
+///
+template <typename T>
+class Response : public SmartChunk<RpcInterface<Response<T>>, T, cxx::add_const_conditionally_t<ResponseHeader, T>>
+{
+    using BaseType = SmartChunk<RpcInterface<Response<T>>, T, cxx::add_const_conditionally_t<ResponseHeader, T>>;
+
+    template <typename S, typename TT>
+    using ForProducerOnly = typename BaseType::template ForProducerOnly<S, TT>;
+
+  public:
+    using BaseType::BaseType;
+
+    using ConditionalResponseHeader_t = cxx::add_const_conditionally_t<ResponseHeader, T>;
+
+    ///
+    /// @brief Retrieve the ResponseHeader of the underlying memory chunk loaned to the Response.
+    /// @return The ResponseHeader of the underlying memory chunk.
+    ///
+    ConditionalResponseHeader_t& getResponseHeader() noexcept;
+
+    ///
+    /// @brief Retrieve the ResponseHeader of the underlying memory chunk loaned to the Response.
+    /// @return The const ResponseHeader of the underlying memory chunk.
+    ///
+    const ResponseHeader& getResponseHeader() const noexcept;
+
+    ///
+    /// @brief Send the response via the server from which it was loaned and automatically release ownership to it.
+    /// @details Only available for non-const type T.
+    ///
+    template <typename S = T, typename = ForProducerOnly<S, T>>
+    void send() noexcept;
+
+  private:
+    template <typename, typename, typename>
+    friend class ServerImpl;
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/response.inl"
+
+#endif // IOX_POSH_POPO_RESPONSE_HPP
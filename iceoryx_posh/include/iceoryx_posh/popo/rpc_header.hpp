@@ -108,6 +108,16 @@ class RequestHeader : public RpcBaseHeader
     RequestHeader& operator=(RequestHeader&& rhs) noexcept = default;
     ~RequestHeader() noexcept = default;
 
+    /// @brief Get the RequestHeader from the user-payload of a request chunk
+    /// @param[in] payload is the pointer to the user-payload of the request
+    /// @return the pointer to the RequestHeader or a nullptr if the payload is a nullptr
+    static RequestHeader* fromPayload(void* const payload) noexcept;
+
+    /// @brief Get the const RequestHeader from the const user-payload of a request chunk
+    /// @param[in] payload is the pointer to the const user-payload of the request
+    /// @return the pointer to the const RequestHeader or a nullptr if the payload is a nullptr
+    static const RequestHeader* fromPayload(const void* const payload) noexcept;
+
     /// @brief Sets the sequence ID which is used to match a response to a request
     /// @param[in] sequenceId is a consecutive number set by the user
     /// @note The user has to set this manually if multiple requests are sent before a response is read since a server
@@ -145,6 +155,16 @@ class ResponseHeader : public RpcBaseHeader
     ResponseHeader& operator=(ResponseHeader&& rhs) noexcept = default;
     ~ResponseHeader() noexcept = default;
 
+    /// @brief Get the ResponseHeader from the user-payload of a response chunk
+    /// @param[in] payload is the pointer to the user-payload of the response
+    /// @return the pointer to the ResponseHeader or a nullptr if the payload is a nullptr
+    static ResponseHeader* fromPayload(void* const payload) noexcept;
+
+    /// @brief Get the const ResponseHeader from the const user-payload of a response chunk
+    /// @param[in] payload is the pointer to the const user-payload of the response
+    /// @return the pointer to the const ResponseHeader or a nullptr if the payload is a nullptr
+    static const ResponseHeader* fromPayload(const void* const payload) noexcept;
+
     /// @brief Sets the server error flag
     void setServerError() noexcept;
 
@@ -0,0 +1,42 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_RPC_INTERFACE_HPP
+#define IOX_POSH_POPO_RPC_INTERFACE_HPP
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Interface for the sending side of the request-response communication, i.e. the Client for the Request and
+/// the Server for the Response. It is used by the Request and Response to send themselves.
+/// @tparam RpcType is either a Request or a Response
+template <typename RpcType>
+class RpcInterface
+{
+  public:
+    /// @brief Sends the given Request or Response and releases its ownership of the chunk
+    /// @param[in] rpc is the Request or Response to send
+    virtual void send(RpcType&& rpc) noexcept = 0;
+
+  protected:
+    RpcInterface() noexcept = default;
+    ~RpcInterface() noexcept = default;
+};
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_RPC_INTERFACE_HPP
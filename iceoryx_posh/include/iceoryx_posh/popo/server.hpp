@@ -0,0 +1,92 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_SERVER_HPP
+#define IOX_POSH_POPO_SERVER_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_posh/internal/popo/rpc_deleter.hpp"
+#include "iceoryx_posh/popo/base_server.hpp"
+#include "iceoryx_posh/popo/request.hpp"
+#include "iceoryx_posh/popo/response.hpp"
+#include "iceoryx_posh/popo/rpc_interface.hpp"
+
+namespace iox
+{
+namespace popo
+{
+///
+/// @brief The Server receives the requests of type Req of the clients of its service and answers them with responses
+/// of type Res. The requests and responses are loaned from the shared memory and are never copied on the way.
+///
+template <typename Req, typename Res, typename BaseServer_t = BaseServer<>>
+class ServerImpl : public BaseServer_t, public RpcInterface<Response<Res>>
+{
+    static_assert(!std::is_void<Req>::value, "The type `Req` must not be void. Use the UntypedServer for void types.");
+    static_assert(!std::is_void<Res>::value, "The type `Res` must not be void. Use the UntypedServer for void types.");
+
+  public:
+    ServerImpl(const capro::ServiceDescription& service, const ServerOptions& serverOptions = ServerOptions()) noexcept;
+    ServerImpl(const ServerImpl&) = delete;
+    ServerImpl(ServerImpl&&) = delete;
+    ServerImpl& operator=(const ServerImpl&) = delete;
+    ServerImpl& operator=(ServerImpl&&) = delete;
+    virtual ~ServerImpl() noexcept = default;
+
+    ///
+    /// @brief Take the Request from the top of the receive queue.
+    /// @return Either a Request or a ChunkReceiveResult.
+    /// @details The Request takes care of the cleanup. Don't store the raw pointer to the content of the Request, but
+    /// always the whole Request.
+    ///
+    cxx::expected<Request<const Req>, ChunkReceiveResult> take() noexcept;
+
+    ///
+    /// @brief Get a Response from loaned shared memory and construct the data with the given arguments.
+    /// @param request The Request which shall be answered with the Response.
+    /// @param args Arguments used to construct the data.
+    /// @return A Response or an AllocationError if no chunk could be loaned.
+    /// @details The loaned Response is automatically released when it goes out of scope.
+    ///
+    template <typename... Args>
+    cxx::expected<Response<Res>, AllocationError> loan(const Request<const Req>& request, Args&&... args) noexcept;
+
+    ///
+    /// @brief Sends the given Response to the client which sent the corresponding Request and releases its ownership
+    /// of the chunk.
+    /// @param response The Response which shall be sent.
+    ///
+    void send(Response<Res>&& response) noexcept override;
+
+    using PortType = typename BaseServer_t::PortType;
+
+  protected:
+    using BaseServer_t::port;
+
+  private:
+    RequestDeleter<PortType> m_requestDeleter{port()};
+    ResponseDeleter<PortType> m_responseDeleter{port()};
+};
+
+template <typename Req, typename Res>
+using Server = ServerImpl<Req, Res>;
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/server.inl"
+
+#endif // IOX_POSH_POPO_SERVER_HPP
@@ -0,0 +1,135 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_SMART_CHUNK_HPP
+#define IOX_POSH_POPO_SMART_CHUNK_HPP
+
+#include "iceoryx_hoofs/cxx/type_traits.hpp"
+#include "iceoryx_hoofs/cxx/unique_ptr.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+
+namespace iox
+{
+namespace popo
+{
+///
+/// @brief The SmartChunk is the common base of the Request and the Response. Like the Sample, it is an abstraction
+/// over a type which is written to or read from loaned shared memory and it takes care of releasing the chunk.
+/// @tparam TransmissionInterface is the interface which is used to send the chunk, i.e. the Client or the Server
+/// @tparam T is the type of the user-payload
+/// @tparam H is the type of the user-header, i.e. the RequestHeader or the ResponseHeader
+///
+template <typename TransmissionInterface, typename T, typename H>
+class SmartChunk
+{
+    static_assert(std::is_const<T>::value == std::is_const<H>::value,
+                  "The type `T` and the user-header `H` must be equal in their const qualifier to ensure the same "
+                  "access restrictions for the user-header as for the user-payload data!");
+
+  protected:
+    /// @brief Helper type to enable some methods only for the sending side, i.e. when T has no const qualifier
+    template <typename S, typename TT>
+    using ForProducerOnly = std::enable_if_t<std::is_same<S, TT>::value && !std::is_const<TT>::value, S>;
+
+    /// @brief Helper type to enable some methods only for the receiving side, i.e. when T has a const qualifier
+    template <typename S, typename TT>
+    using ForConsumerOnly = std::enable_if_t<std::is_same<S, TT>::value && std::is_const<TT>::value, S>;
+
+  public:
+    /// @brief Constructor for a SmartChunk used by the sending side
+    /// @param smartChunkUniquePtr is a `rvalue` to a `cxx::unique_ptr<T>` with to the data of the encapsulated type T
+    /// @param producer is a reference to the sending side to be able to send the chunk
+    template <typename S = T, typename = ForProducerOnly<S, T>>
+    SmartChunk(cxx::unique_ptr<T>&& smartChunkUniquePtr, TransmissionInterface& producer) noexcept;
+
+    /// @brief Constructor for a SmartChunk used by the receiving side
+    /// @param smartChunkUniquePtr is a `rvalue` to a `cxx::unique_ptr<T>` with to the data of the encapsulated type T
+    template <typename S = T, typename = ForConsumerOnly<S, T>>
+    explicit SmartChunk(cxx::unique_ptr<T>&& smartChunkUniquePtr) noexcept;
+
+    ~SmartChunk() noexcept = default;
+
+    SmartChunk& operator=(SmartChunk&& rhs) noexcept = default;
+    SmartChunk(SmartChunk&& rhs) noexcept = default;
+
+    SmartChunk(const SmartChunk&) = delete;
+    SmartChunk& operator=(const SmartChunk&) = delete;
+
+    /// @brief Transparent access to the encapsulated type.
+    /// @return a pointer to the encapsulated type.
+    T* operator->() noexcept;
+
+    /// @brief Transparent read-only access to the encapsulated type.
+    /// @return a const pointer to the encapsulated type.
+    const T* operator->() const noexcept;
+
+    /// @brief Provides a reference to the encapsulated type.
+    /// @return A T& to the encapsulated type.
+    T& operator*() noexcept;
+
+    /// @brief Provides a const reference to the encapsulated type.
+    /// @return A const T& to the encapsulated type.
+    const T& operator*() const noexcept;
+
+    /// @brief Indicates whether the smart chunk is valid, i.e. refers to allocated memory.
+    /// @return true if the smart chunk is valid, false otherwise.
+    operator bool() const noexcept;
+
+    /// @brief Mutable access to the encapsulated type loaned to the smart chunk.
+    /// @return a pointer to the encapsulated type.
+    T* get() noexcept;
+
+    /// @brief Read-only access to the encapsulated type loaned to the smart chunk.
+    /// @return a const pointer to the encapsulated type.
+    const T* get() const noexcept;
+
+    /// @brief Helper type to ensure the access to the ChunkHeader has the same const qualifier as the access to the
+    /// user-payload data
+    using ConditionalConstChunkHeader_t = cxx::add_const_conditionally_t<mepoo::ChunkHeader, T>;
+
+    /// @brief Retrieve the ChunkHeader of the underlying memory chunk loaned to the smart chunk.
+    /// @return The ChunkHeader of the underlying memory chunk.
+    ConditionalConstChunkHeader_t* getChunkHeader() noexcept;
+
+    /// @brief Retrieve the ChunkHeader of the underlying memory chunk loaned to the smart chunk.
+    /// @return The const ChunkHeader of the underlying memory chunk.
+    const mepoo::ChunkHeader* getChunkHeader() const noexcept;
+
+  protected:
+    /// @brief Retrieve the user-header, i.e. the RequestHeader or ResponseHeader, of the underlying memory chunk
+    /// @return The user-header of the underlying memory chunk.
+    H& getUserHeader() noexcept;
+
+    /// @brief Retrieve the user-header, i.e. the RequestHeader or ResponseHeader, of the underlying memory chunk
+    /// @return The const user-header of the underlying memory chunk.
+    const H& getUserHeader() const noexcept;
+
+    /// @note used by the producer to release the chunk ownership from the `SmartChunk` after sending the chunk and
+    /// therefore preventing the invocation of the custom deleter
+    T* release() noexcept;
+
+  protected:
+    cxx::unique_ptr<T> m_smartChunkUniquePtr;
+    /// @note the producer is only set for the sending side
+    TransmissionInterface* m_producer{nullptr};
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/smart_chunk.inl"
+
+#endif // IOX_POSH_POPO_SMART_CHUNK_HPP
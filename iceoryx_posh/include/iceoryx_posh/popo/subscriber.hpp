@@ -48,6 +48,20 @@ class SubscriberImpl : public BaseSubscriber_t
     ///
     cxx::expected<Sample<const T, const H>, ChunkReceiveResult> take() noexcept;
 
+    ///
+    /// @brief Takes up to maxNumberOfSamples samples from the top of the receive queue in one pass, which is cheaper
+    /// than calling take in a loop since the queue is accessed in one go.
+    /// @param[in] maxNumberOfSamples the maximum number of samples to take
+    /// @param[in] callable is called with every sample in the order in which the samples were received, signature
+    /// void(Sample<const T, const H>&&)
+    /// @return Either the number of taken samples, which is zero if the receive queue is empty, or
+    /// ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL if the pass was stopped early.
+    /// @details Like with take, the samples take care of the cleanup.
+    ///
+    template <typename Callable>
+    cxx::expected<uint64_t, ChunkReceiveResult> takeBatch(const uint64_t maxNumberOfSamples,
+                                                          const Callable& callable) noexcept;
+
     using PortType = typename BaseSubscriber_t::PortType;
     using SubscriberSampleDeleter = SampleDeleter<PortType>;
 
@@ -0,0 +1,98 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_UNTYPED_CLIENT_HPP
+#define IOX_POSH_POPO_UNTYPED_CLIENT_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_posh/popo/base_client.hpp"
+#include "iceoryx_posh/popo/rpc_header.hpp"
+
+namespace iox
+{
+namespace popo
+{
+///
+/// @brief The UntypedClient sends requests with a loaned chunk of the given size to the server of its service and
+/// receives the responses of the server
+///
+template <typename BaseClient_t = BaseClient<>>
+class UntypedClientImpl : public BaseClient_t
+{
+  public:
+    UntypedClientImpl(const capro::ServiceDescription& service,
+                      const ClientOptions& clientOptions = ClientOptions()) noexcept;
+    UntypedClientImpl(const UntypedClientImpl&) = delete;
+    UntypedClientImpl(UntypedClientImpl&&) = delete;
+    UntypedClientImpl& operator=(const UntypedClientImpl&) = delete;
+    UntypedClientImpl& operator=(UntypedClientImpl&&) = delete;
+    virtual ~UntypedClientImpl() noexcept = default;
+
+    ///
+    /// @brief Get a request chunk from loaned shared memory.
+    /// @param userPayloadSize The expected user-payload size of the chunk.
+    /// @param userPayloadAlignment The expected user-payload alignment of the chunk.
+    /// @return A pointer to the user-payload of a chunk of memory with the requested size or
+    ///         an AllocationError if no chunk could be loaned.
+    /// @note The RequestHeader of the chunk can be accessed with RequestHeader::fromPayload.
+    ///
+    cxx::expected<void*, AllocationError> loan(const uint32_t userPayloadSize,
+                                               const uint32_t userPayloadAlignment) noexcept;
+
+    ///
+    /// @brief Sends the given request chunk to the server.
+    /// @param requestPayload Pointer to the user-payload of the request which shall be sent.
+    /// @details The requestPayload pointer must have been previously provided by loan and not have been already
+    ///          released or sent. The chunk must not be accessed afterwards.
+    ///
+    void send(void* const requestPayload) noexcept;
+
+    ///
+    /// @brief Releases the ownership of the request chunk provided by the user-payload pointer without sending it.
+    /// @param requestPayload Pointer to the user-payload of the request to be released.
+    /// @details The requestPayload pointer must have been previously provided by loan and not have been already
+    ///          released or sent. The chunk must not be accessed afterwards.
+    ///
+    void releaseRequest(void* const requestPayload) noexcept;
+
+    ///
+    /// @brief Take the response chunk from the top of the receive queue.
+    /// @return The user-payload pointer of the response chunk taken or a ChunkReceiveResult on error.
+    /// @details No automatic cleanup of the associated chunk is performed and must be manually done by calling
+    ///          `releaseResponse`. The ResponseHeader of the chunk can be accessed with ResponseHeader::fromPayload.
+    ///
+    cxx::expected<const void*, ChunkReceiveResult> take() noexcept;
+
+    ///
+    /// @brief Releases the ownership of the response chunk provided by the user-payload pointer.
+    /// @param responsePayload Pointer to the user-payload of the response to be released.
+    /// @details The responsePayload pointer must have been previously provided by take and not have been already
+    ///          released. The chunk must not be accessed afterwards.
+    ///
+    void releaseResponse(const void* const responsePayload) noexcept;
+
+  protected:
+    using BaseClient_t::port;
+};
+
+using UntypedClient = UntypedClientImpl<>;
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/untyped_client.inl"
+
+#endif // IOX_POSH_POPO_UNTYPED_CLIENT_HPP
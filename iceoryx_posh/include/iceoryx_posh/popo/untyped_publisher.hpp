@@ -58,6 +58,33 @@ class UntypedPublisherImpl : public BasePublisher_t
     ///
     void publish(void* const userPayload) noexcept;
 
+    ///
+    /// @brief Get up to numberOfChunks chunks with the same size from loaned shared memory at once, which is cheaper
+    /// than calling loan in a loop.
+    /// @param numberOfChunks The number of chunks to loan.
+    /// @param callable Is called with the user-payload pointer of every loaned chunk, signature void(void*).
+    /// @param usePayloadSize The expected user-payload size of the chunks.
+    /// @param userPayloadAlignment The expected user-payload alignment of the chunks.
+    /// @return The number of loaned chunks, which is less than numberOfChunks if the shared memory is running out of
+    ///         chunks, or an AllocationError if not a single chunk could be loaned.
+    ///
+    template <typename Callable>
+    cxx::expected<uint32_t, AllocationError>
+    loanBatch(const uint32_t numberOfChunks,
+              const Callable& callable,
+              const uint32_t userPayloadSize,
+              const uint32_t userPayloadAlignment = iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+              const uint32_t userHeaderSize = iox::CHUNK_NO_USER_HEADER_SIZE,
+              const uint32_t userHeaderAlignment = iox::CHUNK_NO_USER_HEADER_ALIGNMENT) noexcept;
+
+    ///
+    /// @brief Publish the provided memory chunks in the given order. Every subscriber is notified once per batch
+    /// instead of once per chunk.
+    /// @param userPayloads Array of pointers to the user-payloads of the allocated shared memory chunks.
+    /// @param numberOfChunks The number of pointers in the array.
+    ///
+    void publishBatch(void* const* const userPayloads, const uint32_t numberOfChunks) noexcept;
+
     ///
     /// @brief Releases the ownership of the chunk provided by the user-payload pointer.
     /// @param userPayload pointer to the user-payload of the chunk to be released
@@ -0,0 +1,100 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_UNTYPED_SERVER_HPP
+#define IOX_POSH_POPO_UNTYPED_SERVER_HPP
+
+#include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_posh/popo/base_server.hpp"
+#include "iceoryx_posh/popo/rpc_header.hpp"
+
+namespace iox
+{
+namespace popo
+{
+///
+/// @brief The UntypedServer receives the requests of the clients of its service and answers them with responses in a
+/// loaned chunk of the given size
+///
+template <typename BaseServer_t = BaseServer<>>
+class UntypedServerImpl : public BaseServer_t
+{
+  public:
+    UntypedServerImpl(const capro::ServiceDescription& service,
+                      const ServerOptions& serverOptions = ServerOptions()) noexcept;
+    UntypedServerImpl(const UntypedServerImpl&) = delete;
+    UntypedServerImpl(UntypedServerImpl&&) = delete;
+    UntypedServerImpl& operator=(const UntypedServerImpl&) = delete;
+    UntypedServerImpl& operator=(UntypedServerImpl&&) = delete;
+    virtual ~UntypedServerImpl() noexcept = default;
+
+    ///
+    /// @brief Take the request chunk from the top of the receive queue.
+    /// @return The user-payload pointer of the request chunk taken or a ChunkReceiveResult on error.
+    /// @details No automatic cleanup of the associated chunk is performed and must be manually done by calling
+    ///          `releaseRequest`. The RequestHeader of the chunk can be accessed with RequestHeader::fromPayload.
+    ///
+    cxx::expected<const void*, ChunkReceiveResult> take() noexcept;
+
+    ///
+    /// @brief Releases the ownership of the request chunk provided by the user-payload pointer.
+    /// @param requestPayload Pointer to the user-payload of the request to be released.
+    /// @details The requestPayload pointer must have been previously provided by take and not have been already
+    ///          released. The chunk must not be accessed afterwards.
+    ///
+    void releaseRequest(const void* const requestPayload) noexcept;
+
+    ///
+    /// @brief Get a response chunk from loaned shared memory.
+    /// @param requestHeader Pointer to the RequestHeader of the request which shall be answered.
+    /// @param userPayloadSize The expected user-payload size of the chunk.
+    /// @param userPayloadAlignment The expected user-payload alignment of the chunk.
+    /// @return A pointer to the user-payload of a chunk of memory with the requested size or
+    ///         an AllocationError if no chunk could be loaned.
+    /// @note The ResponseHeader of the chunk can be accessed with ResponseHeader::fromPayload.
+    ///
+    cxx::expected<void*, AllocationError> loan(const RequestHeader* const requestHeader,
+                                               const uint32_t userPayloadSize,
+                                               const uint32_t userPayloadAlignment) noexcept;
+
+    ///
+    /// @brief Sends the given response chunk to the client which sent the corresponding request.
+    /// @param responsePayload Pointer to the user-payload of the response which shall be sent.
+    /// @details The responsePayload pointer must have been previously provided by loan and not have been already
+    ///          released or sent. The chunk must not be accessed afterwards.
+    ///
+    void send(void* const responsePayload) noexcept;
+
+    ///
+    /// @brief Releases the ownership of the response chunk provided by the user-payload pointer without sending it.
+    /// @param responsePayload Pointer to the user-payload of the response to be released.
+    /// @details The responsePayload pointer must have been previously provided by loan and not have been already
+    ///          released or sent. The chunk must not be accessed afterwards.
+    ///
+    void releaseResponse(void* const responsePayload) noexcept;
+
+  protected:
+    using BaseServer_t::port;
+};
+
+using UntypedServer = UntypedServerImpl<>;
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/untyped_server.inl"
+
+#endif // IOX_POSH_POPO_UNTYPED_SERVER_HPP
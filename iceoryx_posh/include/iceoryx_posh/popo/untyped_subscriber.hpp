@@ -55,6 +55,20 @@ class UntypedSubscriberImpl : public BaseSubscriber_t
     ///
     cxx::expected<const void*, ChunkReceiveResult> take() noexcept;
 
+    ///
+    /// @brief Takes up to maxNumberOfChunks chunks from the top of the receive queue in one pass, which is cheaper
+    /// than calling take in a loop since the queue is accessed in one go.
+    /// @param[in] maxNumberOfChunks the maximum number of chunks to take
+    /// @param[in] callable is called with the user-payload pointer of every chunk in the order in which the chunks
+    /// were received, signature void(const void*)
+    /// @return Either the number of taken chunks, which is zero if the receive queue is empty, or
+    /// ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL if the pass was stopped early.
+    /// @details Like with take, every chunk must be released manually by calling `release`
+    ///
+    template <typename Callable>
+    cxx::expected<uint64_t, ChunkReceiveResult> takeBatch(const uint64_t maxNumberOfChunks,
+                                                          const Callable& callable) noexcept;
+
     ///
     /// @brief Releases the ownership of the chunk provided by the user-payload pointer.
     /// @param userPayload pointer to the user-payload of the chunk to be released
@@ -206,6 +206,17 @@ class WaitSet
     /// @return NotificationInfoVector of NotificationInfos that have been triggered
     NotificationInfoVector wait() noexcept;
 
+    /// @brief Sets the time wait() and timedWait() poll for notifications before the WaitSet sleeps. This avoids the
+    ///        wakeup latency when a notification arrives shortly after the call, at the cost of a busy CPU. The
+    ///        default of zero disables the busy poll.
+    /// @param[in] busyPollDuration how long the notifications are polled before the WaitSet sleeps
+    void setBusyPollDuration(const units::Duration busyPollDuration) noexcept;
+
+    /// @brief Returns how often a wait was ended by a notification during the busy poll and how often the WaitSet
+    ///        had to sleep
+    /// @return the wait statistics of the WaitSet
+    WaitStatistics getWaitStatistics() const noexcept;
+
     /// @brief Returns the amount of stored Trigger inside of the WaitSet
     uint64_t size() const noexcept;
 
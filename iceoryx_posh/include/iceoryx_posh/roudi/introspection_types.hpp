@@ -42,6 +42,9 @@ struct MemPoolInfo
     uint32_t m_numChunks{0};
     uint32_t m_chunkSize{0};
     uint32_t m_chunkPayloadSize{0};
+    /// @brief number of chunk requests which fitted into this mempool but were served by a larger one since this
+    /// mempool was exhausted; only increases with mepoo::MemPoolOverflowPolicy::USE_LARGER_MEMPOOL
+    uint64_t m_spilledChunks{0};
 };
 
 /// @brief container for MemPoolInfo structs of all available mempools.
@@ -98,7 +101,10 @@ struct PortThroughputData
     uint32_t m_sampleSize{0};
     uint32_t m_chunkSize{0};
     double m_chunksPerMinute{0};
+    double m_userPayloadBytesPerMinute{0};
     uint64_t m_lastSendIntervalInNanoseconds{0};
+    uint64_t m_sentChunks{0};
+    uint64_t m_lostChunks{0};
     bool m_isField{false};
 };
 
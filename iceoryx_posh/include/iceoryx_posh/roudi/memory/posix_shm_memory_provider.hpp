@@ -39,9 +39,11 @@ class PosixShmMemoryProvider : public MemoryProvider
     /// @param [in] shmName is the name of the posix share memory
     /// @param [in] accessMode defines the read and write access to the memory
     /// @param [in] openMode defines the creation/open mode of the shared memory.
+    /// @param [in] pagingOptions defines whether the memory is backed with huge pages and locked into the RAM
     PosixShmMemoryProvider(const ShmName_t& shmName,
                            const posix::AccessMode accessMode,
-                           const posix::OpenMode openMode) noexcept;
+                           const posix::OpenMode openMode,
+                           const posix::PagingOptions pagingOptions = posix::PagingOptions()) noexcept;
     ~PosixShmMemoryProvider() noexcept;
 
     PosixShmMemoryProvider(PosixShmMemoryProvider&&) = delete;
@@ -63,6 +65,7 @@ class PosixShmMemoryProvider : public MemoryProvider
     ShmName_t m_shmName;
     posix::AccessMode m_accessMode{posix::AccessMode::READ_ONLY};
     posix::OpenMode m_openMode{posix::OpenMode::OPEN_EXISTING};
+    posix::PagingOptions m_pagingOptions;
     cxx::optional<posix::SharedMemoryObject> m_shmObject;
 };
 
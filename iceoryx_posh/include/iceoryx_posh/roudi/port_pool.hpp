@@ -21,15 +21,19 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/application_port.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/interface_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_roudi.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_multi_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_single_producer.hpp"
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
+#include "iceoryx_posh/popo/client_options.hpp"
 #include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 
 namespace iox
@@ -42,8 +46,11 @@ enum class PortPoolError : uint8_t
 {
     INVALID_STATE,
     UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS,
+    UNIQUE_SERVER_PORT_ALREADY_EXISTS,
     PUBLISHER_PORT_LIST_FULL,
     SUBSCRIBER_PORT_LIST_FULL,
+    CLIENT_PORT_LIST_FULL,
+    SERVER_PORT_LIST_FULL,
     INTERFACE_PORT_LIST_FULL,
     APPLICATION_PORT_LIST_FULL,
     NODE_DATA_LIST_FULL,
@@ -64,6 +71,8 @@ class PortPool
     /// update this member if the publisher ports actually changed
     cxx::vector<PublisherPortRouDiType::MemberType_t*, MAX_PUBLISHERS> getPublisherPortDataList() noexcept;
     cxx::vector<SubscriberPortType::MemberType_t*, MAX_SUBSCRIBERS> getSubscriberPortDataList() noexcept;
+    cxx::vector<popo::ClientPortData*, MAX_CLIENTS> getClientPortDataList() noexcept;
+    cxx::vector<popo::ServerPortData*, MAX_SERVERS> getServerPortDataList() noexcept;
     cxx::vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER> getInterfacePortDataList() noexcept;
     cxx::vector<popo::ApplicationPortData*, MAX_PROCESS_NUMBER> getApplicationPortDataList() noexcept;
     cxx::vector<runtime::NodeData*, MAX_NODE_NUMBER> getNodeDataList() noexcept;
@@ -83,6 +92,20 @@ class PortPool
                       const popo::SubscriberOptions& subscriberOptions,
                       const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
 
+    cxx::expected<popo::ClientPortData*, PortPoolError>
+    addClientPort(const capro::ServiceDescription& serviceDescription,
+                  mepoo::MemoryManager* const memoryManager,
+                  const RuntimeName_t& runtimeName,
+                  const popo::ClientOptions& clientOptions,
+                  const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+
+    cxx::expected<popo::ServerPortData*, PortPoolError>
+    addServerPort(const capro::ServiceDescription& serviceDescription,
+                  mepoo::MemoryManager* const memoryManager,
+                  const RuntimeName_t& runtimeName,
+                  const popo::ServerOptions& serverOptions,
+                  const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+
     template <typename T, std::enable_if_t<std::is_same<T, iox::build::ManyToManyPolicy>::value>* = nullptr>
     iox::popo::SubscriberPortData* constructSubscriber(const capro::ServiceDescription& serviceDescription,
                                                        const RuntimeName_t& runtimeName,
@@ -110,6 +133,8 @@ class PortPool
 
     void removePublisherPort(PublisherPortRouDiType::MemberType_t* const portData) noexcept;
     void removeSubscriberPort(SubscriberPortType::MemberType_t* const portData) noexcept;
+    void removeClientPort(popo::ClientPortData* const portData) noexcept;
+    void removeServerPort(popo::ServerPortData* const portData) noexcept;
     void removeInterfacePort(popo::InterfacePortData* const portData) noexcept;
     void removeApplicationPort(popo::ApplicationPortData* const portData) noexcept;
     void removeNodeData(runtime::NodeData* const nodeData) noexcept;
@@ -117,7 +142,27 @@ class PortPool
 
     std::atomic<uint64_t>* serviceRegistryChangeCounter() noexcept;
 
+    /// @brief the data with which the ports announce pending CaPro messages
+    popo::DiscoveryNotificationData& discoveryNotificationData() noexcept;
+
+    /// @brief returns the port data which announces pending CaPro messages with the given discovery notifier index
+    /// @return the port data or a nullptr if no port of this type uses the index
+    PublisherPortRouDiType::MemberType_t* getPublisherPortDataOfDiscoveryNotifier(const uint64_t index) noexcept;
+    SubscriberPortType::MemberType_t* getSubscriberPortDataOfDiscoveryNotifier(const uint64_t index) noexcept;
+    popo::ClientPortData* getClientPortDataOfDiscoveryNotifier(const uint64_t index) noexcept;
+    popo::ServerPortData* getServerPortDataOfDiscoveryNotifier(const uint64_t index) noexcept;
+
   private:
+    // the publishers use the notifier indices [0, MAX_PUBLISHERS[ and the subscribers, clients and servers the
+    // following ones in this order
+    static constexpr uint64_t FIRST_SUBSCRIBER_DISCOVERY_NOTIFIER_INDEX{MAX_PUBLISHERS};
+    static constexpr uint64_t FIRST_CLIENT_DISCOVERY_NOTIFIER_INDEX{FIRST_SUBSCRIBER_DISCOVERY_NOTIFIER_INDEX
+                                                                    + MAX_SUBSCRIBERS};
+    static constexpr uint64_t FIRST_SERVER_DISCOVERY_NOTIFIER_INDEX{FIRST_CLIENT_DISCOVERY_NOTIFIER_INDEX
+                                                                    + MAX_CLIENTS};
+
+    void setDiscoveryNotifier(popo::BasePortData& portData, const uint64_t notifierIndex) noexcept;
+
     PortPoolData* m_portPoolData;
 };
 
@@ -22,8 +22,10 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/application_port.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_user.hpp"
 #include "iceoryx_posh/internal/popo/ports/interface_port.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_user.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_runtime_interface.hpp"
 #include "iceoryx_posh/internal/runtime/node_property.hpp"
@@ -129,6 +131,26 @@ class PoshRuntime
                             const popo::SubscriberOptions& subscriberOptions = {},
                             const PortConfigInfo& portConfigInfo = {}) noexcept = 0;
 
+    /// @brief request the RouDi daemon to create a client port
+    /// @param[in] serviceDescription service description for the new client port
+    /// @param[in] clientOptions like the response queue capacity of a client
+    /// @param[in] portConfigInfo configuration information for the port
+    /// (what type of port is requested, device where its payload memory is located on etc.)
+    /// @return pointer to a created client port data
+    virtual popo::ClientPortData* getMiddlewareClient(const capro::ServiceDescription& service,
+                                                      const popo::ClientOptions& clientOptions = {},
+                                                      const PortConfigInfo& portConfigInfo = {}) noexcept = 0;
+
+    /// @brief request the RouDi daemon to create a server port
+    /// @param[in] serviceDescription service description for the new server port
+    /// @param[in] serverOptions like the request queue capacity of a server
+    /// @param[in] portConfigInfo configuration information for the port
+    /// (what type of port is requested, device where its payload memory is located on etc.)
+    /// @return pointer to a created server port data
+    virtual popo::ServerPortData* getMiddlewareServer(const capro::ServiceDescription& service,
+                                                      const popo::ServerOptions& serverOptions = {},
+                                                      const PortConfigInfo& portConfigInfo = {}) noexcept = 0;
+
     /// @brief request the RouDi daemon to create an interface port
     /// @param[in] interface interface to create
     /// @param[in] nodeName name of the node where the interface should belong to
@@ -30,11 +30,13 @@ namespace mepoo
 MemPoolInfo::MemPoolInfo(const uint32_t usedChunks,
                          const uint32_t minFreeChunks,
                          const uint32_t numChunks,
-                         const uint32_t chunkSize) noexcept
+                         const uint32_t chunkSize,
+                         const uint64_t spilledChunks) noexcept
     : m_usedChunks(usedChunks)
     , m_minFreeChunks(minFreeChunks)
     , m_numChunks(numChunks)
     , m_chunkSize(chunkSize)
+    , m_spilledChunks(spilledChunks)
 {
 }
 
@@ -80,8 +82,8 @@ void* MemPool::getChunk() noexcept
     uint32_t l_index{0U};
     if (!m_freeIndices.pop(l_index))
     {
-        std::cerr << "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
-                  << ", used_chunks = " << m_usedChunks << " ] has no more space left" << std::endl;
+        // an exhausted mempool is not an error by itself since the MemoryManager might spill over to a larger mempool;
+        // the MemoryManager reports when no mempool could serve the request
         return nullptr;
     }
 
@@ -90,18 +92,52 @@ void* MemPool::getChunk() noexcept
     m_usedChunks.fetch_add(1U, std::memory_order_relaxed);
     adjustMinFree();
 
-    return m_rawMemory + l_index * m_chunkSize;
+    return indexToPointer(l_index);
 }
 
-void MemPool::freeChunk(const void* chunk) noexcept
+uint32_t MemPool::getChunks(uint32_t* const chunkIndices, const uint32_t numberOfChunks) noexcept
+{
+    const uint32_t acquiredChunks = m_freeIndices.popN(chunkIndices, numberOfChunks);
+
+    if (acquiredChunks > 0U)
+    {
+        m_usedChunks.fetch_add(acquiredChunks, std::memory_order_relaxed);
+        adjustMinFree();
+    }
+
+    return acquiredChunks;
+}
+
+void MemPool::freeChunks(const uint32_t* const chunkIndices, const uint32_t numberOfChunks) noexcept
+{
+    if (!m_freeIndices.pushN(chunkIndices, numberOfChunks))
+    {
+        errorHandler(Error::kPOSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+    }
+
+    m_usedChunks.fetch_sub(numberOfChunks, std::memory_order_relaxed);
+}
+
+void* MemPool::indexToPointer(const uint32_t index) const noexcept
+{
+    return m_rawMemory.get() + static_cast<uint64_t>(index) * m_chunkSize;
+}
+
+uint32_t MemPool::pointerToIndex(const void* const chunk) const noexcept
 {
-    cxx::Expects(m_rawMemory <= chunk
-                 && chunk <= m_rawMemory + (static_cast<uint64_t>(m_chunkSize) * (m_numberOfChunks - 1U)));
+    const uint8_t* const rawMemory = m_rawMemory.get();
+    cxx::Expects(rawMemory <= chunk
+                 && chunk <= rawMemory + (static_cast<uint64_t>(m_chunkSize) * (m_numberOfChunks - 1U)));
 
-    auto offset = static_cast<const uint8_t*>(chunk) - m_rawMemory;
+    auto offset = static_cast<const uint8_t*>(chunk) - rawMemory;
     cxx::Expects(offset % m_chunkSize == 0);
 
-    uint32_t index = static_cast<uint32_t>(offset / m_chunkSize);
+    return static_cast<uint32_t>(offset / m_chunkSize);
+}
+
+void MemPool::freeChunk(const void* chunk) noexcept
+{
+    const uint32_t index = pointerToIndex(chunk);
 
     if (!m_freeIndices.push(index))
     {
@@ -131,12 +167,23 @@ uint32_t MemPool::getMinFree() const noexcept
     return m_minFree.load(std::memory_order_relaxed);
 }
 
+uint64_t MemPool::getSpilledChunks() const noexcept
+{
+    return m_spilledChunks.load(std::memory_order_relaxed);
+}
+
+void MemPool::increaseSpilledChunks() noexcept
+{
+    m_spilledChunks.fetch_add(1U, std::memory_order_relaxed);
+}
+
 MemPoolInfo MemPool::getInfo() const noexcept
 {
     return {m_usedChunks.load(std::memory_order_relaxed),
             m_minFree.load(std::memory_order_relaxed),
             m_numberOfChunks,
-            m_chunkSize};
+            m_chunkSize,
+            m_spilledChunks.load(std::memory_order_relaxed)};
 }
 
 } // namespace mepoo
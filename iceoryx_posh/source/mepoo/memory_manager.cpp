@@ -32,13 +32,16 @@ namespace iox
 {
 namespace mepoo
 {
+constexpr uint32_t MemoryManager::MAX_CHUNKS_PER_BATCH;
+
 void MemoryManager::printMemPoolVector(log::LogStream& log) const noexcept
 {
     for (auto& l_mempool : m_memPoolVector)
     {
         log << "  MemPool [ ChunkSize = " << l_mempool.getChunkSize()
             << ", ChunkPayloadSize = " << l_mempool.getChunkSize() - sizeof(ChunkHeader)
-            << ", ChunkCount = " << l_mempool.getChunkCount() << " ]";
+            << ", ChunkCount = " << l_mempool.getChunkCount() << ", UsedChunks = " << l_mempool.getUsedChunks()
+            << " ]";
     }
 }
 
@@ -77,6 +80,44 @@ void MemoryManager::generateChunkManagementPool(posix::Allocator& managementAllo
     m_chunkManagementPool.emplace_back(chunkSize, m_totalNumberOfChunks, managementAllocator, managementAllocator);
 }
 
+uint32_t MemoryManager::sizeClassOf(const uint32_t chunkSize) noexcept
+{
+    if (chunkSize < SIZE_CLASSES_PER_POWER_OF_TWO)
+    {
+        return chunkSize;
+    }
+
+    // position of the most significant bit, determined with a fixed number of steps
+    uint32_t msb{0U};
+    uint32_t value{chunkSize};
+    for (uint32_t shift : {16U, 8U, 4U, 2U, 1U})
+    {
+        if (value >= (1U << shift))
+        {
+            value >>= shift;
+            msb += shift;
+        }
+    }
+
+    const uint32_t powerOfTwoRange = msb - SIZE_CLASS_SUBDIVISION_BITS + 1U;
+    const uint32_t subClass = (chunkSize >> (msb - SIZE_CLASS_SUBDIVISION_BITS)) & (SIZE_CLASSES_PER_POWER_OF_TWO - 1U);
+    return (powerOfTwoRange << SIZE_CLASS_SUBDIVISION_BITS) | subClass;
+}
+
+void MemoryManager::generateSizeClassIndex() noexcept
+{
+    uint32_t memPoolIndex{0U};
+    for (uint32_t sizeClass = 0U; sizeClass < NUMBER_OF_SIZE_CLASSES; ++sizeClass)
+    {
+        while (memPoolIndex < m_memPoolVector.size()
+               && sizeClassOf(m_memPoolVector[memPoolIndex].getChunkSize()) < sizeClass)
+        {
+            ++memPoolIndex;
+        }
+        m_sizeClassIndex[sizeClass] = static_cast<MemPoolIndex_t>(memPoolIndex);
+    }
+}
+
 uint32_t MemoryManager::getNumberOfMemPools() const noexcept
 {
     return static_cast<uint32_t>(m_memPoolVector.size());
@@ -145,27 +186,44 @@ void MemoryManager::configureMemoryManager(const MePooConfig& mePooConfig,
     {
         addMemPool(managementAllocator, chunkMemoryAllocator, entry.m_size, entry.m_chunkCount);
     }
+    m_overflowPolicy = mePooConfig.m_overflowPolicy;
+    m_chunkCacheEnabled = mePooConfig.m_chunkCacheEnabled;
 
     generateChunkManagementPool(managementAllocator);
+    generateSizeClassIndex();
 }
 
 SharedChunk MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
 {
     void* chunk{nullptr};
     MemPool* memPoolPointer{nullptr};
+    MemPool* bestFittingMemPool{nullptr};
     const auto requiredChunkSize = chunkSettings.requiredChunkSize();
 
     uint32_t aquiredChunkSize = 0U;
 
-    for (auto& memPool : m_memPoolVector)
+    // the size class index skips all mempools which are definitely too small; only the mempools sharing the size class
+    // of the required chunk size need to be compared
+    const uint32_t numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    for (uint32_t i = m_sizeClassIndex[sizeClassOf(requiredChunkSize)]; i < numberOfMemPools; ++i)
     {
+        auto& memPool = m_memPoolVector[i];
         uint32_t chunkSizeOfMemPool = memPool.getChunkSize();
         if (chunkSizeOfMemPool >= requiredChunkSize)
         {
+            if (bestFittingMemPool == nullptr)
+            {
+                bestFittingMemPool = &memPool;
+            }
             chunk = memPool.getChunk();
             memPoolPointer = &memPool;
             aquiredChunkSize = chunkSizeOfMemPool;
-            break;
+
+            // since the mempools are ordered by increasing chunk size, all following mempools are also large enough
+            if (chunk != nullptr || m_overflowPolicy == MemPoolOverflowPolicy::REJECT_ALLOCATION)
+            {
+                break;
+            }
         }
     }
 
@@ -200,11 +258,229 @@ SharedChunk MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
     }
     else
     {
+        if (memPoolPointer != bestFittingMemPool)
+        {
+            bestFittingMemPool->increaseSpilledChunks();
+        }
+
         auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
         auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
             ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
         return SharedChunk(chunkManagement);
     }
 }
+
+uint32_t MemoryManager::bestFittingMemPoolIndex(const uint32_t requiredChunkSize) const noexcept
+{
+    const uint32_t numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    uint32_t memPoolIndex = m_sizeClassIndex[sizeClassOf(requiredChunkSize)];
+    while (memPoolIndex < numberOfMemPools && m_memPoolVector[memPoolIndex].getChunkSize() < requiredChunkSize)
+    {
+        ++memPoolIndex;
+    }
+    return memPoolIndex;
+}
+
+uint32_t MemoryManager::acquireChunkIndices(MemPool& memPool,
+                                            uint32_t* const chunkIndices,
+                                            uint32_t* const chunkManagementIndices,
+                                            const uint32_t numberOfChunks) noexcept
+{
+    auto& chunkManagementPool = m_chunkManagementPool.front();
+
+    uint32_t acquiredChunks = memPool.getChunks(chunkIndices, numberOfChunks);
+    const uint32_t acquiredChunkManagements = chunkManagementPool.getChunks(chunkManagementIndices, acquiredChunks);
+
+    // the chunk management pool has an entry for every chunk of all mempools and should therefore never run out
+    if (acquiredChunkManagements < acquiredChunks)
+    {
+        memPool.freeChunks(&chunkIndices[acquiredChunkManagements], acquiredChunks - acquiredChunkManagements);
+        acquiredChunks = acquiredChunkManagements;
+    }
+
+    return acquiredChunks;
+}
+
+SharedChunk MemoryManager::createSharedChunk(MemPool& memPool,
+                                             const uint32_t chunkIndex,
+                                             const uint32_t chunkManagementIndex,
+                                             const ChunkSettings& chunkSettings) noexcept
+{
+    auto& chunkManagementPool = m_chunkManagementPool.front();
+    auto chunkHeader = new (memPool.indexToPointer(chunkIndex)) ChunkHeader(memPool.getChunkSize(), chunkSettings);
+    auto chunkManagement = new (chunkManagementPool.indexToPointer(chunkManagementIndex))
+        ChunkManagement(chunkHeader, &memPool, &chunkManagementPool);
+    return SharedChunk(chunkManagement);
+}
+
+uint32_t MemoryManager::getChunks(const ChunkSettings& chunkSettings,
+                                  SharedChunk* const chunks,
+                                  const uint32_t numberOfChunks) noexcept
+{
+    const auto requiredChunkSize = chunkSettings.requiredChunkSize();
+    const uint32_t numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    const uint32_t bestFittingIndex = bestFittingMemPoolIndex(requiredChunkSize);
+
+    if (bestFittingIndex >= numberOfMemPools)
+    {
+        LogFatal() << "Could not find a fitting mempool for chunks of size " << requiredChunkSize;
+        errorHandler((numberOfMemPools == 0U) ? Error::kMEPOO__MEMPOOL_GETCHUNK_CHUNK_WITHOUT_MEMPOOL
+                                              : Error::kMEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE,
+                     nullptr,
+                     ErrorLevel::SEVERE);
+        return 0U;
+    }
+
+    uint32_t chunkIndices[MAX_CHUNKS_PER_BATCH];
+    uint32_t chunkManagementIndices[MAX_CHUNKS_PER_BATCH];
+    uint32_t acquiredChunks{0U};
+
+    // since the mempools are ordered by increasing chunk size, all following mempools are also large enough
+    for (uint32_t memPoolIndex = bestFittingIndex; memPoolIndex < numberOfMemPools && acquiredChunks < numberOfChunks;
+         ++memPoolIndex)
+    {
+        auto& memPool = m_memPoolVector[memPoolIndex];
+        uint32_t requestedChunks{0U};
+        uint32_t acquiredChunksFromMemPool{0U};
+        do
+        {
+            const uint32_t missingChunks = numberOfChunks - acquiredChunks;
+            requestedChunks = (missingChunks < MAX_CHUNKS_PER_BATCH) ? missingChunks : MAX_CHUNKS_PER_BATCH;
+            acquiredChunksFromMemPool =
+                acquireChunkIndices(memPool, chunkIndices, chunkManagementIndices, requestedChunks);
+            for (uint32_t i = 0U; i < acquiredChunksFromMemPool; ++i)
+            {
+                chunks[acquiredChunks] =
+                    createSharedChunk(memPool, chunkIndices[i], chunkManagementIndices[i], chunkSettings);
+                ++acquiredChunks;
+                if (memPoolIndex != bestFittingIndex)
+                {
+                    m_memPoolVector[bestFittingIndex].increaseSpilledChunks();
+                }
+            }
+        } while (acquiredChunksFromMemPool == requestedChunks && acquiredChunks < numberOfChunks);
+
+        if (m_overflowPolicy == MemPoolOverflowPolicy::REJECT_ALLOCATION)
+        {
+            break;
+        }
+    }
+
+    return acquiredChunks;
+}
+
+void MemoryManager::releaseChunks(ShmSafeUnmanagedChunk* const chunks, const uint64_t numberOfChunks) noexcept
+{
+    ChunkManagement* unreferencedChunks[MAX_CHUNKS_PER_BATCH];
+    uint32_t numberOfUnreferencedChunks{0U};
+
+    for (uint64_t i = 0U; i < numberOfChunks; ++i)
+    {
+        auto chunkManagement = chunks[i].releaseToSharedChunk().release();
+        if ((chunkManagement != nullptr)
+            && (chunkManagement->m_referenceCounter.fetch_sub(1U, std::memory_order_relaxed) == 1U))
+        {
+            unreferencedChunks[numberOfUnreferencedChunks] = chunkManagement;
+            ++numberOfUnreferencedChunks;
+            if (numberOfUnreferencedChunks == MAX_CHUNKS_PER_BATCH)
+            {
+                freeUnreferencedChunks(unreferencedChunks, numberOfUnreferencedChunks);
+                numberOfUnreferencedChunks = 0U;
+            }
+        }
+    }
+
+    freeUnreferencedChunks(unreferencedChunks, numberOfUnreferencedChunks);
+}
+
+void MemoryManager::freeUnreferencedChunks(ChunkManagement** const chunkManagements,
+                                           const uint32_t numberOfChunks) noexcept
+{
+    uint32_t chunkIndices[MAX_CHUNKS_PER_BATCH];
+    uint32_t chunkManagementIndices[MAX_CHUNKS_PER_BATCH];
+
+    // the chunks are grouped by their mempool and every group is returned with a single operation on the free lists
+    for (uint32_t first = 0U; first < numberOfChunks; ++first)
+    {
+        if (chunkManagements[first] == nullptr)
+        {
+            continue;
+        }
+
+        MemPool* memPool = chunkManagements[first]->m_mempool.get();
+        MemPool* chunkManagementPool = chunkManagements[first]->m_chunkManagementPool.get();
+        uint32_t numberOfChunksInGroup{0U};
+        for (uint32_t i = first; i < numberOfChunks; ++i)
+        {
+            auto chunkManagement = chunkManagements[i];
+            if (chunkManagement != nullptr && chunkManagement->m_mempool.get() == memPool
+                && chunkManagement->m_chunkManagementPool.get() == chunkManagementPool)
+            {
+                chunkIndices[numberOfChunksInGroup] = memPool->pointerToIndex(chunkManagement->m_chunkHeader.get());
+                chunkManagementIndices[numberOfChunksInGroup] = chunkManagementPool->pointerToIndex(chunkManagement);
+                ++numberOfChunksInGroup;
+                chunkManagements[i] = nullptr;
+            }
+        }
+
+        memPool->freeChunks(chunkIndices, numberOfChunksInGroup);
+        chunkManagementPool->freeChunks(chunkManagementIndices, numberOfChunksInGroup);
+    }
+}
+
+SharedChunk MemoryManager::getChunk(const ChunkSettings& chunkSettings, ChunkCache& chunkCache) noexcept
+{
+    if (!m_chunkCacheEnabled)
+    {
+        return getChunk(chunkSettings);
+    }
+
+    const uint32_t memPoolIndex = bestFittingMemPoolIndex(chunkSettings.requiredChunkSize());
+    if (memPoolIndex >= m_memPoolVector.size())
+    {
+        // there is no fitting mempool, getChunk reports the error
+        return getChunk(chunkSettings);
+    }
+
+    if (chunkCache.m_memPoolIndex != memPoolIndex)
+    {
+        releaseChunkCache(chunkCache);
+        chunkCache.m_memPoolIndex = memPoolIndex;
+    }
+
+    if (chunkCache.m_size == 0U)
+    {
+        // BEGIN of critical section, chunks will be lost if process gets hard terminated in between
+        chunkCache.m_size = acquireChunkIndices(m_memPoolVector[memPoolIndex],
+                                                chunkCache.m_chunkIndices,
+                                                chunkCache.m_chunkManagementIndices,
+                                                ChunkCache::CAPACITY);
+        // END of critical section, chunks will be lost if process gets hard terminated in between
+    }
+
+    if (chunkCache.m_size == 0U)
+    {
+        // the best fitting mempool is exhausted, getChunk applies the overflow policy or reports the error
+        return getChunk(chunkSettings);
+    }
+
+    --chunkCache.m_size;
+    return createSharedChunk(m_memPoolVector[memPoolIndex],
+                             chunkCache.m_chunkIndices[chunkCache.m_size],
+                             chunkCache.m_chunkManagementIndices[chunkCache.m_size],
+                             chunkSettings);
+}
+
+void MemoryManager::releaseChunkCache(ChunkCache& chunkCache) noexcept
+{
+    if (chunkCache.m_size > 0U && chunkCache.m_memPoolIndex < m_memPoolVector.size())
+    {
+        m_memPoolVector[chunkCache.m_memPoolIndex].freeChunks(chunkCache.m_chunkIndices, chunkCache.m_size);
+        m_chunkManagementPool.front().freeChunks(chunkCache.m_chunkManagementIndices, chunkCache.m_size);
+    }
+    chunkCache.m_size = 0U;
+    chunkCache.m_memPoolIndex = ChunkCache::NO_MEMPOOL;
+}
+
 } // namespace mepoo
 } // namespace iox
@@ -41,6 +41,18 @@ void MePooConfig::addMemPool(MePooConfig::Entry f_entry) noexcept
     }
 }
 
+MePooConfig& MePooConfig::setOverflowPolicy(const MemPoolOverflowPolicy policy) noexcept
+{
+    m_overflowPolicy = policy;
+    return *this;
+}
+
+MePooConfig& MePooConfig::setChunkCacheEnabled(const bool enabled) noexcept
+{
+    m_chunkCacheEnabled = enabled;
+    return *this;
+}
+
 /// this is the default memory pool configuration if no one is provided by the user
 MePooConfig& MePooConfig::setDefaults() noexcept
 {
@@ -16,12 +16,30 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_hoofs/cxx/deadline_timer.hpp"
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
 
 namespace iox
 {
 namespace popo
 {
+namespace
+{
+uint64_t countTrailingZeros(const uint64_t value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint64_t>(__builtin_ctzll(value));
+#else
+    uint64_t count{0U};
+    for (auto shiftedValue = value; (shiftedValue & 1U) == 0U; shiftedValue >>= 1U)
+    {
+        ++count;
+    }
+    return count;
+#endif
+}
+} // namespace
+
 ConditionListener::ConditionListener(ConditionVariableData& condVarData) noexcept
     : m_condVarDataPtr(&condVarData)
 {
@@ -66,43 +84,97 @@ bool ConditionListener::wasNotified() const noexcept
 
 ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 {
-    return waitImpl([this]() -> bool {
-        if (this->getMembers()->m_semaphore.wait().has_error())
-        {
-            errorHandler(Error::kPOPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT, nullptr, ErrorLevel::FATAL);
-            return false;
-        }
-        return true;
-    });
+    return waitImpl(
+        [this]() -> bool {
+            if (this->getMembers()->m_semaphore.wait().has_error())
+            {
+                errorHandler(Error::kPOPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT, nullptr, ErrorLevel::FATAL);
+                return false;
+            }
+            return true;
+        },
+        m_busyPollDuration);
 }
 
 ConditionListener::NotificationVector_t ConditionListener::timedWait(const units::Duration& timeToWait) noexcept
 {
-    return waitImpl([this, timeToWait]() -> bool {
-        if (this->getMembers()->m_semaphore.timedWait(timeToWait).has_error())
+    // the busy poll is part of the timeout, the semaphore is only waited for the remaining time
+    const auto busyPollDuration = (m_busyPollDuration < timeToWait) ? m_busyPollDuration : timeToWait;
+    const auto timeToSleep = timeToWait - busyPollDuration;
+    return waitImpl(
+        [this, timeToSleep]() -> bool {
+            if (this->getMembers()->m_semaphore.timedWait(timeToSleep).has_error())
+            {
+                errorHandler(
+                    Error::kPOPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT, nullptr, ErrorLevel::FATAL);
+            }
+            return false;
+        },
+        busyPollDuration);
+}
+
+void ConditionListener::setBusyPollDuration(const units::Duration busyPollDuration) noexcept
+{
+    m_busyPollDuration = busyPollDuration;
+}
+
+units::Duration ConditionListener::getBusyPollDuration() const noexcept
+{
+    return m_busyPollDuration;
+}
+
+WaitStatistics ConditionListener::getWaitStatistics() const noexcept
+{
+    WaitStatistics statistics;
+    statistics.spinHits = m_spinHits.load(std::memory_order_relaxed);
+    statistics.sleeps = m_sleeps.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+bool ConditionListener::busyPollForNotifications(const units::Duration busyPollDuration) const noexcept
+{
+    cxx::DeadlineTimer busyPollTimer(busyPollDuration);
+    do
+    {
+        for (uint64_t wordIndex = 0U; wordIndex < ConditionVariableData::NUMBER_OF_NOTIFICATION_WORDS; ++wordIndex)
         {
-            errorHandler(
-                Error::kPOPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT, nullptr, ErrorLevel::FATAL);
+            if (getMembers()->m_activeNotifications[wordIndex].load(std::memory_order_relaxed) != 0U)
+            {
+                return true;
+            }
         }
-        return false;
-    });
+    } while (!m_toBeDestroyed.load(std::memory_order_relaxed) && !busyPollTimer.hasExpired());
+
+    return false;
 }
 
-ConditionListener::NotificationVector_t ConditionListener::waitImpl(const cxx::function_ref<bool()>& waitCall) noexcept
+ConditionListener::NotificationVector_t ConditionListener::waitImpl(const cxx::function_ref<bool()>& waitCall,
+                                                                    const units::Duration busyPollDuration) noexcept
 {
-    using Type_t = iox::cxx::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
+    using Type_t = NotificationVector_t::value_type;
     NotificationVector_t activeNotifications;
 
     resetSemaphore();
     bool doReturnAfterNotificationCollection = false;
+    bool hasBusyPolled = (busyPollDuration == units::Duration::fromNanoseconds(0U));
     while (!m_toBeDestroyed.load(std::memory_order_relaxed))
     {
-        for (Type_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE; i++)
+        for (uint64_t wordIndex = 0U; wordIndex < ConditionVariableData::NUMBER_OF_NOTIFICATION_WORDS; ++wordIndex)
         {
-            if (getMembers()->m_activeNotifications[i].load(std::memory_order_relaxed))
+            auto& word = getMembers()->m_activeNotifications[wordIndex];
+            // the load avoids the write access of the exchange to the cache line when nothing was notified
+            if (word.load(std::memory_order_relaxed) == 0U)
             {
-                reset(i);
-                activeNotifications.emplace_back(i);
+                continue;
+            }
+
+            auto activeBits = word.exchange(0U, std::memory_order_acquire);
+            while (activeBits != 0U)
+            {
+                const auto bitIndex = countTrailingZeros(activeBits);
+                activeBits &= activeBits - 1U;
+                activeNotifications.emplace_back(
+                    static_cast<Type_t>(wordIndex * ConditionVariableData::NOTIFICATIONS_PER_WORD + bitIndex));
             }
         }
         if (!activeNotifications.empty() || doReturnAfterNotificationCollection)
@@ -110,20 +182,24 @@ ConditionListener::NotificationVector_t ConditionListener::waitImpl(const cxx::f
             return activeNotifications;
         }
 
+        // the busy poll is done only once per wait, a notification which arrives later wakes up the semaphore
+        if (!hasBusyPolled)
+        {
+            hasBusyPolled = true;
+            if (busyPollForNotifications(busyPollDuration))
+            {
+                m_spinHits.store(m_spinHits.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+                continue;
+            }
+        }
+
+        m_sleeps.store(m_sleeps.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
         doReturnAfterNotificationCollection = !waitCall();
     }
 
     return activeNotifications;
 }
 
-void ConditionListener::reset(const uint64_t index) noexcept
-{
-    if (index < MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE)
-    {
-        getMembers()->m_activeNotifications[index].store(false, std::memory_order_relaxed);
-    }
-}
-
 const ConditionVariableData* ConditionListener::getMembers() const noexcept
 {
     return m_condVarDataPtr;
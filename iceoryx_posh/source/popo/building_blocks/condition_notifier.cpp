@@ -38,7 +38,7 @@ void ConditionNotifier::notify() noexcept
 {
     if (m_notificationIndex < MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE)
     {
-        getMembers()->m_activeNotifications[m_notificationIndex].store(true, std::memory_order_release);
+        getMembers()->setNotification(m_notificationIndex);
     }
     getMembers()->m_semaphore.post().or_else([](auto) {
         errorHandler(Error::kPOPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY, nullptr, ErrorLevel::FATAL);
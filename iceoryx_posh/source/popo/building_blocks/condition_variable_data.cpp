@@ -21,6 +21,9 @@ namespace iox
 {
 namespace popo
 {
+constexpr uint64_t ConditionVariableData::NOTIFICATIONS_PER_WORD;
+constexpr uint64_t ConditionVariableData::NUMBER_OF_NOTIFICATION_WORDS;
+
 ConditionVariableData::ConditionVariableData() noexcept
     : ConditionVariableData("")
 {
@@ -29,10 +32,23 @@ ConditionVariableData::ConditionVariableData() noexcept
 ConditionVariableData::ConditionVariableData(const RuntimeName_t& runtimeName) noexcept
     : m_runtimeName(runtimeName)
 {
-    for (auto& id : m_activeNotifications)
+    for (auto& word : m_activeNotifications)
     {
-        id.store(false, std::memory_order_relaxed);
+        word.store(0U, std::memory_order_relaxed);
     }
 }
+
+void ConditionVariableData::setNotification(const uint64_t index) noexcept
+{
+    m_activeNotifications[index / NOTIFICATIONS_PER_WORD].fetch_or(
+        static_cast<uint64_t>(1U) << (index % NOTIFICATIONS_PER_WORD), std::memory_order_release);
+}
+
+bool ConditionVariableData::isNotificationSet(const uint64_t index) const noexcept
+{
+    return (m_activeNotifications[index / NOTIFICATIONS_PER_WORD].load(std::memory_order_relaxed)
+            & (static_cast<uint64_t>(1U) << (index % NOTIFICATIONS_PER_WORD)))
+           != 0U;
+}
 } // namespace popo
 } // namespace iox
@@ -0,0 +1,55 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_listener.hpp"
+
+namespace iox
+{
+namespace popo
+{
+DiscoveryListener::DiscoveryListener(DiscoveryNotificationData& dataRef) noexcept
+    : m_dataPtr(&dataRef)
+{
+}
+
+bool DiscoveryListener::timedWait(const units::Duration timeout) noexcept
+{
+    auto waitResult = m_dataPtr->m_semaphore.timedWait(timeout);
+    if (waitResult.has_error())
+    {
+        errorHandler(Error::kPOPO__DISCOVERY_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT, nullptr, ErrorLevel::FATAL);
+        return false;
+    }
+    return waitResult.value() == posix::SemaphoreWaitState::NO_TIMEOUT;
+}
+
+void DiscoveryListener::takeNotifications(const cxx::function_ref<void(const uint64_t)> callback) noexcept
+{
+    for (uint64_t wordIndex = 0U; wordIndex < DiscoveryNotificationData::NUMBER_OF_WORDS; ++wordIndex)
+    {
+        auto pendingBits = m_dataPtr->m_pendingNotifications[wordIndex].exchange(0U, std::memory_order_acq_rel);
+        for (uint64_t bitIndex = 0U; pendingBits != 0U; ++bitIndex, pendingBits >>= 1U)
+        {
+            if ((pendingBits & 1U) != 0U)
+            {
+                callback(wordIndex * DiscoveryNotificationData::BITS_PER_WORD + bitIndex);
+            }
+        }
+    }
+}
+
+} // namespace popo
+} // namespace iox
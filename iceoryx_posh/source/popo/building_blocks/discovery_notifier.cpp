@@ -0,0 +1,58 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
+
+namespace iox
+{
+namespace popo
+{
+DiscoveryNotifier::DiscoveryNotifier(DiscoveryNotificationData* const dataPtr, const uint64_t index) noexcept
+    : m_dataPtr(dataPtr)
+    , m_index(index)
+{
+    if (index >= DiscoveryNotificationData::MAX_NUMBER_OF_NOTIFIERS)
+    {
+        LogFatal() << "The provided index " << index << " is too large. The index has to be in the range of [0, "
+                   << DiscoveryNotificationData::MAX_NUMBER_OF_NOTIFIERS << "[.";
+        errorHandler(Error::kPOPO__DISCOVERY_NOTIFIER_INDEX_TOO_LARGE, nullptr, ErrorLevel::FATAL);
+        m_dataPtr = nullptr;
+    }
+}
+
+void DiscoveryNotifier::notify() noexcept
+{
+    if (m_dataPtr == nullptr)
+    {
+        return;
+    }
+
+    const uint64_t bit = static_cast<uint64_t>(1U) << (m_index % DiscoveryNotificationData::BITS_PER_WORD);
+    auto& word = m_dataPtr->m_pendingNotifications[m_index / DiscoveryNotificationData::BITS_PER_WORD];
+    // the release pairs with the acquire when the notifications are taken, therefore RouDi sees the port state
+    // which was written before the notification
+    const auto previousWord = word.fetch_or(bit, std::memory_order_acq_rel);
+    if ((previousWord & bit) == 0U)
+    {
+        m_dataPtr->m_semaphore.post().or_else([](auto) {
+            errorHandler(Error::kPOPO__DISCOVERY_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY, nullptr, ErrorLevel::FATAL);
+        });
+    }
+}
+
+} // namespace popo
+} // namespace iox
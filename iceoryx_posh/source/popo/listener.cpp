@@ -16,6 +16,8 @@
 
 #include "iceoryx_posh/popo/listener.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
+#include "iceoryx_hoofs/posix_wrapper/thread.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 
 namespace iox
@@ -23,15 +25,52 @@ namespace iox
 namespace popo
 {
 Listener::Listener() noexcept
-    : Listener(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable())
+    : Listener(ListenerOptions())
 {
 }
 
-Listener::Listener(ConditionVariableData& conditionVariable) noexcept
+Listener::Listener(const ListenerOptions& options) noexcept
+    : Listener(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(), options)
+{
+}
+
+Listener::Listener(ConditionVariableData& conditionVariable, const ListenerOptions& options) noexcept
     : m_conditionVariableData(&conditionVariable)
     , m_conditionListener(conditionVariable)
 {
+    for (auto& dispatchState : m_dispatchStates)
+    {
+        dispatchState.store(DispatchState::IDLE, std::memory_order_relaxed);
+    }
+
+    auto numberOfWorkerThreads = options.numberOfWorkerThreads;
+    if (numberOfWorkerThreads > MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER)
+    {
+        LogWarn() << "The listener supports at most " << MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER
+                  << " worker threads, " << numberOfWorkerThreads << " were requested.";
+        numberOfWorkerThreads = MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER;
+    }
+    for (uint64_t i = 0U; i < numberOfWorkerThreads; ++i)
+    {
+        m_workerThreads.emplace_back(&Listener::workerThreadLoop, this);
+    }
+
+    m_conditionListener.setBusyPollDuration(options.busyPollDuration);
     m_thread = std::thread(&Listener::threadLoop, this);
+
+    if (options.cpuAffinityMask != 0U)
+    {
+        bool hasSetAffinity = posix::setThreadAffinity(m_thread.native_handle(), options.cpuAffinityMask);
+        for (auto& workerThread : m_workerThreads)
+        {
+            hasSetAffinity =
+                posix::setThreadAffinity(workerThread.native_handle(), options.cpuAffinityMask) && hasSetAffinity;
+        }
+        if (!hasSetAffinity)
+        {
+            LogWarn() << "The CPU affinity of the listener threads could not be set.";
+        }
+    }
 }
 
 Listener::~Listener() noexcept
@@ -40,6 +79,18 @@ Listener::~Listener() noexcept
     m_conditionListener.destroy();
 
     m_thread.join();
+
+    for (uint64_t i = 0U; i < m_workerThreads.size(); ++i)
+    {
+        m_workerSemaphore.post().or_else([](auto) {
+            errorHandler(Error::kPOPO__LISTENER_WORKER_SEMAPHORE_CORRUPTED_IN_POST, nullptr, ErrorLevel::FATAL);
+        });
+    }
+    for (auto& workerThread : m_workerThreads)
+    {
+        workerThread.join();
+    }
+
     m_conditionVariableData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
 }
 
@@ -81,13 +132,93 @@ uint64_t Listener::size() const noexcept
     return m_indexManager.indicesInUse();
 }
 
+WaitStatistics Listener::getWaitStatistics() const noexcept
+{
+    return m_conditionListener.getWaitStatistics();
+}
+
 void Listener::threadLoop() noexcept
 {
     while (m_wasDtorCalled.load(std::memory_order_relaxed) == false)
     {
         auto activateNotificationIds = m_conditionListener.wait();
 
-        cxx::forEach(activateNotificationIds, [this](auto id) { m_events[id]->executeCallback(); });
+        if (m_workerThreads.empty())
+        {
+            cxx::forEach(activateNotificationIds, [this](auto id) { m_events[id]->executeCallback(); });
+        }
+        else
+        {
+            cxx::forEach(activateNotificationIds,
+                         [this](auto id) { this->dispatchToWorkerThreads(static_cast<uint32_t>(id)); });
+        }
+    }
+}
+
+void Listener::dispatchToWorkerThreads(const uint32_t index) noexcept
+{
+    // the state is always modified with a read-modify-write operation, even if it does not change, since this
+    // synchronizes with the worker thread which executes the callback next
+    auto& dispatchState = m_dispatchStates[index];
+    auto currentState = dispatchState.load(std::memory_order_relaxed);
+    DispatchState newState{DispatchState::QUEUED};
+    do
+    {
+        newState = (currentState == DispatchState::IDLE || currentState == DispatchState::QUEUED)
+                       ? DispatchState::QUEUED
+                       : DispatchState::RUNNING_AND_NOTIFIED_AGAIN;
+    } while (!dispatchState.compare_exchange_weak(
+        currentState, newState, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+    if (currentState == DispatchState::IDLE)
+    {
+        enqueueForWorkerThreads(index);
+    }
+}
+
+void Listener::enqueueForWorkerThreads(const uint32_t index) noexcept
+{
+    // every event is at most once in the queue, therefore the queue cannot overflow
+    cxx::Expects(m_dispatchQueue.tryPush(index));
+    m_workerSemaphore.post().or_else([](auto) {
+        errorHandler(Error::kPOPO__LISTENER_WORKER_SEMAPHORE_CORRUPTED_IN_POST, nullptr, ErrorLevel::FATAL);
+    });
+}
+
+void Listener::workerThreadLoop() noexcept
+{
+    while (true)
+    {
+        if (m_workerSemaphore.wait().has_error())
+        {
+            errorHandler(Error::kPOPO__LISTENER_WORKER_SEMAPHORE_CORRUPTED_IN_WAIT, nullptr, ErrorLevel::FATAL);
+            return;
+        }
+
+        if (m_wasDtorCalled.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        m_dispatchQueue.pop().and_then([this](auto index) { this->executeDispatchedCallback(index); });
+    }
+}
+
+void Listener::executeDispatchedCallback(const uint32_t index) noexcept
+{
+    auto& dispatchState = m_dispatchStates[index];
+    dispatchState.exchange(DispatchState::RUNNING, std::memory_order_acquire);
+
+    m_events[index]->executeCallback();
+
+    auto expectedState = DispatchState::RUNNING;
+    if (!dispatchState.compare_exchange_strong(
+            expectedState, DispatchState::IDLE, std::memory_order_acq_rel, std::memory_order_acquire))
+    {
+        // the event was notified again while the callback was running, the queue ensures that other events are
+        // not starved by an event which is notified continuously
+        dispatchState.exchange(DispatchState::QUEUED, std::memory_order_acq_rel);
+        enqueueForWorkerThreads(index);
     }
 }
 
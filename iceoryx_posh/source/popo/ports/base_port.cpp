@@ -68,7 +68,10 @@ BasePort::operator bool() const noexcept
 
 void BasePort::destroy() noexcept
 {
+    // RouDi could release the port data as soon as the flag is set, therefore the notifier is acquired before
+    auto discoveryNotifier = getDiscoveryNotifier();
     getMembers()->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    discoveryNotifier.notify();
 }
 
 bool BasePort::toBeDestroyed() const noexcept
@@ -76,5 +79,10 @@ bool BasePort::toBeDestroyed() const noexcept
     return getMembers()->m_toBeDestroyed.load(std::memory_order_relaxed);
 }
 
+DiscoveryNotifier BasePort::getDiscoveryNotifier() noexcept
+{
+    return DiscoveryNotifier(getMembers()->m_discoveryNotificationData.get(), getMembers()->m_discoveryNotifierIndex);
+}
+
 } // namespace popo
 } // namespace iox
@@ -42,6 +42,7 @@ ClientPortData::ClientPortData(const capro::ServiceDescription& serviceDescripti
     , m_connectRequested(clientOptions.connectOnCreate)
 {
     m_chunkReceiverData.m_queue.setCapacity(clientOptions.responseQueueCapacity);
+    m_chunkReceiverData.m_uniqueId = m_uniqueId;
 }
 
 } // namespace popo
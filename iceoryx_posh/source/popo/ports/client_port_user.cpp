@@ -93,6 +93,7 @@ void ClientPortUser::connect() noexcept
     if (!getMembers()->m_connectRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_connectRequested.store(true, std::memory_order_relaxed);
+        getDiscoveryNotifier().notify();
     }
 }
 
@@ -101,6 +102,7 @@ void ClientPortUser::disconnect() noexcept
     if (getMembers()->m_connectRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_connectRequested.store(false, std::memory_order_relaxed);
+        getDiscoveryNotifier().notify();
     }
 }
 
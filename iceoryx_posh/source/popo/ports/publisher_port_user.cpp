@@ -48,6 +48,23 @@ PublisherPortUser::tryAllocateChunk(const uint32_t userPayloadSize,
         getUniqueID(), userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
 }
 
+cxx::expected<uint32_t, AllocationError>
+PublisherPortUser::tryAllocateChunks(const uint32_t userPayloadSize,
+                                     const uint32_t userPayloadAlignment,
+                                     const uint32_t userHeaderSize,
+                                     const uint32_t userHeaderAlignment,
+                                     const uint32_t numberOfChunks,
+                                     const cxx::function_ref<void(mepoo::ChunkHeader*)> callable) noexcept
+{
+    return m_chunkSender.tryAllocateBatch(getUniqueID(),
+                                          userPayloadSize,
+                                          userPayloadAlignment,
+                                          userHeaderSize,
+                                          userHeaderAlignment,
+                                          numberOfChunks,
+                                          callable);
+}
+
 void PublisherPortUser::releaseChunk(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     m_chunkSender.release(chunkHeader);
@@ -71,6 +88,25 @@ void PublisherPortUser::sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcep
     }
 }
 
+void PublisherPortUser::sendChunks(mepoo::ChunkHeader* const* const chunkHeaders,
+                                   const uint32_t numberOfChunks) noexcept
+{
+    const auto offerRequested = getMembers()->m_offeringRequested.load(std::memory_order_relaxed);
+
+    if (offerRequested)
+    {
+        m_chunkSender.sendBatch(chunkHeaders, numberOfChunks);
+    }
+    else
+    {
+        // see sendChunk
+        for (uint32_t i = 0U; i < numberOfChunks; ++i)
+        {
+            m_chunkSender.pushToHistory(chunkHeaders[i]);
+        }
+    }
+}
+
 cxx::optional<const mepoo::ChunkHeader*> PublisherPortUser::tryGetPreviousChunk() const noexcept
 {
     return m_chunkSender.tryGetPreviousChunk();
@@ -81,6 +117,7 @@ void PublisherPortUser::offer() noexcept
     if (!getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(true, std::memory_order_relaxed);
+        getDiscoveryNotifier().notify();
     }
 }
 
@@ -89,6 +126,7 @@ void PublisherPortUser::stopOffer() noexcept
     if (getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(false, std::memory_order_relaxed);
+        getDiscoveryNotifier().notify();
     }
 }
 
@@ -25,7 +25,6 @@ ServerPortUser::ServerPortUser(cxx::not_null<MemberType_t* const> serverPortData
     : BasePort(serverPortDataPtr)
     , m_chunkSender(&getMembers()->m_chunkSenderData)
     , m_chunkReceiver(&getMembers()->m_chunkReceiverData)
-
 {
 }
 
@@ -40,14 +39,28 @@ ServerPortUser::MemberType_t* ServerPortUser::getMembers() noexcept
 }
 
 
-cxx::expected<cxx::optional<const RequestHeader*>, ChunkReceiveResult> ServerPortUser::getRequest() noexcept
+cxx::expected<const RequestHeader*, ChunkReceiveResult> ServerPortUser::getRequest() noexcept
 {
-    return cxx::success<cxx::optional<const RequestHeader*>>(cxx::nullopt_t());
+    auto getChunkResult = m_chunkReceiver.tryGet();
+
+    if (getChunkResult.has_error())
+    {
+        return cxx::error<ChunkReceiveResult>(getChunkResult.get_error());
+    }
+
+    return cxx::success<const RequestHeader*>(static_cast<const RequestHeader*>(getChunkResult.value()->userHeader()));
 }
 
-void ServerPortUser::releaseRequest(const RequestHeader* const /*requestHeader*/) noexcept
+void ServerPortUser::releaseRequest(const RequestHeader* const requestHeader) noexcept
 {
-    /// @todo
+    if (requestHeader)
+    {
+        m_chunkReceiver.release(requestHeader->getChunkHeader());
+    }
+    else
+    {
+        errorHandler(Error::kPOPO__SERVER_PORT_INVALID_REQUEST_TO_RELEASE_FROM_USER, nullptr, ErrorLevel::SEVERE);
+    }
 }
 
 bool ServerPortUser::hasNewRequests() const noexcept
@@ -61,20 +74,61 @@ bool ServerPortUser::hasLostRequestsSinceLastCall() noexcept
 }
 
 cxx::expected<ResponseHeader*, AllocationError>
-ServerPortUser::allocateResponse(const uint32_t /*userPayloadSize*/) noexcept
+ServerPortUser::allocateResponse(const RequestHeader* const requestHeader,
+                                 const uint32_t userPayloadSize,
+                                 const uint32_t userPayloadAlignment) noexcept
 {
-    /// @todo
-    return cxx::error<AllocationError>(AllocationError::RUNNING_OUT_OF_CHUNKS);
+    cxx::Expects(requestHeader != nullptr);
+
+    auto allocateResult = m_chunkSender.tryAllocate(
+        getUniqueID(), userPayloadSize, userPayloadAlignment, sizeof(ResponseHeader), alignof(ResponseHeader));
+
+    if (allocateResult.has_error())
+    {
+        return cxx::error<AllocationError>(allocateResult.get_error());
+    }
+
+    // the index of the client queue is looked up once per response, sending the response then only has to verify it
+    const auto clientQueueIndex =
+        m_chunkSender
+            .getQueueIndex(requestHeader->m_clientQueueUniquePortId, requestHeader->m_lastKnownClientQueueIndex)
+            .value_or(RpcBaseHeader::UNKNOWN_CLIENT_QUEUE_INDEX);
+
+    auto responseHeader = new (allocateResult.value()->userHeader()) ResponseHeader(
+        requestHeader->m_clientQueueUniquePortId, clientQueueIndex, requestHeader->getSequenceId());
+
+    return cxx::success<ResponseHeader*>(responseHeader);
 }
 
-void ServerPortUser::freeResponse(ResponseHeader* const /*responseHeader*/) noexcept
+void ServerPortUser::freeResponse(ResponseHeader* const responseHeader) noexcept
 {
-    /// @todo
+    if (responseHeader)
+    {
+        m_chunkSender.release(responseHeader->getChunkHeader());
+    }
+    else
+    {
+        errorHandler(Error::kPOPO__SERVER_PORT_INVALID_RESPONSE_TO_FREE_FROM_USER, nullptr, ErrorLevel::SEVERE);
+    }
 }
 
-void ServerPortUser::sendResponse(ResponseHeader* const /*responseHeader*/) noexcept
+bool ServerPortUser::sendResponse(ResponseHeader* const responseHeader) noexcept
 {
-    /// @todo
+    if (!responseHeader)
+    {
+        errorHandler(Error::kPOPO__SERVER_PORT_INVALID_RESPONSE_TO_SEND_FROM_USER, nullptr, ErrorLevel::SEVERE);
+        return false;
+    }
+
+    const auto isClientConnected = m_chunkSender.sendToQueue(responseHeader->getChunkHeader(),
+                                                             responseHeader->m_clientQueueUniquePortId,
+                                                             responseHeader->m_lastKnownClientQueueIndex);
+    if (!isClientConnected)
+    {
+        LogWarn() << "Could not deliver the response since the client is no longer connected!";
+    }
+
+    return isClientConnected;
 }
 
 void ServerPortUser::offer() noexcept
@@ -82,6 +136,7 @@ void ServerPortUser::offer() noexcept
     if (!getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(true, std::memory_order_relaxed);
+        getDiscoveryNotifier().notify();
     }
 }
 
@@ -90,6 +145,7 @@ void ServerPortUser::stopOffer() noexcept
     if (getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(false, std::memory_order_relaxed);
+        getDiscoveryNotifier().notify();
     }
 }
 
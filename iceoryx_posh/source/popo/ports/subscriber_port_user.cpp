@@ -48,6 +48,7 @@ void SubscriberPortUser::subscribe() noexcept
         m_chunkReceiver.clear();
 
         getMembers()->m_subscribeRequested.store(true, std::memory_order_relaxed);
+        getDiscoveryNotifier().notify();
     }
 }
 
@@ -56,6 +57,7 @@ void SubscriberPortUser::unsubscribe() noexcept
     if (getMembers()->m_subscribeRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_subscribeRequested.store(false, std::memory_order_relaxed);
+        getDiscoveryNotifier().notify();
     }
 }
 
@@ -69,6 +71,13 @@ cxx::expected<const mepoo::ChunkHeader*, ChunkReceiveResult> SubscriberPortUser:
     return m_chunkReceiver.tryGet();
 }
 
+cxx::expected<uint64_t, ChunkReceiveResult>
+SubscriberPortUser::tryGetChunks(const uint64_t maxNumberOfChunks,
+                                 const cxx::function_ref<void(const mepoo::ChunkHeader*)> callable) noexcept
+{
+    return m_chunkReceiver.tryGetBatch(maxNumberOfChunks, callable);
+}
+
 void SubscriberPortUser::releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     m_chunkReceiver.release(chunkHeader);
@@ -21,6 +21,10 @@ namespace iox
 {
 namespace popo
 {
+constexpr uint8_t RpcBaseHeader::RPC_HEADER_VERSION;
+constexpr uint32_t RpcBaseHeader::UNKNOWN_CLIENT_QUEUE_INDEX;
+constexpr int64_t RpcBaseHeader::START_SEQUENCE_ID;
+
 RpcBaseHeader::RpcBaseHeader(const UniquePortId& clientQueueUniquePortId,
                              const uint32_t lastKnownClientQueueIndex,
                              const int64_t sequenceId,
@@ -68,6 +72,20 @@ RequestHeader::RequestHeader(const UniquePortId& clientQueueUniquePortId,
 {
 }
 
+RequestHeader* RequestHeader::fromPayload(void* const payload) noexcept
+{
+    if (payload == nullptr)
+    {
+        return nullptr;
+    }
+    return static_cast<RequestHeader*>(mepoo::ChunkHeader::fromUserPayload(payload)->userHeader());
+}
+
+const RequestHeader* RequestHeader::fromPayload(const void* const payload) noexcept
+{
+    return RequestHeader::fromPayload(const_cast<void*>(payload));
+}
+
 void RequestHeader::setSequenceId(const int64_t sequenceId) noexcept
 {
     this->m_sequenceId = sequenceId;
@@ -90,6 +108,20 @@ ResponseHeader::ResponseHeader(const UniquePortId& clientQueueUniquePortId,
 {
 }
 
+ResponseHeader* ResponseHeader::fromPayload(void* const payload) noexcept
+{
+    if (payload == nullptr)
+    {
+        return nullptr;
+    }
+    return static_cast<ResponseHeader*>(mepoo::ChunkHeader::fromUserPayload(payload)->userHeader());
+}
+
+const ResponseHeader* ResponseHeader::fromPayload(const void* const payload) noexcept
+{
+    return ResponseHeader::fromPayload(const_cast<void*>(payload));
+}
+
 void ResponseHeader::setServerError() noexcept
 {
     m_hasServerError = true;
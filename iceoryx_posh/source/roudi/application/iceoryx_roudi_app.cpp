@@ -19,9 +19,12 @@
 
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_hoofs/cxx/scoped_static.hpp"
+#include "iceoryx_posh/internal/log/posh_logging.hpp"
 #include "iceoryx_posh/internal/roudi/roudi.hpp"
 #include "iceoryx_posh/roudi/iceoryx_roudi_components.hpp"
 
+#include <chrono>
+
 namespace iox
 {
 namespace roudi
@@ -35,8 +38,10 @@ uint8_t IceOryxRouDiApp::run() noexcept
 {
     if (m_run)
     {
+        const auto startOfStartup = std::chrono::steady_clock::now();
         static cxx::optional<IceOryxRouDiComponents> m_rouDiComponents;
         auto componentsScopeGuard = cxx::makeScopedStatic(m_rouDiComponents, m_config);
+        const auto startOfRouDiCreation = std::chrono::steady_clock::now();
 
         static cxx::optional<RouDi> roudi;
         auto roudiScopeGuard =
@@ -48,6 +53,12 @@ uint8_t IceOryxRouDiApp::run() noexcept
                                                                 RouDi::RuntimeMessagesThreadStart::IMMEDIATE,
                                                                 m_compatibilityCheckLevel,
                                                                 m_processKillDelay});
+        const auto endOfStartup = std::chrono::steady_clock::now();
+        LogInfo() << "Startup phase 'creation of the RouDi components' took "
+                  << units::Duration(startOfRouDiCreation - startOfStartup).toMilliseconds() << " ms";
+        LogInfo() << "Startup phase 'start of RouDi' took "
+                  << units::Duration(endOfStartup - startOfRouDiCreation).toMilliseconds() << " ms";
+        LogInfo() << "RouDi startup took " << units::Duration(endOfStartup - startOfStartup).toMilliseconds() << " ms";
         waitForSignal();
     }
     return EXIT_SUCCESS;
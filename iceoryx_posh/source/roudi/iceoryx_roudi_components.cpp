@@ -17,6 +17,8 @@
 #include "iceoryx_posh/roudi/iceoryx_roudi_components.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
 
+#include <chrono>
+
 namespace iox
 {
 namespace roudi
@@ -28,12 +30,19 @@ IceOryxRouDiComponents::IceOryxRouDiComponents(const RouDiConfig_t& roudiConfig)
         // and close it immediatelly
         // if there was an outdated roudi IPC channel, it will be cleaned up
         // if there is an outdated IPC channel, the start of the apps will be terminated
+        const auto startOfCleanup = std::chrono::steady_clock::now();
         runtime::IpcInterfaceBase::cleanupOutdatedIpcChannel(roudi::IPC_CHANNEL_ROUDI_NAME);
+        LogInfo() << "Startup phase 'cleanup of outdated IPC channel' took "
+                  << units::Duration(std::chrono::steady_clock::now() - startOfCleanup).toMilliseconds() << " ms";
 
+        const auto startOfMemoryCreation = std::chrono::steady_clock::now();
         rouDiMemoryManager.createAndAnnounceMemory().or_else([](RouDiMemoryManagerError error) {
             LogFatal() << "Could not create SharedMemory! Error: " << error;
             errorHandler(Error::kROUDI_COMPONENTS__SHARED_MEMORY_UNAVAILABLE, nullptr, iox::ErrorLevel::FATAL);
         });
+        LogInfo() << "Startup phase 'creation of the shared memory' took "
+                  << units::Duration(std::chrono::steady_clock::now() - startOfMemoryCreation).toMilliseconds()
+                  << " ms";
         return &rouDiMemoryManager;
     }())
 {
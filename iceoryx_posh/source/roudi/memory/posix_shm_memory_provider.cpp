@@ -30,10 +30,12 @@ namespace roudi
 {
 PosixShmMemoryProvider::PosixShmMemoryProvider(const ShmName_t& shmName,
                                                const posix::AccessMode accessMode,
-                                               const posix::OpenMode openMode) noexcept
+                                               const posix::OpenMode openMode,
+                                               const posix::PagingOptions pagingOptions) noexcept
     : m_shmName(shmName)
     , m_accessMode(accessMode)
     , m_openMode(openMode)
+    , m_pagingOptions(pagingOptions)
 {
 }
 
@@ -53,7 +55,13 @@ cxx::expected<void*, MemoryProviderError> PosixShmMemoryProvider::createMemory(c
         return cxx::error<MemoryProviderError>(MemoryProviderError::MEMORY_ALIGNMENT_EXCEEDS_PAGE_SIZE);
     }
 
-    posix::SharedMemoryObject::create(m_shmName, size, m_accessMode, m_openMode, nullptr)
+    posix::SharedMemoryObject::create(m_shmName,
+                                      size,
+                                      m_accessMode,
+                                      m_openMode,
+                                      nullptr,
+                                      S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP,
+                                      m_pagingOptions)
         .and_then([this](auto& sharedMemoryObject) {
             sharedMemoryObject.finalizeAllocation();
             m_shmObject.emplace(std::move(sharedMemoryObject));
@@ -21,6 +21,8 @@
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/roudi/memory/memory_provider.hpp"
 
+#include <chrono>
+
 namespace iox
 {
 namespace roudi
@@ -71,6 +73,7 @@ cxx::expected<RouDiMemoryManagerError> RouDiMemoryManager::createAndAnnounceMemo
 
     for (auto memoryProvider : m_memoryProvider)
     {
+        const auto startOfCreation = std::chrono::steady_clock::now();
         auto result = memoryProvider->create();
         if (result.has_error())
         {
@@ -78,12 +81,17 @@ cxx::expected<RouDiMemoryManagerError> RouDiMemoryManager::createAndAnnounceMemo
                        << MemoryProvider::getErrorString(result.get_error());
             return cxx::error<RouDiMemoryManagerError>(RouDiMemoryManagerError::MEMORY_CREATION_FAILED);
         }
+        LogInfo() << "Created " << memoryProvider->size() << " bytes of memory in "
+                  << units::Duration(std::chrono::steady_clock::now() - startOfCreation).toMilliseconds() << " ms";
     }
 
+    const auto startOfAnnouncement = std::chrono::steady_clock::now();
     for (auto memoryProvider : m_memoryProvider)
     {
         memoryProvider->announceMemoryAvailable();
     }
+    LogInfo() << "Initialized the memory blocks in "
+              << units::Duration(std::chrono::steady_clock::now() - startOfAnnouncement).toMilliseconds() << " ms";
 
     return cxx::success<>();
 }
@@ -20,6 +20,7 @@
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/log/posh_logging.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_listener.hpp"
 #include "iceoryx_posh/popo/publisher_options.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/runtime/node.hpp"
@@ -122,6 +123,10 @@ void PortManager::doDiscovery() noexcept
 
     handleSubscriberPorts();
 
+    handleClientPorts();
+
+    handleServerPorts();
+
     handleApplications();
 
     handleInterfaces();
@@ -131,20 +136,65 @@ void PortManager::doDiscovery() noexcept
     handleConditionVariables();
 }
 
+bool PortManager::waitForDiscoveryNotification(const units::Duration timeout) noexcept
+{
+    return popo::DiscoveryListener(m_portPool->discoveryNotificationData()).timedWait(timeout);
+}
+
+void PortManager::doDiscoveryForNotifiedPorts() noexcept
+{
+    // the notifier indices are ordered like the port types in doDiscovery, therefore the publishers are handled
+    // before the subscribers, clients and servers
+    popo::DiscoveryListener(m_portPool->discoveryNotificationData())
+        .takeNotifications([this](const uint64_t notifierIndex) {
+            auto publisherPortData = m_portPool->getPublisherPortDataOfDiscoveryNotifier(notifierIndex);
+            if (publisherPortData != nullptr)
+            {
+                handlePublisherPort(publisherPortData);
+                return;
+            }
+
+            auto subscriberPortData = m_portPool->getSubscriberPortDataOfDiscoveryNotifier(notifierIndex);
+            if (subscriberPortData != nullptr)
+            {
+                handleSubscriberPort(subscriberPortData);
+                return;
+            }
+
+            auto clientPortData = m_portPool->getClientPortDataOfDiscoveryNotifier(notifierIndex);
+            if (clientPortData != nullptr)
+            {
+                handleClientPort(clientPortData);
+                return;
+            }
+
+            auto serverPortData = m_portPool->getServerPortDataOfDiscoveryNotifier(notifierIndex);
+            if (serverPortData != nullptr)
+            {
+                handleServerPort(serverPortData);
+            }
+        });
+}
+
 void PortManager::handlePublisherPorts() noexcept
 {
     // get the changes of publisher port offer state
     for (auto publisherPortData : m_portPool->getPublisherPortDataList())
     {
-        PublisherPortRouDiType publisherPort(publisherPortData);
+        handlePublisherPort(publisherPortData);
+    }
+}
 
-        doDiscoveryForPublisherPort(publisherPort);
+void PortManager::handlePublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept
+{
+    PublisherPortRouDiType publisherPort(publisherPortData);
 
-        // check if we have to destroy this publisher port
-        if (publisherPort.toBeDestroyed())
-        {
-            destroyPublisherPort(publisherPortData);
-        }
+    doDiscoveryForPublisherPort(publisherPort);
+
+    // check if we have to destroy this publisher port
+    if (publisherPort.toBeDestroyed())
+    {
+        destroyPublisherPort(publisherPortData);
     }
 }
 
@@ -179,15 +229,20 @@ void PortManager::handleSubscriberPorts() noexcept
     // get requests for change of subscription state of subscribers
     for (auto subscriberPortData : m_portPool->getSubscriberPortDataList())
     {
-        SubscriberPortType subscriberPort(subscriberPortData);
+        handleSubscriberPort(subscriberPortData);
+    }
+}
 
-        doDiscoveryForSubscriberPort(subscriberPort);
+void PortManager::handleSubscriberPort(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept
+{
+    SubscriberPortType subscriberPort(subscriberPortData);
 
-        // check if we have to destroy this subscriber port
-        if (subscriberPort.toBeDestroyed())
-        {
-            destroySubscriberPort(subscriberPortData);
-        }
+    doDiscoveryForSubscriberPort(subscriberPort);
+
+    // check if we have to destroy this subscriber port
+    if (subscriberPort.toBeDestroyed())
+    {
+        destroySubscriberPort(subscriberPortData);
     }
 }
 
@@ -219,6 +274,93 @@ void PortManager::doDiscoveryForSubscriberPort(SubscriberPortType& subscriberPor
     });
 }
 
+void PortManager::handleClientPorts() noexcept
+{
+    // get requests for change of connection state of clients
+    for (auto clientPortData : m_portPool->getClientPortDataList())
+    {
+        handleClientPort(clientPortData);
+    }
+}
+
+void PortManager::handleClientPort(popo::ClientPortData* const clientPortData) noexcept
+{
+    popo::ClientPortRouDi clientPort(*clientPortData);
+
+    doDiscoveryForClientPort(clientPort);
+
+    // check if we have to destroy this client port
+    if (clientPort.toBeDestroyed())
+    {
+        destroyClientPort(clientPortData);
+    }
+}
+
+void PortManager::doDiscoveryForClientPort(popo::ClientPortRouDi& clientPort) noexcept
+{
+    clientPort.tryGetCaProMessage().and_then([this, &clientPort](auto caproMessage) {
+        cxx::Expects(caproMessage.m_serviceDescription.isValid() && "invalid service description!");
+        if ((capro::CaproMessageType::CONNECT == caproMessage.m_type)
+            || (capro::CaproMessageType::DISCONNECT == caproMessage.m_type))
+        {
+            if (!this->sendToMatchingServerPorts(caproMessage, clientPort))
+            {
+                LogDebug() << "capro::CONNECT/DISCONNECT, no matching server!!";
+                capro::CaproMessage nackMessage(capro::CaproMessageType::NACK,
+                                                clientPort.getCaProServiceDescription());
+                auto returnMessage = clientPort.dispatchCaProMessageAndGetPossibleResponse(nackMessage);
+                // No response on NACK messages
+                cxx::Ensures(!returnMessage.has_value());
+            }
+        }
+        else
+        {
+            // protocol error
+            errorHandler(
+                Error::kPORT_MANAGER__HANDLE_CLIENT_PORTS_INVALID_CAPRO_MESSAGE, nullptr, iox::ErrorLevel::MODERATE);
+        }
+    });
+}
+
+void PortManager::handleServerPorts() noexcept
+{
+    // get the changes of server port offer state
+    for (auto serverPortData : m_portPool->getServerPortDataList())
+    {
+        handleServerPort(serverPortData);
+    }
+}
+
+void PortManager::handleServerPort(popo::ServerPortData* const serverPortData) noexcept
+{
+    popo::ServerPortRouDi serverPort(serverPortData);
+
+    doDiscoveryForServerPort(serverPort);
+
+    // check if we have to destroy this server port
+    if (serverPort.toBeDestroyed())
+    {
+        destroyServerPort(serverPortData);
+    }
+}
+
+void PortManager::doDiscoveryForServerPort(popo::ServerPortRouDi& serverPort) noexcept
+{
+    serverPort.tryGetCaProMessage().and_then([this, &serverPort](auto caproMessage) {
+        cxx::Expects(caproMessage.m_serviceDescription.isValid() && "invalid service description!");
+        if ((capro::CaproMessageType::OFFER == caproMessage.m_type)
+            || (capro::CaproMessageType::STOP_OFFER == caproMessage.m_type))
+        {
+            this->sendToAllMatchingClientPorts(caproMessage, serverPort);
+        }
+        else
+        {
+            // protocol error
+            errorHandler(
+                Error::kPORT_MANAGER__HANDLE_SERVER_PORTS_INVALID_CAPRO_MESSAGE, nullptr, iox::ErrorLevel::MODERATE);
+        }
+    });
+}
 
 void PortManager::handleInterfaces() noexcept
 {
@@ -362,7 +504,13 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
                                                   SubscriberPortType& subscriberSource) noexcept
 {
     bool publisherFound = false;
-    for (auto publisherPortData : m_portPool->getPublisherPortDataList())
+    auto publishers = m_publishersOfService.find(subscriberSource.getCaProServiceDescription());
+    if (publishers == m_publishersOfService.end())
+    {
+        return publisherFound;
+    }
+
+    for (auto publisherPortData : publishers->second)
     {
         PublisherPortRouDiType publisherPort(publisherPortData);
 
@@ -373,12 +521,11 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
         // they do not have the same interface otherwise we have cyclic connections in gateways
         if (publisherInterface != capro::Interfaces::INTERNAL && publisherInterface == messageInterface)
         {
-            break;
+            continue;
         }
 
-        if (subscriberSource.getCaProServiceDescription() == publisherPort.getCaProServiceDescription()
-            && !(publisherPort.getSubscriberTooSlowPolicy() == popo::SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA
-                 && subscriberSource.getQueueFullPolicy() == popo::QueueFullPolicy::BLOCK_PUBLISHER))
+        if (!(publisherPort.getSubscriberTooSlowPolicy() == popo::SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA
+              && subscriberSource.getQueueFullPolicy() == popo::QueueFullPolicy::BLOCK_PUBLISHER))
         {
             auto publisherResponse = publisherPort.dispatchCaProMessageAndGetPossibleResponse(message);
             if (publisherResponse.has_value())
@@ -402,7 +549,13 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
 void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& message,
                                                    PublisherPortRouDiType& publisherSource) noexcept
 {
-    for (auto subscriberPortData : m_portPool->getSubscriberPortDataList())
+    auto subscribers = m_subscribersOfService.find(publisherSource.getCaProServiceDescription());
+    if (subscribers == m_subscribersOfService.end())
+    {
+        return;
+    }
+
+    for (auto subscriberPortData : subscribers->second)
     {
         SubscriberPortType subscriberPort(subscriberPortData);
 
@@ -413,12 +566,11 @@ void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& me
         // they do not have the same interface otherwise we have cyclic connections in gateways
         if (subscriberInterface != capro::Interfaces::INTERNAL && subscriberInterface == messageInterface)
         {
-            break;
+            continue;
         }
 
-        if (subscriberPort.getCaProServiceDescription() == publisherSource.getCaProServiceDescription()
-            && !(publisherSource.getSubscriberTooSlowPolicy() == popo::SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA
-                 && subscriberPort.getQueueFullPolicy() == popo::QueueFullPolicy::BLOCK_PUBLISHER))
+        if (!(publisherSource.getSubscriberTooSlowPolicy() == popo::SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA
+              && subscriberPort.getQueueFullPolicy() == popo::QueueFullPolicy::BLOCK_PUBLISHER))
         {
             auto subscriberResponse = subscriberPort.dispatchCaProMessageAndGetPossibleResponse(message);
 
@@ -450,6 +602,78 @@ void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& me
     }
 }
 
+bool PortManager::sendToMatchingServerPorts(const capro::CaproMessage& message,
+                                            popo::ClientPortRouDi& clientSource) noexcept
+{
+    auto servers = m_serversOfService.find(clientSource.getCaProServiceDescription());
+    if (servers == m_serversOfService.end())
+    {
+        return false;
+    }
+
+    for (auto serverPortData : servers->second)
+    {
+        popo::ServerPortRouDi serverPort(serverPortData);
+
+        // a server which does not offer or which is not connected to the client responds with a NACK; the client
+        // expects only one response, therefore only the ACK is forwarded
+        auto serverResponse = serverPort.dispatchCaProMessageAndGetPossibleResponse(message);
+        if (serverResponse.has_value() && serverResponse->m_type == capro::CaproMessageType::ACK)
+        {
+            auto returnMessage = clientSource.dispatchCaProMessageAndGetPossibleResponse(serverResponse.value());
+
+            // ACK is sent back to the client port, no further response from this one expected
+            cxx::Ensures(!returnMessage.has_value());
+            return true;
+        }
+    }
+    return false;
+}
+
+void PortManager::sendToAllMatchingClientPorts(const capro::CaproMessage& message,
+                                               popo::ServerPortRouDi& serverSource) noexcept
+{
+    auto clients = m_clientsOfService.find(serverSource.getCaProServiceDescription());
+    if (clients == m_clientsOfService.end())
+    {
+        return;
+    }
+
+    for (auto clientPortData : clients->second)
+    {
+        // the connection state decides whether the client is affected by the offer state of the server; the client
+        // port handles the STOP_OFFER only in the connected state and reacts on the OFFER when it waits for one
+        const auto connectionState = clientPortData->m_connectionState.load(std::memory_order_relaxed);
+        const bool isAffected =
+            (capro::CaproMessageType::OFFER == message.m_type && connectionState == ConnectionState::WAIT_FOR_OFFER)
+            || (capro::CaproMessageType::STOP_OFFER == message.m_type && connectionState == ConnectionState::CONNECTED);
+        if (!isAffected)
+        {
+            continue;
+        }
+
+        popo::ClientPortRouDi clientPort(*clientPortData);
+        auto clientResponse = clientPort.dispatchCaProMessageAndGetPossibleResponse(message);
+
+        // if the client reacts on the change, process it immediately on server side
+        if (clientResponse.has_value())
+        {
+            // we only expect a CONNECT as reaction on OFFER
+            cxx::Expects(capro::CaproMessageType::OFFER == message.m_type);
+
+            auto serverResponse = serverSource.dispatchCaProMessageAndGetPossibleResponse(clientResponse.value());
+            if (serverResponse.has_value())
+            {
+                // send response to client port
+                auto returnMessage = clientPort.dispatchCaProMessageAndGetPossibleResponse(serverResponse.value());
+
+                // ACK or NACK are sent back to the client port, no further response from this one expected
+                cxx::Ensures(!returnMessage.has_value());
+            }
+        }
+    }
+}
+
 void PortManager::sendToAllMatchingInterfacePorts(const capro::CaproMessage& message) noexcept
 {
     for (auto interfacePortData : m_portPool->getInterfacePortDataList())
@@ -475,11 +699,32 @@ void PortManager::unblockProcessShutdown(const RuntimeName_t& runtimeName) noexc
             doDiscoveryForPublisherPort(publisherPort);
         }
     }
+
+    for (auto port : m_portPool->getServerPortDataList())
+    {
+        popo::ServerPortRouDi serverPort(port);
+        if (runtimeName == serverPort.getRuntimeName())
+        {
+            port->m_offeringRequested.store(false, std::memory_order_relaxed);
+            doDiscoveryForServerPort(serverPort);
+        }
+    }
+
+    for (auto port : m_portPool->getClientPortDataList())
+    {
+        popo::ClientPortRouDi clientPort(*port);
+        if (runtimeName == clientPort.getRuntimeName())
+        {
+            port->m_connectRequested.store(false, std::memory_order_relaxed);
+            doDiscoveryForClientPort(clientPort);
+        }
+    }
 }
 
 void PortManager::unblockRouDiShutdown() noexcept
 {
     makeAllPublisherPortsToStopOffer();
+    makeAllServerPortsToStopOffer();
 }
 
 void PortManager::makeAllPublisherPortsToStopOffer() noexcept
@@ -493,6 +738,17 @@ void PortManager::makeAllPublisherPortsToStopOffer() noexcept
     }
 }
 
+void PortManager::makeAllServerPortsToStopOffer() noexcept
+{
+    for (auto port : m_portPool->getServerPortDataList())
+    {
+        port->m_offeringRequested.store(false, std::memory_order_relaxed);
+
+        popo::ServerPortRouDi serverPort(port);
+        doDiscoveryForServerPort(serverPort);
+    }
+}
+
 void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcept
 {
     for (auto port : m_portPool->getPublisherPortDataList())
@@ -513,6 +769,24 @@ void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcep
         }
     }
 
+    for (auto port : m_portPool->getClientPortDataList())
+    {
+        popo::ClientPortRouDi client(*port);
+        if (runtimeName == client.getRuntimeName())
+        {
+            destroyClientPort(port);
+        }
+    }
+
+    for (auto port : m_portPool->getServerPortDataList())
+    {
+        popo::ServerPortRouDi server(port);
+        if (runtimeName == server.getRuntimeName())
+        {
+            destroyServerPort(port);
+        }
+    }
+
     for (auto port : m_portPool->getInterfacePortDataList())
     {
         popo::InterfacePort interface(port);
@@ -574,6 +848,7 @@ void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* con
     m_portIntrospection.removePublisher(publisherPortUser);
 
     // delete publisher port from list after STOP_OFFER was processed
+    removeFromServiceIndex(m_publishersOfService, publisherPortData);
     m_portPool->removePublisherPort(publisherPortData);
 
     LogDebug() << "Destroyed publisher port";
@@ -598,11 +873,50 @@ void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const
 
     m_portIntrospection.removeSubscriber(subscriberPortUser);
     // delete subscriber port from list after UNSUB was processed
+    removeFromServiceIndex(m_subscribersOfService, subscriberPortData);
     m_portPool->removeSubscriberPort(subscriberPortData);
 
     LogDebug() << "Destroyed subscriber port";
 }
 
+void PortManager::destroyClientPort(popo::ClientPortData* const clientPortData) noexcept
+{
+    // create temporary client ports to orderly shut this client down
+    popo::ClientPortRouDi clientPortRoudi(*clientPortData);
+    popo::ClientPortUser clientPortUser(*clientPortData);
+
+    clientPortRoudi.releaseAllChunks();
+    clientPortUser.disconnect();
+
+    // process DISCONNECT for this client in RouDi and distribute it
+    doDiscoveryForClientPort(clientPortRoudi);
+
+    // delete client port from list after DISCONNECT was processed
+    removeFromServiceIndex(m_clientsOfService, clientPortData);
+    m_portPool->removeClientPort(clientPortData);
+
+    LogDebug() << "Destroyed client port";
+}
+
+void PortManager::destroyServerPort(popo::ServerPortData* const serverPortData) noexcept
+{
+    // create temporary server ports to orderly shut this server down
+    popo::ServerPortRouDi serverPortRoudi(serverPortData);
+    popo::ServerPortUser serverPortUser(serverPortData);
+
+    serverPortRoudi.releaseAllChunks();
+    serverPortUser.stopOffer();
+
+    // process STOP_OFFER for this server in RouDi and distribute it
+    doDiscoveryForServerPort(serverPortRoudi);
+
+    // delete server port from list after STOP_OFFER was processed
+    removeFromServiceIndex(m_serversOfService, serverPortData);
+    m_portPool->removeServerPort(serverPortData);
+
+    LogDebug() << "Destroyed server port";
+}
+
 runtime::IpcMessage PortManager::findService(const capro::IdString_t& service,
                                              const capro::IdString_t& instance) noexcept
 {
@@ -664,6 +978,7 @@ PortManager::acquirePublisherPortData(const capro::ServiceDescription& service,
         auto publisherPortData = maybePublisherPortData.value();
         if (publisherPortData)
         {
+            addToServiceIndex(m_publishersOfService, publisherPortData);
             m_portIntrospection.addPublisher(*publisherPortData);
 
             // we do discovery here for trying to connect the waiting subscribers if offer on create is desired
@@ -693,6 +1008,7 @@ PortManager::acquireSubscriberPortData(const capro::ServiceDescription& service,
         auto subscriberPortData = maybeSubscriberPortData.value();
         if (subscriberPortData)
         {
+            addToServiceIndex(m_subscribersOfService, subscriberPortData);
             m_portIntrospection.addSubscriber(*subscriberPortData);
 
             // we do discovery here for trying to connect with publishers if subscribe on create is desired
@@ -704,6 +1020,82 @@ PortManager::acquireSubscriberPortData(const capro::ServiceDescription& service,
     return maybeSubscriberPortData;
 }
 
+cxx::expected<popo::ClientPortData*, PortPoolError>
+PortManager::acquireClientPortData(const capro::ServiceDescription& service,
+                                   const popo::ClientOptions& clientOptions,
+                                   const RuntimeName_t& runtimeName,
+                                   mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
+                                   const PortConfigInfo& portConfigInfo) noexcept
+{
+    if (!service.isValid())
+    {
+        return cxx::error<PortPoolError>(PortPoolError::SERVICE_DESCRIPTION_INVALID);
+    }
+
+    auto maybeClientPortData = m_portPool->addClientPort(
+        service, payloadDataSegmentMemoryManager, runtimeName, clientOptions, portConfigInfo.memoryInfo);
+    if (!maybeClientPortData.has_error())
+    {
+        auto clientPortData = maybeClientPortData.value();
+        if (clientPortData)
+        {
+            addToServiceIndex(m_clientsOfService, clientPortData);
+
+            // we do discovery here for trying to connect with the server if connect on create is desired
+            popo::ClientPortRouDi clientPort(*clientPortData);
+            doDiscoveryForClientPort(clientPort);
+        }
+    }
+
+    return maybeClientPortData;
+}
+
+cxx::expected<popo::ServerPortData*, PortPoolError>
+PortManager::acquireServerPortData(const capro::ServiceDescription& service,
+                                   const popo::ServerOptions& serverOptions,
+                                   const RuntimeName_t& runtimeName,
+                                   mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
+                                   const PortConfigInfo& portConfigInfo) noexcept
+{
+    if (!service.isValid())
+    {
+        return cxx::error<PortPoolError>(PortPoolError::SERVICE_DESCRIPTION_INVALID);
+    }
+
+    auto servers = m_serversOfService.find(service);
+    if (servers != m_serversOfService.end())
+    {
+        for (auto serverPortData : servers->second)
+        {
+            popo::ServerPortRouDi serverPort(serverPortData);
+            if (!serverPort.toBeDestroyed())
+            {
+                LogWarn() << "Process '" << runtimeName
+                          << "' requests a ServerPort which is already used by '" << serverPort.getRuntimeName()
+                          << "' with service '" << service.operator cxx::Serialization().toString() << "'.";
+                errorHandler(Error::kPOSH__PORT_MANAGER_SERVERPORT_NOT_UNIQUE, nullptr, ErrorLevel::MODERATE);
+                return cxx::error<PortPoolError>(PortPoolError::UNIQUE_SERVER_PORT_ALREADY_EXISTS);
+            }
+        }
+    }
+
+    auto maybeServerPortData = m_portPool->addServerPort(
+        service, payloadDataSegmentMemoryManager, runtimeName, serverOptions, portConfigInfo.memoryInfo);
+    if (!maybeServerPortData.has_error())
+    {
+        auto serverPortData = maybeServerPortData.value();
+        if (serverPortData)
+        {
+            addToServiceIndex(m_serversOfService, serverPortData);
+
+            // we do discovery here for trying to connect the waiting clients if offer on create is desired
+            popo::ServerPortRouDi serverPort(serverPortData);
+            doDiscoveryForServerPort(serverPort);
+        }
+    }
+
+    return maybeServerPortData;
+}
 
 /// @todo return a cxx::expected
 popo::InterfacePortData* PortManager::acquireInterfacePortData(capro::Interfaces interface,
@@ -23,6 +23,10 @@ namespace iox
 {
 namespace roudi
 {
+constexpr uint64_t PortPool::FIRST_SUBSCRIBER_DISCOVERY_NOTIFIER_INDEX;
+constexpr uint64_t PortPool::FIRST_CLIENT_DISCOVERY_NOTIFIER_INDEX;
+constexpr uint64_t PortPool::FIRST_SERVER_DISCOVERY_NOTIFIER_INDEX;
+
 PortPool::PortPool(PortPoolData& portPoolData) noexcept
     : m_portPoolData(&portPoolData)
 {
@@ -156,6 +160,7 @@ PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
     {
         auto publisherPortData = m_portPoolData->m_publisherPortMembers.insert(
             serviceDescription, runtimeName, memoryManager, publisherOptions, memoryInfo);
+        setDiscoveryNotifier(*publisherPortData, m_portPoolData->m_publisherPortMembers.indexOf(publisherPortData));
         return cxx::success<PublisherPortRouDiType::MemberType_t*>(publisherPortData);
     }
     else
@@ -175,6 +180,9 @@ PortPool::addSubscriberPort(const capro::ServiceDescription& serviceDescription,
     {
         auto subscriberPortData = constructSubscriber<iox::build::CommunicationPolicy>(
             serviceDescription, runtimeName, subscriberOptions, memoryInfo);
+        setDiscoveryNotifier(*subscriberPortData,
+                             FIRST_SUBSCRIBER_DISCOVERY_NOTIFIER_INDEX
+                                 + m_portPoolData->m_subscriberPortMembers.indexOf(subscriberPortData));
 
         return cxx::success<SubscriberPortType::MemberType_t*>(subscriberPortData);
     }
@@ -185,6 +193,62 @@ PortPool::addSubscriberPort(const capro::ServiceDescription& serviceDescription,
     }
 }
 
+cxx::vector<popo::ClientPortData*, MAX_CLIENTS> PortPool::getClientPortDataList() noexcept
+{
+    return m_portPoolData->m_clientPortMembers.content();
+}
+
+cxx::vector<popo::ServerPortData*, MAX_SERVERS> PortPool::getServerPortDataList() noexcept
+{
+    return m_portPoolData->m_serverPortMembers.content();
+}
+
+cxx::expected<popo::ClientPortData*, PortPoolError>
+PortPool::addClientPort(const capro::ServiceDescription& serviceDescription,
+                        mepoo::MemoryManager* const memoryManager,
+                        const RuntimeName_t& runtimeName,
+                        const popo::ClientOptions& clientOptions,
+                        const mepoo::MemoryInfo& memoryInfo) noexcept
+{
+    if (m_portPoolData->m_clientPortMembers.hasFreeSpace())
+    {
+        auto clientPortData = m_portPoolData->m_clientPortMembers.insert(
+            serviceDescription, runtimeName, clientOptions, memoryManager, memoryInfo);
+        setDiscoveryNotifier(*clientPortData,
+                             FIRST_CLIENT_DISCOVERY_NOTIFIER_INDEX
+                                 + m_portPoolData->m_clientPortMembers.indexOf(clientPortData));
+        return cxx::success<popo::ClientPortData*>(clientPortData);
+    }
+    else
+    {
+        errorHandler(Error::kPORT_POOL__CLIENTLIST_OVERFLOW, nullptr, ErrorLevel::MODERATE);
+        return cxx::error<PortPoolError>(PortPoolError::CLIENT_PORT_LIST_FULL);
+    }
+}
+
+cxx::expected<popo::ServerPortData*, PortPoolError>
+PortPool::addServerPort(const capro::ServiceDescription& serviceDescription,
+                        mepoo::MemoryManager* const memoryManager,
+                        const RuntimeName_t& runtimeName,
+                        const popo::ServerOptions& serverOptions,
+                        const mepoo::MemoryInfo& memoryInfo) noexcept
+{
+    if (m_portPoolData->m_serverPortMembers.hasFreeSpace())
+    {
+        auto serverPortData = m_portPoolData->m_serverPortMembers.insert(
+            serviceDescription, runtimeName, serverOptions, memoryManager, memoryInfo);
+        setDiscoveryNotifier(*serverPortData,
+                             FIRST_SERVER_DISCOVERY_NOTIFIER_INDEX
+                                 + m_portPoolData->m_serverPortMembers.indexOf(serverPortData));
+        return cxx::success<popo::ServerPortData*>(serverPortData);
+    }
+    else
+    {
+        errorHandler(Error::kPORT_POOL__SERVERLIST_OVERFLOW, nullptr, ErrorLevel::MODERATE);
+        return cxx::error<PortPoolError>(PortPoolError::SERVER_PORT_LIST_FULL);
+    }
+}
+
 void PortPool::removePublisherPort(PublisherPortRouDiType::MemberType_t* const portData) noexcept
 {
     m_portPoolData->m_publisherPortMembers.erase(portData);
@@ -195,5 +259,62 @@ void PortPool::removeSubscriberPort(SubscriberPortType::MemberType_t* const port
     m_portPoolData->m_subscriberPortMembers.erase(portData);
 }
 
+void PortPool::removeClientPort(popo::ClientPortData* const portData) noexcept
+{
+    m_portPoolData->m_clientPortMembers.erase(portData);
+}
+
+void PortPool::removeServerPort(popo::ServerPortData* const portData) noexcept
+{
+    m_portPoolData->m_serverPortMembers.erase(portData);
+}
+
+popo::DiscoveryNotificationData& PortPool::discoveryNotificationData() noexcept
+{
+    return m_portPoolData->m_discoveryNotificationData;
+}
+
+PublisherPortRouDiType::MemberType_t* PortPool::getPublisherPortDataOfDiscoveryNotifier(const uint64_t index) noexcept
+{
+    if (index >= FIRST_SUBSCRIBER_DISCOVERY_NOTIFIER_INDEX)
+    {
+        return nullptr;
+    }
+    return m_portPoolData->m_publisherPortMembers.get(index);
+}
+
+SubscriberPortType::MemberType_t* PortPool::getSubscriberPortDataOfDiscoveryNotifier(const uint64_t index) noexcept
+{
+    if (index < FIRST_SUBSCRIBER_DISCOVERY_NOTIFIER_INDEX || index >= FIRST_CLIENT_DISCOVERY_NOTIFIER_INDEX)
+    {
+        return nullptr;
+    }
+    return m_portPoolData->m_subscriberPortMembers.get(index - FIRST_SUBSCRIBER_DISCOVERY_NOTIFIER_INDEX);
+}
+
+popo::ClientPortData* PortPool::getClientPortDataOfDiscoveryNotifier(const uint64_t index) noexcept
+{
+    if (index < FIRST_CLIENT_DISCOVERY_NOTIFIER_INDEX || index >= FIRST_SERVER_DISCOVERY_NOTIFIER_INDEX)
+    {
+        return nullptr;
+    }
+    return m_portPoolData->m_clientPortMembers.get(index - FIRST_CLIENT_DISCOVERY_NOTIFIER_INDEX);
+}
+
+popo::ServerPortData* PortPool::getServerPortDataOfDiscoveryNotifier(const uint64_t index) noexcept
+{
+    if (index < FIRST_SERVER_DISCOVERY_NOTIFIER_INDEX)
+    {
+        return nullptr;
+    }
+    return m_portPoolData->m_serverPortMembers.get(index - FIRST_SERVER_DISCOVERY_NOTIFIER_INDEX);
+}
+
+void PortPool::setDiscoveryNotifier(popo::BasePortData& portData, const uint64_t notifierIndex) noexcept
+{
+    portData.m_discoveryNotificationData = &m_portPoolData->m_discoveryNotificationData;
+    portData.m_discoveryNotifierIndex = notifierIndex;
+}
+
 } // namespace roudi
 } // namespace iox
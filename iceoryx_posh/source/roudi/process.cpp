@@ -66,12 +66,12 @@ uint64_t Process::getSessionId() noexcept
 
 void Process::setTimestamp(const mepoo::TimePointNs_t timestamp) noexcept
 {
-    m_timestamp = timestamp;
+    m_timestamp.store(timestamp, std::memory_order_relaxed);
 }
 
 mepoo::TimePointNs_t Process::getTimestamp() noexcept
 {
-    return m_timestamp;
+    return m_timestamp.load(std::memory_order_relaxed);
 }
 
 posix::PosixUser Process::getUser() const noexcept
@@ -84,5 +84,10 @@ bool Process::isMonitored() const noexcept
     return m_isMonitored;
 }
 
+std::mutex& Process::getMutex() noexcept
+{
+    return m_mutex;
+}
+
 } // namespace roudi
 } // namespace iox
@@ -84,7 +84,10 @@ void ProcessManager::handleProcessShutdownPreparationRequest(const RuntimeName_t
     searchForProcessAndThen(
         name,
         [&](Process& process) {
-            m_portManager.unblockProcessShutdown(name);
+            {
+                std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+                m_portManager.unblockProcessShutdown(name);
+            }
             // Reply with PREPARE_APP_TERMINATION_ACK and let process shutdown
             runtime::IpcMessage sendBuffer;
             sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::PREPARE_APP_TERMINATION_ACK);
@@ -95,18 +98,23 @@ void ProcessManager::handleProcessShutdownPreparationRequest(const RuntimeName_t
 
 void ProcessManager::requestShutdownOfAllProcesses() noexcept
 {
-    // send SIG_TERM to all running applications and wait for processes to answer with TERMINATION
-    for (auto& process : m_processList)
     {
-        requestShutdownOfProcess(process, ShutdownPolicy::SIG_TERM);
+        std::lock_guard<std::mutex> processListLock(m_processListMutex);
+        // send SIG_TERM to all running applications and wait for processes to answer with TERMINATION
+        for (auto& process : m_processList)
+        {
+            requestShutdownOfProcess(process, ShutdownPolicy::SIG_TERM);
+        }
     }
 
     // this unblocks the RouDi shutdown if a publisher port is blocked by a full subscriber queue
+    std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
     m_portManager.unblockRouDiShutdown();
 }
 
 bool ProcessManager::isAnyRegisteredProcessStillRunning() noexcept
 {
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
     for (auto& process : m_processList)
     {
         if (isProcessAlive(process))
@@ -119,6 +127,7 @@ bool ProcessManager::isAnyRegisteredProcessStillRunning() noexcept
 
 void ProcessManager::killAllProcesses() noexcept
 {
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
     for (auto& process : m_processList)
     {
         LogWarn() << "Process ID " << process.getPid() << " named '" << process.getName()
@@ -129,12 +138,19 @@ void ProcessManager::killAllProcesses() noexcept
 
 void ProcessManager::printWarningForRegisteredProcessesAndClearProcessList() noexcept
 {
-    for (auto& process : m_processList)
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
+    auto processIter = m_processList.begin();
+    while (processIter != m_processList.end())
     {
-        LogWarn() << "Process ID " << process.getPid() << " named '" << process.getName()
+        LogWarn() << "Process ID " << processIter->getPid() << " named '" << processIter->getName()
                   << "' is still running after SIGKILL was sent. RouDi is ignoring this process.";
+        {
+            // the runtime message threads are still running; wait until a request of the process which is handled
+            // concurrently is finished, afterwards the process cannot be locked again without the process list lock
+            std::lock_guard<std::mutex> processLock(processIter->getMutex());
+        }
+        processIter = m_processList.erase(processIter);
     }
-    m_processList.clear();
 }
 
 bool ProcessManager::requestShutdownOfProcess(Process& process, ShutdownPolicy shutdownPolicy) noexcept
@@ -198,17 +214,20 @@ bool ProcessManager::registerProcess(const RuntimeName_t& name,
                                      const uint64_t sessionId,
                                      const version::VersionInfo& versionInfo) noexcept
 {
-    bool returnValue{false};
+    // the process list stays locked until the process is added, otherwise a concurrent registration with the same
+    // name could sneak in between the removal and the addition
+    std::unique_lock<std::mutex> processListLock(m_processListMutex);
 
-    searchForProcessAndThen(
-        name,
-        [&](Process& process) {
+    for (auto it = m_processList.begin(); it != m_processList.end(); ++it)
+    {
+        if (name == it->getName())
+        {
             // process is already in list (i.e. registered)
             // depending on the mode we clean up the process resources and register it again
             // if it is monitored, we reject the registration and wait for automatic cleanup
             // otherwise we remove the process ourselves and register it again
 
-            if (process.isMonitored())
+            if (it->isMonitored())
             {
                 LogWarn() << "Received register request, but termination of " << name << " not detected yet";
             }
@@ -218,26 +237,22 @@ bool ProcessManager::registerProcess(const RuntimeName_t& name,
 
             // remove the existing process and add the new process afterwards, we do not send ack to new process
             constexpr TerminationFeedback terminationFeedback{TerminationFeedback::DO_NOT_SEND_ACK_TO_PROCESS};
-            if (!searchForProcessAndRemoveIt(name, terminationFeedback))
+            if (!removeProcessAndDeleteRespectiveSharedMemoryObjects(it, terminationFeedback))
             {
                 LogWarn() << "Application " << name << " could not be removed";
-                return;
-            }
-            else
-            {
-                // try registration again, should succeed since removal was successful
-                returnValue = addProcess(name, pid, user, isMonitored, transmissionTimestamp, sessionId, versionInfo);
+                return false;
             }
-        },
-        [&]() {
-            // process does not exist in list and can be added
-            returnValue = addProcess(name, pid, user, isMonitored, transmissionTimestamp, sessionId, versionInfo);
-        });
+            LogDebug() << "Removed existing application " << name;
+            break; // we can assume there are no other processes with this name
+        }
+    }
 
-    return returnValue;
+    // process does not exist (anymore) in list and can be added
+    return addProcess(processListLock, name, pid, user, isMonitored, transmissionTimestamp, sessionId, versionInfo);
 }
 
-bool ProcessManager::addProcess(const RuntimeName_t& name,
+bool ProcessManager::addProcess(std::unique_lock<std::mutex>& processListLock,
+                                const RuntimeName_t& name,
                                 const uint32_t pid,
                                 const posix::PosixUser& user,
                                 const bool isMonitored,
@@ -261,6 +276,11 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
         return false;
     }
     m_processList.emplace_back(name, pid, user, isMonitored, sessionId);
+    auto& process = m_processList.back();
+
+    // the process is locked until the REG_ACK is sent, the process list is not needed anymore
+    std::lock_guard<std::mutex> processLock(process.getMutex());
+    processListLock.unlock();
 
     // send REG_ACK and BaseAddrString
     runtime::IpcMessage sendBuffer;
@@ -270,10 +290,10 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
                << m_roudiMemoryInterface.mgmtMemoryProvider()->size() << offset << transmissionTimestamp
                << m_mgmtSegmentId;
 
-    m_processList.back().sendViaIpcChannel(sendBuffer);
+    process.sendViaIpcChannel(sendBuffer);
 
     // set current timestamp again (already done in Process's constructor
-    m_processList.back().setTimestamp(mepoo::BaseClock_t::now());
+    process.setTimestamp(mepoo::BaseClock_t::now());
 
     m_processIntrospection->addProcess(static_cast<int>(pid), RuntimeName_t(cxx::TruncateToCapacity, name.c_str()));
 
@@ -294,6 +314,8 @@ bool ProcessManager::unregisterProcess(const RuntimeName_t& name) noexcept
 
 bool ProcessManager::searchForProcessAndRemoveIt(const RuntimeName_t& name, const TerminationFeedback feedback) noexcept
 {
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
+
     // we need to search for the process (currently linear search)
     auto it = m_processList.begin();
     while (it != m_processList.end())
@@ -317,15 +339,22 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
 {
     if (processIter != m_processList.end())
     {
-        m_portManager.deletePortsOfProcess(processIter->getName());
-        m_processIntrospection->removeProcess(static_cast<int32_t>(processIter->getPid()));
-
-        if (feedback == TerminationFeedback::SEND_ACK_TO_PROCESS)
         {
-            // Reply with TERMINATION_ACK and let process shutdown
-            runtime::IpcMessage sendBuffer;
-            sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::TERMINATION_ACK);
-            processIter->sendViaIpcChannel(sendBuffer);
+            // wait until a request of the process which is handled concurrently is finished
+            std::lock_guard<std::mutex> processLock(processIter->getMutex());
+            {
+                std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+                m_portManager.deletePortsOfProcess(processIter->getName());
+            }
+            m_processIntrospection->removeProcess(static_cast<int32_t>(processIter->getPid()));
+
+            if (feedback == TerminationFeedback::SEND_ACK_TO_PROCESS)
+            {
+                // Reply with TERMINATION_ACK and let process shutdown
+                runtime::IpcMessage sendBuffer;
+                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::TERMINATION_ACK);
+                processIter->sendViaIpcChannel(sendBuffer);
+            }
         }
 
         processIter = m_processList.erase(processIter); // delete application
@@ -352,7 +381,11 @@ void ProcessManager::findServiceForProcess(const RuntimeName_t& name,
     searchForProcessAndThen(
         name,
         [&](Process& process) {
-            process.sendViaIpcChannel({m_portManager.findService(service, instance)});
+            std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
+            auto sendBuffer = m_portManager.findService(service, instance);
+            portManagerLock.unlock();
+
+            process.sendViaIpcChannel(sendBuffer);
             LogDebug() << "Sent all found services to application " << name;
         },
         [&]() { LogWarn() << "Unknown process " << name << " requested to find services."; });
@@ -366,7 +399,9 @@ void ProcessManager::addInterfaceForProcess(const RuntimeName_t& name,
         name,
         [&](Process& process) {
             // create a ReceiverPort
+            std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
             popo::InterfacePortData* port = m_portManager.acquireInterfacePortData(interface, name, node);
+            portManagerLock.unlock();
 
             // send ReceiverPort to app as a serialized relative pointer
             auto offset = rp::BaseRelativePointer::getOffset(m_mgmtSegmentId, port);
@@ -387,8 +422,10 @@ void ProcessManager::sendServiceRegistryChangeCounterToProcess(const RuntimeName
         runtimeName,
         [&](Process& process) {
             // send counter to app as a serialized relative pointer
+            std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
             auto offset =
                 rp::BaseRelativePointer::getOffset(m_mgmtSegmentId, m_portManager.serviceRegistryChangeCounter());
+            portManagerLock.unlock();
 
             runtime::IpcMessage sendBuffer;
             sendBuffer << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
@@ -402,7 +439,9 @@ void ProcessManager::addApplicationForProcess(const RuntimeName_t& name) noexcep
     searchForProcessAndThen(
         name,
         [&](Process& process) {
+            std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
             popo::ApplicationPortData* port = m_portManager.acquireApplicationPortData(name);
+            portManagerLock.unlock();
 
             auto offset = rp::BaseRelativePointer::getOffset(m_mgmtSegmentId, port);
 
@@ -421,7 +460,11 @@ void ProcessManager::addNodeForProcess(const RuntimeName_t& runtimeName, const N
     searchForProcessAndThen(
         runtimeName,
         [&](Process& process) {
-            m_portManager.acquireNodeData(runtimeName, nodeName)
+            std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
+            auto maybeNodeData = m_portManager.acquireNodeData(runtimeName, nodeName);
+            portManagerLock.unlock();
+
+            maybeNodeData
                 .and_then([&](auto nodeData) {
                     auto offset = rp::BaseRelativePointer::getOffset(m_mgmtSegmentId, nodeData);
 
@@ -473,8 +516,10 @@ void ProcessManager::addSubscriberForProcess(const RuntimeName_t& name,
         name,
         [&](Process& process) {
             // create a SubscriberPort
+            std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
             auto maybeSubscriber =
                 m_portManager.acquireSubscriberPortData(service, subscriberOptions, name, portConfigInfo);
+            portManagerLock.unlock();
 
             if (!maybeSubscriber.has_error())
             {
@@ -508,10 +553,13 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
     searchForProcessAndThen(
         name,
         [&](Process& process) { // create a PublisherPort
+            std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
             auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process.getUser());
 
             if (!segmentInfo.m_memoryManager.has_value())
             {
+                portManagerLock.unlock();
+
                 // Tell the app no writable shared memory segment was found
                 runtime::IpcMessage sendBuffer;
                 sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
@@ -523,6 +571,7 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
 
             auto maybePublisher = m_portManager.acquirePublisherPortData(
                 service, publisherOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+            portManagerLock.unlock();
 
             if (!maybePublisher.has_error())
             {
@@ -551,12 +600,123 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
         [&]() { LogWarn() << "Unknown application " << name << " requested a PublisherPort."; });
 }
 
+void ProcessManager::addClientForProcess(const RuntimeName_t& name,
+                                         const capro::ServiceDescription& service,
+                                         const popo::ClientOptions& clientOptions,
+                                         const PortConfigInfo& portConfigInfo) noexcept
+{
+    searchForProcessAndThen(
+        name,
+        [&](Process& process) { // create a ClientPort
+            std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
+            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process.getUser());
+
+            if (!segmentInfo.m_memoryManager.has_value())
+            {
+                portManagerLock.unlock();
+
+                // Tell the app no writable shared memory segment was found
+                runtime::IpcMessage sendBuffer;
+                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
+                sendBuffer << runtime::IpcMessageErrorTypeToString(
+                    runtime::IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT);
+                process.sendViaIpcChannel(sendBuffer);
+                return;
+            }
+
+            auto maybeClient = m_portManager.acquireClientPortData(
+                service, clientOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+            portManagerLock.unlock();
+
+            if (!maybeClient.has_error())
+            {
+                // send ClientPort to app as a serialized relative pointer
+                auto offset = rp::BaseRelativePointer::getOffset(m_mgmtSegmentId, maybeClient.value());
+
+                runtime::IpcMessage sendBuffer;
+                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_CLIENT_ACK)
+                           << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
+                process.sendViaIpcChannel(sendBuffer);
+
+                LogDebug() << "Created new ClientPort for application " << name;
+            }
+            else
+            {
+                runtime::IpcMessage sendBuffer;
+                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
+                sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::CLIENT_LIST_FULL);
+                process.sendViaIpcChannel(sendBuffer);
+                LogError() << "Could not create ClientPort for application " << name;
+            }
+        },
+        [&]() { LogWarn() << "Unknown application " << name << " requested a ClientPort."; });
+}
+
+void ProcessManager::addServerForProcess(const RuntimeName_t& name,
+                                         const capro::ServiceDescription& service,
+                                         const popo::ServerOptions& serverOptions,
+                                         const PortConfigInfo& portConfigInfo) noexcept
+{
+    searchForProcessAndThen(
+        name,
+        [&](Process& process) { // create a ServerPort
+            std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
+            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process.getUser());
+
+            if (!segmentInfo.m_memoryManager.has_value())
+            {
+                portManagerLock.unlock();
+
+                // Tell the app no writable shared memory segment was found
+                runtime::IpcMessage sendBuffer;
+                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
+                sendBuffer << runtime::IpcMessageErrorTypeToString(
+                    runtime::IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT);
+                process.sendViaIpcChannel(sendBuffer);
+                return;
+            }
+
+            auto maybeServer = m_portManager.acquireServerPortData(
+                service, serverOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+            portManagerLock.unlock();
+
+            if (!maybeServer.has_error())
+            {
+                // send ServerPort to app as a serialized relative pointer
+                auto offset = rp::BaseRelativePointer::getOffset(m_mgmtSegmentId, maybeServer.value());
+
+                runtime::IpcMessage sendBuffer;
+                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SERVER_ACK)
+                           << cxx::convert::toString(offset) << cxx::convert::toString(m_mgmtSegmentId);
+                process.sendViaIpcChannel(sendBuffer);
+
+                LogDebug() << "Created new ServerPort for application " << name;
+            }
+            else
+            {
+                runtime::IpcMessage sendBuffer;
+                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
+                sendBuffer << runtime::IpcMessageErrorTypeToString( // map error codes
+                    (maybeServer.get_error() == PortPoolError::UNIQUE_SERVER_PORT_ALREADY_EXISTS
+                         ? runtime::IpcMessageErrorType::NO_UNIQUE_CREATED
+                         : runtime::IpcMessageErrorType::SERVER_LIST_FULL));
+                process.sendViaIpcChannel(sendBuffer);
+                LogError() << "Could not create ServerPort for application " << name;
+            }
+        },
+        [&]() { LogWarn() << "Unknown application " << name << " requested a ServerPort."; });
+}
+
 void ProcessManager::addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept
 {
     searchForProcessAndThen(
         runtimeName,
         [&](Process& process) { // Try to create a condition variable
-            m_portManager.acquireConditionVariableData(runtimeName)
+            std::unique_lock<std::mutex> portManagerLock(m_portManagerMutex);
+            auto maybeConditionVariable = m_portManager.acquireConditionVariableData(runtimeName);
+            portManagerLock.unlock();
+
+            maybeConditionVariable
                 .and_then([&](auto condVar) {
                     auto offset = rp::BaseRelativePointer::getOffset(m_mgmtSegmentId, condVar);
 
@@ -601,6 +761,7 @@ popo::PublisherPortData* ProcessManager::addIntrospectionPublisherPort(const cap
     popo::PublisherOptions options;
     options.historyCapacity = 1;
     options.nodeName = INTROSPECTION_NODE_NAME;
+    std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
     auto maybePublisher = m_portManager.acquirePublisherPortData(
         service, options, process_name, m_introspectionMemoryManager, PortConfigInfo());
 
@@ -617,6 +778,8 @@ bool ProcessManager::searchForProcessAndThen(const RuntimeName_t& name,
                                              cxx::function_ref<void(Process&)> AndThenCallable,
                                              cxx::function_ref<void()> OrElseCallable) noexcept
 {
+    std::unique_lock<std::mutex> processListLock(m_processListMutex);
+
     typename ProcessList_t::iterator it = m_processList.begin();
     const typename ProcessList_t::iterator itEnd = m_processList.end();
 
@@ -626,11 +789,17 @@ bool ProcessManager::searchForProcessAndThen(const RuntimeName_t& name,
         {
             if (AndThenCallable)
             {
+                // the process cannot be removed as long as it is locked, therefore the process list can be unlocked
+                std::lock_guard<std::mutex> processLock(it->getMutex());
+                processListLock.unlock();
+
                 AndThenCallable(*it);
                 return true;
             }
         }
     }
+    processListLock.unlock();
+
     if (OrElseCallable)
     {
         OrElseCallable();
@@ -642,6 +811,7 @@ void ProcessManager::monitorProcesses() noexcept
 {
     auto currentTimestamp = mepoo::BaseClock_t::now();
 
+    std::lock_guard<std::mutex> processListLock(m_processListMutex);
     auto processIterator = m_processList.begin();
     while (processIterator != m_processList.end())
     {
@@ -659,12 +829,20 @@ void ProcessManager::monitorProcesses() noexcept
                 // note: if we would want to use the removeProcess function, it would search for the process again
                 // (but we already found it and have an iterator to remove it)
 
-                // delete all associated subscriber and publisher ports in shared
-                // memory and the associated RouDi discovery ports
-                // @todo Check if ShmManager and Process Manager end up in unintended condition
-                m_portManager.deletePortsOfProcess(processIterator->getName());
+                {
+                    // wait until a request of the process which is handled concurrently is finished
+                    std::lock_guard<std::mutex> processLock(processIterator->getMutex());
+
+                    // delete all associated subscriber and publisher ports in shared
+                    // memory and the associated RouDi discovery ports
+                    // @todo Check if ShmManager and Process Manager end up in unintended condition
+                    {
+                        std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+                        m_portManager.deletePortsOfProcess(processIterator->getName());
+                    }
 
-                m_processIntrospection->removeProcess(static_cast<int32_t>(processIterator->getPid()));
+                    m_processIntrospection->removeProcess(static_cast<int32_t>(processIterator->getPid()));
+                }
 
                 // delete application
                 processIterator = m_processList.erase(processIterator);
@@ -677,8 +855,15 @@ void ProcessManager::monitorProcesses() noexcept
 
 void ProcessManager::discoveryUpdate() noexcept
 {
+    std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
     m_portManager.doDiscovery();
 }
 
+void ProcessManager::discoveryUpdateForNotifiedPorts() noexcept
+{
+    std::lock_guard<std::mutex> portManagerLock(m_portManagerMutex);
+    m_portManager.doDiscoveryForNotifiedPorts();
+}
+
 } // namespace roudi
 } // namespace iox
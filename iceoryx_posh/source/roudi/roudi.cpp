@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/internal/roudi/roudi.hpp"
 #include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/cxx/deadline_timer.hpp"
 #include "iceoryx_hoofs/cxx/helplets.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_hoofs/posix_wrapper/thread.hpp"
@@ -31,23 +32,59 @@ namespace iox
 {
 namespace roudi
 {
+namespace
+{
+/// @brief a numeric parameter of a runtime message is copied into this string on the stack to convert it
+using NumericParameter_t = cxx::string<32U>;
+
+/// @brief converts the numeric parameter at the given index of the message without an intermediate std::string
+/// @return true if the parameter exists and could be converted, otherwise the error is logged and false returned
+template <typename T>
+bool convertParameter(const runtime::IpcMessage& message,
+                      const uint32_t index,
+                      T& value,
+                      const char* const messageType) noexcept
+{
+    NumericParameter_t parameter;
+    if (!message.getElementAtIndex(index, parameter) || !cxx::convert::fromString(parameter.c_str(), value))
+    {
+        LogError() << "Invalid parameter for \"IpcMessageType::" << messageType << "\"! '" << parameter.c_str()
+                   << "' cannot be extracted from string\n";
+        return false;
+    }
+    return true;
+}
+
+/// @brief FNV-1a hash of the runtime name; it selects the worker thread of a runtime without creating a std::string
+uint64_t hashRuntimeName(const RuntimeName_t& runtimeName) noexcept
+{
+    constexpr uint64_t FNV_OFFSET_BASIS{14695981039346656037ULL};
+    constexpr uint64_t FNV_PRIME{1099511628211ULL};
+    uint64_t hash{FNV_OFFSET_BASIS};
+    for (uint64_t i = 0U; i < runtimeName.size(); ++i)
+    {
+        hash = (hash ^ static_cast<uint8_t>(runtimeName.c_str()[i])) * FNV_PRIME;
+    }
+    return hash;
+}
+} // namespace
+
 RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
              PortManager& portManager,
              RoudiStartupParameters roudiStartupParameters) noexcept
     : m_killProcessesInDestructor(roudiStartupParameters.m_killProcessesInDestructor)
     , m_runMonitoringAndDiscoveryThread(true)
     , m_runHandleRuntimeMessageThread(true)
+    , m_runRuntimeMessageWorkerThreads(true)
+    , m_numberOfRuntimeMessageWorkerThreads(roudiStartupParameters.m_numberOfRuntimeMessageWorkerThreads)
     , m_roudiMemoryInterface(&roudiMemoryInterface)
     , m_portManager(&portManager)
-    , m_prcMgr(concurrent::ForwardArgsToCTor,
-               *m_roudiMemoryInterface,
-               portManager,
-               roudiStartupParameters.m_compatibilityCheckLevel)
+    , m_prcMgr(*m_roudiMemoryInterface, portManager, roudiStartupParameters.m_compatibilityCheckLevel)
     , m_mempoolIntrospection(*m_roudiMemoryInterface->introspectionMemoryManager()
                                   .value(), /// @todo create a RouDiMemoryManagerData struct with all the pointer
                              *m_roudiMemoryInterface->segmentManager().value(),
-                             PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionMempoolService,
-                                                                                           IPC_CHANNEL_ROUDI_NAME)))
+                             PublisherPortUserType(m_prcMgr.addIntrospectionPublisherPort(IntrospectionMempoolService,
+                                                                                          IPC_CHANNEL_ROUDI_NAME)))
     , m_monitoringMode(roudiStartupParameters.m_monitoringMode)
     , m_processKillDelay(roudiStartupParameters.m_processKillDelay)
 {
@@ -55,9 +92,15 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
     {
         LogWarn() << "Runnning RouDi on 32-bit architectures is not supported! Use at your own risk!";
     }
+    if (m_numberOfRuntimeMessageWorkerThreads > MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKER_THREADS)
+    {
+        LogWarn() << "The number of worker threads for the runtime messages is limited to "
+                  << MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKER_THREADS << "!";
+        m_numberOfRuntimeMessageWorkerThreads = MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKER_THREADS;
+    }
     m_processIntrospection.registerPublisherPort(PublisherPortUserType(
-        m_prcMgr->addIntrospectionPublisherPort(IntrospectionProcessService, IPC_CHANNEL_ROUDI_NAME)));
-    m_prcMgr->initIntrospection(&m_processIntrospection);
+        m_prcMgr.addIntrospectionPublisherPort(IntrospectionProcessService, IPC_CHANNEL_ROUDI_NAME)));
+    m_prcMgr.initIntrospection(&m_processIntrospection);
     m_processIntrospection.run();
     m_mempoolIntrospection.run();
 
@@ -81,6 +124,14 @@ RouDi::~RouDi() noexcept
 
 void RouDi::startProcessRuntimeMessagesThread() noexcept
 {
+    for (uint32_t i = 0U; i < m_numberOfRuntimeMessageWorkerThreads; ++i)
+    {
+        m_runtimeMessageWorkers.emplace_back();
+        auto& worker = m_runtimeMessageWorkers.back();
+        worker.thread = std::thread(&RouDi::processRuntimeMessagesOfWorker, this, std::ref(worker));
+        posix::setThreadName(worker.thread.native_handle(), "IPC-msg-worker");
+    }
+
     m_handleRuntimeMessageThread = std::thread(&RouDi::processRuntimeMessages, this);
     posix::setThreadName(m_handleRuntimeMessageThread.native_handle(), "IPC-msg-process");
 }
@@ -103,11 +154,11 @@ void RouDi::shutdown() noexcept
     {
         cxx::DeadlineTimer finalKillTimer(m_processKillDelay);
 
-        m_prcMgr->requestShutdownOfAllProcesses();
+        m_prcMgr.requestShutdownOfAllProcesses();
 
         using namespace units::duration_literals;
         auto remainingDurationForWarnPrint = m_processKillDelay - 2_s;
-        while (m_prcMgr->isAnyRegisteredProcessStillRunning() && !finalKillTimer.hasExpired())
+        while (m_prcMgr.isAnyRegisteredProcessStillRunning() && !finalKillTimer.hasExpired())
         {
             if (remainingDurationForWarnPrint > finalKillTimer.remainingTime())
             {
@@ -120,15 +171,15 @@ void RouDi::shutdown() noexcept
         }
 
         // Is any processes still alive?
-        if (m_prcMgr->isAnyRegisteredProcessStillRunning() && finalKillTimer.hasExpired())
+        if (m_prcMgr.isAnyRegisteredProcessStillRunning() && finalKillTimer.hasExpired())
         {
             // Time to kill them
-            m_prcMgr->killAllProcesses();
+            m_prcMgr.killAllProcesses();
         }
 
-        if (m_prcMgr->isAnyRegisteredProcessStillRunning())
+        if (m_prcMgr.isAnyRegisteredProcessStillRunning())
         {
-            m_prcMgr->printWarningForRegisteredProcessesAndClearProcessList();
+            m_prcMgr.printWarningForRegisteredProcessesAndClearProcessList();
         }
     }
 
@@ -141,6 +192,35 @@ void RouDi::shutdown() noexcept
         m_handleRuntimeMessageThread.join();
         LogDebug() << "...'IPC-msg-process' thread joined.";
     }
+
+    stopRuntimeMessageWorkerThreads();
+}
+
+void RouDi::stopRuntimeMessageWorkerThreads() noexcept
+{
+    // the worker threads process all messages in their queue before they stop
+    m_runRuntimeMessageWorkerThreads = false;
+    for (auto& worker : m_runtimeMessageWorkers)
+    {
+        // notifying with the lock held ensures that a worker does not miss the wakeup between its check of the
+        // predicate and its wait
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.wakeup.notify_one();
+    }
+
+    if (!m_runtimeMessageWorkers.empty())
+    {
+        LogDebug() << "Joining 'IPC-msg-worker' threads...";
+        for (auto& worker : m_runtimeMessageWorkers)
+        {
+            if (worker.thread.joinable())
+            {
+                worker.thread.join();
+            }
+        }
+        LogDebug() << "...'IPC-msg-worker' threads joined.";
+    }
+    m_runtimeMessageWorkers.clear();
 }
 
 void RouDi::cyclicUpdateHook() noexcept
@@ -152,11 +232,21 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
 {
     while (m_runMonitoringAndDiscoveryThread)
     {
-        m_prcMgr->run();
+        m_prcMgr.run();
 
         cyclicUpdateHook();
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(DISCOVERY_INTERVAL.toMilliseconds()));
+        // until the next cycle only the ports which announced a pending CaPro message are handled, which makes the
+        // discovery latency independent of the discovery interval; the cycle remains for the process monitoring and
+        // all other ports
+        cxx::DeadlineTimer nextCycle(DISCOVERY_INTERVAL);
+        while (m_runMonitoringAndDiscoveryThread && !nextCycle.hasExpired())
+        {
+            if (m_portManager->waitForDiscoveryNotification(nextCycle.remainingTime()))
+            {
+                m_prcMgr.discoveryUpdateForNotifiedPorts();
+            }
+        }
     }
 }
 
@@ -173,22 +263,65 @@ void RouDi::processRuntimeMessages() noexcept
         runtime::IpcMessage message;
         if (roudiIpcInterface.timedReceive(m_runtimeMessagesThreadTimeout, message))
         {
-            auto cmd = runtime::stringToIpcMessageType(message.getElementAtIndex(0).c_str());
-            std::string runtimeName = message.getElementAtIndex(1);
+            NumericParameter_t messageType;
+            message.getElementAtIndex(0, messageType);
+            auto cmd = runtime::stringToIpcMessageType(messageType.c_str());
+            RuntimeName_t runtimeName;
+            message.getElementAtIndex(1, runtimeName);
 
-            processMessage(message, cmd, RuntimeName_t(cxx::TruncateToCapacity, runtimeName));
+            if (m_runtimeMessageWorkers.empty())
+            {
+                processMessage(message, cmd, runtimeName);
+            }
+            else
+            {
+                dispatchRuntimeMessage(message, cmd, runtimeName);
+            }
         }
     }
 }
 
+void RouDi::dispatchRuntimeMessage(const runtime::IpcMessage& message,
+                                   const runtime::IpcMessageType cmd,
+                                   const RuntimeName_t& runtimeName) noexcept
+{
+    auto workerIndex = hashRuntimeName(runtimeName) % m_runtimeMessageWorkers.size();
+    auto& worker = m_runtimeMessageWorkers[workerIndex];
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.queue.push_back({message, cmd, runtimeName});
+    }
+    worker.wakeup.notify_one();
+}
+
+void RouDi::processRuntimeMessagesOfWorker(RuntimeMessageWorker& worker) noexcept
+{
+    std::unique_lock<std::mutex> lock(worker.mutex);
+    while (true)
+    {
+        worker.wakeup.wait(lock, [&] { return !worker.queue.empty() || !m_runRuntimeMessageWorkerThreads; });
+        if (worker.queue.empty())
+        {
+            return;
+        }
+
+        auto runtimeMessage = std::move(worker.queue.front());
+        worker.queue.pop_front();
+
+        lock.unlock();
+        processMessage(runtimeMessage.message, runtimeMessage.cmd, runtimeMessage.runtimeName);
+        lock.lock();
+    }
+}
+
 version::VersionInfo RouDi::parseRegisterMessage(const runtime::IpcMessage& message,
                                                  uint32_t& pid,
                                                  uid_t& userId,
                                                  int64_t& transmissionTimestamp) noexcept
 {
-    cxx::convert::fromString(message.getElementAtIndex(2).c_str(), pid);
-    cxx::convert::fromString(message.getElementAtIndex(3).c_str(), userId);
-    cxx::convert::fromString(message.getElementAtIndex(4).c_str(), transmissionTimestamp);
+    IOX_DISCARD_RESULT(convertParameter(message, 2U, pid, "REG"));
+    IOX_DISCARD_RESULT(convertParameter(message, 3U, userId, "REG"));
+    IOX_DISCARD_RESULT(convertParameter(message, 4U, transmissionTimestamp, "REG"));
     cxx::Serialization serializationVersionInfo(message.getElementAtIndex(5));
     return serializationVersionInfo;
 }
@@ -201,7 +334,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
     {
     case runtime::IpcMessageType::SERVICE_REGISTRY_CHANGE_COUNTER:
     {
-        m_prcMgr->sendServiceRegistryChangeCounterToProcess(runtimeName);
+        m_prcMgr.sendServiceRegistryChangeCounterToProcess(runtimeName);
         break;
     }
     case runtime::IpcMessageType::REG:
@@ -229,18 +362,19 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
     }
     case runtime::IpcMessageType::CREATE_PUBLISHER:
     {
-        if (message.getNumberOfElements() != 8)
+        if (message.getNumberOfElements() != 9)
         {
             LogError() << "Wrong number of parameters for \"IpcMessageType::CREATE_PUBLISHER\" from \"" << runtimeName
                        << "\"received!";
         }
         else
         {
+            const auto serializedServiceDescription = message.getElementAtIndex(2);
             auto deserializationResult =
-                capro::ServiceDescription::deserialize(cxx::Serialization(message.getElementAtIndex(2)));
+                capro::ServiceDescription::deserialize(cxx::Serialization(serializedServiceDescription));
             if (deserializationResult.has_error())
             {
-                LogError() << "Deserialization failed when '" << message.getElementAtIndex(2).c_str()
+                LogError() << "Deserialization failed when '" << serializedServiceDescription.c_str()
                            << "' was provided\n";
                 break;
             }
@@ -250,40 +384,41 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             if (!service.isValid())
             {
-                LogError() << "Invalid service description '" << message.getElementAtIndex(2).c_str() << "' provided\n";
+                LogError() << "Invalid service description '" << serializedServiceDescription.c_str() << "' provided\n";
                 break;
             }
 
             popo::PublisherOptions options;
             uint64_t historyCapacity{};
-            if (!cxx::convert::fromString(message.getElementAtIndex(3).c_str(), historyCapacity))
+            if (!convertParameter(message, 3U, historyCapacity, "CREATE_PUBLISHER"))
             {
-                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_PUBLISHER\"! '"
-                           << message.getElementAtIndex(3).c_str() << "' cannot be extracted from string\n";
                 break;
             }
             options.historyCapacity = historyCapacity;
-            options.nodeName = NodeName_t(cxx::TruncateToCapacity, message.getElementAtIndex(4));
+            message.getElementAtIndex(4, options.nodeName);
 
             uint64_t offerOnCreate{};
-            if (!cxx::convert::fromString(message.getElementAtIndex(5).c_str(), offerOnCreate))
+            if (!convertParameter(message, 5U, offerOnCreate, "CREATE_PUBLISHER"))
             {
-                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_PUBLISHER\"! '"
-                           << message.getElementAtIndex(5).c_str() << "' cannot be extracted from string\n";
                 break;
             }
             options.offerOnCreate = (0U == offerOnCreate) ? false : true;
 
             uint8_t subscriberTooSlowPolicy{};
-            if (!cxx::convert::fromString(message.getElementAtIndex(6).c_str(), subscriberTooSlowPolicy))
+            if (!convertParameter(message, 6U, subscriberTooSlowPolicy, "CREATE_PUBLISHER"))
             {
-                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_PUBLISHER\"! '"
-                           << message.getElementAtIndex(6).c_str() << "' cannot be extracted from string\n";
                 break;
             }
             options.subscriberTooSlowPolicy = static_cast<popo::SubscriberTooSlowPolicy>(subscriberTooSlowPolicy);
 
-            m_prcMgr->addPublisherForProcess(
+            uint64_t maxBlockingTimeInNanoseconds{};
+            if (!convertParameter(message, 8U, maxBlockingTimeInNanoseconds, "CREATE_PUBLISHER"))
+            {
+                break;
+            }
+            options.maxBlockingTime = units::Duration::fromNanoseconds(maxBlockingTimeInNanoseconds);
+
+            m_prcMgr.addPublisherForProcess(
                 runtimeName, service, options, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
         }
         break;
@@ -297,11 +432,12 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         else
         {
+            const auto serializedServiceDescription = message.getElementAtIndex(2);
             auto deserializationResult =
-                capro::ServiceDescription::deserialize(cxx::Serialization(message.getElementAtIndex(2)));
+                capro::ServiceDescription::deserialize(cxx::Serialization(serializedServiceDescription));
             if (deserializationResult.has_error())
             {
-                LogError() << "Deserialization failed when '" << message.getElementAtIndex(2).c_str()
+                LogError() << "Deserialization failed when '" << serializedServiceDescription.c_str()
                            << "' was provided\n";
                 break;
             }
@@ -311,52 +447,134 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             if (!service.isValid())
             {
-                LogError() << "Invalid service description '" << message.getElementAtIndex(2).c_str() << "' provided\n";
+                LogError() << "Invalid service description '" << serializedServiceDescription.c_str() << "' provided\n";
                 break;
             }
 
             popo::SubscriberOptions options;
             uint64_t historyRequest;
-            if (!cxx::convert::fromString(message.getElementAtIndex(3).c_str(), historyRequest))
+            if (!convertParameter(message, 3U, historyRequest, "CREATE_SUBSCRIBER"))
             {
-                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_SUBSCRIBER\"! '"
-                           << message.getElementAtIndex(3).c_str() << "' cannot be extracted from string\n";
                 break;
             }
             options.historyRequest = historyRequest;
             uint64_t queueCapacity;
-            if (!cxx::convert::fromString(message.getElementAtIndex(4).c_str(), queueCapacity))
+            if (!convertParameter(message, 4U, queueCapacity, "CREATE_SUBSCRIBER"))
             {
-                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_SUBSCRIBER\"! '"
-                           << message.getElementAtIndex(4).c_str() << "' cannot be extracted from string\n";
                 break;
             }
             options.queueCapacity = queueCapacity;
-            options.nodeName = NodeName_t(cxx::TruncateToCapacity, message.getElementAtIndex(5));
+            message.getElementAtIndex(5, options.nodeName);
 
             uint32_t subscribeOnCreate;
-            if (!cxx::convert::fromString(message.getElementAtIndex(6).c_str(), subscribeOnCreate))
+            if (!convertParameter(message, 6U, subscribeOnCreate, "CREATE_SUBSCRIBER"))
             {
-                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_SUBSCRIBER\"! '"
-                           << message.getElementAtIndex(6).c_str() << "' cannot be extracted from string\n";
                 break;
             }
             options.subscribeOnCreate = (0U == subscribeOnCreate ? false : true);
 
             uint8_t queueFullPolicy{};
-            if (!cxx::convert::fromString(message.getElementAtIndex(7).c_str(), queueFullPolicy))
+            if (!convertParameter(message, 7U, queueFullPolicy, "CREATE_SUBSCRIBER"))
             {
-                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_SUBSCRIBER\"! '"
-                           << message.getElementAtIndex(7).c_str() << "' cannot be extracted from string\n";
                 break;
             }
             options.queueFullPolicy = static_cast<popo::QueueFullPolicy>(queueFullPolicy);
 
-            m_prcMgr->addSubscriberForProcess(
+            m_prcMgr.addSubscriberForProcess(
                 runtimeName, service, options, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
         }
         break;
     }
+    case runtime::IpcMessageType::CREATE_CLIENT:
+    {
+        if (message.getNumberOfElements() != 5)
+        {
+            LogError() << "Wrong number of parameters for \"IpcMessageType::CREATE_CLIENT\" from \"" << runtimeName
+                       << "\"received!";
+        }
+        else
+        {
+            const auto serializedServiceDescription = message.getElementAtIndex(2);
+            auto deserializationResult =
+                capro::ServiceDescription::deserialize(cxx::Serialization(serializedServiceDescription));
+            if (deserializationResult.has_error())
+            {
+                LogError() << "Deserialization failed when '" << serializedServiceDescription.c_str()
+                           << "' was provided\n";
+                break;
+            }
+
+            const auto& service = deserializationResult.value();
+            if (!service.isValid())
+            {
+                LogError() << "Invalid service description '" << serializedServiceDescription.c_str() << "' provided\n";
+                break;
+            }
+
+            const auto serializedClientOptions = message.getElementAtIndex(3);
+            auto clientOptionsDeserializationResult =
+                popo::ClientOptions::deserialize(cxx::Serialization(serializedClientOptions));
+            if (clientOptionsDeserializationResult.has_error())
+            {
+                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_CLIENT\"! '"
+                           << serializedClientOptions.c_str() << "' cannot be deserialized\n";
+                break;
+            }
+
+            cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(4));
+
+            m_prcMgr.addClientForProcess(runtimeName,
+                                         service,
+                                         clientOptionsDeserializationResult.value(),
+                                         iox::runtime::PortConfigInfo(portConfigInfoSerialization));
+        }
+        break;
+    }
+    case runtime::IpcMessageType::CREATE_SERVER:
+    {
+        if (message.getNumberOfElements() != 5)
+        {
+            LogError() << "Wrong number of parameters for \"IpcMessageType::CREATE_SERVER\" from \"" << runtimeName
+                       << "\"received!";
+        }
+        else
+        {
+            const auto serializedServiceDescription = message.getElementAtIndex(2);
+            auto deserializationResult =
+                capro::ServiceDescription::deserialize(cxx::Serialization(serializedServiceDescription));
+            if (deserializationResult.has_error())
+            {
+                LogError() << "Deserialization failed when '" << serializedServiceDescription.c_str()
+                           << "' was provided\n";
+                break;
+            }
+
+            const auto& service = deserializationResult.value();
+            if (!service.isValid())
+            {
+                LogError() << "Invalid service description '" << serializedServiceDescription.c_str() << "' provided\n";
+                break;
+            }
+
+            const auto serializedServerOptions = message.getElementAtIndex(3);
+            auto serverOptionsDeserializationResult =
+                popo::ServerOptions::deserialize(cxx::Serialization(serializedServerOptions));
+            if (serverOptionsDeserializationResult.has_error())
+            {
+                LogError() << "Invalid parameter for \"IpcMessageType::CREATE_SERVER\"! '"
+                           << serializedServerOptions.c_str() << "' cannot be deserialized\n";
+                break;
+            }
+
+            cxx::Serialization portConfigInfoSerialization(message.getElementAtIndex(4));
+
+            m_prcMgr.addServerForProcess(runtimeName,
+                                         service,
+                                         serverOptionsDeserializationResult.value(),
+                                         iox::runtime::PortConfigInfo(portConfigInfoSerialization));
+        }
+        break;
+    }
     case runtime::IpcMessageType::CREATE_CONDITION_VARIABLE:
     {
         if (message.getNumberOfElements() != 2)
@@ -366,7 +584,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         else
         {
-            m_prcMgr->addConditionVariableForProcess(runtimeName);
+            m_prcMgr.addConditionVariableForProcess(runtimeName);
         }
         break;
     }
@@ -379,11 +597,12 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         else
         {
-            capro::Interfaces interface =
-                StringToCaProInterface(capro::IdString_t(cxx::TruncateToCapacity, message.getElementAtIndex(2)));
+            capro::IdString_t interfaceName;
+            message.getElementAtIndex(2, interfaceName);
+            NodeName_t nodeName;
+            message.getElementAtIndex(3, nodeName);
 
-            m_prcMgr->addInterfaceForProcess(
-                runtimeName, interface, NodeName_t(cxx::TruncateToCapacity, message.getElementAtIndex(3)));
+            m_prcMgr.addInterfaceForProcess(runtimeName, StringToCaProInterface(interfaceName), nodeName);
         }
         break;
     }
@@ -396,7 +615,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         else
         {
-            m_prcMgr->addApplicationForProcess(runtimeName);
+            m_prcMgr.addApplicationForProcess(runtimeName);
         }
         break;
     }
@@ -410,7 +629,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         else
         {
             runtime::NodeProperty nodeProperty(cxx::Serialization(message.getElementAtIndex(2)));
-            m_prcMgr->addNodeForProcess(runtimeName, nodeProperty.m_name);
+            m_prcMgr.addNodeForProcess(runtimeName, nodeProperty.m_name);
         }
         break;
     }
@@ -423,16 +642,18 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         else
         {
-            capro::IdString_t service{cxx::TruncateToCapacity, message.getElementAtIndex(2)};
-            capro::IdString_t instance{cxx::TruncateToCapacity, message.getElementAtIndex(3)};
+            capro::IdString_t service;
+            message.getElementAtIndex(2, service);
+            capro::IdString_t instance;
+            message.getElementAtIndex(3, instance);
 
-            m_prcMgr->findServiceForProcess(runtimeName, service, instance);
+            m_prcMgr.findServiceForProcess(runtimeName, service, instance);
         }
         break;
     }
     case runtime::IpcMessageType::KEEPALIVE:
     {
-        m_prcMgr->updateLivelinessOfProcess(runtimeName);
+        m_prcMgr.updateLivelinessOfProcess(runtimeName);
         break;
     }
     case runtime::IpcMessageType::PREPARE_APP_TERMINATION:
@@ -445,7 +666,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         else
         {
             // this is used to unblock a potentially block application by blocking publisher
-            m_prcMgr->handleProcessShutdownPreparationRequest(runtimeName);
+            m_prcMgr.handleProcessShutdownPreparationRequest(runtimeName);
         }
         break;
     }
@@ -458,7 +679,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         else
         {
-            IOX_DISCARD_RESULT(m_prcMgr->unregisterProcess(runtimeName));
+            IOX_DISCARD_RESULT(m_prcMgr.unregisterProcess(runtimeName));
         }
         break;
     }
@@ -466,7 +687,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
     {
         LogError() << "Unknown IPC message command [" << runtime::IpcMessageTypeToString(cmd) << "]";
 
-        m_prcMgr->sendMessageNotSupportedToRuntime(runtimeName);
+        m_prcMgr.sendMessageNotSupportedToRuntime(runtimeName);
         break;
     }
     }
@@ -481,12 +702,12 @@ void RouDi::registerProcess(const RuntimeName_t& name,
 {
     bool monitorProcess = (m_monitoringMode == roudi::MonitoringMode::ON);
     IOX_DISCARD_RESULT(
-        m_prcMgr->registerProcess(name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo));
+        m_prcMgr.registerProcess(name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo));
 }
 
 uint64_t RouDi::getUniqueSessionIdForProcess() noexcept
 {
-    static uint64_t sessionId = 0;
+    static std::atomic<uint64_t> sessionId{0U};
     return ++sessionId;
 }
 
@@ -113,7 +113,17 @@ TomlRouDiConfigFileProvider::parse() noexcept
     {
         auto writer = segment->get_as<std::string>("writer").value_or(groupOfCurrentProcess);
         auto reader = segment->get_as<std::string>("reader").value_or(groupOfCurrentProcess);
+        auto overflowToLargerMempool = segment->get_as<bool>("overflow-to-larger-mempool").value_or(false);
+        auto chunkCache = segment->get_as<bool>("chunk-cache").value_or(false);
+        iox::mepoo::MemoryInfo memoryInfo;
+        memoryInfo.useHugePages = segment->get_as<bool>("huge-pages").value_or(false);
+        memoryInfo.lockMemory = segment->get_as<bool>("lock-memory").value_or(false);
         iox::mepoo::MePooConfig mempoolConfig;
+        if (overflowToLargerMempool)
+        {
+            mempoolConfig.setOverflowPolicy(iox::mepoo::MemPoolOverflowPolicy::USE_LARGER_MEMPOOL);
+        }
+        mempoolConfig.setChunkCacheEnabled(chunkCache);
         auto mempools = segment->get_table_array("mempool");
         if (!mempools)
         {
@@ -146,7 +156,8 @@ TomlRouDiConfigFileProvider::parse() noexcept
         parsedConfig.m_sharedMemorySegments.push_back(
             {iox::posix::PosixGroup::string_t(iox::cxx::TruncateToCapacity, reader),
              iox::posix::PosixGroup::string_t(iox::cxx::TruncateToCapacity, writer),
-             mempoolConfig});
+             mempoolConfig,
+             memoryInfo});
     }
 
     return iox::cxx::success<iox::RouDiConfig_t>(parsedConfig);
@@ -24,10 +24,11 @@ namespace iox
 namespace runtime
 {
 const char IpcMessage::m_separator = ',';
+constexpr uint64_t IpcMessage::MAX_NUMBER_OF_INDEXED_ELEMENTS;
 
 IpcMessage::IpcMessage(const std::initializer_list<std::string>& msg) noexcept
 {
-    for (auto element : msg)
+    for (const auto& element : msg)
     {
         addEntry(element);
     }
@@ -45,22 +46,75 @@ uint32_t IpcMessage::getNumberOfElements() const noexcept
 
 std::string IpcMessage::getElementAtIndex(const uint32_t index) const noexcept
 {
-    std::string messageRemainder(m_msg);
-    size_t startPos = 0u;
-    size_t endPos = messageRemainder.find_first_of(m_separator, startPos);
+    uint64_t startPosition{0U};
+    uint64_t endPosition{0U};
+    if (!getPositionOfElement(index, startPosition, endPosition))
+    {
+        return std::string();
+    }
+    return m_msg.substr(startPosition, endPosition - startPosition);
+}
 
-    for (uint32_t counter = 0u; endPos != std::string::npos; ++counter)
+bool IpcMessage::getPositionOfElement(const uint32_t index,
+                                      uint64_t& startPosition,
+                                      uint64_t& endPosition) const noexcept
+{
+    if (index < m_separatorPositions.size())
     {
-        if (counter == index)
+        startPosition = (index == 0U) ? 0U : m_separatorPositions[index - 1U] + 1U;
+        endPosition = m_separatorPositions[index];
+        return true;
+    }
+
+    if (m_separatorPositions.size() < m_separatorPositions.capacity())
+    {
+        return false;
+    }
+
+    // the separator positions of the entries behind the indexed ones are not stored, search them in the message
+    uint64_t position = m_separatorPositions.back() + 1U;
+    for (uint64_t currentIndex = m_separatorPositions.size(); currentIndex < index; ++currentIndex)
+    {
+        const auto separatorPosition = m_msg.find(m_separator, position);
+        if (separatorPosition == std::string::npos)
         {
-            return messageRemainder.substr(startPos, endPos - startPos);
+            return false;
         }
+        position = separatorPosition + 1U;
+    }
 
-        startPos = endPos + 1u;
-        endPos = messageRemainder.find_first_of(m_separator, startPos);
+    const auto separatorPosition = m_msg.find(m_separator, position);
+    if (separatorPosition == std::string::npos)
+    {
+        return false;
     }
+    startPosition = position;
+    endPosition = separatorPosition;
+    return true;
+}
 
-    return std::string();
+void IpcMessage::indexSeparator(const uint64_t position) noexcept
+{
+    if (m_separatorPositions.size() < m_separatorPositions.capacity())
+    {
+        m_separatorPositions.push_back(position);
+    }
+}
+
+void IpcMessage::addEntry(const std::string& entry) noexcept
+{
+    if (!isValidEntry(entry))
+    {
+        LogError() << "\'" << entry.c_str() << "\' is an invalid IPC channel entry";
+        m_isValid = false;
+    }
+    else
+    {
+        m_msg.append(entry);
+        indexSeparator(m_msg.size());
+        m_msg.push_back(m_separator);
+        ++m_numberOfElements;
+    }
 }
 
 bool IpcMessage::isValidEntry(const std::string& entry) const noexcept
@@ -87,20 +141,31 @@ void IpcMessage::setMessage(const std::string& msg) noexcept
     clearMessage();
 
     m_msg = msg;
+    // the entries in front of the last separator are accessible even when the message is invalid
+    uint32_t numberOfSeparators{0U};
+    for (uint64_t position = 0U; position < m_msg.size(); ++position)
+    {
+        if (m_msg[position] == m_separator)
+        {
+            indexSeparator(position);
+            ++numberOfSeparators;
+        }
+    }
+
     if (!m_msg.empty() && m_msg.back() != m_separator)
     {
         m_isValid = false;
     }
     else
     {
-        m_numberOfElements =
-            static_cast<uint32_t>(std::count_if(m_msg.begin(), m_msg.end(), [&](char c) { return c == m_separator; }));
+        m_numberOfElements = numberOfSeparators;
     }
 }
 
 void IpcMessage::clearMessage() noexcept
 {
     m_msg.clear();
+    m_separatorPositions.clear();
     m_numberOfElements = 0u;
     m_isValid = true;
 }
@@ -28,7 +28,9 @@
 #include "iceoryx_posh/runtime/node.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
 
+#include <algorithm>
 #include <cstdint>
+#include <limits>
 
 namespace iox
 {
@@ -126,12 +128,18 @@ PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service
         options.nodeName = m_appName;
     }
 
+    // strtoull reports the maximum value of uint64_t as error, therefore an unlimited blocking time is transferred as
+    // the next smaller value, which still corresponds to more than 500 years
+    const uint64_t maxBlockingTimeInNanoseconds =
+        std::min(options.maxBlockingTime.toNanoseconds(), std::numeric_limits<uint64_t>::max() - 1U);
+
     IpcMessage sendBuffer;
     sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PUBLISHER) << m_appName
                << static_cast<cxx::Serialization>(service).toString() << cxx::convert::toString(options.historyCapacity)
                << options.nodeName << cxx::convert::toString(options.offerOnCreate)
                << cxx::convert::toString(static_cast<uint8_t>(options.subscriberTooSlowPolicy))
-               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+               << static_cast<cxx::Serialization>(portConfigInfo).toString()
+               << cxx::convert::toString(maxBlockingTimeInNanoseconds);
 
     auto maybePublisher = requestPublisherFromRoudi(sendBuffer);
     if (maybePublisher.has_error())
@@ -315,6 +323,219 @@ PoshRuntimeImpl::requestSubscriberFromRoudi(const IpcMessage& sendBuffer) noexce
     return cxx::error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE);
 }
 
+popo::ClientPortData* PoshRuntimeImpl::getMiddlewareClient(const capro::ServiceDescription& service,
+                                                          const popo::ClientOptions& clientOptions,
+                                                          const PortConfigInfo& portConfigInfo) noexcept
+{
+    constexpr uint64_t MAX_QUEUE_CAPACITY = popo::ClientChunkQueueData_t::MAX_CAPACITY;
+
+    cxx::Expects(service.isValid() && "Could not create client, invalid service description provided");
+
+    auto options = clientOptions;
+    if (options.responseQueueCapacity > MAX_QUEUE_CAPACITY)
+    {
+        LogWarn() << "Requested response queue capacity " << options.responseQueueCapacity
+                  << " exceeds the maximum possible one for this client"
+                  << ", limiting from " << clientOptions.responseQueueCapacity << " to " << MAX_QUEUE_CAPACITY;
+        options.responseQueueCapacity = MAX_QUEUE_CAPACITY;
+    }
+    else if (0U == options.responseQueueCapacity)
+    {
+        LogWarn() << "Requested response queue capacity of 0 doesn't make sense as no data would be received,"
+                  << " the capacity is set to 1";
+        options.responseQueueCapacity = 1U;
+    }
+
+    if (options.nodeName.empty())
+    {
+        options.nodeName = m_appName;
+    }
+
+    IpcMessage sendBuffer;
+    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_CLIENT) << m_appName
+               << static_cast<cxx::Serialization>(service).toString() << options.serialize().toString()
+               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+
+    auto maybeClient = requestClientFromRoudi(sendBuffer);
+    if (maybeClient.has_error())
+    {
+        switch (maybeClient.get_error())
+        {
+        case IpcMessageErrorType::CLIENT_LIST_FULL:
+            LogWarn() << "Service '" << service.operator cxx::Serialization().toString()
+                      << "' could not be created since we are out of memory for clients.";
+            errorHandler(Error::kPOSH__RUNTIME_ROUDI_CLIENT_LIST_FULL, nullptr, iox::ErrorLevel::SEVERE);
+            break;
+        case IpcMessageErrorType::REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE:
+            LogWarn() << "Service '" << service.operator cxx::Serialization().toString()
+                      << "' could not be created. Request client got wrong IPC channel response.";
+            errorHandler(Error::kPOSH__RUNTIME_ROUDI_REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE,
+                         nullptr,
+                         iox::ErrorLevel::SEVERE);
+            break;
+        case IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT:
+            LogWarn() << "Service '" << service.operator cxx::Serialization().toString()
+                      << "' could not be created. RouDi did not find a writable shared memory segment for the current "
+                         "user. Try using another user or adapt RouDi's config.";
+            errorHandler(Error::kPOSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, nullptr, iox::ErrorLevel::SEVERE);
+            break;
+        default:
+            LogWarn() << "Unknown error occurred while creating service '"
+                      << service.operator cxx::Serialization().toString() << "'.";
+            errorHandler(Error::kPOSH__RUNTIME_CLIENT_PORT_CREATION_UNKNOWN_ERROR, nullptr, iox::ErrorLevel::SEVERE);
+            break;
+        }
+        return nullptr;
+    }
+    return maybeClient.value();
+}
+
+cxx::expected<popo::ClientPortData*, IpcMessageErrorType>
+PoshRuntimeImpl::requestClientFromRoudi(const IpcMessage& sendBuffer) noexcept
+{
+    IpcMessage receiveBuffer;
+    if (sendRequestToRouDi(sendBuffer, receiveBuffer) && (3U == receiveBuffer.getNumberOfElements()))
+    {
+        std::string IpcMessage = receiveBuffer.getElementAtIndex(0U);
+
+        if (stringToIpcMessageType(IpcMessage.c_str()) == IpcMessageType::CREATE_CLIENT_ACK)
+        {
+            rp::BaseRelativePointer::id_t segmentId{0U};
+            cxx::convert::fromString(receiveBuffer.getElementAtIndex(2U).c_str(), segmentId);
+            rp::BaseRelativePointer::offset_t offset{0U};
+            cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), offset);
+            auto ptr = rp::BaseRelativePointer::getPtr(segmentId, offset);
+            return cxx::success<popo::ClientPortData*>(reinterpret_cast<popo::ClientPortData*>(ptr));
+        }
+    }
+    else
+    {
+        if (receiveBuffer.getNumberOfElements() == 2U)
+        {
+            std::string IpcMessage1 = receiveBuffer.getElementAtIndex(0U);
+            std::string IpcMessage2 = receiveBuffer.getElementAtIndex(1U);
+
+            if (stringToIpcMessageType(IpcMessage1.c_str()) == IpcMessageType::ERROR)
+            {
+                LogError() << "Request client received no valid client port from RouDi.";
+                return cxx::error<IpcMessageErrorType>(stringToIpcMessageErrorType(IpcMessage2.c_str()));
+            }
+        }
+    }
+
+    LogError() << "Request client got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'";
+    return cxx::error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE);
+}
+
+popo::ServerPortData* PoshRuntimeImpl::getMiddlewareServer(const capro::ServiceDescription& service,
+                                                          const popo::ServerOptions& serverOptions,
+                                                          const PortConfigInfo& portConfigInfo) noexcept
+{
+    constexpr uint64_t MAX_QUEUE_CAPACITY = popo::ServerChunkQueueData_t::MAX_CAPACITY;
+
+    cxx::Expects(service.isValid() && "Could not create server, invalid service description provided");
+
+    auto options = serverOptions;
+    if (options.requestQueueCapacity > MAX_QUEUE_CAPACITY)
+    {
+        LogWarn() << "Requested request queue capacity " << options.requestQueueCapacity
+                  << " exceeds the maximum possible one for this server"
+                  << ", limiting from " << serverOptions.requestQueueCapacity << " to " << MAX_QUEUE_CAPACITY;
+        options.requestQueueCapacity = MAX_QUEUE_CAPACITY;
+    }
+    else if (0U == options.requestQueueCapacity)
+    {
+        LogWarn() << "Requested request queue capacity of 0 doesn't make sense as no data would be received,"
+                  << " the capacity is set to 1";
+        options.requestQueueCapacity = 1U;
+    }
+
+    if (options.nodeName.empty())
+    {
+        options.nodeName = m_appName;
+    }
+
+    IpcMessage sendBuffer;
+    sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SERVER) << m_appName
+               << static_cast<cxx::Serialization>(service).toString() << options.serialize().toString()
+               << static_cast<cxx::Serialization>(portConfigInfo).toString();
+
+    auto maybeServer = requestServerFromRoudi(sendBuffer);
+    if (maybeServer.has_error())
+    {
+        switch (maybeServer.get_error())
+        {
+        case IpcMessageErrorType::NO_UNIQUE_CREATED:
+            LogWarn() << "Service '" << service.operator cxx::Serialization().toString()
+                      << "' already in use by another server.";
+            errorHandler(Error::kPOSH__RUNTIME_SERVER_PORT_NOT_UNIQUE, nullptr, iox::ErrorLevel::SEVERE);
+            break;
+        case IpcMessageErrorType::SERVER_LIST_FULL:
+            LogWarn() << "Service '" << service.operator cxx::Serialization().toString()
+                      << "' could not be created since we are out of memory for servers.";
+            errorHandler(Error::kPOSH__RUNTIME_ROUDI_SERVER_LIST_FULL, nullptr, iox::ErrorLevel::SEVERE);
+            break;
+        case IpcMessageErrorType::REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE:
+            LogWarn() << "Service '" << service.operator cxx::Serialization().toString()
+                      << "' could not be created. Request server got wrong IPC channel response.";
+            errorHandler(Error::kPOSH__RUNTIME_ROUDI_REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE,
+                         nullptr,
+                         iox::ErrorLevel::SEVERE);
+            break;
+        case IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT:
+            LogWarn() << "Service '" << service.operator cxx::Serialization().toString()
+                      << "' could not be created. RouDi did not find a writable shared memory segment for the current "
+                         "user. Try using another user or adapt RouDi's config.";
+            errorHandler(Error::kPOSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, nullptr, iox::ErrorLevel::SEVERE);
+            break;
+        default:
+            LogWarn() << "Unknown error occurred while creating service '"
+                      << service.operator cxx::Serialization().toString() << "'.";
+            errorHandler(Error::kPOSH__RUNTIME_SERVER_PORT_CREATION_UNKNOWN_ERROR, nullptr, iox::ErrorLevel::SEVERE);
+            break;
+        }
+        return nullptr;
+    }
+    return maybeServer.value();
+}
+
+cxx::expected<popo::ServerPortData*, IpcMessageErrorType>
+PoshRuntimeImpl::requestServerFromRoudi(const IpcMessage& sendBuffer) noexcept
+{
+    IpcMessage receiveBuffer;
+    if (sendRequestToRouDi(sendBuffer, receiveBuffer) && (3U == receiveBuffer.getNumberOfElements()))
+    {
+        std::string IpcMessage = receiveBuffer.getElementAtIndex(0U);
+
+        if (stringToIpcMessageType(IpcMessage.c_str()) == IpcMessageType::CREATE_SERVER_ACK)
+        {
+            rp::BaseRelativePointer::id_t segmentId{0U};
+            cxx::convert::fromString(receiveBuffer.getElementAtIndex(2U).c_str(), segmentId);
+            rp::BaseRelativePointer::offset_t offset{0U};
+            cxx::convert::fromString(receiveBuffer.getElementAtIndex(1U).c_str(), offset);
+            auto ptr = rp::BaseRelativePointer::getPtr(segmentId, offset);
+            return cxx::success<popo::ServerPortData*>(reinterpret_cast<popo::ServerPortData*>(ptr));
+        }
+    }
+    else
+    {
+        if (receiveBuffer.getNumberOfElements() == 2U)
+        {
+            std::string IpcMessage1 = receiveBuffer.getElementAtIndex(0U);
+            std::string IpcMessage2 = receiveBuffer.getElementAtIndex(1U);
+
+            if (stringToIpcMessageType(IpcMessage1.c_str()) == IpcMessageType::ERROR)
+            {
+                LogError() << "Request server received no valid server port from RouDi.";
+                return cxx::error<IpcMessageErrorType>(stringToIpcMessageErrorType(IpcMessage2.c_str()));
+            }
+        }
+    }
+
+    LogError() << "Request server got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'";
+    return cxx::error<IpcMessageErrorType>(IpcMessageErrorType::REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE);
+}
+
 popo::InterfacePortData* PoshRuntimeImpl::getMiddlewareInterface(const capro::Interfaces interface,
                                                                  const NodeName_t& nodeName) noexcept
 {
@@ -64,7 +64,11 @@ void SharedMemoryUser::openDataSegments(const uint64_t segmentId,
                                           segment.m_size,
                                           accessMode,
                                           posix::OpenMode::OPEN_EXISTING,
-                                          posix::SharedMemoryObject::NO_ADDRESS_HINT)
+                                          posix::SharedMemoryObject::NO_ADDRESS_HINT,
+                                          S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP,
+                                          // the paging options apply per mapping and have to be repeated by every user
+                                          posix::PagingOptions{segment.m_memoryInfo.useHugePages,
+                                                               segment.m_memoryInfo.lockMemory})
             .and_then([this, &segment](auto& sharedMemoryObject) {
                 if (static_cast<uint32_t>(m_dataShmObjects.size()) >= MAX_SHM_SEGMENTS)
                 {
@@ -0,0 +1,213 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/popo/client.hpp"
+#include "iceoryx_posh/popo/server.hpp"
+#include "iceoryx_posh/popo/untyped_client.hpp"
+#include "iceoryx_posh/popo/untyped_server.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/testing/roudi_gtest.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+
+using namespace iox;
+using namespace iox::popo;
+
+struct AddRequest
+{
+    uint64_t augend{0U};
+    uint64_t addend{0U};
+};
+
+struct AddResponse
+{
+    uint64_t sum{0U};
+};
+
+class ClientServer_test : public RouDi_GTest
+{
+  public:
+    void SetUp()
+    {
+        runtime::PoshRuntime::initRuntime("ClientServer_test");
+        m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    };
+    void TearDown(){};
+
+    Watchdog m_watchdog{units::Duration::fromSeconds(5)};
+    capro::ServiceDescription m_serviceDescription{"ClientServer", "IntegrationTest", "AllHailHypnotoad"};
+};
+
+TEST_F(ClientServer_test, ClientConnectsToOfferedServer)
+{
+    Server<AddRequest, AddResponse> server{m_serviceDescription};
+    Client<AddRequest, AddResponse> client{m_serviceDescription};
+    this->InterOpWait();
+
+    EXPECT_THAT(client.getConnectionState(), Eq(ConnectionState::CONNECTED));
+    EXPECT_TRUE(server.isOffered());
+    EXPECT_TRUE(server.hasClients());
+}
+
+TEST_F(ClientServer_test, ClientWaitsForOfferWhenServerStopsOffer)
+{
+    Server<AddRequest, AddResponse> server{m_serviceDescription};
+    Client<AddRequest, AddResponse> client{m_serviceDescription};
+    this->InterOpWait();
+
+    server.stopOffer();
+    this->InterOpWait();
+
+    EXPECT_FALSE(server.isOffered());
+    EXPECT_THAT(client.getConnectionState(), Eq(ConnectionState::WAIT_FOR_OFFER));
+
+    server.offer();
+    this->InterOpWait();
+
+    EXPECT_THAT(client.getConnectionState(), Eq(ConnectionState::CONNECTED));
+}
+
+TEST_F(ClientServer_test, TypedRequestIsAnsweredWithTypedResponse)
+{
+    Server<AddRequest, AddResponse> server{m_serviceDescription};
+    Client<AddRequest, AddResponse> client{m_serviceDescription};
+    this->InterOpWait();
+
+    constexpr int64_t SEQUENCE_ID{73};
+    ASSERT_FALSE(client.loan()
+                     .and_then([&](auto& request) {
+                         request.getRequestHeader().setSequenceId(SEQUENCE_ID);
+                         request->augend = 40U;
+                         request->addend = 2U;
+                         request.send();
+                     })
+                     .has_error());
+
+    ASSERT_FALSE(server.take()
+                     .and_then([&](const auto& request) {
+                         ASSERT_FALSE(server.loan(request)
+                                          .and_then([&](auto& response) {
+                                              response->sum = request->augend + request->addend;
+                                              response.send();
+                                          })
+                                          .has_error());
+                     })
+                     .has_error());
+
+    ASSERT_FALSE(client.take()
+                     .and_then([&](const auto& response) {
+                         EXPECT_THAT(response->sum, Eq(42U));
+                         EXPECT_THAT(response.getResponseHeader().getSequenceId(), Eq(SEQUENCE_ID));
+                     })
+                     .has_error());
+}
+
+TEST_F(ClientServer_test, ResponsesAreOnlyDeliveredToTheRequestingClient)
+{
+    Server<AddRequest, AddResponse> server{m_serviceDescription};
+    Client<AddRequest, AddResponse> requestingClient{m_serviceDescription};
+    Client<AddRequest, AddResponse> otherClient{m_serviceDescription};
+    this->InterOpWait();
+
+    ASSERT_FALSE(requestingClient.loan()
+                     .and_then([&](auto& request) {
+                         request->augend = 1U;
+                         request->addend = 1U;
+                         request.send();
+                     })
+                     .has_error());
+
+    ASSERT_FALSE(server.take()
+                     .and_then([&](const auto& request) {
+                         server.loan(request).and_then([&](auto& response) {
+                             response->sum = request->augend + request->addend;
+                             response.send();
+                         });
+                     })
+                     .has_error());
+
+    EXPECT_FALSE(requestingClient.take().has_error());
+    auto otherResult = otherClient.take();
+    ASSERT_TRUE(otherResult.has_error());
+    EXPECT_THAT(otherResult.get_error(), Eq(ChunkReceiveResult::NO_CHUNK_AVAILABLE));
+}
+
+TEST_F(ClientServer_test, UntypedRequestIsAnsweredWithUntypedResponse)
+{
+    UntypedServer server{m_serviceDescription};
+    UntypedClient client{m_serviceDescription};
+    this->InterOpWait();
+
+    constexpr uint64_t REQUEST_DATA{0xC0FFEEU};
+    ASSERT_FALSE(client.loan(sizeof(uint64_t), alignof(uint64_t))
+                     .and_then([&](void* payload) {
+                         *static_cast<uint64_t*>(payload) = REQUEST_DATA;
+                         client.send(payload);
+                     })
+                     .has_error());
+
+    ASSERT_FALSE(server.take()
+                     .and_then([&](const void* requestPayload) {
+                         server.loan(RequestHeader::fromPayload(requestPayload), sizeof(uint64_t), alignof(uint64_t))
+                             .and_then([&](void* responsePayload) {
+                                 *static_cast<uint64_t*>(responsePayload) =
+                                     *static_cast<const uint64_t*>(requestPayload) + 1U;
+                                 server.send(responsePayload);
+                             });
+                         server.releaseRequest(requestPayload);
+                     })
+                     .has_error());
+
+    ASSERT_FALSE(client.take()
+                     .and_then([&](const void* responsePayload) {
+                         EXPECT_THAT(*static_cast<const uint64_t*>(responsePayload), Eq(REQUEST_DATA + 1U));
+                         client.releaseResponse(responsePayload);
+                     })
+                     .has_error());
+}
+
+TEST_F(ClientServer_test, WaitSetWakesUpServerOnRequestAndClientOnResponse)
+{
+    Server<AddRequest, AddResponse> server{m_serviceDescription};
+    Client<AddRequest, AddResponse> client{m_serviceDescription};
+    this->InterOpWait();
+
+    WaitSet<> waitSet;
+    ASSERT_FALSE(waitSet.attachState(server, ServerState::HAS_REQUEST).has_error());
+    ASSERT_FALSE(waitSet.attachEvent(client, ClientEvent::RESPONSE_RECEIVED).has_error());
+
+    client.loan().and_then([&](auto& request) { request.send(); });
+
+    auto notifications = waitSet.wait();
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_TRUE(notifications[0]->doesOriginateFrom(&server));
+
+    server.take().and_then(
+        [&](const auto& request) { server.loan(request).and_then([&](auto& response) { response.send(); }); });
+
+    notifications = waitSet.wait();
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_TRUE(notifications[0]->doesOriginateFrom(&client));
+    EXPECT_FALSE(client.take().has_error());
+}
+
+} // namespace
@@ -0,0 +1,188 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/cxx/deadline_timer.hpp"
+#include "iceoryx_hoofs/cxx/optional.hpp"
+#include "iceoryx_hoofs/log/logmanager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/typed_unique_id.hpp"
+#include "iceoryx_posh/internal/roudi/roudi.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_message.hpp"
+#include "iceoryx_posh/roudi/iceoryx_roudi_components.hpp"
+#include "test.hpp"
+
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::units::duration_literals;
+using iox::roudi::IceOryxRouDiComponents;
+using iox::roudi::RouDi;
+using iox::runtime::IpcMessage;
+using iox::runtime::IpcMessageType;
+
+/// @brief records the messages in the order in which they are processed instead of handling them
+class RecordingRouDi : public RouDi
+{
+  public:
+    explicit RecordingRouDi(IceOryxRouDiComponents& components, const uint32_t numberOfWorkerThreads)
+        : RouDi(components.rouDiMemoryManager,
+                components.portManager,
+                RouDi::RoudiStartupParameters{iox::roudi::MonitoringMode::OFF,
+                                              false,
+                                              RouDi::RuntimeMessagesThreadStart::DEFER_START,
+                                              iox::version::CompatibilityCheckLevel::OFF,
+                                              iox::roudi::PROCESS_DEFAULT_KILL_DELAY,
+                                              numberOfWorkerThreads})
+    {
+        startProcessRuntimeMessagesThread();
+    }
+
+    ~RecordingRouDi()
+    {
+        // the threads have to be stopped before the recorded messages are destroyed
+        shutdown();
+    }
+
+    void processMessage(const IpcMessage& message,
+                        const IpcMessageType&,
+                        const iox::RuntimeName_t& runtimeName) noexcept override
+    {
+        uint64_t sequenceNumber{0U};
+        EXPECT_TRUE(iox::cxx::convert::fromString(message.getElementAtIndex(2U).c_str(), sequenceNumber));
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_sequenceNumbers[runtimeName.c_str()].push_back(sequenceNumber);
+        m_threads[runtimeName.c_str()].insert(std::this_thread::get_id());
+        ++m_numberOfMessages;
+    }
+
+    uint64_t numberOfMessages()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_numberOfMessages;
+    }
+
+    std::mutex m_mutex;
+    std::map<std::string, std::vector<uint64_t>> m_sequenceNumbers;
+    std::map<std::string, std::set<std::thread::id>> m_threads;
+    uint64_t m_numberOfMessages{0U};
+};
+
+class RouDiRuntimeMessageDispatch_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        iox::popo::internal::setUniqueRouDiId(0U);
+        iox::log::LogManager::GetLogManager().SetDefaultLogLevel(iox::log::LogLevel::kWarn,
+                                                                 iox::log::LogLevelOutput::kHideLogLevel);
+        m_roudiComponents.emplace(iox::RouDiConfig_t().setDefaults());
+    }
+
+    void TearDown() override
+    {
+        m_roudiComponents.reset();
+        iox::popo::internal::unsetUniqueRouDiId();
+    }
+
+    static bool waitForRouDiIpcChannel()
+    {
+        // RouDi creates its IPC channel when the thread which receives the messages starts
+        iox::cxx::DeadlineTimer timeout(5_s);
+        while (!iox::runtime::IpcInterfaceUser(iox::roudi::IPC_CHANNEL_ROUDI_NAME).isInitialized())
+        {
+            if (timeout.hasExpired())
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return true;
+    }
+
+    static void sendMessages(const std::string& runtimeName, const uint64_t numberOfMessages)
+    {
+        iox::runtime::IpcInterfaceUser roudiIpcInterface{iox::roudi::IPC_CHANNEL_ROUDI_NAME};
+        ASSERT_TRUE(roudiIpcInterface.isInitialized());
+
+        iox::cxx::DeadlineTimer timeout(5_s);
+        for (uint64_t i = 0U; i < numberOfMessages; ++i)
+        {
+            IpcMessage message{iox::runtime::IpcMessageTypeToString(IpcMessageType::KEEPALIVE), runtimeName};
+            message << i;
+            while (!roudiIpcInterface.timedSend(message, 100_ms))
+            {
+                ASSERT_FALSE(timeout.hasExpired());
+            }
+        }
+    }
+
+    iox::cxx::optional<IceOryxRouDiComponents> m_roudiComponents;
+};
+
+TEST_F(RouDiRuntimeMessageDispatch_test, MessagesOfEachRuntimeAreProcessedInOrderBySameWorkerThread)
+{
+    constexpr uint32_t NUMBER_OF_WORKER_THREADS{4U};
+    constexpr uint64_t NUMBER_OF_RUNTIMES{8U};
+    constexpr uint64_t NUMBER_OF_MESSAGES_PER_RUNTIME{200U};
+    RecordingRouDi sut{m_roudiComponents.value(), NUMBER_OF_WORKER_THREADS};
+    ASSERT_TRUE(waitForRouDiIpcChannel());
+
+    std::vector<std::thread> runtimes;
+    for (uint64_t i = 0U; i < NUMBER_OF_RUNTIMES; ++i)
+    {
+        runtimes.emplace_back(sendMessages, "runtime" + std::to_string(i), NUMBER_OF_MESSAGES_PER_RUNTIME);
+    }
+    for (auto& runtime : runtimes)
+    {
+        runtime.join();
+    }
+
+    iox::cxx::DeadlineTimer timeout(5_s);
+    while (sut.numberOfMessages() < NUMBER_OF_RUNTIMES * NUMBER_OF_MESSAGES_PER_RUNTIME && !timeout.hasExpired())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    std::lock_guard<std::mutex> lock(sut.m_mutex);
+    ASSERT_THAT(sut.m_sequenceNumbers.size(), Eq(NUMBER_OF_RUNTIMES));
+    std::set<std::thread::id> usedWorkerThreads;
+    for (const auto& runtime : sut.m_sequenceNumbers)
+    {
+        const auto& sequenceNumbers = runtime.second;
+        ASSERT_THAT(sequenceNumbers.size(), Eq(NUMBER_OF_MESSAGES_PER_RUNTIME)) << runtime.first;
+        for (uint64_t i = 0U; i < NUMBER_OF_MESSAGES_PER_RUNTIME; ++i)
+        {
+            EXPECT_THAT(sequenceNumbers[i], Eq(i)) << runtime.first;
+        }
+
+        const auto& threads = sut.m_threads[runtime.first];
+        EXPECT_THAT(threads.size(), Eq(1U)) << runtime.first;
+        usedWorkerThreads.insert(threads.begin(), threads.end());
+    }
+    EXPECT_THAT(usedWorkerThreads.size(), Gt(1U));
+    EXPECT_THAT(usedWorkerThreads.count(std::this_thread::get_id()), Eq(0U));
+}
+
+} // namespace
@@ -60,6 +60,14 @@ class PoshRuntimeMock : public iox::runtime::PoshRuntime
                  iox::SubscriberPortUserType::MemberType_t*(const iox::capro::ServiceDescription&,
                                                             const iox::popo::SubscriberOptions&,
                                                             const iox::runtime::PortConfigInfo&));
+    MOCK_METHOD3(getMiddlewareClientMock,
+                 iox::popo::ClientPortData*(const iox::capro::ServiceDescription&,
+                                            const iox::popo::ClientOptions&,
+                                            const iox::runtime::PortConfigInfo&));
+    MOCK_METHOD3(getMiddlewareServerMock,
+                 iox::popo::ServerPortData*(const iox::capro::ServiceDescription&,
+                                            const iox::popo::ServerOptions&,
+                                            const iox::runtime::PortConfigInfo&));
     MOCK_METHOD2(getMiddlewareInterfaceMock,
                  iox::popo::InterfacePortData*(const iox::capro::Interfaces, const iox::NodeName_t&));
     MOCK_METHOD0(getMiddlewareApplicationMock, iox::popo::ApplicationPortData*());
@@ -122,6 +130,22 @@ class PoshRuntimeMock : public iox::runtime::PoshRuntime
         return getMiddlewareSubscriberMock(service, subscriberOptions, portConfigInfo);
     }
 
+    iox::popo::ClientPortData*
+    getMiddlewareClient(const iox::capro::ServiceDescription& service,
+                        const iox::popo::ClientOptions& clientOptions = {},
+                        const iox::runtime::PortConfigInfo& portConfigInfo = {}) noexcept override
+    {
+        return getMiddlewareClientMock(service, clientOptions, portConfigInfo);
+    }
+
+    iox::popo::ServerPortData*
+    getMiddlewareServer(const iox::capro::ServiceDescription& service,
+                        const iox::popo::ServerOptions& serverOptions = {},
+                        const iox::runtime::PortConfigInfo& portConfigInfo = {}) noexcept override
+    {
+        return getMiddlewareServerMock(service, serverOptions, portConfigInfo);
+    }
+
     iox::popo::InterfacePortData* getMiddlewareInterface(const iox::capro::Interfaces interface,
                                                          const iox::NodeName_t& nodeName = {}) noexcept override
     {
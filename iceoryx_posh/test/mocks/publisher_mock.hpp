@@ -19,6 +19,7 @@
 #define IOX_POSH_MOCKS_PUBLISHER_MOCK_HPP
 
 #include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/function_ref.hpp"
 #include "iceoryx_posh/popo/base_publisher.hpp"
 #include "iceoryx_posh/popo/publisher.hpp"
 #include "iceoryx_posh/popo/sample.hpp"
@@ -56,8 +57,17 @@ class MockPublisherPortUser
     MOCK_METHOD4(tryAllocateChunk,
                  iox::cxx::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>(
                      const uint32_t, const uint32_t, const uint32_t, const uint32_t));
+    MOCK_METHOD6(tryAllocateChunks,
+                 iox::cxx::expected<uint32_t, iox::popo::AllocationError>(
+                     const uint32_t,
+                     const uint32_t,
+                     const uint32_t,
+                     const uint32_t,
+                     const uint32_t,
+                     const iox::cxx::function_ref<void(iox::mepoo::ChunkHeader*)>));
     MOCK_METHOD1(releaseChunk, void(iox::mepoo::ChunkHeader* const));
     MOCK_METHOD1(sendChunk, void(iox::mepoo::ChunkHeader* const));
+    MOCK_METHOD2(sendChunks, void(iox::mepoo::ChunkHeader* const* const, const uint32_t));
     MOCK_METHOD0(tryGetPreviousChunk, iox::cxx::optional<iox::mepoo::ChunkHeader*>());
     MOCK_METHOD0(offer, void());
     MOCK_METHOD0(stopOffer, void());
@@ -19,6 +19,7 @@
 #define IOX_POSH_MOCKS_SUBSCRIBER_MOCK_HPP
 
 #include "iceoryx_hoofs/cxx/expected.hpp"
+#include "iceoryx_hoofs/cxx/function_ref.hpp"
 #include "iceoryx_hoofs/cxx/optional.hpp"
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
@@ -52,6 +53,9 @@ class MockSubscriberPortUser
     MOCK_METHOD0(unsubscribe, void());
     MOCK_CONST_METHOD0(getSubscriptionState, iox::SubscribeState());
     MOCK_METHOD0(tryGetChunk, iox::cxx::expected<const iox::mepoo::ChunkHeader*, iox::popo::ChunkReceiveResult>());
+    MOCK_METHOD2(tryGetChunks,
+                 iox::cxx::expected<uint64_t, iox::popo::ChunkReceiveResult>(
+                     const uint64_t, const iox::cxx::function_ref<void(const iox::mepoo::ChunkHeader*)>));
     MOCK_METHOD1(releaseChunk, void(const void* const));
     MOCK_METHOD0(releaseQueuedChunks, void());
     MOCK_CONST_METHOD0(hasNewChunks, bool());
@@ -79,6 +83,9 @@ class MockBaseSubscriber
     MOCK_CONST_METHOD0(hasData, bool());
     MOCK_METHOD0(hasMissedData, bool());
     MOCK_METHOD0(takeChunk, iox::cxx::expected<const iox::mepoo::ChunkHeader*, iox::popo::ChunkReceiveResult>());
+    MOCK_METHOD2(takeChunks,
+                 iox::cxx::expected<uint64_t, iox::popo::ChunkReceiveResult>(
+                     const uint64_t, const iox::cxx::function_ref<void(const iox::mepoo::ChunkHeader*)>));
     MOCK_METHOD0(releaseQueuedData, void());
     MOCK_METHOD1(invalidateTrigger, bool(const uint64_t));
     MOCK_METHOD1(disableEvent, void(const iox::popo::SubscriberEvent));
@@ -397,6 +397,84 @@ TEST_F(MemoryManager_test, emptyMemPoolDoesNotResultInAcquiringChunksFromOtherMe
     EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(0U));
 }
 
+TEST_F(MemoryManager_test, emptyMemPoolWithOverflowPolicyResultsInAcquiringChunksFromNextLargerMemPool)
+{
+    constexpr uint32_t CHUNK_COUNT{100};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    mempoolconf.setOverflowPolicy(iox::mepoo::MemPoolOverflowPolicy::USE_LARGER_MEMPOOL);
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (size_t i = 0; i < CHUNK_COUNT; i++)
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_64));
+    }
+
+    chunkStore.push_back(sut->getChunk(chunkSettings_64));
+    EXPECT_THAT(chunkStore.back(), Eq(true));
+    EXPECT_THAT(chunkStore.back().getChunkHeader()->chunkSize(), Eq(sut->getMemPoolInfo(2).m_chunkSize));
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_usedChunks, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, spilledChunksAreCountedAtTheExhaustedMemPool)
+{
+    constexpr uint32_t CHUNK_COUNT{10};
+    constexpr uint32_t NUMBER_OF_SPILLED_CHUNKS{3};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.setOverflowPolicy(iox::mepoo::MemPoolOverflowPolicy::USE_LARGER_MEMPOOL);
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (size_t i = 0; i < CHUNK_COUNT + NUMBER_OF_SPILLED_CHUNKS; i++)
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_32));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+    }
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_spilledChunks, Eq(NUMBER_OF_SPILLED_CHUNKS));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_spilledChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_spilledChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(NUMBER_OF_SPILLED_CHUNKS));
+}
+
+TEST_F(MemoryManager_test, getChunkWithOverflowPolicyWhenAllFittingMemPoolsAreExhaustedReturnsError)
+{
+    constexpr uint32_t CHUNK_COUNT{1U};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.setOverflowPolicy(iox::mepoo::MemPoolOverflowPolicy::USE_LARGER_MEMPOOL);
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    chunkStore.push_back(sut->getChunk(chunkSettings_32));
+    chunkStore.push_back(sut->getChunk(chunkSettings_32));
+
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::setTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel errorLevel) {
+            detectedError.emplace(error);
+            EXPECT_EQ(errorLevel, iox::ErrorLevel::MODERATE);
+        });
+
+    EXPECT_THAT(sut->getChunk(chunkSettings_32), Eq(false));
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_EQ(detectedError.value(), iox::Error::kMEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS);
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_spilledChunks, Eq(1U));
+}
+
 TEST_F(MemoryManager_test, freeChunkMultiMemPoolFullToEmptyToFull)
 {
     constexpr uint32_t CHUNK_COUNT{100U};
@@ -452,6 +530,315 @@ TEST_F(MemoryManager_test, freeChunkMultiMemPoolFullToEmptyToFull)
     EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(CHUNK_COUNT));
 }
 
+TEST_F(MemoryManager_test, getChunkWithManyMemPoolsOfSimilarSizeAcquiresChunkFromBestFittingMemPool)
+{
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t NUMBER_OF_MEMPOOLS{16U};
+    constexpr uint32_t CHUNK_SIZE_INCREMENT{8U};
+
+    for (uint32_t i = 0U; i < NUMBER_OF_MEMPOOLS; ++i)
+    {
+        mempoolconf.addMemPool({CHUNK_SIZE_128 + i * CHUNK_SIZE_INCREMENT, CHUNK_COUNT});
+    }
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (uint32_t i = 0U; i < NUMBER_OF_MEMPOOLS; ++i)
+    {
+        auto chunkSettingsResult = ChunkSettings::create(CHUNK_SIZE_128 + i * CHUNK_SIZE_INCREMENT,
+                                                         iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        ASSERT_FALSE(chunkSettingsResult.has_error());
+        chunkStore.push_back(sut->getChunk(chunkSettingsResult.value()));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+    }
+
+    for (uint32_t i = 0U; i < NUMBER_OF_MEMPOOLS; ++i)
+    {
+        EXPECT_THAT(sut->getMemPoolInfo(i).m_usedChunks, Eq(1U));
+    }
+}
+
+TEST_F(MemoryManager_test, getChunkWithMemPoolsSpanningManySizeClassesAcquiresChunkFromBestFittingMemPool)
+{
+    constexpr uint32_t CHUNK_COUNT{1U};
+    constexpr uint32_t NUMBER_OF_MEMPOOLS{12U};
+
+    for (uint32_t i = 0U; i < NUMBER_OF_MEMPOOLS; ++i)
+    {
+        mempoolconf.addMemPool({CHUNK_SIZE_32 << i, CHUNK_COUNT});
+    }
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (uint32_t i = 0U; i < NUMBER_OF_MEMPOOLS; ++i)
+    {
+        // one byte more than the next smaller mempool provides is the worst case for the mempool selection
+        const uint32_t userPayloadSize = (i == 0U) ? 1U : (CHUNK_SIZE_32 << (i - 1U)) + 1U;
+        auto chunkSettingsResult =
+            ChunkSettings::create(userPayloadSize, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        ASSERT_FALSE(chunkSettingsResult.has_error());
+        chunkStore.push_back(sut->getChunk(chunkSettingsResult.value()));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+        EXPECT_THAT(sut->getMemPoolInfo(i).m_usedChunks, Eq(1U));
+    }
+}
+
+TEST_F(MemoryManager_test, getChunkWithChunkCacheAndDisabledChunkCacheAcquiresOnlyOneChunk)
+{
+    constexpr uint32_t CHUNK_COUNT{2U * iox::mepoo::ChunkCache::CAPACITY};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkCache chunkCache;
+    auto chunk = sut->getChunk(chunkSettings_32, chunkCache);
+
+    EXPECT_THAT(chunk, Eq(true));
+    EXPECT_THAT(chunkCache.m_size, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(1U));
+}
+
+TEST_F(MemoryManager_test, getChunkWithEnabledChunkCacheRefillsChunkCacheFromBestFittingMemPool)
+{
+    constexpr uint32_t CHUNK_COUNT{2U * iox::mepoo::ChunkCache::CAPACITY};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.setChunkCacheEnabled(true);
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkCache chunkCache;
+    auto chunk = sut->getChunk(chunkSettings_64, chunkCache);
+
+    EXPECT_THAT(chunk, Eq(true));
+    EXPECT_THAT(chunk.getChunkHeader()->userPayloadSize(), Eq(CHUNK_SIZE_64));
+    EXPECT_THAT(chunkCache.m_memPoolIndex, Eq(1U));
+    EXPECT_THAT(chunkCache.m_size, Eq(iox::mepoo::ChunkCache::CAPACITY - 1U));
+    // the cached chunks are not available for other users of the mempool and are therefore accounted as used
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(iox::mepoo::ChunkCache::CAPACITY));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_minFreeChunks, Eq(CHUNK_COUNT - iox::mepoo::ChunkCache::CAPACITY));
+}
+
+TEST_F(MemoryManager_test, getChunkWithEnabledChunkCacheServesChunksFromChunkCache)
+{
+    constexpr uint32_t CHUNK_COUNT{2U * iox::mepoo::ChunkCache::CAPACITY};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.setChunkCacheEnabled(true);
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkCache chunkCache;
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (uint32_t i = 0U; i < iox::mepoo::ChunkCache::CAPACITY; ++i)
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_32, chunkCache));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+    }
+
+    EXPECT_THAT(chunkCache.m_size, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(iox::mepoo::ChunkCache::CAPACITY));
+
+    chunkStore.clear();
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, getChunkWithEnabledChunkCacheAcquiresAllChunksOfMemPool)
+{
+    constexpr uint32_t CHUNK_COUNT{iox::mepoo::ChunkCache::CAPACITY + 3U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.setChunkCacheEnabled(true);
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkCache chunkCache;
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (uint32_t i = 0U; i < CHUNK_COUNT; ++i)
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_32, chunkCache));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+    }
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_minFreeChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, getChunkWithEnabledChunkCacheAndExhaustedMemPoolFails)
+{
+    constexpr uint32_t CHUNK_COUNT{3U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.setChunkCacheEnabled(true);
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkCache chunkCache;
+    std::vector<iox::mepoo::SharedChunk> chunkStore;
+    for (uint32_t i = 0U; i < CHUNK_COUNT; ++i)
+    {
+        chunkStore.push_back(sut->getChunk(chunkSettings_32, chunkCache));
+        EXPECT_THAT(chunkStore.back(), Eq(true));
+    }
+
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::setTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel errorLevel) {
+            detectedError.emplace(error);
+            EXPECT_THAT(errorLevel, Eq(iox::ErrorLevel::MODERATE));
+        });
+
+    EXPECT_THAT(sut->getChunk(chunkSettings_32, chunkCache), Eq(false));
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::Error::kMEPOO__MEMPOOL_GETCHUNK_POOL_IS_RUNNING_OUT_OF_CHUNKS));
+}
+
+TEST_F(MemoryManager_test, getChunkWithChunkCacheOfOtherMemPoolReleasesChunkCache)
+{
+    constexpr uint32_t CHUNK_COUNT{2U * iox::mepoo::ChunkCache::CAPACITY};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.setChunkCacheEnabled(true);
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkCache chunkCache;
+    auto chunk32 = sut->getChunk(chunkSettings_32, chunkCache);
+    auto chunk64 = sut->getChunk(chunkSettings_64, chunkCache);
+
+    EXPECT_THAT(chunk32, Eq(true));
+    EXPECT_THAT(chunk64, Eq(true));
+    EXPECT_THAT(chunkCache.m_memPoolIndex, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(iox::mepoo::ChunkCache::CAPACITY));
+}
+
+TEST_F(MemoryManager_test, releaseChunkCacheReturnsCachedChunksToMemPool)
+{
+    constexpr uint32_t CHUNK_COUNT{2U * iox::mepoo::ChunkCache::CAPACITY};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.setChunkCacheEnabled(true);
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::ChunkCache chunkCache;
+    auto chunk = sut->getChunk(chunkSettings_32, chunkCache);
+    sut->releaseChunkCache(chunkCache);
+
+    EXPECT_THAT(chunkCache.m_size, Eq(0U));
+    EXPECT_THAT(chunkCache.m_memPoolIndex, Eq(iox::mepoo::ChunkCache::NO_MEMPOOL));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(1U));
+
+    chunk = nullptr;
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, getChunksAcquiresRequestedNumberOfChunksFromBestFittingMemPool)
+{
+    constexpr uint32_t CHUNK_COUNT{2U * iox::mepoo::MemoryManager::MAX_CHUNKS_PER_BATCH};
+    constexpr uint32_t NUMBER_OF_REQUESTED_CHUNKS{iox::mepoo::MemoryManager::MAX_CHUNKS_PER_BATCH + 3U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::SharedChunk chunks[NUMBER_OF_REQUESTED_CHUNKS];
+    EXPECT_THAT(sut->getChunks(chunkSettings_64, chunks, NUMBER_OF_REQUESTED_CHUNKS), Eq(NUMBER_OF_REQUESTED_CHUNKS));
+
+    for (const auto& chunk : chunks)
+    {
+        ASSERT_THAT(chunk, Eq(true));
+        EXPECT_THAT(chunk.getChunkHeader()->userPayloadSize(), Eq(CHUNK_SIZE_64));
+    }
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(NUMBER_OF_REQUESTED_CHUNKS));
+}
+
+TEST_F(MemoryManager_test, getChunksAcquiresRemainingChunksWhenMemPoolRunsOutOfChunks)
+{
+    constexpr uint32_t CHUNK_COUNT{5U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::mepoo::SharedChunk chunks[2U * CHUNK_COUNT];
+    EXPECT_THAT(sut->getChunks(chunkSettings_32, chunks, 2U * CHUNK_COUNT), Eq(CHUNK_COUNT));
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(0U));
+    EXPECT_THAT(chunks[CHUNK_COUNT], Eq(false));
+}
+
+TEST_F(MemoryManager_test, getChunksWithOverflowPolicyAcquiresRemainingChunksFromLargerMemPool)
+{
+    constexpr uint32_t CHUNK_COUNT{5U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.setOverflowPolicy(iox::mepoo::MemPoolOverflowPolicy::USE_LARGER_MEMPOOL);
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    constexpr uint32_t NUMBER_OF_REQUESTED_CHUNKS{CHUNK_COUNT + 2U};
+    iox::mepoo::SharedChunk chunks[NUMBER_OF_REQUESTED_CHUNKS];
+    EXPECT_THAT(sut->getChunks(chunkSettings_32, chunks, NUMBER_OF_REQUESTED_CHUNKS), Eq(NUMBER_OF_REQUESTED_CHUNKS));
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_spilledChunks, Eq(2U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(2U));
+}
+
+TEST_F(MemoryManager_test, getChunksWithTooLargeChunkSizeReturnsError)
+{
+    mempoolconf.addMemPool({CHUNK_SIZE_32, 5U});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::setTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel errorLevel) {
+            detectedError.emplace(error);
+            EXPECT_THAT(errorLevel, Eq(iox::ErrorLevel::SEVERE));
+        });
+
+    iox::mepoo::SharedChunk chunks[2U];
+    EXPECT_THAT(sut->getChunks(chunkSettings_64, chunks, 2U), Eq(0U));
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::Error::kMEPOO__MEMPOOL_GETCHUNK_CHUNK_IS_TOO_LARGE));
+}
+
+TEST_F(MemoryManager_test, releaseChunksReturnsChunksOfAllMemPools)
+{
+    constexpr uint32_t CHUNK_COUNT{2U * iox::mepoo::MemoryManager::MAX_CHUNKS_PER_BATCH};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    std::vector<iox::mepoo::ShmSafeUnmanagedChunk> unmanagedChunks;
+    for (uint32_t i = 0U; i < CHUNK_COUNT; ++i)
+    {
+        unmanagedChunks.emplace_back(sut->getChunk(chunkSettings_32));
+        unmanagedChunks.emplace_back(sut->getChunk(chunkSettings_64));
+    }
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_COUNT));
+
+    iox::mepoo::MemoryManager::releaseChunks(unmanagedChunks.data(), unmanagedChunks.size());
+
+    for (const auto& unmanagedChunk : unmanagedChunks)
+    {
+        EXPECT_TRUE(unmanagedChunk.isLogicalNullptr());
+    }
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, releaseChunksDoesNotReturnChunksWithOtherOwners)
+{
+    constexpr uint32_t CHUNK_COUNT{4U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkWithOtherOwner = sut->getChunk(chunkSettings_32);
+    iox::mepoo::ShmSafeUnmanagedChunk unmanagedChunks[] = {
+        iox::mepoo::ShmSafeUnmanagedChunk(chunkWithOtherOwner),
+        iox::mepoo::ShmSafeUnmanagedChunk(sut->getChunk(chunkSettings_32)),
+        iox::mepoo::ShmSafeUnmanagedChunk()};
+
+    iox::mepoo::MemoryManager::releaseChunks(unmanagedChunks, 3U);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(1U));
+    chunkWithOtherOwner = nullptr;
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
 TEST_F(MemoryManager_test, getChunkWithUserPayloadSizeZeroShouldNotFail)
 {
     constexpr uint32_t USER_PAYLOAD_SIZE{0U};
@@ -196,6 +196,62 @@ TEST_F(MemPool_test, GetMinFreeMethodReturnsTheNumberOfFreeChunks)
     }
 }
 
+TEST_F(MemPool_test, GetChunksMethodAcquiresRequestedNumberOfChunks)
+{
+    constexpr uint32_t NUMBER_OF_REQUESTED_CHUNKS{10U};
+    uint32_t chunkIndices[NUMBER_OF_REQUESTED_CHUNKS];
+
+    EXPECT_THAT(sut.getChunks(chunkIndices, NUMBER_OF_REQUESTED_CHUNKS), Eq(NUMBER_OF_REQUESTED_CHUNKS));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_REQUESTED_CHUNKS));
+    EXPECT_THAT(sut.getMinFree(), Eq(NUMBER_OF_CHUNKS - NUMBER_OF_REQUESTED_CHUNKS));
+    for (uint32_t i = 0U; i < NUMBER_OF_REQUESTED_CHUNKS; ++i)
+    {
+        EXPECT_THAT(sut.pointerToIndex(sut.indexToPointer(chunkIndices[i])), Eq(chunkIndices[i]));
+    }
+}
+
+TEST_F(MemPool_test, GetChunksMethodAcquiresRemainingChunksWhenMempoolRunsOutOfChunks)
+{
+    uint32_t chunkIndices[NUMBER_OF_CHUNKS + 1U];
+
+    EXPECT_THAT(sut.getChunks(chunkIndices, NUMBER_OF_CHUNKS + 1U), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(sut.getChunks(chunkIndices, 1U), Eq(0U));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(sut.getMinFree(), Eq(0U));
+}
+
+TEST_F(MemPool_test, FreeChunksMethodReturnsAllChunks)
+{
+    constexpr uint32_t NUMBER_OF_REQUESTED_CHUNKS{10U};
+    uint32_t chunkIndices[NUMBER_OF_REQUESTED_CHUNKS];
+    ASSERT_THAT(sut.getChunks(chunkIndices, NUMBER_OF_REQUESTED_CHUNKS), Eq(NUMBER_OF_REQUESTED_CHUNKS));
+
+    sut.freeChunks(chunkIndices, NUMBER_OF_REQUESTED_CHUNKS);
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(sut.getMinFree(), Eq(NUMBER_OF_CHUNKS - NUMBER_OF_REQUESTED_CHUNKS));
+}
+
+TEST_F(MemPool_test, FreeChunksMethodWhenTheSameChunksAreFreedTwiceReturnsError)
+{
+    constexpr uint32_t NUMBER_OF_REQUESTED_CHUNKS{10U};
+    uint32_t chunkIndices[NUMBER_OF_REQUESTED_CHUNKS];
+    ASSERT_THAT(sut.getChunks(chunkIndices, NUMBER_OF_REQUESTED_CHUNKS), Eq(NUMBER_OF_REQUESTED_CHUNKS));
+    sut.freeChunks(chunkIndices, NUMBER_OF_REQUESTED_CHUNKS);
+
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::setTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel errorLevel) {
+            detectedError.emplace(error);
+            EXPECT_THAT(errorLevel, Eq(iox::ErrorLevel::FATAL));
+        });
+
+    sut.freeChunks(chunkIndices, NUMBER_OF_REQUESTED_CHUNKS);
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::Error::kPOSH__MEMPOOL_POSSIBLE_DOUBLE_FREE));
+}
+
 TEST_F(MemPool_test, dieWhenMempoolChunkSizeIsSmallerThan32Bytes)
 {
     EXPECT_DEATH({ iox::mepoo::MemPool sut(12, 10, allocator, allocator); }, ".*");
@@ -68,9 +68,11 @@ class MePooSegment_test : public Test
                                 const AccessMode accessMode,
                                 const OpenMode openMode,
                                 const void* baseAddressHint,
-                                const mode_t permissions)
+                                const mode_t permissions,
+                                const PagingOptions pagingOptions)
             : m_memorySizeInBytes(memorySizeInBytes)
             , m_baseAddressHint(const_cast<void*>(baseAddressHint))
+            , m_pagingOptions(pagingOptions)
         {
             if (createVerificator)
             {
@@ -116,6 +118,7 @@ class MePooSegment_test : public Test
 
         uint64_t m_memorySizeInBytes{0};
         void* m_baseAddressHint{nullptr};
+        PagingOptions m_pagingOptions;
         static constexpr int MEM_SIZE = 100000;
         char memory[MEM_SIZE];
         std::shared_ptr<iox::posix::Allocator> allocator{new iox::posix::Allocator(memory, MEM_SIZE)};
@@ -185,6 +188,26 @@ TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(GetSharedMemoryObject))
     EXPECT_THAT(sut2.getSharedMemoryObject().getSizeInBytes(), Eq(memorySizeInBytes));
 }
 
+TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(PagingOptionsAreTakenFromMemoryInfo))
+{
+    MemoryInfo memoryInfo;
+    memoryInfo.useHugePages = true;
+    memoryInfo.lockMemory = true;
+    MePooSegment<SharedMemoryObject_MOCK, MemoryManager> sut2{
+        mepooConfig, m_managementAllocator, PosixGroup{"iox_roudi_test1"}, PosixGroup{"iox_roudi_test2"}, memoryInfo};
+
+    EXPECT_TRUE(sut2.getSharedMemoryObject().m_pagingOptions.useHugePages);
+    EXPECT_TRUE(sut2.getSharedMemoryObject().m_pagingOptions.lockPages);
+    EXPECT_TRUE(sut2.getMemoryInfo().useHugePages);
+    EXPECT_TRUE(sut2.getMemoryInfo().lockMemory);
+}
+
+TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(PagingOptionsAreDisabledByDefault))
+{
+    EXPECT_FALSE(sut.getSharedMemoryObject().m_pagingOptions.useHugePages);
+    EXPECT_FALSE(sut.getSharedMemoryObject().m_pagingOptions.lockPages);
+}
+
 TEST_F(MePooSegment_test, ADD_TEST_WITH_ADDITIONAL_USER(GetReaderGroup))
 {
     EXPECT_THAT(sut.getReaderGroup(), Eq(iox::posix::PosixGroup("iox_roudi_test1")));
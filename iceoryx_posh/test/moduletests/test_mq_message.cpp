@@ -247,6 +247,37 @@ TEST_F(IpcMessage_test, getElementAtIndex)
     EXPECT_THAT(message2.getElementAtIndex(2), Eq("13"));
 }
 
+TEST_F(IpcMessage_test, getElementAtIndexAsCxxString)
+{
+    IpcMessage message1({"fuu", "", "bla"});
+
+    iox::cxx::string<16> element("unchanged");
+    EXPECT_TRUE(message1.getElementAtIndex(0, element));
+    EXPECT_THAT(element, Eq(iox::cxx::string<16>("fuu")));
+    EXPECT_TRUE(message1.getElementAtIndex(1, element));
+    EXPECT_THAT(element, Eq(iox::cxx::string<16>("")));
+    EXPECT_TRUE(message1.getElementAtIndex(2, element));
+    EXPECT_THAT(element, Eq(iox::cxx::string<16>("bla")));
+}
+
+TEST_F(IpcMessage_test, getElementAtIndexAsCxxStringTruncatesTooLongElement)
+{
+    IpcMessage message1({"abcdefgh"});
+
+    iox::cxx::string<4> element;
+    EXPECT_TRUE(message1.getElementAtIndex(0, element));
+    EXPECT_THAT(element, Eq(iox::cxx::string<4>("abcd")));
+}
+
+TEST_F(IpcMessage_test, getElementAtIndexAsCxxStringFailsForNonExistingElement)
+{
+    IpcMessage message1("fuu,bar,");
+
+    iox::cxx::string<16> element("unchanged");
+    EXPECT_FALSE(message1.getElementAtIndex(2, element));
+    EXPECT_THAT(element, Eq(iox::cxx::string<16>("unchanged")));
+}
+
 TEST_F(IpcMessage_test, isValidEntry)
 {
     IpcMessage message;
@@ -436,5 +467,56 @@ TEST_F(IpcMessage_test, setMessage)
     EXPECT_THAT(message1.isValid(), Eq(false));
 }
 
+TEST_F(IpcMessage_test, getElementAtIndexAfterSetMessageAndAddEntry)
+{
+    IpcMessage message1;
+
+    message1.setMessage("asd1,,asd3,");
+    message1.addEntry("asd4");
+    EXPECT_THAT(message1.getNumberOfElements(), Eq(4u));
+    EXPECT_THAT(message1.getElementAtIndex(0), Eq("asd1"));
+    EXPECT_THAT(message1.getElementAtIndex(1), Eq(""));
+    EXPECT_THAT(message1.getElementAtIndex(2), Eq("asd3"));
+    EXPECT_THAT(message1.getElementAtIndex(3), Eq("asd4"));
+    EXPECT_THAT(message1.getElementAtIndex(4), Eq(""));
+
+    message1.clearMessage();
+    EXPECT_THAT(message1.getElementAtIndex(0), Eq(""));
+}
+
+TEST_F(IpcMessage_test, getElementAtIndexWithMoreElementsThanIndexedSeparators)
+{
+    constexpr uint32_t NUMBER_OF_ELEMENTS{40U};
+    IpcMessage message1;
+    std::string message2String;
+    for (uint32_t i = 0U; i < NUMBER_OF_ELEMENTS; ++i)
+    {
+        message1.addEntry(i);
+        message2String += std::to_string(i) + ",";
+    }
+    IpcMessage message2(message2String);
+
+    for (const auto& message : {message1, message2})
+    {
+        EXPECT_THAT(message.isValid(), Eq(true));
+        EXPECT_THAT(message.getNumberOfElements(), Eq(NUMBER_OF_ELEMENTS));
+        for (uint32_t i = 0U; i < NUMBER_OF_ELEMENTS; ++i)
+        {
+            EXPECT_THAT(message.getElementAtIndex(i), Eq(std::to_string(i)));
+            iox::cxx::string<8U> element;
+            EXPECT_THAT(message.getElementAtIndex(i, element), Eq(true));
+            EXPECT_THAT(element.c_str(), StrEq(std::to_string(i)));
+        }
+        EXPECT_THAT(message.getElementAtIndex(NUMBER_OF_ELEMENTS), Eq(""));
+        iox::cxx::string<8U> element;
+        EXPECT_THAT(message.getElementAtIndex(NUMBER_OF_ELEMENTS, element), Eq(false));
+    }
+
+    message2.setMessage(message2String + "tail");
+    EXPECT_THAT(message2.isValid(), Eq(false));
+    EXPECT_THAT(message2.getElementAtIndex(NUMBER_OF_ELEMENTS - 1U), Eq(std::to_string(NUMBER_OF_ELEMENTS - 1U)));
+    EXPECT_THAT(message2.getElementAtIndex(NUMBER_OF_ELEMENTS), Eq(""));
+}
+
 } // namespace
 #endif
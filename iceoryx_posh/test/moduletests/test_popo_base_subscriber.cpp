@@ -60,6 +60,7 @@ class StubbedBaseSubscriber : public iox::popo::BaseSubscriber<port_t>
     using SubscriberParent::enableEvent;
     using SubscriberParent::enableState;
     using SubscriberParent::takeChunk;
+    using SubscriberParent::takeChunks;
 
     using SubscriberParent::port;
 };
@@ -156,6 +157,44 @@ TEST_F(BaseSubscriberTest, ReceiveForwardsErrorsFromUnderlyingPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(BaseSubscriberTest, TakeChunksForwardsAllChunksFromUnderlyingPort)
+{
+    // ===== Setup ===== //
+    constexpr uint64_t MAX_NUMBER_OF_CHUNKS{3U};
+    EXPECT_CALL(sut.port(), tryGetChunks(MAX_NUMBER_OF_CHUNKS, _))
+        .WillOnce(Invoke(
+            [&](const uint64_t, const iox::cxx::function_ref<void(const iox::mepoo::ChunkHeader*)> callable) {
+                callable(chunkMock.chunkHeader());
+                callable(chunkMock.chunkHeader());
+                return iox::cxx::success<uint64_t>(2U);
+            }));
+    // ===== Test ===== //
+    uint64_t numberOfCalls{0U};
+    auto result = sut.takeChunks(MAX_NUMBER_OF_CHUNKS, [&](const iox::mepoo::ChunkHeader* chunkHeader) {
+        EXPECT_EQ(chunkHeader, chunkMock.chunkHeader());
+        ++numberOfCalls;
+    });
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value(), 2U);
+    EXPECT_EQ(numberOfCalls, 2U);
+    // ===== Cleanup ===== //
+}
+
+TEST_F(BaseSubscriberTest, TakeChunksForwardsErrorsFromUnderlyingPort)
+{
+    // ===== Setup ===== //
+    EXPECT_CALL(sut.port(), tryGetChunks)
+        .WillOnce(Return(ByMove(iox::cxx::error<iox::popo::ChunkReceiveResult>(
+            iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL))));
+    // ===== Test ===== //
+    auto result = sut.takeChunks(1U, [](const iox::mepoo::ChunkHeader*) {});
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL, result.get_error());
+    // ===== Cleanup ===== //
+}
+
 TEST_F(BaseSubscriberTest, ClearReceiveBufferCallForwardedToUnderlyingSubscriberPort)
 {
     // ===== Setup ===== //
@@ -371,6 +371,70 @@ TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithMultipleQueuesMult
     EXPECT_THAT(sut.getHistorySize(), Eq(limit));
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToAllStoredQueuesWithMultipleQueuesDeliversAllChunksInOrder)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint32_t NUMBER_OF_QUEUES{5U};
+    constexpr uint32_t NUMBER_OF_CHUNKS{4U};
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    SharedChunk chunks[NUMBER_OF_CHUNKS];
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks[i] = this->allocateChunk(i * 34U);
+    }
+    EXPECT_THAT(sut.deliverBatchToAllStoredQueues(chunks, NUMBER_OF_CHUNKS), Eq(0U));
+
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData[i].get());
+        for (auto k = 0U; k < NUMBER_OF_CHUNKS; ++k)
+        {
+            auto maybeSharedChunk = queue.tryPop();
+            ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+            EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(k * 34U));
+        }
+        EXPECT_THAT(queue.empty(), Eq(true));
+    }
+    EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToAllStoredQueuesReturnsNumberOfLostChunks)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t QUEUE_CAPACITY{2U};
+    constexpr uint32_t NUMBER_OF_CHUNKS{5U};
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(QUEUE_CAPACITY);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    SharedChunk chunks[NUMBER_OF_CHUNKS];
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks[i] = this->allocateChunk(i);
+    }
+    EXPECT_THAT(sut.deliverBatchToAllStoredQueues(chunks, NUMBER_OF_CHUNKS), Eq(NUMBER_OF_CHUNKS - QUEUE_CAPACITY));
+    EXPECT_THAT(queue.hasLostChunks(), Eq(true));
+
+    // the oldest chunks are discarded
+    for (auto i = NUMBER_OF_CHUNKS - QUEUE_CAPACITY; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+    }
+}
+
 TYPED_TEST(ChunkDistributor_test, AddToHistoryWithoutQueues)
 {
     auto sutData = this->getChunkDistributorData();
@@ -474,6 +538,95 @@ TYPED_TEST(ChunkDistributor_test, DeliverToQueueDirectlyWhenAddedDoesNotChangeHi
     EXPECT_THAT(sut.getHistorySize(), Eq(0u));
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverToQueueWithUniqueIdAndCorrectIndexWhenAdded)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    queueData->m_uniqueId = iox::UniquePortId();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    auto chunk = this->allocateChunk(1313);
+    EXPECT_FALSE(sut.deliverToQueue(queueData->m_uniqueId, 0U, chunk).has_error());
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    auto maybeSharedChunk = queue.tryPop();
+
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(1313u));
+    EXPECT_THAT(sut.getHistorySize(), Eq(0u));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToQueueWithUniqueIdAndOutdatedIndexFindsTheQueue)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto otherQueueData = this->getChunkQueueData();
+    otherQueueData->m_uniqueId = iox::UniquePortId();
+    ASSERT_FALSE(sut.tryAddQueue(otherQueueData.get()).has_error());
+    auto queueData = this->getChunkQueueData();
+    queueData->m_uniqueId = iox::UniquePortId();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    auto chunk = this->allocateChunk(4242);
+    EXPECT_FALSE(sut.deliverToQueue(queueData->m_uniqueId, 0U, chunk).has_error());
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(4242u));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> otherQueue(otherQueueData.get());
+    EXPECT_FALSE(otherQueue.tryPop().has_value());
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToQueueWithUniqueIdWhenNotAddedFails)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    queueData->m_uniqueId = iox::UniquePortId();
+
+    auto chunk = this->allocateChunk(73);
+    auto result = sut.deliverToQueue(queueData->m_uniqueId, 0U, chunk);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.get_error(), Eq(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER));
+}
+
+TYPED_TEST(ChunkDistributor_test, GetQueueIndexReturnsIndexOfAddedQueue)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto firstQueueData = this->getChunkQueueData();
+    firstQueueData->m_uniqueId = iox::UniquePortId();
+    ASSERT_FALSE(sut.tryAddQueue(firstQueueData.get()).has_error());
+    auto secondQueueData = this->getChunkQueueData();
+    secondQueueData->m_uniqueId = iox::UniquePortId();
+    ASSERT_FALSE(sut.tryAddQueue(secondQueueData.get()).has_error());
+
+    auto index = sut.getQueueIndex(secondQueueData->m_uniqueId, 0U);
+
+    ASSERT_TRUE(index.has_value());
+    EXPECT_THAT(*index, Eq(1U));
+}
+
+TYPED_TEST(ChunkDistributor_test, GetQueueIndexReturnsNothingForUnknownQueue)
+{
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    queueData->m_uniqueId = iox::UniquePortId();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    EXPECT_FALSE(sut.getQueueIndex(iox::UniquePortId(), 0U).has_value());
+}
+
 TYPED_TEST(ChunkDistributor_test, DeliverHistoryOnAddWithLessThanAvailable)
 {
     auto sutData = this->getChunkDistributorData();
@@ -590,6 +743,44 @@ TYPED_TEST(ChunkDistributor_test, DeliverToSingleQueueBlocksWhenOptionsAreSetToB
     EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(152U));
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToBlockingQueueDeliversAllChunksWhenSpaceBecomesAvailable)
+{
+    auto sutData = this->getChunkDistributorData(SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PUBLISHER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+
+    constexpr uint32_t NUMBER_OF_CHUNKS{3U};
+    SharedChunk chunks[NUMBER_OF_CHUNKS];
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks[i] = this->allocateChunk(i);
+    }
+
+    std::atomic_bool wasBatchDelivered{false};
+    std::thread t1([&] {
+        EXPECT_THAT(sut.deliverBatchToAllStoredQueues(chunks, NUMBER_OF_CHUNKS), Eq(0U));
+        wasBatchDelivered = true;
+    });
+
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        iox::cxx::optional<SharedChunk> maybeSharedChunk;
+        while (!(maybeSharedChunk = queue.tryPop()).has_value())
+        {
+            std::this_thread::yield();
+        }
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+    }
+
+    t1.join(); // join needs to be before the load to ensure the wasBatchDelivered store happens before the read
+    EXPECT_THAT(wasBatchDelivered.load(), Eq(true));
+}
+
 TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBecomesSpaceAvailable)
 {
     auto sutData = this->getChunkDistributorData(SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER);
@@ -647,4 +838,146 @@ TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBec
     }
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverToBlockingQueueDropsChunkWhenMaxBlockingTimeHasPassed)
+{
+    auto sutData = std::make_shared<typename TestFixture::ChunkDistributorData_t>(
+        SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER, this->HISTORY_SIZE, iox::units::Duration::fromMilliseconds(10U));
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PUBLISHER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(155U));
+    sut.deliverToAllStoredQueues(this->allocateChunk(152U));
+
+    EXPECT_TRUE(queue.hasLostChunks());
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(155U));
+    EXPECT_FALSE(queue.tryPop().has_value());
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovingBlockingQueueUnblocksDelivery)
+{
+    auto sutData = this->getChunkDistributorData(SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PUBLISHER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(155U));
+
+    auto threadSyncSemaphore = iox::posix::Semaphore::create(iox::posix::CreateUnnamedSingleProcessSemaphore, 0U);
+    std::atomic_bool wasChunkDelivered{false};
+    std::thread t1([&] {
+        ASSERT_FALSE(threadSyncSemaphore->post().has_error());
+        sut.deliverToAllStoredQueues(this->allocateChunk(152U));
+        wasChunkDelivered = true;
+    });
+
+    ASSERT_FALSE(threadSyncSemaphore->wait().has_error());
+    std::this_thread::sleep_for(std::chrono::milliseconds(this->TIMEOUT_IN_MS));
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(false));
+
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+
+    t1.join(); // join needs to be before the load to ensure the wasChunkDelivered store happens before the read
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(true));
+
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(155U));
+    EXPECT_FALSE(queue.tryPop().has_value());
+}
+
+TYPED_TEST(ChunkDistributor_test, AddingQueueWhileDeliveryIsBlockedKeepsTheDeliveryBlocked)
+{
+    auto sutData = this->getChunkDistributorData(SubscriberTooSlowPolicy::WAIT_FOR_SUBSCRIBER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PUBLISHER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+    auto addedQueueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PUBLISHER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> addedQueue(addedQueueData.get());
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(155U));
+
+    auto threadSyncSemaphore = iox::posix::Semaphore::create(iox::posix::CreateUnnamedSingleProcessSemaphore, 0U);
+    std::atomic_bool wasChunkDelivered{false};
+    std::thread t1([&] {
+        ASSERT_FALSE(threadSyncSemaphore->post().has_error());
+        sut.deliverToAllStoredQueues(this->allocateChunk(152U));
+        wasChunkDelivered = true;
+    });
+
+    ASSERT_FALSE(threadSyncSemaphore->wait().has_error());
+    std::this_thread::sleep_for(std::chrono::milliseconds(this->TIMEOUT_IN_MS));
+
+    // the blocked delivery is woken up by the modification and waits again for the full queue
+    ASSERT_FALSE(sut.tryAddQueue(addedQueueData.get(), 0U).has_error());
+    std::this_thread::sleep_for(std::chrono::milliseconds(this->TIMEOUT_IN_MS));
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(false));
+
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(155U));
+
+    t1.join(); // join needs to be before the load to ensure the wasChunkDelivered store happens before the read
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(true));
+
+    maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(152U));
+    EXPECT_FALSE(addedQueue.tryPop().has_value());
+}
+
+TYPED_TEST(ChunkDistributor_test, AddingAndRemovingQueuesWhileDeliveringDoesNotAffectOtherQueues)
+{
+    // no history, otherwise the mempool would run out of chunks
+    auto sutData = std::make_shared<typename TestFixture::ChunkDistributorData_t>(
+        SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA, 0U);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto permanentQueueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> permanentQueue(permanentQueueData.get());
+    permanentQueue.setCapacity(1U);
+    ASSERT_FALSE(sut.tryAddQueue(permanentQueueData.get()).has_error());
+
+    auto changingQueueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> changingQueue(changingQueueData.get());
+    changingQueue.setCapacity(1U);
+
+    constexpr uint32_t NUMBER_OF_CHUNKS{1000U};
+    std::atomic_bool isDelivering{true};
+    std::thread publisher([&] {
+        for (uint32_t i = 1U; i <= NUMBER_OF_CHUNKS; ++i)
+        {
+            sut.deliverToAllStoredQueues(this->allocateChunk(i));
+        }
+        isDelivering = false;
+    });
+
+    while (isDelivering)
+    {
+        ASSERT_FALSE(sut.tryAddQueue(changingQueueData.get()).has_error());
+        ASSERT_FALSE(sut.tryRemoveQueue(changingQueueData.get()).has_error());
+    }
+    publisher.join();
+
+    auto maybeSharedChunk = permanentQueue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(permanentQueue.empty(), Eq(true));
+}
+
 } // namespace
@@ -28,6 +28,9 @@
 
 #include "test.hpp"
 
+#include <atomic>
+#include <thread>
+
 namespace
 {
 using namespace ::testing;
@@ -69,18 +72,39 @@ class ChunkQueue_testBase
     static constexpr uint32_t RESIZED_CAPACITY{5U};
 };
 
-template <typename PolicyType, iox::cxx::VariantQueueTypes VariantQueueType>
+template <iox::cxx::VariantQueueTypes VariantQueueType>
+struct FixedTypeChunkQueueConfig
+{
+    static constexpr uint64_t MAX_QUEUE_CAPACITY = iox::DefaultChunkQueueConfig::MAX_QUEUE_CAPACITY;
+    static constexpr iox::cxx::VariantQueueTypes QUEUE_TYPE = VariantQueueType;
+};
+
+template <typename PolicyType,
+          iox::cxx::VariantQueueTypes VariantQueueType,
+          typename ChunkQueueConfig = iox::DefaultChunkQueueConfig>
 struct TypeDefinitions
 {
     using PolicyType_t = PolicyType;
+    using ChunkQueueConfig_t = ChunkQueueConfig;
     static const iox::cxx::VariantQueueTypes variantQueueType{VariantQueueType};
 };
 
+template <typename PolicyType, iox::cxx::VariantQueueTypes VariantQueueType>
+using FixedTypeDefinitions =
+    TypeDefinitions<PolicyType, VariantQueueType, FixedTypeChunkQueueConfig<VariantQueueType>>;
+
 using ChunkQueueSubjects =
     Types<TypeDefinitions<ThreadSafePolicy, iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer>,
           TypeDefinitions<ThreadSafePolicy, iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer>,
           TypeDefinitions<SingleThreadedPolicy, iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer>,
-          TypeDefinitions<SingleThreadedPolicy, iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer>>;
+          TypeDefinitions<SingleThreadedPolicy, iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer>,
+          FixedTypeDefinitions<ThreadSafePolicy, iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer>,
+          FixedTypeDefinitions<ThreadSafePolicy, iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer>,
+          FixedTypeDefinitions<ThreadSafePolicy, iox::cxx::VariantQueueTypes::SoFi_MultiProducerSingleConsumer>,
+          // the request and response queues share the underlying queue of the multi producer FiFo with the SoFi
+          TypeDefinitions<ThreadSafePolicy,
+                          iox::cxx::VariantQueueTypes::SoFi_MultiProducerSingleConsumer,
+                          FixedTypeChunkQueueConfig<iox::cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer>>>;
 
 /// we require TYPED_TEST since we support gtest 1.8 for our safety targets
 #pragma GCC diagnostic push
@@ -95,7 +119,7 @@ class ChunkQueue_test : public Test, public ChunkQueue_testBase
     void SetUp() override{};
     void TearDown() override{};
 
-    using ChunkQueueData_t = ChunkQueueData<iox::DefaultChunkQueueConfig, typename TestTypes::PolicyType_t>;
+    using ChunkQueueData_t = ChunkQueueData<typename TestTypes::ChunkQueueConfig_t, typename TestTypes::PolicyType_t>;
 
     iox::cxx::VariantQueueTypes m_variantQueueType{TestTypes::variantQueueType};
     ChunkQueueData_t m_chunkData{QueueFullPolicy::DISCARD_OLDEST_DATA, m_variantQueueType};
@@ -158,6 +182,27 @@ TYPED_TEST(ChunkQueue_test, PushedChunksMustBePoppedInTheSameOrder)
     }
 }
 
+TYPED_TEST(ChunkQueue_test, BatchPushedChunksMustBePoppedInTheSameOrder)
+{
+    constexpr int32_t NUMBER_CHUNKS{5};
+    SharedChunk chunks[NUMBER_CHUNKS];
+    for (int i = 0; i < NUMBER_CHUNKS; ++i)
+    {
+        chunks[i] = this->allocateChunk();
+        *reinterpret_cast<int32_t*>(chunks[i].getUserPayload()) = i;
+    }
+    EXPECT_THAT(this->m_pusher.pushBatch(chunks, NUMBER_CHUNKS), Eq(0U));
+
+    for (int i = 0; i < NUMBER_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = this->m_popper.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        auto data = *reinterpret_cast<int32_t*>((*maybeSharedChunk).getUserPayload());
+        EXPECT_THAT(data, Eq(i));
+    }
+    EXPECT_THAT(this->m_popper.empty(), Eq(true));
+}
+
 TYPED_TEST(ChunkQueue_test, PopChunkWithIncompatibleChunkHeaderCallsErrorHandler)
 {
     auto chunk = this->allocateChunk();
@@ -217,6 +262,21 @@ TYPED_TEST(ChunkQueue_test, PushAndNotifyConditionVariable)
     EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true)); // shouldn't trigger a second time
 }
 
+TYPED_TEST(ChunkQueue_test, PushBatchAndNotifyConditionVariable)
+{
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    constexpr uint64_t NUMBER_CHUNKS{3U};
+    SharedChunk chunks[NUMBER_CHUNKS] = {this->allocateChunk(), this->allocateChunk(), this->allocateChunk()};
+    this->m_pusher.pushBatch(chunks, NUMBER_CHUNKS);
+
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(false));
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true)); // shouldn't trigger a second time
+}
+
 TYPED_TEST(ChunkQueue_test, AttachSecondConditionVariable)
 {
     ConditionVariableData condVar1("Horscht");
@@ -237,6 +297,55 @@ TYPED_TEST(ChunkQueue_test, AttachSecondConditionVariable)
     EXPECT_THAT(condVarWaiter2.timedWait(1_ms).empty(), Eq(false));
 }
 
+TYPED_TEST(ChunkQueue_test, DetachedConditionVariableIsNotNotified)
+{
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+
+    this->m_popper.setConditionVariable(condVar, 0U);
+    this->m_popper.unsetConditionVariable();
+    EXPECT_THAT(this->m_popper.isConditionVariableSet(), Eq(false));
+
+    auto chunk = this->allocateChunk();
+    this->m_pusher.push(chunk);
+
+    EXPECT_THAT(condVarWaiter.timedWait(1_ms).empty(), Eq(true));
+}
+
+TYPED_TEST(ChunkQueue_test, AttachingAndDetachingConditionVariableWhilePushingIsSafe)
+{
+    ConditionVariableData condVar1("Horscht");
+    ConditionVariableData condVar2("Schnuppi");
+    ConditionListener condVarWaiter2{condVar2};
+
+    constexpr uint64_t NUMBER_OF_PUSHES{10000U};
+    std::atomic_bool isPushing{true};
+    std::thread pusher([&] {
+        for (uint64_t i = 0U; i < NUMBER_OF_PUSHES; ++i)
+        {
+            this->m_pusher.push(this->allocateChunk());
+            EXPECT_TRUE(this->m_popper.tryPop().has_value());
+        }
+        isPushing = false;
+    });
+
+    uint64_t notificationIndex{0U};
+    while (isPushing)
+    {
+        this->m_popper.setConditionVariable(condVar1, notificationIndex);
+        this->m_popper.unsetConditionVariable();
+        notificationIndex = (notificationIndex + 1U) % iox::MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE;
+    }
+    pusher.join();
+
+    this->m_popper.setConditionVariable(condVar2, 1U);
+    this->m_pusher.push(this->allocateChunk());
+
+    auto notifications = condVarWaiter2.timedWait(1_ms);
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0], Eq(1U));
+}
+
 /// @note this could be changed to a parameterized ChunkQueueSaturatingFIFO_test when there are more FIFOs available
 using ChunkQueueFiFoTestSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
 /// we require TYPED_TEST since we support gtest 1.8 for our safety targets
@@ -254,7 +363,7 @@ class ChunkQueueFiFo_test : public Test, public ChunkQueue_testBase
 
     using ChunkQueueData_t = ChunkQueueData<iox::DefaultChunkQueueConfig, PolicyType>;
 
-    ChunkQueueData_t m_chunkData{QueueFullPolicy::DISCARD_OLDEST_DATA,
+    ChunkQueueData_t m_chunkData{QueueFullPolicy::BLOCK_PUBLISHER,
                                  iox::cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer};
     ChunkQueuePopper<ChunkQueueData_t> m_popper{&m_chunkData};
     ChunkQueuePusher<ChunkQueueData_t> m_pusher{&m_chunkData};
@@ -299,6 +408,86 @@ TYPED_TEST(ChunkQueueFiFo_test, PushFull)
     EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
 }
 
+TYPED_TEST(ChunkQueueFiFo_test, PushOrWaitForSubscriberPushesWhenQueueIsNotFull)
+{
+    EXPECT_TRUE(this->m_pusher.pushOrWaitForSubscriber(this->allocateChunk(), 1_s));
+    EXPECT_THAT(this->m_popper.size(), Eq(1U));
+}
+
+TYPED_TEST(ChunkQueueFiFo_test, PushOrWaitForSubscriberReturnsFalseAfterTimeoutWhenQueueIsFull)
+{
+    for (auto i = 0U; i < iox::MAX_SUBSCRIBER_QUEUE_CAPACITY; ++i)
+    {
+        EXPECT_TRUE(this->m_pusher.push(this->allocateChunk()));
+    }
+
+    EXPECT_FALSE(this->m_pusher.pushOrWaitForSubscriber(this->allocateChunk(), 10_ms));
+    EXPECT_THAT(this->m_popper.size(), Eq(iox::MAX_SUBSCRIBER_QUEUE_CAPACITY));
+
+    this->m_popper.clear();
+}
+
+TYPED_TEST(ChunkQueueFiFo_test, PushOrWaitForSubscriberIsWokenUpWhenChunkIsPopped)
+{
+    for (auto i = 0U; i < iox::MAX_SUBSCRIBER_QUEUE_CAPACITY; ++i)
+    {
+        EXPECT_TRUE(this->m_pusher.push(this->allocateChunk()));
+    }
+
+    constexpr int64_t WAIT_TIME_IN_MS{100};
+    auto threadSyncSemaphore = iox::posix::Semaphore::create(iox::posix::CreateUnnamedSingleProcessSemaphore, 0U);
+    std::atomic_bool hasReturned{false};
+    std::thread publisher([&] {
+        ASSERT_FALSE(threadSyncSemaphore->post().has_error());
+        // the return value depends on whether the pop happened before the push was tried
+        this->m_pusher.pushOrWaitForSubscriber(this->allocateChunk(), 1000_s);
+        hasReturned = true;
+    });
+
+    ASSERT_FALSE(threadSyncSemaphore->wait().has_error());
+    std::this_thread::sleep_for(std::chrono::milliseconds(WAIT_TIME_IN_MS));
+    EXPECT_FALSE(hasReturned.load());
+
+    EXPECT_TRUE(this->m_popper.tryPop().has_value());
+    publisher.join();
+    EXPECT_TRUE(hasReturned.load());
+
+    this->m_popper.clear();
+}
+
+TYPED_TEST(ChunkQueueFiFo_test, PushOrWaitForSubscriberIsWokenUpOnlyOnceWhenManyChunksArePopped)
+{
+    for (auto i = 0U; i < iox::MAX_SUBSCRIBER_QUEUE_CAPACITY; ++i)
+    {
+        EXPECT_TRUE(this->m_pusher.push(this->allocateChunk()));
+    }
+
+    constexpr int64_t WAIT_TIME_IN_MS{100};
+    auto threadSyncSemaphore = iox::posix::Semaphore::create(iox::posix::CreateUnnamedSingleProcessSemaphore, 0U);
+    std::thread publisher([&] {
+        ASSERT_FALSE(threadSyncSemaphore->post().has_error());
+        this->m_pusher.pushOrWaitForSubscriber(this->allocateChunk(), 1000_s);
+    });
+
+    ASSERT_FALSE(threadSyncSemaphore->wait().has_error());
+    std::this_thread::sleep_for(std::chrono::milliseconds(WAIT_TIME_IN_MS));
+    while (this->m_popper.tryPop().has_value())
+    {
+    }
+    publisher.join();
+
+    // without stale posts of the previous pops a publisher waits for the full timeout
+    for (auto i = this->m_popper.size(); i < iox::MAX_SUBSCRIBER_QUEUE_CAPACITY; ++i)
+    {
+        EXPECT_TRUE(this->m_pusher.push(this->allocateChunk()));
+    }
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(this->m_pusher.pushOrWaitForSubscriber(this->allocateChunk(), 10_ms));
+    EXPECT_THAT(std::chrono::steady_clock::now() - start, Ge(std::chrono::milliseconds(10)));
+
+    this->m_popper.clear();
+}
+
 /// @note this could be changed to a parameterized ChunkQueueOverflowingFIFO_test when there are more FIFOs available
 using ChunkQueueSoFiSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
 /// we require TYPED_TEST since we support gtest 1.8 for our safety targets
@@ -363,6 +552,31 @@ TYPED_TEST(ChunkQueueSoFi_test, PushFull)
 }
 
 
+TYPED_TEST(ChunkQueueSoFi_test, PushBatchToFullQueueReturnsNumberOfLostChunks)
+{
+    constexpr uint64_t CAPACITY{2U};
+    constexpr uint64_t NUMBER_CHUNKS{5U};
+    this->m_popper.setCapacity(CAPACITY);
+
+    SharedChunk chunks[NUMBER_CHUNKS];
+    for (auto i = 0U; i < NUMBER_CHUNKS; ++i)
+    {
+        chunks[i] = this->allocateChunk();
+    }
+    EXPECT_THAT(this->m_pusher.pushBatch(chunks, NUMBER_CHUNKS), Eq(NUMBER_CHUNKS - CAPACITY));
+
+    for (auto i = 0U; i < NUMBER_CHUNKS; ++i)
+    {
+        chunks[i] = nullptr;
+    }
+    while (this->m_popper.tryPop().has_value())
+    {
+    }
+
+    // all chunks must be released
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+}
+
 TYPED_TEST(ChunkQueueSoFi_test, InitialNoLostChunks)
 {
     EXPECT_FALSE(this->m_popper.hasLostChunks());
@@ -383,4 +597,14 @@ TYPED_TEST(ChunkQueueSoFi_test, LostChunkInfoIsResetAfterRead)
     EXPECT_FALSE(this->m_popper.hasLostChunks());
 }
 
+TEST(ChunkQueueData_test, FixedTypeQueueRequiresLessSharedMemoryForSingleProducerQueues)
+{
+    using VariantChunkQueueData_t = ChunkQueueData<iox::DefaultChunkQueueConfig, ThreadSafePolicy>;
+    using FixedTypeChunkQueueData_t = ChunkQueueData<
+        FixedTypeChunkQueueConfig<iox::cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer>,
+        ThreadSafePolicy>;
+
+    EXPECT_THAT(sizeof(FixedTypeChunkQueueData_t), Lt(sizeof(VariantChunkQueueData_t)));
+}
+
 } // namespace
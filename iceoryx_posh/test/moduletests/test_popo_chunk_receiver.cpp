@@ -181,6 +181,77 @@ TEST_F(ChunkReceiver_test, getTooMuchWithoutRelease)
     EXPECT_THAT(maybeChunkHeader.get_error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
 }
 
+TEST_F(ChunkReceiver_test, getBatchFromEmptyQueueProvidesNoChunk)
+{
+    uint64_t numberOfCalls{0U};
+    auto maybeNumberOfChunks =
+        m_chunkReceiver.tryGetBatch(10U, [&](const iox::mepoo::ChunkHeader*) { ++numberOfCalls; });
+    ASSERT_FALSE(maybeNumberOfChunks.has_error());
+    EXPECT_THAT(*maybeNumberOfChunks, Eq(0U));
+    EXPECT_THAT(numberOfCalls, Eq(0U));
+}
+
+TEST_F(ChunkReceiver_test, getBatchProvidesChunksInOrderAndRespectsMaxNumberOfChunks)
+{
+    constexpr uint64_t NUMBER_OF_PUSHED_CHUNKS{5U};
+    constexpr uint64_t MAX_NUMBER_OF_CHUNKS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_PUSHED_CHUNKS; ++i)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        ASSERT_TRUE(sharedChunk);
+        new (sharedChunk.getUserPayload()) DummySample();
+        static_cast<DummySample*>(sharedChunk.getUserPayload())->dummy = i;
+        m_chunkQueuePusher.push(sharedChunk);
+    }
+
+    std::vector<const iox::mepoo::ChunkHeader*> chunks;
+    auto collectChunk = [&](const iox::mepoo::ChunkHeader* chunkHeader) { chunks.push_back(chunkHeader); };
+
+    auto maybeNumberOfChunks = m_chunkReceiver.tryGetBatch(MAX_NUMBER_OF_CHUNKS, collectChunk);
+    ASSERT_FALSE(maybeNumberOfChunks.has_error());
+    EXPECT_THAT(*maybeNumberOfChunks, Eq(MAX_NUMBER_OF_CHUNKS));
+
+    maybeNumberOfChunks = m_chunkReceiver.tryGetBatch(MAX_NUMBER_OF_CHUNKS, collectChunk);
+    ASSERT_FALSE(maybeNumberOfChunks.has_error());
+    EXPECT_THAT(*maybeNumberOfChunks, Eq(NUMBER_OF_PUSHED_CHUNKS - MAX_NUMBER_OF_CHUNKS));
+
+    ASSERT_THAT(chunks.size(), Eq(NUMBER_OF_PUSHED_CHUNKS));
+    for (uint64_t i = 0U; i < NUMBER_OF_PUSHED_CHUNKS; ++i)
+    {
+        EXPECT_THAT(static_cast<const DummySample*>(chunks[i]->userPayload())->dummy, Eq(i));
+        m_chunkReceiver.release(chunks[i]);
+    }
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkReceiver_test, getBatchWithTooManyChunksHeldFails)
+{
+    // see getTooMuchWithoutRelease for the additional chunk
+    for (size_t i = 0; i < iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY + 1; i++)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        EXPECT_TRUE(sharedChunk);
+
+        m_chunkQueuePusher.push(sharedChunk);
+
+        auto maybeChunkHeader = m_chunkReceiver.tryGet();
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+    }
+
+    auto sharedChunk = getChunkFromMemoryManager();
+    EXPECT_TRUE(sharedChunk);
+
+    m_chunkQueuePusher.push(sharedChunk);
+
+    uint64_t numberOfCalls{0U};
+    auto maybeNumberOfChunks =
+        m_chunkReceiver.tryGetBatch(10U, [&](const iox::mepoo::ChunkHeader*) { ++numberOfCalls; });
+    ASSERT_TRUE(maybeNumberOfChunks.has_error());
+    EXPECT_THAT(maybeNumberOfChunks.get_error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
+    EXPECT_THAT(numberOfCalls, Eq(0U));
+}
+
 TEST_F(ChunkReceiver_test, releaseInvalidChunk)
 {
     {
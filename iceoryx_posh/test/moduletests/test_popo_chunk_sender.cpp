@@ -198,6 +198,79 @@ TEST_F(ChunkSender_test, allocate_Overflow)
                 Eq(iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY));
 }
 
+TEST_F(ChunkSender_test, allocateBatch_AllocatesRequestedNumberOfChunksWithOriginIdSet)
+{
+    constexpr uint32_t NUMBER_OF_CHUNKS{4U};
+    iox::UniquePortId uniqueId;
+    std::vector<iox::mepoo::ChunkHeader*> chunks;
+    auto maybeNumberOfChunks = m_chunkSender.tryAllocateBatch(uniqueId,
+                                                              sizeof(DummySample),
+                                                              alignof(DummySample),
+                                                              USER_HEADER_SIZE,
+                                                              USER_HEADER_ALIGNMENT,
+                                                              NUMBER_OF_CHUNKS,
+                                                              [&](iox::mepoo::ChunkHeader* chunkHeader) {
+                                                                  chunks.push_back(chunkHeader);
+                                                              });
+    ASSERT_FALSE(maybeNumberOfChunks.has_error());
+    EXPECT_THAT(*maybeNumberOfChunks, Eq(NUMBER_OF_CHUNKS));
+    ASSERT_THAT(chunks.size(), Eq(NUMBER_OF_CHUNKS));
+    for (auto chunk : chunks)
+    {
+        EXPECT_THAT(chunk->originId(), Eq(uniqueId));
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUMBER_OF_CHUNKS));
+}
+
+TEST_F(ChunkSender_test, allocateBatch_StopsWhenTooManyChunksAreAllocatedInParallel)
+{
+    constexpr uint32_t NUMBER_OF_CHUNKS{iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY + 2U};
+    std::vector<iox::mepoo::ChunkHeader*> chunks;
+    auto collectChunk = [&](iox::mepoo::ChunkHeader* chunkHeader) { chunks.push_back(chunkHeader); };
+
+    auto maybeNumberOfChunks = m_chunkSender.tryAllocateBatch(iox::UniquePortId(),
+                                                              sizeof(DummySample),
+                                                              alignof(DummySample),
+                                                              USER_HEADER_SIZE,
+                                                              USER_HEADER_ALIGNMENT,
+                                                              NUMBER_OF_CHUNKS,
+                                                              collectChunk);
+    ASSERT_FALSE(maybeNumberOfChunks.has_error());
+    EXPECT_THAT(*maybeNumberOfChunks, Eq(iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks,
+                Eq(iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY));
+
+    maybeNumberOfChunks = m_chunkSender.tryAllocateBatch(iox::UniquePortId(),
+                                                         sizeof(DummySample),
+                                                         alignof(DummySample),
+                                                         USER_HEADER_SIZE,
+                                                         USER_HEADER_ALIGNMENT,
+                                                         1U,
+                                                         collectChunk);
+    ASSERT_TRUE(maybeNumberOfChunks.has_error());
+    EXPECT_THAT(maybeNumberOfChunks.get_error(), Eq(iox::popo::AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL));
+    EXPECT_THAT(chunks.size(), Eq(iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks,
+                Eq(iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY));
+}
+
+TEST_F(ChunkSender_test, allocateBatch_WithInvalidUserPayloadAlignmentFails)
+{
+    uint64_t numberOfCalls{0U};
+    auto maybeNumberOfChunks =
+        m_chunkSender.tryAllocateBatch(iox::UniquePortId(),
+                                       sizeof(DummySample),
+                                       3U,
+                                       USER_HEADER_SIZE,
+                                       USER_HEADER_ALIGNMENT,
+                                       2U,
+                                       [&](iox::mepoo::ChunkHeader*) { ++numberOfCalls; });
+    ASSERT_TRUE(maybeNumberOfChunks.has_error());
+    EXPECT_THAT(maybeNumberOfChunks.get_error(),
+                Eq(iox::popo::AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER));
+    EXPECT_THAT(numberOfCalls, Eq(0U));
+}
+
 TEST_F(ChunkSender_test, freeChunk)
 {
     std::vector<iox::mepoo::ChunkHeader*> chunks;
@@ -430,6 +503,150 @@ TEST_F(ChunkSender_test, sendInvalidChunk)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
 }
 
+TEST_F(ChunkSender_test, SendUpdatesStatistics)
+{
+    constexpr uint64_t NUMBER_OF_SENT_CHUNKS{3U};
+    uint32_t chunkSize{0U};
+    for (uint64_t i = 0U; i < NUMBER_OF_SENT_CHUNKS; ++i)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(
+            iox::UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunkSize = (*maybeChunkHeader)->chunkSize();
+        m_chunkSender.send(*maybeChunkHeader);
+    }
+
+    const auto& statistics = m_chunkSenderData.m_statistics;
+    EXPECT_THAT(statistics.m_sentChunks.load(), Eq(NUMBER_OF_SENT_CHUNKS));
+    EXPECT_THAT(statistics.m_sentUserPayloadBytes.load(), Eq(NUMBER_OF_SENT_CHUNKS * sizeof(DummySample)));
+    EXPECT_THAT(statistics.m_lostChunks.load(), Eq(0U));
+    EXPECT_THAT(statistics.m_lastUserPayloadSize.load(), Eq(sizeof(DummySample)));
+    EXPECT_THAT(statistics.m_lastChunkSize.load(), Eq(chunkSize));
+    EXPECT_THAT(statistics.m_lastSendTimestampInNanoseconds.load(), Gt(0));
+    EXPECT_THAT(statistics.m_lastSendIntervalInNanoseconds.load(), Ge(0));
+}
+
+TEST_F(ChunkSender_test, SendToFullQueueCountsLostChunksInStatistics)
+{
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+    constexpr uint64_t QUEUE_CAPACITY{2U};
+    constexpr uint64_t NUMBER_OF_SENT_CHUNKS{5U};
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t>(&m_chunkQueueData).setCapacity(QUEUE_CAPACITY);
+
+    for (uint64_t i = 0U; i < NUMBER_OF_SENT_CHUNKS; ++i)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(
+            iox::UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        m_chunkSender.send(*maybeChunkHeader);
+    }
+
+    EXPECT_THAT(m_chunkSenderData.m_statistics.m_sentChunks.load(), Eq(NUMBER_OF_SENT_CHUNKS));
+    EXPECT_THAT(m_chunkSenderData.m_statistics.m_lostChunks.load(), Eq(NUMBER_OF_SENT_CHUNKS - QUEUE_CAPACITY));
+}
+
+TEST_F(ChunkSender_test, sendBatchWithReceiverDeliversAllChunksInOrder)
+{
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+    constexpr uint32_t NUMBER_OF_CHUNKS{iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY};
+
+    std::vector<iox::mepoo::ChunkHeader*> chunks;
+    auto maybeNumberOfChunks = m_chunkSender.tryAllocateBatch(iox::UniquePortId(),
+                                                              sizeof(DummySample),
+                                                              alignof(DummySample),
+                                                              USER_HEADER_SIZE,
+                                                              USER_HEADER_ALIGNMENT,
+                                                              NUMBER_OF_CHUNKS,
+                                                              [&](iox::mepoo::ChunkHeader* chunkHeader) {
+                                                                  auto sample = chunkHeader->userPayload();
+                                                                  new (sample) DummySample();
+                                                                  static_cast<DummySample*>(sample)->dummy =
+                                                                      chunks.size();
+                                                                  chunks.push_back(chunkHeader);
+                                                              });
+    ASSERT_FALSE(maybeNumberOfChunks.has_error());
+    ASSERT_THAT(chunks.size(), Eq(NUMBER_OF_CHUNKS));
+
+    m_chunkSender.sendBatch(chunks.data(), NUMBER_OF_CHUNKS);
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto popRet = myQueue.tryPop();
+        ASSERT_TRUE(popRet.has_value());
+        EXPECT_THAT(static_cast<DummySample*>(popRet->getUserPayload())->dummy, Eq(i));
+        EXPECT_THAT(popRet->getChunkHeader()->sequenceNumber(), Eq(i));
+    }
+    EXPECT_TRUE(myQueue.empty());
+    EXPECT_THAT(m_chunkSenderData.m_statistics.m_sentChunks.load(), Eq(NUMBER_OF_CHUNKS));
+    ASSERT_TRUE(m_chunkSender.tryGetPreviousChunk().has_value());
+    EXPECT_THAT(*m_chunkSender.tryGetPreviousChunk(), Eq(chunks.back()));
+}
+
+TEST_F(ChunkSender_test, sendBatchToFullQueueCountsLostChunksInStatistics)
+{
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+    constexpr uint64_t QUEUE_CAPACITY{2U};
+    constexpr uint32_t NUMBER_OF_SENT_CHUNKS{5U};
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t>(&m_chunkQueueData).setCapacity(QUEUE_CAPACITY);
+
+    std::vector<iox::mepoo::ChunkHeader*> chunks;
+    ASSERT_FALSE(m_chunkSender
+                     .tryAllocateBatch(iox::UniquePortId(),
+                                       sizeof(DummySample),
+                                       alignof(DummySample),
+                                       USER_HEADER_SIZE,
+                                       USER_HEADER_ALIGNMENT,
+                                       NUMBER_OF_SENT_CHUNKS,
+                                       [&](iox::mepoo::ChunkHeader* chunkHeader) { chunks.push_back(chunkHeader); })
+                     .has_error());
+    m_chunkSender.sendBatch(chunks.data(), NUMBER_OF_SENT_CHUNKS);
+
+    EXPECT_THAT(m_chunkSenderData.m_statistics.m_sentChunks.load(), Eq(NUMBER_OF_SENT_CHUNKS));
+    EXPECT_THAT(m_chunkSenderData.m_statistics.m_lostChunks.load(), Eq(NUMBER_OF_SENT_CHUNKS - QUEUE_CAPACITY));
+    EXPECT_TRUE(iox::popo::ChunkQueuePopper<ChunkQueueData_t>(&m_chunkQueueData).hasLostChunks());
+}
+
+TEST_F(ChunkSender_test, sendBatchKeepsNewestChunksInHistory)
+{
+    constexpr uint32_t NUMBER_OF_SENT_CHUNKS{HISTORY_CAPACITY + 2U};
+
+    std::vector<iox::mepoo::ChunkHeader*> chunks;
+    ASSERT_FALSE(m_chunkSenderWithHistory
+                     .tryAllocateBatch(iox::UniquePortId(),
+                                       sizeof(DummySample),
+                                       alignof(DummySample),
+                                       USER_HEADER_SIZE,
+                                       USER_HEADER_ALIGNMENT,
+                                       NUMBER_OF_SENT_CHUNKS,
+                                       [&](iox::mepoo::ChunkHeader* chunkHeader) { chunks.push_back(chunkHeader); })
+                     .has_error());
+    m_chunkSenderWithHistory.sendBatch(chunks.data(), NUMBER_OF_SENT_CHUNKS);
+
+    EXPECT_THAT(m_chunkSenderWithHistory.getHistorySize(), Eq(HISTORY_CAPACITY));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(HISTORY_CAPACITY));
+
+    ASSERT_FALSE(m_chunkSenderWithHistory.tryAddQueue(&m_chunkQueueData, HISTORY_CAPACITY).has_error());
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    for (uint64_t i = NUMBER_OF_SENT_CHUNKS - HISTORY_CAPACITY; i < NUMBER_OF_SENT_CHUNKS; ++i)
+    {
+        auto popRet = myQueue.tryPop();
+        ASSERT_TRUE(popRet.has_value());
+        EXPECT_THAT(popRet->getChunkHeader(), Eq(chunks[i]));
+    }
+}
+
+TEST_F(ChunkSender_test, PushToHistoryDoesNotUpdateStatistics)
+{
+    auto maybeChunkHeader = m_chunkSenderWithHistory.tryAllocate(
+        iox::UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    m_chunkSenderWithHistory.pushToHistory(*maybeChunkHeader);
+
+    EXPECT_THAT(m_chunkSenderDataWithHistory.m_statistics.m_sentChunks.load(), Eq(0U));
+    EXPECT_THAT(m_chunkSenderDataWithHistory.m_statistics.m_lastSendTimestampInNanoseconds.load(), Eq(0));
+}
+
 TEST_F(ChunkSender_test, pushToHistory)
 {
     for (size_t i = 0; i < 10 * HISTORY_CAPACITY; i++)
@@ -631,4 +848,27 @@ TEST_F(ChunkSender_test, Cleanup)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(ChunkSender_test, CleanupReleasesChunkCache)
+{
+    std::unique_ptr<uint8_t[]> memory{new uint8_t[MEMORY_SIZE]};
+    iox::posix::Allocator memoryAllocator{memory.get(), MEMORY_SIZE};
+    iox::mepoo::MemoryManager memoryManager;
+    iox::mepoo::MePooConfig mempoolconf;
+    mempoolconf.addMemPool({SMALL_CHUNK, NUM_CHUNKS_IN_POOL});
+    mempoolconf.setChunkCacheEnabled(true);
+    memoryManager.configureMemoryManager(mempoolconf, memoryAllocator, memoryAllocator);
+
+    ChunkSenderData_t chunkSenderData{&memoryManager, iox::popo::SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA, 0};
+    iox::popo::ChunkSender<ChunkSenderData_t> sut{&chunkSenderData};
+
+    auto maybeChunkHeader =
+        sut.tryAllocate(iox::UniquePortId(), SMALL_CHUNK, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(iox::mepoo::ChunkCache::CAPACITY));
+
+    sut.releaseAll();
+
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
 } // namespace
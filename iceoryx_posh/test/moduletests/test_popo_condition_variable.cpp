@@ -127,9 +127,9 @@ TEST_F(ConditionVariable_test, WaitAndNotifyResultsInImmediateTriggerMultiThread
 TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstruction)
 {
     ConditionVariableData sut;
-    for (auto& notification : sut.m_activeNotifications)
+    for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE; i++)
     {
-        EXPECT_THAT(notification, Eq(false));
+        EXPECT_THAT(sut.isNotificationSet(i), Eq(false));
     }
 }
 
@@ -140,9 +140,9 @@ TEST_F(ConditionVariable_test, CorrectRuntimeNameAfterConstructionWithRuntimeNam
 
 TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstructionWithRuntimeName)
 {
-    for (auto& notification : m_condVarData.m_activeNotifications)
+    for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE; i++)
     {
-        EXPECT_THAT(notification, Eq(false));
+        EXPECT_THAT(m_condVarData.isNotificationSet(i), Eq(false));
     }
 }
 
@@ -155,11 +155,11 @@ TEST_F(ConditionVariable_test, NotifyActivatesCorrectIndex)
     {
         if (i == EVENT_INDEX)
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i], Eq(true));
+            EXPECT_THAT(m_condVarData.isNotificationSet(i), Eq(true));
         }
         else
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i], Eq(false));
+            EXPECT_THAT(m_condVarData.isNotificationSet(i), Eq(false));
         }
     }
 }
@@ -200,6 +200,25 @@ TEST_F(ConditionVariable_test, TimedWaitReturnsMultipleNotifiedIndices)
     EXPECT_THAT(indices[1U], Eq(15U));
 }
 
+TEST_F(ConditionVariable_test, TimedWaitReturnsNotifiedIndicesAtTheBordersOfTheNotificationWords)
+{
+    constexpr uint64_t LAST_INDEX = iox::MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE - 1U;
+    constexpr uint64_t WORD_SIZE = ConditionVariableData::NOTIFICATIONS_PER_WORD;
+    ConditionListener sut(m_condVarData);
+    ConditionNotifier(m_condVarData, LAST_INDEX).notify();
+    ConditionNotifier(m_condVarData, WORD_SIZE).notify();
+    ConditionNotifier(m_condVarData, WORD_SIZE - 1U).notify();
+    ConditionNotifier(m_condVarData, 0U).notify();
+
+    auto indices = sut.timedWait(iox::units::Duration::fromMilliseconds(100));
+
+    ASSERT_THAT(indices.size(), Eq(4U));
+    EXPECT_THAT(indices[0U], Eq(0U));
+    EXPECT_THAT(indices[1U], Eq(WORD_SIZE - 1U));
+    EXPECT_THAT(indices[2U], Eq(WORD_SIZE));
+    EXPECT_THAT(indices[3U], Eq(LAST_INDEX));
+}
+
 TEST_F(ConditionVariable_test, TimedWaitReturnsAllNotifiedIndices)
 {
     ConditionListener sut(m_condVarData);
@@ -399,9 +418,9 @@ TIMING_TEST_F(ConditionVariable_test, SecondWaitBlocksUntilNewNotification, Repe
         hasWaited.store(true, std::memory_order_relaxed);
         ASSERT_THAT(activeNotifications.size(), Eq(1U));
         EXPECT_THAT(activeNotifications[0], Eq(FIRST_EVENT_INDEX));
-        for (const auto& notification : m_condVarData.m_activeNotifications)
+        for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS_PER_CONDITION_VARIABLE; i++)
         {
-            EXPECT_THAT(notification, Eq(false));
+            EXPECT_THAT(m_condVarData.isNotificationSet(i), Eq(false));
         }
     });
 
@@ -468,4 +487,91 @@ TEST_F(ConditionVariable_test, TimedWaitReturnsSortedListWhenTriggeredInReverseO
         *this, [this] { return m_waiter.timedWait(iox::units::Duration::fromSeconds(1)); });
 }
 
+TEST_F(ConditionVariable_test, BusyPollDurationIsZeroAfterConstruction)
+{
+    EXPECT_THAT(m_waiter.getBusyPollDuration(), Eq(0_s));
+}
+
+TEST_F(ConditionVariable_test, SetBusyPollDurationIsReturned)
+{
+    m_waiter.setBusyPollDuration(42_us);
+    EXPECT_THAT(m_waiter.getBusyPollDuration(), Eq(42_us));
+}
+
+TEST_F(ConditionVariable_test, WaitStatisticsAreZeroAfterConstruction)
+{
+    auto statistics = m_waiter.getWaitStatistics();
+    EXPECT_THAT(statistics.spinHits, Eq(0U));
+    EXPECT_THAT(statistics.sleeps, Eq(0U));
+}
+
+TEST_F(ConditionVariable_test, WaitWithPendingNotificationNeitherSpinsNorSleeps)
+{
+    m_waiter.setBusyPollDuration(1_s);
+    m_signaler.notify();
+
+    EXPECT_THAT(m_waiter.wait().size(), Eq(1U));
+
+    auto statistics = m_waiter.getWaitStatistics();
+    EXPECT_THAT(statistics.spinHits, Eq(0U));
+    EXPECT_THAT(statistics.sleeps, Eq(0U));
+}
+
+TEST_F(ConditionVariable_test, WaitWithoutBusyPollSleepsUntilNotification)
+{
+    std::thread notifier([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        m_notifiers[7U].notify();
+    });
+
+    auto notifications = m_waiter.wait();
+    notifier.join();
+
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0], Eq(7U));
+    auto statistics = m_waiter.getWaitStatistics();
+    EXPECT_THAT(statistics.spinHits, Eq(0U));
+    EXPECT_THAT(statistics.sleeps, Eq(1U));
+}
+
+TEST_F(ConditionVariable_test, NotificationDuringBusyPollIsReturnedWithoutSleep)
+{
+    m_waiter.setBusyPollDuration(10_s);
+    std::thread notifier([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        m_notifiers[7U].notify();
+    });
+
+    auto notifications = m_waiter.wait();
+    notifier.join();
+
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0], Eq(7U));
+    auto statistics = m_waiter.getWaitStatistics();
+    EXPECT_THAT(statistics.spinHits, Eq(1U));
+    EXPECT_THAT(statistics.sleeps, Eq(0U));
+}
+
+TEST_F(ConditionVariable_test, TimedWaitBusyPollsAtMostForTheTimeout)
+{
+    m_waiter.setBusyPollDuration(10_s);
+
+    auto notifications = m_waiter.timedWait(10_ms);
+
+    EXPECT_THAT(notifications.size(), Eq(0U));
+    auto statistics = m_waiter.getWaitStatistics();
+    EXPECT_THAT(statistics.spinHits, Eq(0U));
+    EXPECT_THAT(statistics.sleeps, Eq(1U));
+}
+
+TEST_F(ConditionVariable_test, DestroyEndsTheBusyPoll)
+{
+    m_waiter.setBusyPollDuration(10_s);
+    std::thread waiter([&] { EXPECT_THAT(m_waiter.wait().size(), Eq(0U)); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    m_waiter.destroy();
+    waiter.join();
+}
+
 } // namespace
@@ -0,0 +1,131 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notification_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_notifier.hpp"
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+class DiscoveryNotification_test : public Test
+{
+  public:
+    std::vector<uint64_t> takeNotifications()
+    {
+        std::vector<uint64_t> notifierIndices;
+        m_listener.takeNotifications([&](const uint64_t index) { notifierIndices.push_back(index); });
+        return notifierIndices;
+    }
+
+    static constexpr uint64_t LAST_INDEX{DiscoveryNotificationData::MAX_NUMBER_OF_NOTIFIERS - 1U};
+
+    DiscoveryNotificationData m_data;
+    DiscoveryListener m_listener{m_data};
+};
+
+constexpr uint64_t DiscoveryNotification_test::LAST_INDEX;
+
+TEST_F(DiscoveryNotification_test, TimedWaitWithoutNotificationTimesOut)
+{
+    EXPECT_FALSE(m_listener.timedWait(1_ms));
+}
+
+TEST_F(DiscoveryNotification_test, TimedWaitAfterNotifyDoesNotTimeOut)
+{
+    DiscoveryNotifier(&m_data, 0U).notify();
+
+    EXPECT_TRUE(m_listener.timedWait(1_ms));
+}
+
+TEST_F(DiscoveryNotification_test, TakeNotificationsWithoutNotificationCallsNoCallback)
+{
+    EXPECT_THAT(takeNotifications(), IsEmpty());
+}
+
+TEST_F(DiscoveryNotification_test, TakeNotificationsReportsAllNotifiersInAscendingOrder)
+{
+    DiscoveryNotifier(&m_data, LAST_INDEX).notify();
+    DiscoveryNotifier(&m_data, 64U).notify();
+    DiscoveryNotifier(&m_data, 0U).notify();
+    DiscoveryNotifier(&m_data, 63U).notify();
+
+    EXPECT_THAT(takeNotifications(), ElementsAre(0U, 63U, 64U, LAST_INDEX));
+}
+
+TEST_F(DiscoveryNotification_test, TakeNotificationsResetsTheNotifications)
+{
+    DiscoveryNotifier(&m_data, 3U).notify();
+    takeNotifications();
+
+    EXPECT_THAT(takeNotifications(), IsEmpty());
+}
+
+TEST_F(DiscoveryNotification_test, RepeatedNotifyOfPendingNotifierWakesUpOnlyOnce)
+{
+    DiscoveryNotifier notifier(&m_data, 5U);
+    notifier.notify();
+    notifier.notify();
+    notifier.notify();
+
+    EXPECT_TRUE(m_listener.timedWait(1_ms));
+    EXPECT_FALSE(m_listener.timedWait(1_ms));
+    EXPECT_THAT(takeNotifications(), ElementsAre(5U));
+}
+
+TEST_F(DiscoveryNotification_test, NotifyAfterTakeNotificationsWakesUpAgain)
+{
+    DiscoveryNotifier notifier(&m_data, 5U);
+    notifier.notify();
+    EXPECT_TRUE(m_listener.timedWait(1_ms));
+    takeNotifications();
+
+    notifier.notify();
+
+    EXPECT_TRUE(m_listener.timedWait(1_ms));
+    EXPECT_THAT(takeNotifications(), ElementsAre(5U));
+}
+
+TEST_F(DiscoveryNotification_test, NotifierWithoutDataDoesNothing)
+{
+    DiscoveryNotifier(nullptr, 0U).notify();
+
+    EXPECT_FALSE(m_listener.timedWait(1_ms));
+    EXPECT_THAT(takeNotifications(), IsEmpty());
+}
+
+TEST_F(DiscoveryNotification_test, NotifierWithTooLargeIndexCallsErrorHandlerAndDoesNothing)
+{
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::setTemporaryErrorHandler(
+        [&detectedError](const iox::Error error, const std::function<void()>, const iox::ErrorLevel) {
+            detectedError.emplace(error);
+        });
+
+    DiscoveryNotifier(&m_data, DiscoveryNotificationData::MAX_NUMBER_OF_NOTIFIERS).notify();
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::Error::kPOPO__DISCOVERY_NOTIFIER_INDEX_TOO_LARGE));
+    EXPECT_FALSE(m_listener.timedWait(1_ms));
+}
+
+} // namespace
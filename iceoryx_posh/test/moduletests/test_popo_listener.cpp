@@ -138,6 +138,11 @@ class TestListener : public Listener
         : Listener(data)
     {
     }
+
+    TestListener(ConditionVariableData& data, const ListenerOptions& options) noexcept
+        : Listener(data, options)
+    {
+    }
 };
 
 struct EventAndSutPair_t
@@ -1184,4 +1189,132 @@ TIMING_TEST_F(Listener_test, AttachingInCallbackWorks, Repeat(5), [&] {
 // END
 //////////////////////////////////
 
-} // namespace
\ No newline at end of file
+//////////////////////////////////
+// BEGIN worker threads
+//////////////////////////////////
+TIMING_TEST_F(Listener_test, WorkerThreadsExecuteCallbacksOfDifferentEventsConcurrently, Repeat(5), [&] {
+    ListenerOptions options;
+    options.numberOfWorkerThreads = 2U;
+    m_sut.emplace(m_condVarData, options);
+    SimpleEventClass fuu;
+    SimpleEventClass bar;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(bar,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<1U>))
+                     .has_error());
+
+    activateTriggerCallbackBlocker();
+    fuu.triggerStoepsel();
+    bar.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    // both callbacks are blocked, therefore they can only have been called when they run concurrently
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count == 1U);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[1U].m_count == 1U);
+
+    m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    unblockTriggerCallback(2U);
+});
+
+TIMING_TEST_F(Listener_test, WorkerThreadsDoNotExecuteCallbackOfSameEventConcurrently, Repeat(5), [&] {
+    ListenerOptions options;
+    options.numberOfWorkerThreads = 2U;
+    m_sut.emplace(m_condVarData, options);
+    SimpleEventClass fuu;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+
+    constexpr uint64_t NUMBER_OF_TRIGGER_UNBLOCKS = 10U;
+
+    activateTriggerCallbackBlocker();
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count == 1U);
+
+    m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    unblockTriggerCallback(NUMBER_OF_TRIGGER_UNBLOCKS);
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_source == &fuu);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count == 2U);
+});
+
+TIMING_TEST_F(Listener_test, MoreThanMaximumNumberOfWorkerThreadsAreLimitedAndExecuteCallbacks, Repeat(5), [&] {
+    ListenerOptions options;
+    options.numberOfWorkerThreads = iox::MAX_NUMBER_OF_WORKER_THREADS_PER_LISTENER + 1U;
+    m_sut.emplace(m_condVarData, options);
+    SimpleEventClass fuu;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_source == &fuu);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count == 1U);
+});
+//////////////////////////////////
+// END
+//////////////////////////////////
+
+//////////////////////////////////
+// BEGIN busy poll
+//////////////////////////////////
+TIMING_TEST_F(Listener_test, EventDuringBusyPollIsCountedAsSpinHit, Repeat(5), [&] {
+    ListenerOptions options;
+    options.busyPollDuration = iox::units::Duration::fromSeconds(10U);
+    m_sut.emplace(m_condVarData, options);
+    SimpleEventClass fuu;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count == 1U);
+    auto statistics = m_sut->getWaitStatistics();
+    TIMING_TEST_EXPECT_TRUE(statistics.spinHits >= 1U);
+    TIMING_TEST_EXPECT_TRUE(statistics.sleeps == 0U);
+});
+
+TIMING_TEST_F(Listener_test, ListenerWithoutBusyPollSleepsUntilEvent, Repeat(5), [&] {
+    SimpleEventClass fuu;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count == 1U);
+    auto statistics = m_sut->getWaitStatistics();
+    TIMING_TEST_EXPECT_TRUE(statistics.spinHits == 0U);
+    TIMING_TEST_EXPECT_TRUE(statistics.sleeps >= 1U);
+});
+//////////////////////////////////
+// END
+//////////////////////////////////
+
+} // namespace
@@ -21,6 +21,8 @@
 
 #include "test.hpp"
 
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -262,6 +264,74 @@ TEST_F(PublisherTest, PublishingSendsUnderlyingMemoryChunkOnPublisherPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(PublisherTest, LoanBatchProvidesDefaultConstructedSamplesOfAllAllocatedChunks)
+{
+    ChunkMock<DummyData> secondChunkMock;
+    constexpr uint32_t NUMBER_OF_SAMPLES{3U};
+    EXPECT_CALL(portMock, tryAllocateChunks(sizeof(DummyData), _, _, _, NUMBER_OF_SAMPLES, _))
+        .WillOnce(Invoke([&](const uint32_t,
+                             const uint32_t,
+                             const uint32_t,
+                             const uint32_t,
+                             const uint32_t,
+                             const iox::cxx::function_ref<void(iox::mepoo::ChunkHeader*)> callable) {
+            callable(chunkMock.chunkHeader());
+            callable(secondChunkMock.chunkHeader());
+            return iox::cxx::success<uint32_t>(2U);
+        }));
+    EXPECT_CALL(portMock, releaseChunk(_)).Times(2);
+    // ===== Test ===== //
+    std::vector<iox::popo::Sample<DummyData>> samples;
+    auto result = sut.loanBatch(NUMBER_OF_SAMPLES, [&](iox::popo::Sample<DummyData>&& sample) {
+        samples.emplace_back(std::move(sample));
+    });
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value(), 2U);
+    ASSERT_EQ(samples.size(), 2U);
+    EXPECT_EQ(samples[0].getChunkHeader(), chunkMock.chunkHeader());
+    EXPECT_EQ(samples[1].getChunkHeader(), secondChunkMock.chunkHeader());
+    EXPECT_EQ(samples[0]->val, DummyData::defaultVal());
+    EXPECT_EQ(samples[1]->val, DummyData::defaultVal());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, LoanBatchForwardsAllocationErrorsToCaller)
+{
+    EXPECT_CALL(portMock, tryAllocateChunks(sizeof(DummyData), _, _, _, _, _))
+        .WillOnce(Return(
+            ByMove(iox::cxx::error<iox::popo::AllocationError>(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS))));
+    // ===== Test ===== //
+    auto result = sut.loanBatch(2U, [](iox::popo::Sample<DummyData>&&) {});
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS, result.get_error());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, PublishBatchSendsAllUnderlyingMemoryChunksAtOnce)
+{
+    ChunkMock<DummyData> secondChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunk(sizeof(DummyData), _, _, _))
+        .WillOnce(Return(ByMove(iox::cxx::success<iox::mepoo::ChunkHeader*>(chunkMock.chunkHeader()))))
+        .WillOnce(Return(ByMove(iox::cxx::success<iox::mepoo::ChunkHeader*>(secondChunkMock.chunkHeader()))));
+    EXPECT_CALL(portMock, sendChunks(_, 2U))
+        .WillOnce(Invoke([&](iox::mepoo::ChunkHeader* const* const chunkHeaders, const uint32_t) {
+            EXPECT_EQ(chunkHeaders[0], chunkMock.chunkHeader());
+            EXPECT_EQ(chunkHeaders[1], secondChunkMock.chunkHeader());
+        }));
+    EXPECT_CALL(portMock, releaseChunk(_)).Times(0);
+    // ===== Test ===== //
+    std::vector<iox::popo::Sample<DummyData>> samples;
+    samples.emplace_back(std::move(sut.loan().value()));
+    samples.emplace_back(std::move(sut.loan().value()));
+    sut.publishBatch(samples.data(), static_cast<uint32_t>(samples.size()));
+    // ===== Verify ===== //
+    EXPECT_EQ(samples[0].get(), nullptr);
+    EXPECT_EQ(samples[1].get(), nullptr);
+    // ===== Cleanup ===== //
+}
+
 // test whether the BasePublisher methods are called
 
 TEST_F(PublisherTest, OfferDoesOfferServiceOnUnderlyingPort)
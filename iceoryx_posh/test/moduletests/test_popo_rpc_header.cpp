@@ -177,6 +177,25 @@ TEST_F(RequestHeader_test, SetFireAndForgetWorks)
     EXPECT_THAT(sut->isFireAndForget(), Eq(true));
 }
 
+TEST_F(RequestHeader_test, FromPayloadReturnsRequestHeaderOfTheChunk)
+{
+    EXPECT_THAT(RequestHeader::fromPayload(static_cast<void*>(chunk.sample())), Eq(sut));
+}
+
+TEST_F(RequestHeader_test, FromPayloadWithConstPayloadReturnsRequestHeaderOfTheChunk)
+{
+    const void* payload = chunk.sample();
+    EXPECT_THAT(RequestHeader::fromPayload(payload), Eq(sut));
+}
+
+TEST_F(RequestHeader_test, FromPayloadWithNullptrReturnsNullptr)
+{
+    void* payload{nullptr};
+    const void* constPayload{nullptr};
+    EXPECT_THAT(RequestHeader::fromPayload(payload), Eq(nullptr));
+    EXPECT_THAT(RequestHeader::fromPayload(constPayload), Eq(nullptr));
+}
+
 class ResponseHeader_test : public Test
 {
   public:
@@ -222,4 +241,23 @@ TEST_F(ResponseHeader_test, SetServerErrorWorks)
     EXPECT_THAT(sut->hasServerError(), Eq(true));
 }
 
+TEST_F(ResponseHeader_test, FromPayloadReturnsResponseHeaderOfTheChunk)
+{
+    EXPECT_THAT(ResponseHeader::fromPayload(static_cast<void*>(chunk.sample())), Eq(sut));
+}
+
+TEST_F(ResponseHeader_test, FromPayloadWithConstPayloadReturnsResponseHeaderOfTheChunk)
+{
+    const void* payload = chunk.sample();
+    EXPECT_THAT(ResponseHeader::fromPayload(payload), Eq(sut));
+}
+
+TEST_F(ResponseHeader_test, FromPayloadWithNullptrReturnsNullptr)
+{
+    void* payload{nullptr};
+    const void* constPayload{nullptr};
+    EXPECT_THAT(ResponseHeader::fromPayload(payload), Eq(nullptr));
+    EXPECT_THAT(ResponseHeader::fromPayload(constPayload), Eq(nullptr));
+}
+
 } // namespace
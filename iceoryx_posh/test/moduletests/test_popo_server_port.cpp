@@ -0,0 +1,350 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/ports/client_port_data.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_roudi.hpp"
+#include "iceoryx_posh/internal/popo/ports/client_port_user.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_data.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_roudi.hpp"
+#include "iceoryx_posh/internal/popo/ports/server_port_user.hpp"
+
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::capro;
+using namespace iox::popo;
+
+class ServerPort_test : public Test
+{
+    // keep this the very first and also private
+    iox::cxx::GenericRAII m_uniqueRouDiId{[] { iox::popo::internal::setUniqueRouDiId(0U); },
+                                          [] { iox::popo::internal::unsetUniqueRouDiId(); }};
+
+    static constexpr iox::units::Duration DEADLOCK_TIMEOUT{5_s};
+    Watchdog m_deadlockWatchdog{DEADLOCK_TIMEOUT};
+
+  public:
+    ServerPort_test()
+    {
+        iox::mepoo::MePooConfig mempoolconf;
+        mempoolconf.addMemPool({CHUNK_SIZE, NUM_CHUNKS});
+        m_memoryManager.configureMemoryManager(mempoolconf, m_memoryAllocator, m_memoryAllocator);
+    }
+
+    void SetUp() override
+    {
+        m_deadlockWatchdog.watchAndActOnFailure([] { std::terminate(); });
+    }
+
+    void TearDown() override
+    {
+    }
+
+    /// @brief this is basically what RouDi does when a client connects to an offered server
+    void connectClient(ServerPortRouDi& serverPortRouDi, ClientPortRouDi& clientPortRouDi)
+    {
+        auto maybeClientMessage = clientPortRouDi.tryGetCaProMessage();
+        ASSERT_TRUE(maybeClientMessage.has_value());
+        ASSERT_THAT(maybeClientMessage->m_type, Eq(CaproMessageType::CONNECT));
+
+        auto maybeServerMessage = serverPortRouDi.dispatchCaProMessageAndGetPossibleResponse(*maybeClientMessage);
+        ASSERT_TRUE(maybeServerMessage.has_value());
+        ASSERT_THAT(maybeServerMessage->m_type, Eq(CaproMessageType::ACK));
+
+        clientPortRouDi.dispatchCaProMessageAndGetPossibleResponse(*maybeServerMessage);
+        ASSERT_THAT(clientPortUser.getConnectionState(), Eq(iox::ConnectionState::CONNECTED));
+    }
+
+    void sendRequest(const uint64_t value)
+    {
+        auto maybeRequest = clientPortUser.allocateRequest(sizeof(uint64_t), alignof(uint64_t));
+        ASSERT_FALSE(maybeRequest.has_error());
+        *static_cast<uint64_t*>(maybeRequest.value()->getUserPayload()) = value;
+        clientPortUser.sendRequest(maybeRequest.value());
+    }
+
+    uint32_t getNumberOfUsedChunks() const
+    {
+        return m_memoryManager.getMemPoolInfo(0U).m_usedChunks;
+    }
+
+    /// @brief the ChunkSender of a port keeps the last sent chunk for reuse, this releases the kept chunks
+    void releaseLastSentChunks()
+    {
+        clientPortRouDi.releaseAllChunks();
+        serverPortRouDi.releaseAllChunks();
+    }
+
+  private:
+    static constexpr uint32_t NUM_CHUNKS = 1024U;
+    static constexpr uint32_t CHUNK_SIZE = 128U;
+    static constexpr size_t MEMORY_SIZE = 1024U * 1024U;
+    uint8_t m_memory[MEMORY_SIZE];
+    iox::posix::Allocator m_memoryAllocator{m_memory, MEMORY_SIZE};
+    iox::mepoo::MemoryManager m_memoryManager;
+
+    ServiceDescription m_serviceDescription{"hyp", "no", "toad"};
+    iox::RuntimeName_t m_runtimeName{"hypnotoad"};
+
+    ServerOptions m_serverOptionsWithoutOfferOnCreate = [] {
+        ServerOptions options;
+        options.offerOnCreate = false;
+        return options;
+    }();
+
+  public:
+    ServerPortData serverPortData{m_serviceDescription, m_runtimeName, ServerOptions{}, &m_memoryManager};
+    ServerPortUser serverPortUser{&serverPortData};
+    ServerPortRouDi serverPortRouDi{&serverPortData};
+
+    ServerPortData serverPortDataWithoutOfferOnCreate{
+        m_serviceDescription, m_runtimeName, m_serverOptionsWithoutOfferOnCreate, &m_memoryManager};
+    ServerPortUser serverPortUserWithoutOfferOnCreate{&serverPortDataWithoutOfferOnCreate};
+    ServerPortRouDi serverPortRouDiWithoutOfferOnCreate{&serverPortDataWithoutOfferOnCreate};
+
+    ClientPortData clientPortData{m_serviceDescription, m_runtimeName, ClientOptions{}, &m_memoryManager};
+    ClientPortUser clientPortUser{clientPortData};
+    ClientPortRouDi clientPortRouDi{clientPortData};
+};
+constexpr iox::units::Duration ServerPort_test::DEADLOCK_TIMEOUT;
+
+TEST_F(ServerPort_test, PortWithOfferOnCreateIsOfferedAndSendsOfferMessage)
+{
+    EXPECT_TRUE(serverPortUser.isOffered());
+
+    auto maybeCaproMessage = serverPortRouDi.tryGetCaProMessage();
+    ASSERT_TRUE(maybeCaproMessage.has_value());
+    EXPECT_THAT(maybeCaproMessage->m_type, Eq(CaproMessageType::OFFER));
+    EXPECT_FALSE(serverPortRouDi.tryGetCaProMessage().has_value());
+}
+
+TEST_F(ServerPort_test, PortWithoutOfferOnCreateIsNotOfferedAndSendsNoMessage)
+{
+    EXPECT_FALSE(serverPortUserWithoutOfferOnCreate.isOffered());
+    EXPECT_FALSE(serverPortRouDiWithoutOfferOnCreate.tryGetCaProMessage().has_value());
+}
+
+TEST_F(ServerPort_test, OfferOnNotOfferedPortSendsOfferMessage)
+{
+    serverPortUserWithoutOfferOnCreate.offer();
+
+    EXPECT_TRUE(serverPortUserWithoutOfferOnCreate.isOffered());
+    auto maybeCaproMessage = serverPortRouDiWithoutOfferOnCreate.tryGetCaProMessage();
+    ASSERT_TRUE(maybeCaproMessage.has_value());
+    EXPECT_THAT(maybeCaproMessage->m_type, Eq(CaproMessageType::OFFER));
+}
+
+TEST_F(ServerPort_test, StopOfferOnOfferedPortSendsStopOfferMessageAndRemovesClients)
+{
+    serverPortRouDi.tryGetCaProMessage();
+    connectClient(serverPortRouDi, clientPortRouDi);
+    ASSERT_TRUE(serverPortUser.hasClients());
+
+    serverPortUser.stopOffer();
+
+    EXPECT_FALSE(serverPortUser.isOffered());
+    auto maybeCaproMessage = serverPortRouDi.tryGetCaProMessage();
+    ASSERT_TRUE(maybeCaproMessage.has_value());
+    EXPECT_THAT(maybeCaproMessage->m_type, Eq(CaproMessageType::STOP_OFFER));
+    EXPECT_FALSE(serverPortUser.hasClients());
+}
+
+TEST_F(ServerPort_test, ConnectOnOfferedPortIsAcknowledgedWithRequestQueue)
+{
+    serverPortRouDi.tryGetCaProMessage();
+
+    CaproMessage connectMessage{CaproMessageType::CONNECT, serverPortData.m_serviceDescription};
+    connectMessage.m_chunkQueueData = &clientPortData.m_chunkReceiverData;
+    auto maybeResponse = serverPortRouDi.dispatchCaProMessageAndGetPossibleResponse(connectMessage);
+
+    ASSERT_TRUE(maybeResponse.has_value());
+    EXPECT_THAT(maybeResponse->m_type, Eq(CaproMessageType::ACK));
+    EXPECT_THAT(maybeResponse->m_chunkQueueData, Eq(static_cast<void*>(&serverPortData.m_chunkReceiverData)));
+    EXPECT_TRUE(serverPortUser.hasClients());
+}
+
+TEST_F(ServerPort_test, ConnectOnNotOfferedPortIsRejected)
+{
+    CaproMessage connectMessage{CaproMessageType::CONNECT, serverPortData.m_serviceDescription};
+    connectMessage.m_chunkQueueData = &clientPortData.m_chunkReceiverData;
+    auto maybeResponse = serverPortRouDiWithoutOfferOnCreate.dispatchCaProMessageAndGetPossibleResponse(connectMessage);
+
+    ASSERT_TRUE(maybeResponse.has_value());
+    EXPECT_THAT(maybeResponse->m_type, Eq(CaproMessageType::NACK));
+    EXPECT_FALSE(serverPortUserWithoutOfferOnCreate.hasClients());
+}
+
+TEST_F(ServerPort_test, DisconnectOfConnectedClientIsAcknowledgedAndRemovesClient)
+{
+    serverPortRouDi.tryGetCaProMessage();
+    connectClient(serverPortRouDi, clientPortRouDi);
+
+    CaproMessage disconnectMessage{CaproMessageType::DISCONNECT, serverPortData.m_serviceDescription};
+    disconnectMessage.m_chunkQueueData = &clientPortData.m_chunkReceiverData;
+    auto maybeResponse = serverPortRouDi.dispatchCaProMessageAndGetPossibleResponse(disconnectMessage);
+
+    ASSERT_TRUE(maybeResponse.has_value());
+    EXPECT_THAT(maybeResponse->m_type, Eq(CaproMessageType::ACK));
+    EXPECT_FALSE(serverPortUser.hasClients());
+}
+
+TEST_F(ServerPort_test, GetRequestWithoutRequestsReturnsNoChunkAvailable)
+{
+    EXPECT_FALSE(serverPortUser.hasNewRequests());
+
+    auto maybeRequest = serverPortUser.getRequest();
+    ASSERT_TRUE(maybeRequest.has_error());
+    EXPECT_THAT(maybeRequest.get_error(), Eq(ChunkReceiveResult::NO_CHUNK_AVAILABLE));
+}
+
+TEST_F(ServerPort_test, RequestOfConnectedClientIsReceived)
+{
+    constexpr uint64_t REQUEST_VALUE{42U};
+    serverPortRouDi.tryGetCaProMessage();
+    connectClient(serverPortRouDi, clientPortRouDi);
+
+    sendRequest(REQUEST_VALUE);
+
+    EXPECT_TRUE(serverPortUser.hasNewRequests());
+    auto maybeRequest = serverPortUser.getRequest();
+    ASSERT_FALSE(maybeRequest.has_error());
+    EXPECT_THAT(*static_cast<const uint64_t*>(maybeRequest.value()->getUserPayload()), Eq(REQUEST_VALUE));
+
+    serverPortUser.releaseRequest(maybeRequest.value());
+    releaseLastSentChunks();
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(0U));
+}
+
+TEST_F(ServerPort_test, ResponseIsDeliveredToRequestingClient)
+{
+    constexpr uint64_t RESPONSE_VALUE{73U};
+    constexpr int64_t SEQUENCE_ID{1337};
+    serverPortRouDi.tryGetCaProMessage();
+    connectClient(serverPortRouDi, clientPortRouDi);
+
+    auto maybeRequest = clientPortUser.allocateRequest(sizeof(uint64_t), alignof(uint64_t));
+    ASSERT_FALSE(maybeRequest.has_error());
+    maybeRequest.value()->setSequenceId(SEQUENCE_ID);
+    clientPortUser.sendRequest(maybeRequest.value());
+
+    auto maybeReceivedRequest = serverPortUser.getRequest();
+    ASSERT_FALSE(maybeReceivedRequest.has_error());
+    auto maybeResponse = serverPortUser.allocateResponse(maybeReceivedRequest.value(), sizeof(uint64_t), 8U);
+    ASSERT_FALSE(maybeResponse.has_error());
+    *static_cast<uint64_t*>(maybeResponse.value()->getUserPayload()) = RESPONSE_VALUE;
+    EXPECT_TRUE(serverPortUser.sendResponse(maybeResponse.value()));
+    serverPortUser.releaseRequest(maybeReceivedRequest.value());
+
+    auto maybeReceivedResponse = clientPortUser.getResponse();
+    ASSERT_FALSE(maybeReceivedResponse.has_error());
+    EXPECT_THAT(maybeReceivedResponse.value()->getSequenceId(), Eq(SEQUENCE_ID));
+    EXPECT_THAT(*static_cast<const uint64_t*>(maybeReceivedResponse.value()->getUserPayload()), Eq(RESPONSE_VALUE));
+    clientPortUser.releaseResponse(maybeReceivedResponse.value());
+    releaseLastSentChunks();
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(0U));
+}
+
+TEST_F(ServerPort_test, ResponseToDisconnectedClientIsDropped)
+{
+    serverPortRouDi.tryGetCaProMessage();
+    connectClient(serverPortRouDi, clientPortRouDi);
+    sendRequest(1U);
+
+    auto maybeReceivedRequest = serverPortUser.getRequest();
+    ASSERT_FALSE(maybeReceivedRequest.has_error());
+    auto maybeResponse = serverPortUser.allocateResponse(maybeReceivedRequest.value(), sizeof(uint64_t), 8U);
+    ASSERT_FALSE(maybeResponse.has_error());
+
+    CaproMessage disconnectMessage{CaproMessageType::DISCONNECT, serverPortData.m_serviceDescription};
+    disconnectMessage.m_chunkQueueData = &clientPortData.m_chunkReceiverData;
+    serverPortRouDi.dispatchCaProMessageAndGetPossibleResponse(disconnectMessage);
+
+    EXPECT_FALSE(serverPortUser.sendResponse(maybeResponse.value()));
+    EXPECT_FALSE(clientPortUser.hasNewResponses());
+    serverPortUser.releaseRequest(maybeReceivedRequest.value());
+    releaseLastSentChunks();
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(0U));
+}
+
+TEST_F(ServerPort_test, FreeResponseReleasesTheChunk)
+{
+    serverPortRouDi.tryGetCaProMessage();
+    connectClient(serverPortRouDi, clientPortRouDi);
+    sendRequest(1U);
+
+    auto maybeReceivedRequest = serverPortUser.getRequest();
+    ASSERT_FALSE(maybeReceivedRequest.has_error());
+    auto maybeResponse = serverPortUser.allocateResponse(maybeReceivedRequest.value(), sizeof(uint64_t), 8U);
+    ASSERT_FALSE(maybeResponse.has_error());
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(2U));
+
+    serverPortUser.freeResponse(maybeResponse.value());
+    serverPortUser.releaseRequest(maybeReceivedRequest.value());
+    releaseLastSentChunks();
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(0U));
+}
+
+TEST_F(ServerPort_test, ReleaseAllChunksReleasesRequestsAndResponses)
+{
+    serverPortRouDi.tryGetCaProMessage();
+    connectClient(serverPortRouDi, clientPortRouDi);
+    sendRequest(1U);
+
+    auto maybeReceivedRequest = serverPortUser.getRequest();
+    ASSERT_FALSE(maybeReceivedRequest.has_error());
+    auto maybeResponse = serverPortUser.allocateResponse(maybeReceivedRequest.value(), sizeof(uint64_t), 8U);
+    ASSERT_FALSE(maybeResponse.has_error());
+
+    serverPortRouDi.releaseAllChunks();
+    // the client port keeps the last sent request for reuse
+    clientPortRouDi.releaseAllChunks();
+    EXPECT_THAT(getNumberOfUsedChunks(), Eq(0U));
+}
+
+TEST_F(ServerPort_test, ReleasingNullptrRequestCallsErrorHandler)
+{
+    iox::cxx::optional<iox::Error> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandler::setTemporaryErrorHandler(
+        [&](const iox::Error error, const std::function<void()>, const iox::ErrorLevel errorLevel) {
+            detectedError.emplace(error);
+            EXPECT_THAT(errorLevel, Eq(iox::ErrorLevel::SEVERE));
+        });
+
+    serverPortUser.releaseRequest(nullptr);
+
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_THAT(detectedError.value(), Eq(iox::Error::kPOPO__SERVER_PORT_INVALID_REQUEST_TO_RELEASE_FROM_USER));
+}
+
+TEST_F(ServerPort_test, SettingConditionVariableIsReflectedByPort)
+{
+    ConditionVariableData conditionVariableData{"hypnotoad"};
+    EXPECT_FALSE(serverPortUser.isConditionVariableSet());
+
+    serverPortUser.setConditionVariable(conditionVariableData, 0U);
+    EXPECT_TRUE(serverPortUser.isConditionVariableSet());
+
+    serverPortUser.unsetConditionVariable();
+    EXPECT_FALSE(serverPortUser.isConditionVariableSet());
+}
+
+} // namespace
@@ -169,6 +169,31 @@ TEST_F(SubscriberTest, ReceivedSamplesAreAutomaticallyDeletedWhenOutOfScope)
     // ===== Cleanup ===== //
 }
 
+TEST_F(SubscriberTest, TakeBatchWrapsAllTakenChunksInSamples)
+{
+    // ===== Setup ===== //
+    constexpr uint64_t MAX_NUMBER_OF_SAMPLES{4U};
+    EXPECT_CALL(sut, takeChunks(MAX_NUMBER_OF_SAMPLES, _))
+        .WillOnce(Invoke(
+            [&](const uint64_t, const iox::cxx::function_ref<void(const iox::mepoo::ChunkHeader*)> callable) {
+                callable(chunkMock.chunkHeader());
+                callable(chunkMock.chunkHeader());
+                return iox::cxx::success<uint64_t>(2U);
+            }));
+    EXPECT_CALL(sut.port(), releaseChunk).Times(2);
+    // ===== Test ===== //
+    uint64_t numberOfSamples{0U};
+    auto result = sut.takeBatch(MAX_NUMBER_OF_SAMPLES, [&](iox::popo::Sample<const DummyData>&& sample) {
+        EXPECT_EQ(sample.get(), chunkMock.chunkHeader()->userPayload());
+        ++numberOfSamples;
+    });
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value(), 2U);
+    EXPECT_EQ(numberOfSamples, 2U);
+    // ===== Cleanup ===== //
+}
+
 TEST_F(SubscriberTest, ReleasesQueuedDataViaBaseSubscriber)
 {
     // ===== Setup ===== //
@@ -133,6 +133,46 @@ TEST_F(UntypedPublisherTest, PublishesUserPayloadViaUnderlyingPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(UntypedPublisherTest, LoanBatchProvidesUserPayloadsOfAllAllocatedChunks)
+{
+    constexpr uint32_t ALLOCATION_SIZE = 7U;
+    constexpr uint32_t NUMBER_OF_CHUNKS = 4U;
+    EXPECT_CALL(portMock, tryAllocateChunks(ALLOCATION_SIZE, _, _, _, NUMBER_OF_CHUNKS, _))
+        .WillOnce(Invoke([&](const uint32_t,
+                             const uint32_t,
+                             const uint32_t,
+                             const uint32_t,
+                             const uint32_t,
+                             const iox::cxx::function_ref<void(iox::mepoo::ChunkHeader*)> callable) {
+            callable(chunkMock.chunkHeader());
+            return iox::cxx::success<uint32_t>(1U);
+        }));
+    // ===== Test ===== //
+    void* userPayload{nullptr};
+    auto result = sut.loanBatch(NUMBER_OF_CHUNKS, [&](void* payload) { userPayload = payload; }, ALLOCATION_SIZE);
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value(), 1U);
+    EXPECT_EQ(userPayload, chunkMock.chunkHeader()->userPayload());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(UntypedPublisherTest, PublishBatchSendsUserPayloadsViaUnderlyingPort)
+{
+    // ===== Setup ===== //
+    ChunkMock<uint64_t> secondChunkMock;
+    void* userPayloads[] = {chunkMock.chunkHeader()->userPayload(), secondChunkMock.chunkHeader()->userPayload()};
+    EXPECT_CALL(portMock, sendChunks(_, 2U))
+        .WillOnce(Invoke([&](iox::mepoo::ChunkHeader* const* const chunkHeaders, const uint32_t) {
+            EXPECT_EQ(chunkHeaders[0], chunkMock.chunkHeader());
+            EXPECT_EQ(chunkHeaders[1], secondChunkMock.chunkHeader());
+        }));
+    // ===== Test ===== //
+    sut.publishBatch(userPayloads, 2U);
+    // ===== Verify ===== //
+    // ===== Cleanup ===== //
+}
+
 // test whether the BasePublisher methods are called
 
 TEST_F(UntypedPublisherTest, OfferDoesOfferServiceOnUnderlyingPort)
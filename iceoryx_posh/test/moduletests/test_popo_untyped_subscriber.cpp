@@ -139,6 +139,27 @@ TEST_F(UntypedSubscriberTest, TakeReturnsAllocatedMemoryChunk)
     sut.release(maybeChunk.value());
 }
 
+TEST_F(UntypedSubscriberTest, TakeBatchReturnsUserPayloadsOfAllTakenChunks)
+{
+    // ===== Setup ===== //
+    constexpr uint64_t MAX_NUMBER_OF_CHUNKS{4U};
+    EXPECT_CALL(sut, takeChunks(MAX_NUMBER_OF_CHUNKS, _))
+        .WillOnce(Invoke(
+            [&](const uint64_t, const iox::cxx::function_ref<void(const iox::mepoo::ChunkHeader*)> callable) {
+                callable(chunkMock.chunkHeader());
+                return iox::cxx::success<uint64_t>(1U);
+            }));
+    // ===== Test ===== //
+    const void* userPayload{nullptr};
+    auto result = sut.takeBatch(MAX_NUMBER_OF_CHUNKS, [&](const void* payload) { userPayload = payload; });
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value(), 1U);
+    EXPECT_EQ(userPayload, chunkMock.chunkHeader()->userPayload());
+    // ===== Cleanup ===== //
+    sut.release(userPayload);
+}
+
 TEST_F(UntypedSubscriberTest, ReleasesQueuedDataViaBaseSubscriber)
 {
     // ===== Setup ===== //
@@ -223,6 +223,58 @@ TEST_F(UsedChunkList_test, UsedChunkListCanBeFilledToCapacityAndFullyEmptied)
     checkIfEmpty();
 }
 
+TEST_F(UsedChunkList_test, ChunksCanBeFoundAfterManyInterleavedRemovalsAndInsertions)
+{
+    std::vector<SharedChunk> chunksInUse;
+    createMultipleChunks(USED_CHUNK_LIST_CAPACITY, [&](SharedChunk&& chunk) {
+        EXPECT_TRUE(sut.insert(chunk));
+        chunksInUse.push_back(chunk);
+    });
+
+    // remove the chunks in an order which differs from the insertion order and insert them again to shuffle the
+    // entries of the list
+    constexpr uint32_t NUMBER_OF_CYCLES{100U};
+    constexpr uint32_t STRIDE{3U};
+    for (uint32_t i = 0U; i < NUMBER_OF_CYCLES; ++i)
+    {
+        auto& chunk = chunksInUse[(i * STRIDE) % USED_CHUNK_LIST_CAPACITY];
+        SharedChunk removedChunk;
+        ASSERT_TRUE(sut.remove(chunk.getChunkHeader(), removedChunk));
+        EXPECT_EQ(removedChunk.getChunkHeader(), chunk.getChunkHeader());
+        EXPECT_TRUE(sut.insert(removedChunk));
+    }
+
+    for (auto& chunk : chunksInUse)
+    {
+        SharedChunk removedChunk;
+        EXPECT_TRUE(sut.remove(chunk.getChunkHeader(), removedChunk));
+        EXPECT_EQ(removedChunk.getChunkHeader(), chunk.getChunkHeader());
+    }
+
+    checkIfEmpty();
+}
+
+TEST_F(UsedChunkList_test, ChunkAddedTwiceCanBeRemovedTwiceAfterOtherChunkWasRemoved)
+{
+    std::vector<ChunkHeader*> chunkHeaderInUse;
+    createMultipleChunks(2U, [&](SharedChunk&& chunk) {
+        chunkHeaderInUse.push_back(chunk.getChunkHeader());
+        sut.insert(chunk);
+        sut.insert(chunk);
+    });
+
+    SharedChunk removedChunk;
+    EXPECT_TRUE(sut.remove(chunkHeaderInUse[0U], removedChunk));
+
+    for (uint32_t i = 0U; i < 2U; ++i)
+    {
+        SharedChunk removedDuplicate;
+        EXPECT_TRUE(sut.remove(chunkHeaderInUse[1U], removedDuplicate));
+        EXPECT_EQ(removedDuplicate.getChunkHeader(), chunkHeaderInUse[1U]);
+    }
+    EXPECT_FALSE(sut.remove(chunkHeaderInUse[1U], removedChunk));
+}
+
 TEST_F(UsedChunkList_test, RemoveChunkFromEmptyListIsHandledGracefully)
 {
     auto chunk = getChunkFromMemoryManager();
@@ -1459,4 +1459,37 @@ TEST_F(WaitSet_test, TimedWaitUnblocksAfterMarkForDestructionCall)
     t.join();
 }
 
+TEST_F(WaitSet_test, WaitWithoutBusyPollIsCountedAsSleep)
+{
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0U], 0U).has_error());
+
+    std::thread t([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        m_simpleEvents[0U].trigger();
+    });
+    EXPECT_THAT(m_sut->wait().size(), Eq(1U));
+    t.join();
+
+    auto statistics = m_sut->getWaitStatistics();
+    EXPECT_THAT(statistics.spinHits, Eq(0U));
+    EXPECT_THAT(statistics.sleeps, Eq(1U));
+}
+
+TEST_F(WaitSet_test, WaitWithBusyPollIsCountedAsSpinHitWhenTriggeredDuringTheBusyPoll)
+{
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0U], 0U).has_error());
+    m_sut->setBusyPollDuration(10_s);
+
+    std::thread t([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        m_simpleEvents[0U].trigger();
+    });
+    EXPECT_THAT(m_sut->wait().size(), Eq(1U));
+    t.join();
+
+    auto statistics = m_sut->getWaitStatistics();
+    EXPECT_THAT(statistics.spinHits, Eq(1U));
+    EXPECT_THAT(statistics.sleeps, Eq(0U));
+}
+
 } // namespace
@@ -54,6 +54,53 @@ TEST_F(RoudiConfigTomlFileProvider_test, ParseDefaultConfigIsSuccessful)
     EXPECT_FALSE(result.has_error());
 }
 
+TEST_F(RoudiConfigTomlFileProvider_test, ParseMemPoolOverflowPolicyIsSuccessful)
+{
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_mempool_overflow.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_EQ(segments.size(), 2U);
+    EXPECT_EQ(segments[0].m_mempoolConfig.m_overflowPolicy, iox::mepoo::MemPoolOverflowPolicy::USE_LARGER_MEMPOOL);
+    EXPECT_EQ(segments[1].m_mempoolConfig.m_overflowPolicy, iox::mepoo::MemPoolOverflowPolicy::REJECT_ALLOCATION);
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParseChunkCacheIsSuccessful)
+{
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_chunk_cache.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_EQ(segments.size(), 2U);
+    EXPECT_TRUE(segments[0].m_mempoolConfig.m_chunkCacheEnabled);
+    EXPECT_FALSE(segments[1].m_mempoolConfig.m_chunkCacheEnabled);
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParseHugePagesAndLockMemoryIsSuccessful)
+{
+    m_cmdLineArgs.configFilePath.append(iox::cxx::TruncateToCapacity, "roudi_config_huge_pages_and_lock_memory.toml");
+
+    iox::config::TomlRouDiConfigFileProvider sut(m_cmdLineArgs);
+
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_EQ(segments.size(), 2U);
+    EXPECT_TRUE(segments[0].m_memoryInfo.useHugePages);
+    EXPECT_TRUE(segments[0].m_memoryInfo.lockMemory);
+    EXPECT_FALSE(segments[1].m_memoryInfo.useHugePages);
+    EXPECT_FALSE(segments[1].m_memoryInfo.lockMemory);
+}
+
 /// we require INSTANTIATE_TEST_CASE_P since we support gtest 1.8 for our safety targets
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
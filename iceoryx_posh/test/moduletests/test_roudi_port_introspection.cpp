@@ -447,6 +447,77 @@ TEST_F(PortIntrospection_test, addAndRemoveSubscriber)
     chunk->sample()->~PortIntrospectionFieldTopic();
 }
 
+TEST_F(PortIntrospection_test, sendThroughputData_ReportsStatisticsAndRatesOfPublisher)
+{
+    using Topic = iox::roudi::PortThroughputIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    iox::mepoo::MemoryManager memoryManager;
+    iox::popo::PublisherOptions publisherOptions;
+    iox::popo::PublisherPortData portData(
+        iox::capro::ServiceDescription("Radar", "Front", "Object"), "name", &memoryManager, publisherOptions);
+    EXPECT_THAT(m_introspectionAccess.addPublisher(portData), Eq(true));
+
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(iox::cxx::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>::create_value(
+            chunk.get()->chunkHeader())));
+
+    bool chunkWasSent = false;
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), sendChunk(_))
+        .WillRepeatedly(Invoke([&](iox::mepoo::ChunkHeader* const) { chunkWasSent = true; }));
+
+    constexpr uint32_t USER_PAYLOAD_SIZE{64U};
+    constexpr uint32_t CHUNK_SIZE{128U};
+    constexpr int64_t SEND_INTERVAL{1000};
+    constexpr uint64_t LOST_CHUNKS{2U};
+    auto& statistics = portData.m_chunkSenderData.m_statistics;
+    statistics.m_sentChunks = 10U;
+    statistics.m_sentUserPayloadBytes = 10U * USER_PAYLOAD_SIZE;
+    statistics.m_lostChunks = LOST_CHUNKS;
+    statistics.m_lastUserPayloadSize = USER_PAYLOAD_SIZE;
+    statistics.m_lastChunkSize = CHUNK_SIZE;
+    statistics.m_lastSendIntervalInNanoseconds = SEND_INTERVAL;
+
+    m_introspectionAccess.sendThroughputData();
+    ASSERT_THAT(chunkWasSent, Eq(true));
+
+    {
+        ASSERT_THAT(chunk->sample()->m_throughputList.size(), Eq(1U));
+        const auto& throughput = chunk->sample()->m_throughputList[0];
+        EXPECT_THAT(throughput.m_sampleSize, Eq(USER_PAYLOAD_SIZE));
+        EXPECT_THAT(throughput.m_chunkSize, Eq(CHUNK_SIZE));
+        EXPECT_THAT(throughput.m_lastSendIntervalInNanoseconds, Eq(static_cast<uint64_t>(SEND_INTERVAL)));
+        EXPECT_THAT(throughput.m_sentChunks, Eq(10U));
+        EXPECT_THAT(throughput.m_lostChunks, Eq(LOST_CHUNKS));
+        // the rates need a previous update
+        EXPECT_THAT(throughput.m_chunksPerMinute, Eq(0.0));
+        EXPECT_THAT(throughput.m_userPayloadBytesPerMinute, Eq(0.0));
+    }
+
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+    statistics.m_sentChunks = 20U;
+    statistics.m_sentUserPayloadBytes = 20U * USER_PAYLOAD_SIZE;
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    chunkWasSent = false;
+    m_introspectionAccess.sendThroughputData();
+    ASSERT_THAT(chunkWasSent, Eq(true));
+
+    {
+        ASSERT_THAT(chunk->sample()->m_throughputList.size(), Eq(1U));
+        const auto& throughput = chunk->sample()->m_throughputList[0];
+        EXPECT_THAT(throughput.m_sentChunks, Eq(20U));
+        // 10 chunks within at least 10 ms result in at most 60000 chunks per minute
+        EXPECT_THAT(throughput.m_chunksPerMinute, Gt(0.0));
+        EXPECT_THAT(throughput.m_chunksPerMinute, Le(60000.0));
+        EXPECT_THAT(throughput.m_userPayloadBytesPerMinute,
+                    DoubleEq(throughput.m_chunksPerMinute * static_cast<double>(USER_PAYLOAD_SIZE)));
+    }
+
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+}
+
 
 TEST_F(PortIntrospection_test, DISABLED_thread)
 {
@@ -351,6 +351,139 @@ TEST_F(PortManager_test, DoDiscoveryWithSubscribersCreatedBeforeAndAfterCreation
     EXPECT_THAT(subscriber2.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
 }
 
+TEST_F(PortManager_test, DoDiscoveryConnectsOnlyPortsWithTheSameService)
+{
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+
+    PublisherPortUser publisher1(
+        m_portManager
+            ->acquirePublisherPortData(
+                {"1", "1", "1"}, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value());
+    PublisherPortUser publisher2(
+        m_portManager
+            ->acquirePublisherPortData(
+                {"2", "2", "2"}, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value());
+    SubscriberPortUser subscriber1(
+        m_portManager->acquireSubscriberPortData({"1", "1", "1"}, subscriberOptions, "schlomo", PortConfigInfo())
+            .value());
+    SubscriberPortUser subscriberWithoutPublisher(
+        m_portManager->acquireSubscriberPortData({"3", "3", "3"}, subscriberOptions, "schlomo", PortConfigInfo())
+            .value());
+    subscriber1.subscribe();
+    subscriberWithoutPublisher.subscribe();
+    publisher1.offer();
+    publisher2.offer();
+
+    m_portManager->doDiscovery();
+
+    EXPECT_TRUE(publisher1.hasSubscribers());
+    EXPECT_FALSE(publisher2.hasSubscribers());
+    EXPECT_THAT(subscriber1.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+    if (std::is_same<iox::build::CommunicationPolicy, iox::build::OneToManyPolicy>::value)
+    {
+        EXPECT_THAT(subscriberWithoutPublisher.getSubscriptionState(), Eq(iox::SubscribeState::WAIT_FOR_OFFER));
+    }
+}
+
+TEST_F(PortManager_test, OfferOfGatewayPublisherReachesInternalSubscriberAfterSubscriberOfSameInterface)
+{
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+    const iox::capro::ServiceDescription gatewayService(
+        "1", "1", "1", {0U, 0U, 0U, 0U}, iox::capro::Interfaces::DDS);
+
+    SubscriberPortUser gatewaySubscriber(
+        m_portManager->acquireSubscriberPortData(gatewayService, subscriberOptions, "gateway", PortConfigInfo())
+            .value());
+    SubscriberPortUser subscriber(
+        m_portManager->acquireSubscriberPortData({"1", "1", "1"}, subscriberOptions, "schlomo", PortConfigInfo())
+            .value());
+    gatewaySubscriber.subscribe();
+    subscriber.subscribe();
+    m_portManager->doDiscovery();
+
+    PublisherPortUser gatewayPublisher(
+        m_portManager
+            ->acquirePublisherPortData(
+                gatewayService, publisherOptions, "gateway", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value());
+    gatewayPublisher.offer();
+    m_portManager->doDiscovery();
+
+    // the subscriber of the gateway must not receive the offer of its own interface but this must not prevent the
+    // delivery to the other subscribers
+    EXPECT_TRUE(gatewayPublisher.hasSubscribers());
+    EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+    if (std::is_same<iox::build::CommunicationPolicy, iox::build::OneToManyPolicy>::value)
+    {
+        EXPECT_THAT(gatewaySubscriber.getSubscriptionState(), Eq(iox::SubscribeState::WAIT_FOR_OFFER));
+    }
+}
+
+TEST_F(PortManager_test, AcquiringPublisherAfterDestroyingPublisherWithSameServiceIsSuccessful)
+{
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    const iox::capro::ServiceDescription service{"1", "1", "1"};
+
+    auto publisherData =
+        m_portManager
+            ->acquirePublisherPortData(
+                service, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value();
+    PublisherPortUser(publisherData).destroy();
+    m_portManager->doDiscovery();
+
+    EXPECT_FALSE(m_portManager
+                     ->acquirePublisherPortData(
+                         service, publisherOptions, "schlomo", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+                     .has_error());
+}
+
+TEST_F(PortManager_test, OfferAndSubscribeConnectPortsWithDoDiscoveryForNotifiedPorts)
+{
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+
+    PublisherPortUser publisher(
+        m_portManager
+            ->acquirePublisherPortData(
+                {"1", "1", "1"}, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value());
+    SubscriberPortUser subscriber(
+        m_portManager->acquireSubscriberPortData({"1", "1", "1"}, subscriberOptions, "schlomo", PortConfigInfo())
+            .value());
+    subscriber.subscribe();
+    publisher.offer();
+
+    EXPECT_TRUE(m_portManager->waitForDiscoveryNotification(iox::units::Duration::fromMilliseconds(0U)));
+    m_portManager->doDiscoveryForNotifiedPorts();
+
+    EXPECT_TRUE(publisher.hasSubscribers());
+    EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+}
+
+TEST_F(PortManager_test, DestroyedPublisherIsRemovedWithDoDiscoveryForNotifiedPorts)
+{
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+
+    PublisherPortUser publisher(
+        m_portManager
+            ->acquirePublisherPortData(
+                {"1", "1", "1"}, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value());
+    publisher.offer();
+    m_portManager->doDiscoveryForNotifiedPorts();
+    const auto serviceCounter = m_portManager->serviceRegistryChangeCounter()->load();
+
+    publisher.destroy();
+    m_portManager->doDiscoveryForNotifiedPorts();
+
+    EXPECT_THAT(m_portManager->serviceRegistryChangeCounter()->load(), Gt(serviceCounter));
+}
+
 TEST_F(PortManager_test, SubscribeOnCreateSubscribesWithoutDiscoveryLoopWhenPublisherAvailable)
 {
     PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
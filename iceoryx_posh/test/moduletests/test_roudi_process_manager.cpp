@@ -27,6 +27,11 @@
 #include "iceoryx_posh/version/compatibility_check_level.hpp"
 #include "test.hpp"
 
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -118,6 +123,45 @@ TEST_F(ProcessManager_test, RegisterAndUnregisterWorks)
     EXPECT_TRUE(unregisterResult);
 }
 
+TEST_F(ProcessManager_test, ConcurrentRegistrationAndUnregistrationOfDifferentProcessesWorks)
+{
+    constexpr uint32_t NUMBER_OF_PROCESSES{16U};
+    std::vector<iox::RuntimeName_t> processNames;
+    std::vector<std::unique_ptr<IpcInterfaceCreator>> processIpcInterfaces;
+    for (uint32_t i = 0U; i < NUMBER_OF_PROCESSES; ++i)
+    {
+        processNames.emplace_back(iox::cxx::TruncateToCapacity, "ConcurrentProcess" + std::to_string(i));
+        processIpcInterfaces.emplace_back(std::make_unique<IpcInterfaceCreator>(processNames.back()));
+    }
+
+    std::atomic<uint32_t> numberOfRegistrations{0U};
+    std::atomic<uint32_t> numberOfUnregistrations{0U};
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0U; i < NUMBER_OF_PROCESSES; ++i)
+    {
+        threads.emplace_back([&, i] {
+            if (m_sut->registerProcess(processNames[i], m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo))
+            {
+                ++numberOfRegistrations;
+            }
+            m_sut->updateLivelinessOfProcess(processNames[i]);
+            m_sut->run();
+            if (m_sut->unregisterProcess(processNames[i]))
+            {
+                ++numberOfUnregistrations;
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(numberOfRegistrations.load(), NUMBER_OF_PROCESSES);
+    EXPECT_EQ(numberOfUnregistrations.load(), NUMBER_OF_PROCESSES);
+    EXPECT_FALSE(m_sut->unregisterProcess(processNames[0]));
+}
+
 TEST_F(ProcessManager_test, HandleProcessShutdownPreparationRequestWorks)
 {
     m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo);
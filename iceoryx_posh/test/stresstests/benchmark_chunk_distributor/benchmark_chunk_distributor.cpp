@@ -0,0 +1,154 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/attributes.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace iox;
+
+constexpr uint64_t NUMBER_OF_ITERATIONS{1000000U};
+constexpr uint32_t CHUNK_COUNT{1000U};
+constexpr uint32_t CHUNK_PAYLOAD_SIZE{128U};
+constexpr uint64_t QUEUE_CAPACITY{16U};
+
+struct ChunkDistributorConfig
+{
+    static constexpr uint32_t MAX_QUEUES = MAX_SUBSCRIBERS_PER_PUBLISHER;
+    static constexpr uint64_t MAX_HISTORY_CAPACITY = MAX_PUBLISHER_HISTORY;
+};
+
+struct ChunkQueueConfig
+{
+    static constexpr uint64_t MAX_QUEUE_CAPACITY = QUEUE_CAPACITY;
+};
+
+using ChunkQueueData_t = popo::ChunkQueueData<ChunkQueueConfig, popo::ThreadSafePolicy>;
+using ChunkDistributorData_t =
+    popo::ChunkDistributorData<ChunkDistributorConfig, popo::ThreadSafePolicy, popo::ChunkQueuePusher<ChunkQueueData_t>>;
+using ChunkDistributor_t = popo::ChunkDistributor<ChunkDistributorData_t>;
+
+/// @brief measures the latency of delivering a chunk to the given number of queues while another thread, like RouDi
+/// during discovery, optionally connects and disconnects a subscriber queue in a loop
+void benchmarkDelivery(const uint32_t numberOfQueues, const bool withChangingQueue)
+{
+    mepoo::MePooConfig mempoolConfig;
+    mempoolConfig.addMemPool({CHUNK_PAYLOAD_SIZE, CHUNK_COUNT});
+
+    const uint64_t memorySize = mepoo::MemoryManager::requiredFullMemorySize(mempoolConfig);
+    void* rawMemory = malloc(memorySize);
+    posix::Allocator allocator(rawMemory, memorySize);
+    auto memoryManager = new mepoo::MemoryManager();
+    memoryManager->configureMemoryManager(mempoolConfig, allocator, allocator);
+    auto chunkSettings = mepoo::ChunkSettings::create(CHUNK_PAYLOAD_SIZE, CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+
+    ChunkDistributorData_t distributorData{popo::SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA, 0U};
+    ChunkDistributor_t distributor{&distributorData};
+
+    std::vector<std::unique_ptr<ChunkQueueData_t>> queues;
+    for (uint32_t i = 0U; i < numberOfQueues + 1U; ++i)
+    {
+        queues.emplace_back(new ChunkQueueData_t(popo::QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                                 cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer));
+    }
+    for (uint32_t i = 0U; i < numberOfQueues; ++i)
+    {
+        if (distributor.tryAddQueue(queues[i].get()).has_error())
+        {
+            std::cerr << "Could not add a queue!" << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+    }
+
+    std::atomic_bool keepRunning{true};
+    std::thread discovery([&] {
+        while (withChangingQueue && keepRunning)
+        {
+            IOX_DISCARD_RESULT(distributor.tryAddQueue(queues.back().get()));
+            IOX_DISCARD_RESULT(distributor.tryRemoveQueue(queues.back().get()));
+        }
+    });
+
+    uint64_t maxLatency{0U};
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+    {
+        auto chunk = memoryManager->getChunk(chunkSettings);
+        if (!chunk)
+        {
+            std::cerr << "Could not acquire a chunk!" << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        auto deliveryStart = std::chrono::steady_clock::now();
+        distributor.deliverToAllStoredQueues(chunk);
+        auto deliveryStop = std::chrono::steady_clock::now();
+        maxLatency = std::max(maxLatency,
+                              static_cast<uint64_t>(
+                                  std::chrono::duration_cast<std::chrono::nanoseconds>(deliveryStop - deliveryStart)
+                                      .count()));
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    keepRunning = false;
+    discovery.join();
+
+    auto averageLatency = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count())
+                          / static_cast<double>(NUMBER_OF_ITERATIONS);
+    std::cout << std::setw(8) << numberOfQueues << " | " << std::setw(9) << (withChangingQueue ? "yes" : "no") << " | "
+              << std::setw(12) << std::fixed << std::setprecision(2) << averageLatency << " | " << std::setw(12)
+              << maxLatency << std::endl;
+
+    for (auto& queue : queues)
+    {
+        popo::ChunkQueuePopper<ChunkQueueData_t>(queue.get()).clear();
+    }
+    queues.clear();
+    delete memoryManager;
+    free(rawMemory);
+}
+
+int main()
+{
+    std::cout << "  Queues | Discovery | Average [ns] |     Max [ns]" << std::endl;
+    std::cout << "---------|-----------|--------------|-------------" << std::endl;
+
+    for (uint32_t numberOfQueues : {1U, 8U, 32U})
+    {
+        for (bool withChangingQueue : {false, true})
+        {
+            benchmarkDelivery(numberOfQueues, withChangingQueue);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
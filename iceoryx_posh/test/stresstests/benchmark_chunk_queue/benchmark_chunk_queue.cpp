@@ -0,0 +1,103 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+
+using namespace iox;
+
+constexpr uint64_t NUMBER_OF_SUBSCRIBERS{1024U};
+constexpr uint64_t NUMBER_OF_CHUNKS{10000000U};
+constexpr uint64_t BURST_SIZE{8U};
+
+template <cxx::VariantQueueTypes QueueType>
+struct FixedTypeChunkQueueConfig
+{
+    static constexpr uint64_t MAX_QUEUE_CAPACITY = DefaultChunkQueueConfig::MAX_QUEUE_CAPACITY;
+    static constexpr cxx::VariantQueueTypes QUEUE_TYPE = QueueType;
+};
+
+/// @brief measures the average time to push a chunk into the queue of the chunk queue data and to pop it again
+template <typename ChunkQueueData_t>
+double benchmarkPushPop(const cxx::VariantQueueTypes queueType)
+{
+    std::unique_ptr<ChunkQueueData_t> chunkQueueData(
+        new ChunkQueueData_t(popo::QueueFullPolicy::DISCARD_OLDEST_DATA, queueType));
+    auto& queue = chunkQueueData->m_queue;
+
+    uint64_t numberOfPoppedChunks{0U};
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t burst = 0U; burst < NUMBER_OF_CHUNKS / BURST_SIZE; ++burst)
+    {
+        for (uint64_t i = 0U; i < BURST_SIZE; ++i)
+        {
+            queue.push(mepoo::ShmSafeUnmanagedChunk());
+        }
+        while (queue.pop().has_value())
+        {
+            ++numberOfPoppedChunks;
+        }
+    }
+    auto duration = std::chrono::steady_clock::now() - start;
+
+    if (numberOfPoppedChunks != (NUMBER_OF_CHUNKS / BURST_SIZE) * BURST_SIZE)
+    {
+        std::cerr << "Not all chunks were popped!" << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count())
+           / static_cast<double>(numberOfPoppedChunks);
+}
+
+template <cxx::VariantQueueTypes QueueType>
+void benchmarkQueueType(const char* queueTypeName)
+{
+    using VariantChunkQueueData_t = popo::ChunkQueueData<DefaultChunkQueueConfig, popo::ThreadSafePolicy>;
+    using FixedTypeChunkQueueData_t =
+        popo::ChunkQueueData<FixedTypeChunkQueueConfig<QueueType>, popo::ThreadSafePolicy>;
+
+    constexpr uint64_t KIBIBYTE{1024U};
+    std::cout << std::setw(34) << queueTypeName << " | " << std::setw(8)
+              << sizeof(VariantChunkQueueData_t) * NUMBER_OF_SUBSCRIBERS / KIBIBYTE << " KiB | " << std::setw(10)
+              << sizeof(FixedTypeChunkQueueData_t) * NUMBER_OF_SUBSCRIBERS / KIBIBYTE << " KiB | " << std::setw(12)
+              << std::fixed << std::setprecision(2) << benchmarkPushPop<VariantChunkQueueData_t>(QueueType) << " | "
+              << std::setw(10) << benchmarkPushPop<FixedTypeChunkQueueData_t>(QueueType) << std::endl;
+}
+
+int main()
+{
+    std::cout << "Chunk queue data of " << NUMBER_OF_SUBSCRIBERS << " subscribers and push/pop time per chunk"
+              << std::endl;
+    std::cout << std::setw(34) << "Queue Type"
+              << " | VariantQueue | FixedTypeQueue | Variant [ns] | Fixed [ns]" << std::endl;
+    std::cout << std::string(34, '-') << "-|--------------|----------------|--------------|-----------" << std::endl;
+
+    benchmarkQueueType<cxx::VariantQueueTypes::FiFo_SingleProducerSingleConsumer>("FiFo_SingleProducerSingleConsumer");
+    benchmarkQueueType<cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer>("SoFi_SingleProducerSingleConsumer");
+    benchmarkQueueType<cxx::VariantQueueTypes::FiFo_MultiProducerSingleConsumer>("FiFo_MultiProducerSingleConsumer");
+    benchmarkQueueType<cxx::VariantQueueTypes::SoFi_MultiProducerSingleConsumer>("SoFi_MultiProducerSingleConsumer");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,120 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_hoofs/cxx/serialization.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_base.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_message.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iceoryx_posh/version/version_info.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+
+using namespace iox;
+
+constexpr uint64_t NUMBER_OF_PORTS{1000U};
+constexpr uint64_t NUMBER_OF_ROUNDS{100U};
+
+/// @brief creates the messages like the runtime, transfers them as string like the IPC channel and parses them like
+/// RouDi; the handling of the requests in the ProcessManager and PortManager is not part of the measurement
+uint64_t registerAndCreatePorts()
+{
+    const RuntimeName_t runtimeName{"bm_ipc_message"};
+    uint64_t checksum{0U};
+
+    runtime::IpcMessage registerRequest;
+    registerRequest << runtime::IpcMessageTypeToString(runtime::IpcMessageType::REG) << runtimeName
+                    << cxx::convert::toString(4711) << cxx::convert::toString(1000) << cxx::convert::toString(123456789)
+                    << static_cast<cxx::Serialization>(version::VersionInfo::getCurrentVersion()).toString();
+    runtime::IpcMessage receivedRegisterRequest(registerRequest.getMessage());
+
+    RuntimeName_t receivedRuntimeName;
+    receivedRegisterRequest.getElementAtIndex(1U, receivedRuntimeName);
+    uint32_t pid{0U};
+    cxx::convert::fromString(receivedRegisterRequest.getElementAtIndex(2U).c_str(), pid);
+    uint32_t userId{0U};
+    cxx::convert::fromString(receivedRegisterRequest.getElementAtIndex(3U).c_str(), userId);
+    int64_t transmissionTimestamp{0};
+    cxx::convert::fromString(receivedRegisterRequest.getElementAtIndex(4U).c_str(), transmissionTimestamp);
+    version::VersionInfo versionInfo(cxx::Serialization(receivedRegisterRequest.getElementAtIndex(5U)));
+    checksum += pid + userId + static_cast<uint64_t>(versionInfo.isValid());
+
+    const popo::PublisherOptions options;
+    const runtime::PortConfigInfo portConfigInfo;
+    // like the runtime, transfer the unlimited blocking time as the next smaller value which strtoull accepts
+    const uint64_t maxBlockingTimeInNanoseconds =
+        std::min(options.maxBlockingTime.toNanoseconds(), std::numeric_limits<uint64_t>::max() - 1U);
+    for (uint64_t port = 0U; port < NUMBER_OF_PORTS; ++port)
+    {
+        const capro::ServiceDescription service{"Camera", "FrontLeft", capro::IdString_t(cxx::TruncateToCapacity,
+                                                                                         cxx::convert::toString(port))};
+        runtime::IpcMessage request;
+        request << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER) << runtimeName
+                << static_cast<cxx::Serialization>(service).toString()
+                << cxx::convert::toString(options.historyCapacity) << options.nodeName
+                << cxx::convert::toString(options.offerOnCreate)
+                << cxx::convert::toString(static_cast<uint8_t>(options.subscriberTooSlowPolicy))
+                << static_cast<cxx::Serialization>(portConfigInfo).toString()
+                << cxx::convert::toString(maxBlockingTimeInNanoseconds);
+        runtime::IpcMessage receivedRequest(request.getMessage());
+
+        auto receivedService =
+            capro::ServiceDescription::deserialize(cxx::Serialization(receivedRequest.getElementAtIndex(2U)));
+        runtime::PortConfigInfo receivedPortConfigInfo(cxx::Serialization(receivedRequest.getElementAtIndex(7U)));
+        popo::PublisherOptions receivedOptions;
+        cxx::convert::fromString(receivedRequest.getElementAtIndex(3U).c_str(), receivedOptions.historyCapacity);
+        receivedRequest.getElementAtIndex(4U, receivedOptions.nodeName);
+        uint64_t offerOnCreate{0U};
+        cxx::convert::fromString(receivedRequest.getElementAtIndex(5U).c_str(), offerOnCreate);
+        uint8_t subscriberTooSlowPolicy{0U};
+        cxx::convert::fromString(receivedRequest.getElementAtIndex(6U).c_str(), subscriberTooSlowPolicy);
+        uint64_t receivedMaxBlockingTimeInNanoseconds{0U};
+        cxx::convert::fromString(receivedRequest.getElementAtIndex(8U).c_str(), receivedMaxBlockingTimeInNanoseconds);
+
+        checksum += receivedService.has_error() ? 0U : receivedService.value().getEventIDString().size();
+        checksum += offerOnCreate + receivedPortConfigInfo.portType;
+    }
+
+    return checksum;
+}
+
+int main()
+{
+    // the checksum is printed to prevent the compiler from removing the parsing
+    uint64_t checksum{0U};
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t round = 0U; round < NUMBER_OF_ROUNDS; ++round)
+    {
+        checksum += registerAndCreatePorts();
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(stop - start).count();
+    auto averageDuration = static_cast<double>(duration) / static_cast<double>(NUMBER_OF_ROUNDS);
+    std::cout << "Registration and creation of " << NUMBER_OF_PORTS << " publisher ports: " << std::fixed
+              << std::setprecision(1) << averageDuration << " us (checksum " << checksum << ")" << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,185 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/popo/listener.hpp"
+#include "iceoryx_posh/popo/trigger_handle.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace iox;
+
+constexpr uint64_t NUMBER_OF_ROUNDS{2000U};
+constexpr uint64_t NUMBER_OF_SUBSCRIBERS{8U};
+constexpr std::chrono::microseconds CALLBACK_RUNTIME{20};
+
+/// @brief stands in for a subscriber, it notifies the listener and records how long it took until its callback
+/// was finished
+class BenchmarkEvent
+{
+  public:
+    BenchmarkEvent(std::atomic<uint64_t>& numberOfFinishedCallbacks) noexcept
+        : m_numberOfFinishedCallbacks(numberOfFinishedCallbacks)
+    {
+    }
+
+    BenchmarkEvent(const BenchmarkEvent&) = delete;
+    BenchmarkEvent(BenchmarkEvent&&) = delete;
+    ~BenchmarkEvent() noexcept
+    {
+        m_handle.reset();
+    }
+
+    BenchmarkEvent& operator=(const BenchmarkEvent&) = delete;
+    BenchmarkEvent& operator=(BenchmarkEvent&&) = delete;
+
+    void enableEvent(popo::TriggerHandle&& handle) noexcept
+    {
+        m_handle = std::move(handle);
+    }
+
+    void invalidateTrigger(const uint64_t uniqueTriggerId) noexcept
+    {
+        if (m_handle.getUniqueId() == uniqueTriggerId)
+        {
+            m_handle.invalidate();
+        }
+    }
+
+    void disableEvent() noexcept
+    {
+        m_handle.reset();
+    }
+
+    void trigger() noexcept
+    {
+        m_triggerTime = std::chrono::steady_clock::now();
+        m_handle.trigger();
+    }
+
+    static void callback(BenchmarkEvent* const self) noexcept
+    {
+        // simulates the processing of a sample
+        auto processingEnd = std::chrono::steady_clock::now() + CALLBACK_RUNTIME;
+        while (std::chrono::steady_clock::now() < processingEnd)
+        {
+        }
+
+        auto latency = std::chrono::steady_clock::now() - self->m_triggerTime;
+        self->m_latencySum += latency;
+        self->m_maxLatency = std::max(self->m_maxLatency, std::chrono::nanoseconds(latency));
+        self->m_numberOfFinishedCallbacks.fetch_add(1U, std::memory_order_release);
+    }
+
+    std::chrono::nanoseconds m_latencySum{0};
+    std::chrono::nanoseconds m_maxLatency{0};
+
+  private:
+    popo::TriggerHandle m_handle;
+    std::chrono::steady_clock::time_point m_triggerTime;
+    std::atomic<uint64_t>& m_numberOfFinishedCallbacks;
+};
+
+class BenchmarkListener : public popo::Listener
+{
+  public:
+    BenchmarkListener(popo::ConditionVariableData& conditionVariableData, const popo::ListenerOptions& options) noexcept
+        : popo::Listener(conditionVariableData, options)
+    {
+    }
+};
+
+struct LatencyResult
+{
+    double average{0.0};
+    double maximum{0.0};
+};
+
+/// @brief measures the time from the notification of all subscribers until each of their callbacks is finished when
+/// the listener runs with the given number of worker threads
+LatencyResult benchmarkCallbackLatency(const uint64_t numberOfWorkerThreads)
+{
+    popo::ConditionVariableData conditionVariableData;
+    popo::ListenerOptions options;
+    options.numberOfWorkerThreads = numberOfWorkerThreads;
+    std::unique_ptr<BenchmarkListener> listener(new BenchmarkListener(conditionVariableData, options));
+
+    std::atomic<uint64_t> numberOfFinishedCallbacks{0U};
+    std::vector<std::unique_ptr<BenchmarkEvent>> events;
+    for (uint64_t i = 0U; i < NUMBER_OF_SUBSCRIBERS; ++i)
+    {
+        events.emplace_back(new BenchmarkEvent(numberOfFinishedCallbacks));
+        if (listener->attachEvent(*events.back(), popo::createNotificationCallback(BenchmarkEvent::callback))
+                .has_error())
+        {
+            std::cerr << "Could not attach the subscriber to the listener!" << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+    }
+
+    for (uint64_t round = 1U; round <= NUMBER_OF_ROUNDS; ++round)
+    {
+        for (auto& event : events)
+        {
+            event->trigger();
+        }
+
+        while (numberOfFinishedCallbacks.load(std::memory_order_acquire) < round * NUMBER_OF_SUBSCRIBERS)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    LatencyResult result;
+    for (auto& event : events)
+    {
+        result.average += static_cast<double>(event->m_latencySum.count());
+        result.maximum = std::max(result.maximum, static_cast<double>(event->m_maxLatency.count()));
+    }
+    result.average /= static_cast<double>(NUMBER_OF_ROUNDS * NUMBER_OF_SUBSCRIBERS) * 1000.0;
+    result.maximum /= 1000.0;
+
+    listener.reset();
+    events.clear();
+
+    return result;
+}
+
+int main()
+{
+    std::cout << NUMBER_OF_SUBSCRIBERS << " subscribers, " << CALLBACK_RUNTIME.count()
+              << " us callback runtime, " << std::thread::hardware_concurrency() << " CPUs" << std::endl
+              << std::endl;
+    std::cout << " Worker Threads | Average Latency [us] | Max Latency [us]" << std::endl;
+    std::cout << "----------------|----------------------|-----------------" << std::endl;
+
+    for (uint64_t numberOfWorkerThreads : {0U, 1U, 2U, 4U, 8U})
+    {
+        const auto result = benchmarkCallbackLatency(numberOfWorkerThreads);
+        std::cout << std::setw(15) << numberOfWorkerThreads << " | " << std::setw(20) << std::fixed
+                  << std::setprecision(2) << result.average << " | " << std::setw(16) << result.maximum << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
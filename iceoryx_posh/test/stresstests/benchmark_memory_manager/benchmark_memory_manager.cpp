@@ -0,0 +1,151 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace iox;
+
+constexpr uint64_t NUMBER_OF_ITERATIONS{10000000U};
+constexpr uint32_t CHUNK_COUNT{16U};
+constexpr uint32_t SMALLEST_CHUNK_PAYLOAD_SIZE{128U};
+constexpr uint32_t CHUNK_PAYLOAD_SIZE_INCREMENT{128U};
+
+/// @brief measures the average time of a loan and release cycle of a chunk from the largest of the given number of
+/// mempools, which is the worst case for a linear search over all mempools
+void benchmarkLoanFromLargestMemPool(const uint32_t numberOfMemPools)
+{
+    mepoo::MePooConfig mempoolConfig;
+    for (uint32_t i = 0U; i < numberOfMemPools; ++i)
+    {
+        mempoolConfig.addMemPool({SMALLEST_CHUNK_PAYLOAD_SIZE + i * CHUNK_PAYLOAD_SIZE_INCREMENT, CHUNK_COUNT});
+    }
+
+    const uint64_t memorySize = mepoo::MemoryManager::requiredFullMemorySize(mempoolConfig);
+    void* rawMemory = malloc(memorySize);
+    posix::Allocator allocator(rawMemory, memorySize);
+    auto memoryManager = new mepoo::MemoryManager();
+    memoryManager->configureMemoryManager(mempoolConfig, allocator, allocator);
+
+    const uint32_t userPayloadSize = mempoolConfig.m_mempoolConfig.back().m_size;
+    auto chunkSettings = mepoo::ChunkSettings::create(userPayloadSize, CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+    {
+        // the chunk is released when the SharedChunk goes out of scope
+        auto chunk = memoryManager->getChunk(chunkSettings);
+        if (!chunk)
+        {
+            std::cerr << "Could not acquire a chunk!" << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    auto averageLatency = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count())
+                          / static_cast<double>(NUMBER_OF_ITERATIONS);
+    std::cout << std::setw(10) << numberOfMemPools << " | " << std::setw(16) << std::fixed << std::setprecision(2)
+              << averageLatency << std::endl;
+
+    delete memoryManager;
+    free(rawMemory);
+}
+
+/// @brief measures the average time of a loan and release cycle of a chunk when multiple threads loan concurrently
+/// from the same mempool; every thread uses its own chunk cache like a publisher does
+void benchmarkConcurrentLoan(const uint32_t numberOfThreads, const bool chunkCacheEnabled)
+{
+    mepoo::MePooConfig mempoolConfig;
+    mempoolConfig.addMemPool({SMALLEST_CHUNK_PAYLOAD_SIZE, numberOfThreads * 2U * mepoo::ChunkCache::CAPACITY});
+    mempoolConfig.setChunkCacheEnabled(chunkCacheEnabled);
+
+    const uint64_t memorySize = mepoo::MemoryManager::requiredFullMemorySize(mempoolConfig);
+    void* rawMemory = malloc(memorySize);
+    posix::Allocator allocator(rawMemory, memorySize);
+    auto memoryManager = new mepoo::MemoryManager();
+    memoryManager->configureMemoryManager(mempoolConfig, allocator, allocator);
+
+    auto chunkSettings =
+        mepoo::ChunkSettings::create(SMALLEST_CHUNK_PAYLOAD_SIZE, CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+    const uint64_t iterationsPerThread = NUMBER_OF_ITERATIONS / numberOfThreads;
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0U; t < numberOfThreads; ++t)
+    {
+        threads.emplace_back([&] {
+            mepoo::ChunkCache chunkCache;
+            for (uint64_t i = 0U; i < iterationsPerThread; ++i)
+            {
+                auto chunk = memoryManager->getChunk(chunkSettings, chunkCache);
+                if (!chunk)
+                {
+                    std::cerr << "Could not acquire a chunk!" << std::endl;
+                    std::exit(EXIT_FAILURE);
+                }
+            }
+            memoryManager->releaseChunkCache(chunkCache);
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    auto averageLatency = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count())
+                          / static_cast<double>(iterationsPerThread * numberOfThreads);
+    std::cout << std::setw(10) << numberOfThreads << " | " << std::setw(11) << (chunkCacheEnabled ? "on" : "off")
+              << " | " << std::setw(16) << std::fixed << std::setprecision(2) << averageLatency << std::endl;
+
+    delete memoryManager;
+    free(rawMemory);
+}
+
+int main()
+{
+    std::cout << "  MemPools | Loan/Release [ns]" << std::endl;
+    std::cout << "-----------|------------------" << std::endl;
+
+    for (uint32_t numberOfMemPools : {1U, 8U, 32U})
+    {
+        benchmarkLoanFromLargestMemPool(numberOfMemPools);
+    }
+
+    std::cout << std::endl;
+    std::cout << "   Threads | Chunk Cache | Loan/Release [ns]" << std::endl;
+    std::cout << "-----------|-------------|------------------" << std::endl;
+
+    for (uint32_t numberOfThreads : {1U, 2U, 4U, 8U})
+    {
+        for (bool chunkCacheEnabled : {false, true})
+        {
+            benchmarkConcurrentLoan(numberOfThreads, chunkCacheEnabled);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
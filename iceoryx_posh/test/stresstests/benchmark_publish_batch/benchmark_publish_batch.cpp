@@ -0,0 +1,170 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_sender.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace iox;
+
+using ChunkQueueData_t = popo::ChunkQueueData<DefaultChunkQueueConfig, popo::ThreadSafePolicy>;
+using ChunkDistributorData_t = popo::ChunkDistributorData<DefaultChunkDistributorConfig,
+                                                          popo::ThreadSafePolicy,
+                                                          popo::ChunkQueuePusher<ChunkQueueData_t>>;
+using ChunkSenderData_t =
+    popo::ChunkSenderData<MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY, ChunkDistributorData_t>;
+
+constexpr uint64_t NUMBER_OF_SAMPLES{2000000U};
+constexpr uint32_t CHUNK_PAYLOAD_SIZE{128U};
+constexpr uint32_t NUMBER_OF_CHUNKS{2U * MAX_SUBSCRIBER_QUEUE_CAPACITY};
+constexpr uint32_t NUMBER_OF_SUBSCRIBERS{4U};
+
+enum class PublishMode
+{
+    PER_SAMPLE,
+    BATCH
+};
+
+/// @brief measures the average time per sample to loan and publish bursts of the given size to subscribers which
+/// have a condition variable attached, either with one tryAllocate and send per sample or with one tryAllocateBatch
+/// and sendBatch per burst
+double benchmarkPublish(const PublishMode publishMode, const uint32_t burstSize)
+{
+    mepoo::MePooConfig mempoolConfig;
+    mempoolConfig.addMemPool({CHUNK_PAYLOAD_SIZE, NUMBER_OF_CHUNKS});
+
+    const uint64_t memorySize = mepoo::MemoryManager::requiredFullMemorySize(mempoolConfig);
+    void* rawMemory = malloc(memorySize);
+    posix::Allocator allocator(rawMemory, memorySize);
+    auto memoryManager = new mepoo::MemoryManager();
+    memoryManager->configureMemoryManager(mempoolConfig, allocator, allocator);
+
+    std::unique_ptr<ChunkSenderData_t> chunkSenderData(
+        new ChunkSenderData_t(memoryManager, popo::SubscriberTooSlowPolicy::DISCARD_OLDEST_DATA, 0U));
+    popo::ChunkSender<ChunkSenderData_t> chunkSender{chunkSenderData.get()};
+
+    popo::ConditionVariableData conditionVariableData;
+    popo::ConditionListener conditionListener{conditionVariableData};
+    std::vector<std::unique_ptr<ChunkQueueData_t>> chunkQueueData;
+    for (uint32_t i = 0U; i < NUMBER_OF_SUBSCRIBERS; ++i)
+    {
+        chunkQueueData.emplace_back(new ChunkQueueData_t(popo::QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                                         cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer));
+        popo::ChunkQueuePopper<ChunkQueueData_t>(chunkQueueData.back().get())
+            .setConditionVariable(conditionVariableData, i);
+        if (chunkSender.tryAddQueue(chunkQueueData.back().get()).has_error())
+        {
+            std::cerr << "Could not add the subscriber queue!" << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+    }
+
+    const UniquePortId originId{popo::InvalidId};
+    const uint64_t numberOfBursts = NUMBER_OF_SAMPLES / burstSize;
+    uint64_t numberOfPublishedSamples{0U};
+    mepoo::ChunkHeader* chunkHeaders[MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY];
+    std::chrono::nanoseconds publishDuration{0};
+    for (uint64_t burst = 0U; burst < numberOfBursts; ++burst)
+    {
+        auto start = std::chrono::steady_clock::now();
+        if (publishMode == PublishMode::PER_SAMPLE)
+        {
+            for (uint32_t i = 0U; i < burstSize; ++i)
+            {
+                chunkSender
+                    .tryAllocate(originId,
+                                 CHUNK_PAYLOAD_SIZE,
+                                 CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                                 CHUNK_NO_USER_HEADER_SIZE,
+                                 CHUNK_NO_USER_HEADER_ALIGNMENT)
+                    .and_then([&](mepoo::ChunkHeader* chunkHeader) {
+                        chunkSender.send(chunkHeader);
+                        ++numberOfPublishedSamples;
+                    });
+            }
+        }
+        else
+        {
+            uint32_t numberOfChunkHeaders{0U};
+            chunkSender
+                .tryAllocateBatch(originId,
+                                  CHUNK_PAYLOAD_SIZE,
+                                  CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT,
+                                  CHUNK_NO_USER_HEADER_SIZE,
+                                  CHUNK_NO_USER_HEADER_ALIGNMENT,
+                                  burstSize,
+                                  [&](mepoo::ChunkHeader* chunkHeader) {
+                                      chunkHeaders[numberOfChunkHeaders] = chunkHeader;
+                                      ++numberOfChunkHeaders;
+                                  })
+                .and_then([&](const uint32_t numberOfAllocatedChunks) {
+                    chunkSender.sendBatch(chunkHeaders, numberOfAllocatedChunks);
+                    numberOfPublishedSamples += numberOfAllocatedChunks;
+                });
+        }
+        publishDuration += std::chrono::steady_clock::now() - start;
+
+        // the subscribers consume the burst outside of the measurement
+        conditionListener.timedWait(units::Duration::fromNanoseconds(0U));
+        for (auto& queueData : chunkQueueData)
+        {
+            popo::ChunkQueuePopper<ChunkQueueData_t>(queueData.get()).clear();
+        }
+    }
+
+    if (numberOfPublishedSamples != numberOfBursts * burstSize)
+    {
+        std::cerr << "Not all samples were published!" << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    chunkSender.releaseAll();
+    chunkSenderData.reset();
+    chunkQueueData.clear();
+    delete memoryManager;
+    free(rawMemory);
+
+    return static_cast<double>(publishDuration.count()) / static_cast<double>(numberOfPublishedSamples);
+}
+
+int main()
+{
+    std::cout << " Burst Size | Per Sample [ns] | Batch [ns]" << std::endl;
+    std::cout << "------------|-----------------|-----------" << std::endl;
+
+    for (uint32_t burstSize : {1U, 2U, 4U, 8U})
+    {
+        const auto perSampleLatency = benchmarkPublish(PublishMode::PER_SAMPLE, burstSize);
+        const auto batchLatency = benchmarkPublish(PublishMode::BATCH, burstSize);
+        std::cout << std::setw(11) << burstSize << " | " << std::setw(15) << std::fixed << std::setprecision(2)
+                  << perSampleLatency << " | " << std::setw(10) << batchLatency << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
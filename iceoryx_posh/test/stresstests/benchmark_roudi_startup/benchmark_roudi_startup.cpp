@@ -0,0 +1,132 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/cxx/convert.hpp"
+#include "iceoryx_posh/iceoryx_posh_config.hpp"
+#include "iceoryx_posh/internal/roudi/roudi.hpp"
+#include "iceoryx_posh/roudi/iceoryx_roudi_components.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace iox;
+
+constexpr uint32_t NUMBER_OF_PUBLISHERS_PER_PROCESS{4U};
+constexpr const char CHILD_ARGUMENT[] = "--child";
+
+/// @brief the work of one application during a cold start, i.e. the registration and the creation of its ports
+int runChild(const char* index)
+{
+    const std::string runtimeName = std::string("iox-bm-roudi-startup-") + index;
+    auto& runtime = runtime::PoshRuntime::initRuntime(RuntimeName_t(cxx::TruncateToCapacity, runtimeName));
+    for (uint32_t i = 0U; i < NUMBER_OF_PUBLISHERS_PER_PROCESS; ++i)
+    {
+        // all applications offer the same services to stay within the capacity of the service registry
+        runtime.getMiddlewarePublisher(
+            {"BmRouDiStartup", "Publisher", capro::IdString_t(cxx::TruncateToCapacity, cxx::convert::toString(i))});
+    }
+    return EXIT_SUCCESS;
+}
+
+/// @brief starts the given number of applications at once and measures the time until all of them are registered,
+/// have created their ports and are terminated again
+void benchmarkColdStart(const char* executable,
+                        const uint32_t numberOfRuntimeMessageWorkerThreads,
+                        const uint32_t numberOfProcesses)
+{
+    std::vector<pid_t> children;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0U; i < numberOfProcesses; ++i)
+    {
+        const auto index = cxx::convert::toString(i);
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            execl(executable, executable, CHILD_ARGUMENT, index.c_str(), nullptr);
+            std::cerr << "Could not start an application: " << strerror(errno) << std::endl;
+            _exit(EXIT_FAILURE);
+        }
+        if (pid < 0)
+        {
+            std::cerr << "Could not fork an application: " << strerror(errno) << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        children.push_back(pid);
+    }
+
+    bool allSucceeded{true};
+    for (auto child : children)
+    {
+        int status{0};
+        waitpid(child, &status, 0);
+        allSucceeded &= WIFEXITED(status) && (WEXITSTATUS(status) == EXIT_SUCCESS);
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    if (!allSucceeded)
+    {
+        std::cerr << "An application failed!" << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    std::cout << std::setw(14) << numberOfRuntimeMessageWorkerThreads << " | " << std::setw(9) << numberOfProcesses
+              << " | " << std::setw(15)
+              << std::chrono::duration_cast<std::chrono::milliseconds>(stop - start).count() << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    log::LogManager::GetLogManager().SetDefaultLogLevel(log::LogLevel::kWarn, log::LogLevelOutput::kHideLogLevel);
+
+    if (argc == 3 && strcmp(argv[1], CHILD_ARGUMENT) == 0)
+    {
+        return runChild(argv[2]);
+    }
+
+    std::cout << "Worker threads | Processes | Cold start [ms]" << std::endl;
+    std::cout << "---------------|-----------|----------------" << std::endl;
+
+    for (uint32_t numberOfRuntimeMessageWorkerThreads : {0U, roudi::DEFAULT_NUMBER_OF_RUNTIME_MESSAGE_WORKER_THREADS})
+    {
+        RouDiConfig_t roudiConfig;
+        roudiConfig.setDefaults();
+        roudi::IceOryxRouDiComponents roudiComponents(roudiConfig);
+        roudi::RouDi roudi(roudiComponents.rouDiMemoryManager,
+                           roudiComponents.portManager,
+                           roudi::RouDi::RoudiStartupParameters{roudi::MonitoringMode::OFF,
+                                                                false,
+                                                                roudi::RouDi::RuntimeMessagesThreadStart::IMMEDIATE,
+                                                                version::CompatibilityCheckLevel::PATCH,
+                                                                roudi::PROCESS_DEFAULT_KILL_DELAY,
+                                                                numberOfRuntimeMessageWorkerThreads});
+
+        // /proc/self/exe is used since argv[0] does not contain the path when the benchmark is started via the PATH
+        for (uint32_t numberOfProcesses : {10U, 50U, 100U})
+        {
+            benchmarkColdStart("/proc/self/exe", numberOfRuntimeMessageWorkerThreads, numberOfProcesses);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,128 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_receiver.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+using namespace iox;
+
+using ChunkQueueData_t = popo::ChunkQueueData<DefaultChunkQueueConfig, popo::ThreadSafePolicy>;
+using ChunkReceiverData_t = popo::ChunkReceiverData<MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY, ChunkQueueData_t>;
+
+constexpr uint64_t NUMBER_OF_SAMPLES{10000000U};
+constexpr uint32_t CHUNK_PAYLOAD_SIZE{128U};
+constexpr uint32_t NUMBER_OF_CHUNKS{MAX_SUBSCRIBER_QUEUE_CAPACITY};
+
+enum class TakeMode
+{
+    PER_SAMPLE,
+    BATCH
+};
+
+/// @brief measures the average time per sample to drain bursts of the given size from the receive queue of a
+/// subscriber and to release the samples again, either with one tryGet per sample or with one tryGetBatch per burst
+double benchmarkTake(const TakeMode takeMode, const uint32_t burstSize)
+{
+    mepoo::MePooConfig mempoolConfig;
+    mempoolConfig.addMemPool({CHUNK_PAYLOAD_SIZE, NUMBER_OF_CHUNKS});
+
+    const uint64_t memorySize = mepoo::MemoryManager::requiredFullMemorySize(mempoolConfig);
+    void* rawMemory = malloc(memorySize);
+    posix::Allocator allocator(rawMemory, memorySize);
+    auto memoryManager = new mepoo::MemoryManager();
+    memoryManager->configureMemoryManager(mempoolConfig, allocator, allocator);
+    auto chunkSettings = mepoo::ChunkSettings::create(CHUNK_PAYLOAD_SIZE, CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+
+    std::unique_ptr<ChunkReceiverData_t> chunkReceiverData(new ChunkReceiverData_t(
+        cxx::VariantQueueTypes::SoFi_SingleProducerSingleConsumer, popo::QueueFullPolicy::DISCARD_OLDEST_DATA));
+    popo::ChunkReceiver<ChunkReceiverData_t> chunkReceiver{chunkReceiverData.get()};
+    popo::ChunkQueuePusher<ChunkReceiverData_t> chunkQueuePusher{chunkReceiverData.get()};
+
+    const uint64_t numberOfBursts = NUMBER_OF_SAMPLES / burstSize;
+    uint64_t numberOfTakenSamples{0U};
+    std::chrono::nanoseconds takeDuration{0};
+    for (uint64_t burst = 0U; burst < numberOfBursts; ++burst)
+    {
+        for (uint32_t i = 0U; i < burstSize; ++i)
+        {
+            chunkQueuePusher.push(memoryManager->getChunk(chunkSettings));
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        if (takeMode == TakeMode::PER_SAMPLE)
+        {
+            while (true)
+            {
+                auto maybeChunkHeader = chunkReceiver.tryGet();
+                if (maybeChunkHeader.has_error())
+                {
+                    break;
+                }
+                chunkReceiver.release(maybeChunkHeader.value());
+                ++numberOfTakenSamples;
+            }
+        }
+        else
+        {
+            chunkReceiver.tryGetBatch(burstSize, [&](const mepoo::ChunkHeader* chunkHeader) {
+                chunkReceiver.release(chunkHeader);
+                ++numberOfTakenSamples;
+            });
+        }
+        takeDuration += std::chrono::steady_clock::now() - start;
+    }
+
+    if (numberOfTakenSamples != numberOfBursts * burstSize)
+    {
+        std::cerr << "Not all samples were taken!" << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    chunkReceiver.releaseAll();
+    chunkReceiverData.reset();
+    delete memoryManager;
+    free(rawMemory);
+
+    return static_cast<double>(takeDuration.count()) / static_cast<double>(numberOfTakenSamples);
+}
+
+int main()
+{
+    std::cout << " Burst Size | Per Sample [ns] | Batch [ns]" << std::endl;
+    std::cout << "------------|-----------------|-----------" << std::endl;
+
+    for (uint32_t burstSize : {1U, 8U, 32U, 128U, 256U})
+    {
+        const auto perSampleLatency = benchmarkTake(TakeMode::PER_SAMPLE, burstSize);
+        const auto batchLatency = benchmarkTake(TakeMode::BATCH, burstSize);
+        std::cout << std::setw(11) << burstSize << " | " << std::setw(15) << std::fixed << std::setprecision(2)
+                  << perSampleLatency << " | " << std::setw(10) << batchLatency << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
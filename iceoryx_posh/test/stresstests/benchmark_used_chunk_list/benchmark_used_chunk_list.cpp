@@ -0,0 +1,97 @@
+// Copyright (c) 2022 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/allocator.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace iox;
+
+constexpr uint64_t NUMBER_OF_ITERATIONS{10000000U};
+constexpr uint32_t MAX_HELD_CHUNKS{256U};
+constexpr uint32_t CHUNK_PAYLOAD_SIZE{128U};
+
+/// @brief measures the average time to remove the oldest of the held chunks from the UsedChunkList and to insert it
+/// again, like a subscriber which releases the oldest sample it holds while taking a new one
+void benchmarkRemoveAndInsert(const uint32_t numberOfHeldChunks)
+{
+    mepoo::MePooConfig mempoolConfig;
+    mempoolConfig.addMemPool({CHUNK_PAYLOAD_SIZE, MAX_HELD_CHUNKS});
+
+    const uint64_t memorySize = mepoo::MemoryManager::requiredFullMemorySize(mempoolConfig);
+    void* rawMemory = malloc(memorySize);
+    posix::Allocator allocator(rawMemory, memorySize);
+    auto memoryManager = new mepoo::MemoryManager();
+    memoryManager->configureMemoryManager(mempoolConfig, allocator, allocator);
+    auto chunkSettings = mepoo::ChunkSettings::create(CHUNK_PAYLOAD_SIZE, CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+
+    std::unique_ptr<popo::UsedChunkList<MAX_HELD_CHUNKS>> usedChunkList(new popo::UsedChunkList<MAX_HELD_CHUNKS>());
+    std::vector<const mepoo::ChunkHeader*> heldChunks;
+    for (uint32_t i = 0U; i < numberOfHeldChunks; ++i)
+    {
+        auto chunk = memoryManager->getChunk(chunkSettings);
+        if (!chunk || !usedChunkList->insert(chunk))
+        {
+            std::cerr << "Could not hold a chunk!" << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        heldChunks.push_back(chunk.getChunkHeader());
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+    {
+        mepoo::SharedChunk chunk;
+        const auto oldestChunk = heldChunks[i % numberOfHeldChunks];
+        if (!usedChunkList->remove(oldestChunk, chunk) || !usedChunkList->insert(chunk))
+        {
+            std::cerr << "Could not remove and insert a chunk!" << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    auto averageLatency = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count())
+                          / static_cast<double>(NUMBER_OF_ITERATIONS);
+    std::cout << std::setw(12) << numberOfHeldChunks << " | " << std::setw(19) << std::fixed << std::setprecision(2)
+              << averageLatency << std::endl;
+
+    usedChunkList->cleanup();
+    delete memoryManager;
+    free(rawMemory);
+}
+
+int main()
+{
+    std::cout << " Held Chunks | Remove/Insert [ns]" << std::endl;
+    std::cout << "-------------|--------------------" << std::endl;
+
+    for (uint32_t numberOfHeldChunks : {1U, 8U, 32U, 128U, 256U})
+    {
+        benchmarkRemoveAndInsert(numberOfHeldChunks);
+    }
+
+    return EXIT_SUCCESS;
+}
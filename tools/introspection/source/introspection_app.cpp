@@ -23,6 +23,7 @@
 #include "iceoryx_versions.hpp"
 
 #include <chrono>
+#include <cinttypes>
 #include <iomanip>
 #include <poll.h>
 #include <thread>
@@ -274,14 +275,16 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
     constexpr int32_t minFreechunksWidth{9};
     constexpr int32_t chunkSizeWidth{11};
     constexpr int32_t chunkPayloadSizeWidth{13};
+    constexpr int32_t spilledChunksWidth{9};
 
     wprintw(pad, "%*s |", memPoolWidth, "MemPool");
     wprintw(pad, "%*s |", usedchunksWidth, "Chunks In Use");
     wprintw(pad, "%*s |", numchunksWidth, "Total");
     wprintw(pad, "%*s |", minFreechunksWidth, "Min Free");
     wprintw(pad, "%*s |", chunkSizeWidth, "Chunk Size");
-    wprintw(pad, "%*s\n", chunkPayloadSizeWidth, "Chunk Payload Size");
-    wprintw(pad, "--------------------------------------------------------------------------------\n");
+    wprintw(pad, "%*s |", chunkPayloadSizeWidth, "Chunk Payload Size");
+    wprintw(pad, "%*s\n", spilledChunksWidth, "Spilled");
+    wprintw(pad, "--------------------------------------------------------------------------------------------\n");
 
     for (size_t i = 0u; i < introspectionInfo.m_mempoolInfo.size(); ++i)
     {
@@ -293,7 +296,8 @@ void IntrospectionApp::printMemPoolInfo(const MemPoolIntrospectionInfo& introspe
             wprintw(pad, "%*d |", numchunksWidth, info.m_numChunks);
             wprintw(pad, "%*d |", minFreechunksWidth, info.m_minFreeChunks);
             wprintw(pad, "%*d |", chunkSizeWidth, info.m_chunkSize);
-            wprintw(pad, "%*d\n", chunkPayloadSizeWidth, info.m_chunkPayloadSize);
+            wprintw(pad, "%*d |", chunkPayloadSizeWidth, info.m_chunkPayloadSize);
+            wprintw(pad, "%*" PRIu64 "\n", spilledChunksWidth, info.m_spilledChunks);
         }
     }
     wprintw(pad, "\n");
@@ -307,11 +311,11 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     constexpr int32_t eventWidth{21};
     constexpr int32_t runtimeNameWidth{23};
     constexpr int32_t nodeNameWidth{23};
-    // uncomment once this information is needed
-    // constexpr int32_t sampleSizeWidth{12};
-    // constexpr int32_t chunkSizeWidth{12};
-    // constexpr int32_t chunksWidth{12};
-    // constexpr int32_t intervalWidth{19};
+    constexpr int32_t sampleSizeWidth{12};
+    constexpr int32_t chunkSizeWidth{12};
+    constexpr int32_t chunksWidth{12};
+    constexpr int32_t intervalWidth{19};
+    constexpr int32_t lostChunksWidth{12};
     constexpr int32_t subscriptionStateWidth{14};
     // constexpr int32_t fifoWidth{17};    // uncomment once this information is needed
     constexpr int32_t scopeWidth{12};
@@ -324,11 +328,11 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     wprintw(pad, " %*s |", eventWidth, "Event");
     wprintw(pad, " %*s |", runtimeNameWidth, "Process");
     wprintw(pad, " %*s |", nodeNameWidth, "Node");
-    // uncomment once this information is needed
-    // wprintw(pad, " %*s |", sampleSizeWidth, "Sample Size");
-    // wprintw(pad, " %*s |", chunkSizeWidth, "Chunk Size");
-    // wprintw(pad, " %*s |", chunksWidth, "Chunks");
-    // wprintw(pad, " %*s |", intervalWidth, "Last Send Interval");
+    wprintw(pad, " %*s |", sampleSizeWidth, "Sample Size");
+    wprintw(pad, " %*s |", chunkSizeWidth, "Chunk Size");
+    wprintw(pad, " %*s |", chunksWidth, "Chunks");
+    wprintw(pad, " %*s |", intervalWidth, "Last Send Interval");
+    wprintw(pad, " %*s |", lostChunksWidth, "Lost Chunks");
     wprintw(pad, " %*s\n", interfaceSourceWidth, "Src. Itf.");
 
     wprintw(pad, " %*s |", serviceWidth, "");
@@ -336,15 +340,16 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
     wprintw(pad, " %*s |", eventWidth, "");
     wprintw(pad, " %*s |", runtimeNameWidth, "");
     wprintw(pad, " %*s |", nodeNameWidth, "");
-    // uncomment once this information is needed
-    // wprintw(pad, " %*s |", sampleSizeWidth, "[Byte]");
-    // wprintw(pad, " %*s |", chunkSizeWidth, "[Byte]");
-    // wprintw(pad, " %*s |", chunksWidth, "[/Minute]");
-    // wprintw(pad, " %*s |", intervalWidth, "[Milliseconds]");
+    wprintw(pad, " %*s |", sampleSizeWidth, "[Byte]");
+    wprintw(pad, " %*s |", chunkSizeWidth, "[Byte]");
+    wprintw(pad, " %*s |", chunksWidth, "[/Minute]");
+    wprintw(pad, " %*s |", intervalWidth, "[Milliseconds]");
+    wprintw(pad, " %*s |", lostChunksWidth, "[Total]");
     wprintw(pad, " %*s\n", interfaceSourceWidth, "");
 
     wprintw(pad, "---------------------------------------------------------------------------------------------------");
-    wprintw(pad, "--------------------------------\n");
+    wprintw(pad, "---------------------------------------------------------------------------------------------------");
+    wprintw(pad, "---------------\n");
 
     bool needsLineBreak{false};
     uint32_t currentLine{0U};
@@ -381,11 +386,12 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
 
     for (auto& publisherPort : publisherPortData)
     {
-        // uncomment once this information is needed
-        // std::string m_sampleSize{"n/a"};
-        // std::string m_chunkSize{"n/a"};
-        // std::string m_chunksPerMinute{"n/a"};
-        // std::string sendInterval{"n/a"};
+        const auto& throughput = *publisherPort.throughputData;
+        std::stringstream chunksPerMinute;
+        chunksPerMinute << std::fixed << std::setprecision(1) << throughput.m_chunksPerMinute;
+        std::stringstream sendInterval;
+        sendInterval << std::fixed << std::setprecision(3)
+                     << static_cast<double>(throughput.m_lastSendIntervalInNanoseconds) / 1000000.0;
 
         currentLine = 0;
         do
@@ -396,11 +402,11 @@ void IntrospectionApp::printPortIntrospectionData(const std::vector<ComposedPubl
             wprintw(pad, " %s |", printEntry(eventWidth, publisherPort.portData->m_caproEventMethodID).c_str());
             wprintw(pad, " %s |", printEntry(runtimeNameWidth, publisherPort.portData->m_name).c_str());
             wprintw(pad, " %s |", printEntry(nodeNameWidth, publisherPort.portData->m_node).c_str());
-            // uncomment once this information is needed
-            // wprintw(pad, " %s |", printEntry(sampleSizeWidth, m_sampleSize).c_str());
-            // wprintw(pad, " %s |", printEntry(chunkSizeWidth, m_chunkSize).c_str());
-            // wprintw(pad, " %s |", printEntry(chunksWidth, m_chunksPerMinute).c_str());
-            // wprintw(pad, " %s |", printEntry(intervalWidth, sendInterval).c_str());
+            wprintw(pad, " %s |", printEntry(sampleSizeWidth, std::to_string(throughput.m_sampleSize)).c_str());
+            wprintw(pad, " %s |", printEntry(chunkSizeWidth, std::to_string(throughput.m_chunkSize)).c_str());
+            wprintw(pad, " %s |", printEntry(chunksWidth, chunksPerMinute.str()).c_str());
+            wprintw(pad, " %s |", printEntry(intervalWidth, sendInterval.str()).c_str());
+            wprintw(pad, " %s |", printEntry(lostChunksWidth, std::to_string(throughput.m_lostChunks)).c_str());
             wprintw(
                 pad,
                 " %s\n",
@@ -530,7 +536,8 @@ IntrospectionApp::composePublisherPortData(const PortIntrospectionFieldTopic* po
     std::vector<ComposedPublisherPortData> publisherPortData;
     publisherPortData.reserve(portData->m_publisherList.size());
 
-    const PortThroughputData dummyThroughputData;
+    // static since the composed data keeps a pointer to it after returning
+    static const PortThroughputData dummyThroughputData;
 
     auto& m_publisherList = portData->m_publisherList;
     auto& m_throughputList = throughputData->m_throughputList;